@@ -0,0 +1,165 @@
+/*
+ * Filename: button_debounce.c
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: debounced push button, runs button_debounce_fsm from the GPIO ISR and an esp_timer
+ */
+
+#include <stdlib.h>
+#include "esp_timer.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "button_debounce.h"
+
+static const char *TAG = "button_debounce";
+
+typedef struct button_debounce_t {
+    gpio_num_t gpio_num;
+    int active_level;
+    QueueHandle_t event_queue;
+    button_debounce_event_cb_t on_event;
+    void *on_event_ctx;
+    esp_timer_handle_t timer;
+    portMUX_TYPE lock;             // Protects the state machine, it is run by the ISR and the timer
+    button_debounce_fsm_t fsm;
+    bool isr_added;
+} button_debounce_t;
+
+static void button_debounce_isr(void *arg);
+static void button_debounce_timer_cb(void *arg);
+static void button_debounce_arm_timer(button_debounce_t *button, int64_t now_us);
+
+esp_err_t button_debounce_new(const button_debounce_config_t *config, button_debounce_handle_t *ret_button)
+{
+    esp_err_t ret = ESP_OK;
+    button_debounce_t *button = NULL;
+    ESP_GOTO_ON_FALSE(config && ret_button && GPIO_IS_VALID_GPIO(config->gpio_num), ESP_ERR_INVALID_ARG, err, TAG,
+                      "invalid argument");
+    ESP_GOTO_ON_FALSE(config->debounce_ms > 0, ESP_ERR_INVALID_ARG, err, TAG, "debounce time must not be 0");
+    button = calloc(1, sizeof(button_debounce_t));
+    ESP_GOTO_ON_FALSE(button, ESP_ERR_NO_MEM, err, TAG, "no mem for button");
+
+    button->gpio_num = config->gpio_num;
+    button->active_level = config->active_level ? 1 : 0;
+    button->event_queue = config->event_queue;
+    portMUX_INITIALIZE(&button->lock);
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = button_debounce_timer_cb,
+        .arg = button,
+        .name = "button_debounce",
+    };
+    ESP_GOTO_ON_ERROR(esp_timer_create(&timer_args, &button->timer), err, TAG, "create timer failed");
+
+    gpio_config_t io_conf = {
+        .pin_bit_mask = 1ULL << config->gpio_num,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = config->enable_internal_pull && !button->active_level ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+        .pull_down_en = config->enable_internal_pull && button->active_level ? GPIO_PULLDOWN_ENABLE : GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_ANYEDGE,
+    };
+    ESP_GOTO_ON_ERROR(gpio_config(&io_conf), err, TAG, "configure gpio failed");
+
+    button_debounce_fsm_config_t fsm_config = {
+        .debounce_us = config->debounce_ms * 1000,
+        .long_press_us = config->long_press_ms * 1000,
+        .double_click_us = config->double_click_ms * 1000,
+    };
+    button_debounce_fsm_init(&button->fsm, &fsm_config, gpio_get_level(config->gpio_num) == button->active_level);
+
+    // The application may have installed the ISR service already
+    esp_err_t isr_ret = gpio_install_isr_service(0);
+    ESP_GOTO_ON_FALSE(isr_ret == ESP_OK || isr_ret == ESP_ERR_INVALID_STATE, isr_ret, err, TAG, "install gpio isr service failed");
+    ESP_GOTO_ON_ERROR(gpio_isr_handler_add(config->gpio_num, button_debounce_isr, button), err, TAG, "add isr failed");
+    button->isr_added = true;
+
+    *ret_button = button;
+    ESP_LOGD(TAG, "new button @%p on gpio %d", button, config->gpio_num);
+
+    return ESP_OK;
+
+err:
+    if (button) {
+        button_debounce_del(button);
+    }
+    return ret;
+}
+
+esp_err_t button_debounce_del(button_debounce_handle_t button)
+{
+    ESP_RETURN_ON_FALSE(button, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_LOGD(TAG, "del button @%p", button);
+    if (button->isr_added) {
+        gpio_isr_handler_remove(button->gpio_num);
+        gpio_set_intr_type(button->gpio_num, GPIO_INTR_DISABLE);
+    }
+    if (button->timer) {
+        esp_timer_stop(button->timer);
+        esp_timer_delete(button->timer);
+    }
+    free(button);
+    return ESP_OK;
+}
+
+esp_err_t button_debounce_register_event_callback(button_debounce_handle_t button, button_debounce_event_cb_t cb, void *user_ctx)
+{
+    ESP_RETURN_ON_FALSE(button, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    button->on_event_ctx = user_ctx;
+    button->on_event = cb;
+    return ESP_OK;
+}
+
+bool button_debounce_is_pressed(button_debounce_handle_t button)
+{
+    return button->fsm.pressed;
+}
+
+static void button_debounce_isr(void *arg)
+{
+    button_debounce_t *button = arg;
+    // Timestamp the edge here, the timer only confirms it later
+    int64_t now_us = esp_timer_get_time();
+
+    portENTER_CRITICAL_ISR(&button->lock);
+    if (button_debounce_fsm_edge(&button->fsm, now_us)) {
+        button_debounce_arm_timer(button, now_us);
+    }
+    portEXIT_CRITICAL_ISR(&button->lock);
+}
+
+static void button_debounce_timer_cb(void *arg)
+{
+    button_debounce_t *button = arg;
+    button_debounce_fsm_event_t fsm_events[BUTTON_DEBOUNCE_FSM_MAX_EVENTS];
+    int64_t now_us = esp_timer_get_time();
+
+    portENTER_CRITICAL(&button->lock);
+    int count = button_debounce_fsm_timeout(&button->fsm, now_us, gpio_get_level(button->gpio_num) == button->active_level,
+                                            fsm_events);
+    button_debounce_arm_timer(button, now_us);
+    portEXIT_CRITICAL(&button->lock);
+
+    for (int i = 0; i < count; i++) {
+        button_debounce_event_t event = {
+            .gpio_num = button->gpio_num,
+            .type = fsm_events[i].type,
+            .time_us = fsm_events[i].time_us,
+        };
+        if (button->event_queue && xQueueSend(button->event_queue, &event, 0) != pdTRUE) {
+            ESP_LOGW(TAG, "event queue of gpio %d is full, event %d dropped", button->gpio_num, event.type);
+        }
+        if (button->on_event) {
+            button->on_event(button, &event, button->on_event_ctx);
+        }
+    }
+}
+
+// Called with the lock held, so the ISR and the timer never arm the timer at the same time
+static void button_debounce_arm_timer(button_debounce_t *button, int64_t now_us)
+{
+    int64_t deadline_us = button_debounce_fsm_next_deadline(&button->fsm);
+
+    esp_timer_stop(button->timer); // fails if the timer is not running, which is fine
+    if (deadline_us != BUTTON_DEBOUNCE_FSM_NO_DEADLINE) {
+        esp_timer_start_once(button->timer, deadline_us > now_us ? deadline_us - now_us : 1);
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Filename: button_debounce_fsm.c
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: debounce state machine of one push button, see button_debounce_fsm.h
+ */
+
+#include "button_debounce_fsm.h"
+
+void button_debounce_fsm_init(button_debounce_fsm_t *fsm, const button_debounce_fsm_config_t *config, bool pressed)
+{
+    *fsm = (button_debounce_fsm_t) {
+        .config = *config,
+        .pressed = pressed,
+    };
+}
+
+bool button_debounce_fsm_edge(button_debounce_fsm_t *fsm, int64_t time_us)
+{
+    if (fsm->window_active) {
+        return false; // bounce inside the window
+    }
+    fsm->window_active = true;
+    fsm->window_start_us = time_us;
+    return true;
+}
+
+int64_t button_debounce_fsm_next_deadline(const button_debounce_fsm_t *fsm)
+{
+    int64_t deadline = BUTTON_DEBOUNCE_FSM_NO_DEADLINE;
+
+    if (fsm->window_active) {
+        deadline = fsm->window_start_us + fsm->config.debounce_us;
+    }
+    if (fsm->long_press_pending && fsm->press_us + fsm->config.long_press_us < deadline) {
+        deadline = fsm->press_us + fsm->config.long_press_us;
+    }
+    return deadline;
+}
+
+int button_debounce_fsm_timeout(button_debounce_fsm_t *fsm, int64_t now_us, bool pressed, button_debounce_fsm_event_t *events)
+{
+    int count = 0;
+
+    if (fsm->window_active && now_us >= fsm->window_start_us + fsm->config.debounce_us) {
+        fsm->window_active = false;
+        if (pressed != fsm->pressed) {
+            // the change happened at the first edge, not when it was confirmed
+            int64_t time_us = fsm->window_start_us;
+            fsm->pressed = pressed;
+            if (pressed) {
+                events[count++] = (button_debounce_fsm_event_t) {BUTTON_DEBOUNCE_EVENT_PRESS, time_us};
+                fsm->press_us = time_us;
+                fsm->long_press_pending = fsm->config.long_press_us > 0;
+            } else {
+                events[count++] = (button_debounce_fsm_event_t) {BUTTON_DEBOUNCE_EVENT_RELEASE, time_us};
+                bool short_click = !fsm->config.long_press_us || time_us - fsm->press_us < fsm->config.long_press_us;
+                fsm->long_press_pending = false;
+                if (!short_click || !fsm->config.double_click_us) {
+                    fsm->click_pending = false;
+                } else if (fsm->click_pending && fsm->press_us - fsm->click_release_us <= fsm->config.double_click_us) {
+                    events[count++] = (button_debounce_fsm_event_t) {BUTTON_DEBOUNCE_EVENT_DOUBLE_CLICK, time_us};
+                    fsm->click_pending = false;
+                } else {
+                    fsm->click_pending = true;
+                    fsm->click_release_us = time_us;
+                }
+            }
+        }
+    }
+
+    if (fsm->long_press_pending && now_us >= fsm->press_us + fsm->config.long_press_us) {
+        events[count++] = (button_debounce_fsm_event_t) {BUTTON_DEBOUNCE_EVENT_LONG_PRESS, fsm->press_us + fsm->config.long_press_us};
+        fsm->long_press_pending = false;
+    }
+
+    return count;
+}
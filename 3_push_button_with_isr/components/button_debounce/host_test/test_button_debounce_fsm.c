@@ -0,0 +1,246 @@
+/*
+ * Filename: test_button_debounce_fsm.c
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: host test of the button debounce state machine
+ *          timestamped edge traces are replayed the way the ISR and the esp_timer of button_debounce.c drive it
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "button_debounce_fsm.h"
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+#define DEBOUNCE_US     (20 * 1000)
+#define LONG_PRESS_US   (1000 * 1000)
+#define DOUBLE_CLICK_US (300 * 1000)
+
+#define MAX_EDGES  16
+#define MAX_EVENTS 16
+
+// Level change of the button input, i.e. one interrupt
+typedef struct {
+    int64_t time_us;
+    bool pressed;
+} trace_edge_t;
+
+typedef struct {
+    button_debounce_event_type_t type;
+    int64_t time_us;
+} trace_event_t;
+
+typedef struct {
+    const char *name;
+    trace_edge_t edges[MAX_EDGES];
+    int edge_cnt;
+    int64_t end_us;
+    trace_event_t events[MAX_EVENTS];
+    int event_cnt;
+} trace_case_t;
+
+#define P(t) {(t), true}
+#define R(t) {(t), false}
+#define EV(type, t) {BUTTON_DEBOUNCE_EVENT_##type, (t)}
+
+static const trace_case_t trace_cases[] = {
+    {
+        "clean click",
+        {P(1000), R(101000)}, 2, 2000000,
+        {EV(PRESS, 1000), EV(RELEASE, 101000)}, 2,
+    },
+    {
+        "bouncing press and release",
+        {P(1000), R(1300), P(1800), R(2500), P(3000), R(200000), P(200400), R(200900)}, 8, 2000000,
+        {EV(PRESS, 1000), EV(RELEASE, 200000)}, 2,
+    },
+    {
+        "glitch",
+        {P(1000), R(1500)}, 2, 2000000,
+        {{0}}, 0,
+    },
+    {
+        "glitch inside a press",
+        {P(1000), R(300000), P(300200)}, 3, 600000,
+        {EV(PRESS, 1000)}, 1,
+    },
+    {
+        // The edges after the window open a new window which ends at the same level
+        "bounce longer than the window",
+        {P(1000), R(15000), P(19000), R(25000), P(26000)}, 5, 600000,
+        {EV(PRESS, 1000)}, 1,
+    },
+    {
+        "long press",
+        {P(1000), R(1500000), P(1500300), R(1500500)}, 4, 3000000,
+        {EV(PRESS, 1000), EV(LONG_PRESS, 1001000), EV(RELEASE, 1500000)}, 3,
+    },
+    {
+        "released just before the long press",
+        {P(1000), R(980000)}, 2, 3000000,
+        {EV(PRESS, 1000), EV(RELEASE, 980000)}, 2,
+    },
+    {
+        // The long press is taken from the first edge, not from the end of the window
+        "bouncing long press",
+        {P(1000), R(1100), P(1400)}, 3, 3000000,
+        {EV(PRESS, 1000), EV(LONG_PRESS, 1001000)}, 2,
+    },
+    {
+        "double click",
+        {P(1000), R(100000), P(300000), R(400000)}, 4, 2000000,
+        {EV(PRESS, 1000), EV(RELEASE, 100000), EV(PRESS, 300000), EV(RELEASE, 400000), EV(DOUBLE_CLICK, 400000)}, 5,
+    },
+    {
+        "bouncing double click",
+        {P(1000), R(1200), P(1500), R(100000), P(100300), R(100700), P(300000), R(300100), P(300600), R(400000)}, 10, 2000000,
+        {EV(PRESS, 1000), EV(RELEASE, 100000), EV(PRESS, 300000), EV(RELEASE, 400000), EV(DOUBLE_CLICK, 400000)}, 5,
+    },
+    {
+        "clicks too slow for a double click",
+        {P(1000), R(100000), P(400001), R(500000)}, 4, 2000000,
+        {EV(PRESS, 1000), EV(RELEASE, 100000), EV(PRESS, 400001), EV(RELEASE, 500000)}, 4,
+    },
+    {
+        // A double click consumes both clicks, the third one starts a new pair
+        "repeated clicks",
+        {P(1000), R(50000), P(150000), R(200000), P(300000), R(350000), P(450000), R(500000)}, 8, 2000000,
+        {
+            EV(PRESS, 1000), EV(RELEASE, 50000), EV(PRESS, 150000), EV(RELEASE, 200000), EV(DOUBLE_CLICK, 200000),
+            EV(PRESS, 300000), EV(RELEASE, 350000), EV(PRESS, 450000), EV(RELEASE, 500000), EV(DOUBLE_CLICK, 500000),
+        }, 10,
+    },
+    {
+        "long press then click",
+        {P(1000), R(1200000), P(1300000), R(1400000)}, 4, 3000000,
+        {EV(PRESS, 1000), EV(LONG_PRESS, 1001000), EV(RELEASE, 1200000), EV(PRESS, 1300000), EV(RELEASE, 1400000)}, 5,
+    },
+    {
+        "repeated long presses",
+        {P(1000), R(1500000), P(2000000), R(3500000)}, 4, 4000000,
+        {
+            EV(PRESS, 1000), EV(LONG_PRESS, 1001000), EV(RELEASE, 1500000),
+            EV(PRESS, 2000000), EV(LONG_PRESS, 3000000), EV(RELEASE, 3500000),
+        }, 6,
+    },
+};
+
+static void fail(const trace_case_t *c, const char *msg, int index)
+{
+    printf("trace \"%s\": %s at event %d\n", c->name, msg, index);
+    exit(1);
+}
+
+/**
+ * Replay the edges of a trace: an edge may open a window, the timer runs at the next deadline and
+ * reads the level at that time. A deadline at the time of an edge is processed before the edge.
+ */
+static void replay(const trace_case_t *c)
+{
+    const button_debounce_fsm_config_t config = {
+        .debounce_us = DEBOUNCE_US,
+        .long_press_us = LONG_PRESS_US,
+        .double_click_us = DOUBLE_CLICK_US,
+    };
+    button_debounce_fsm_t fsm;
+    button_debounce_fsm_init(&fsm, &config, false);
+
+    bool level = false;
+    int64_t deadline_us = button_debounce_fsm_next_deadline(&fsm);
+    int edge_index = 0;
+    int event_cnt = 0;
+
+    for (;;) {
+        int64_t edge_us = edge_index < c->edge_cnt ? c->edges[edge_index].time_us : INT64_MAX;
+        if (deadline_us <= edge_us && deadline_us <= c->end_us) {
+            button_debounce_fsm_event_t events[BUTTON_DEBOUNCE_FSM_MAX_EVENTS];
+            int count = button_debounce_fsm_timeout(&fsm, deadline_us, level, events);
+            for (int i = 0; i < count; i++, event_cnt++) {
+                if (event_cnt >= c->event_cnt) {
+                    fail(c, "unexpected event", event_cnt);
+                }
+                if (events[i].type != c->events[event_cnt].type) {
+                    fail(c, "wrong type", event_cnt);
+                }
+                if (events[i].time_us != c->events[event_cnt].time_us) {
+                    fail(c, "wrong time", event_cnt);
+                }
+                // An event is reported at most one debounce window late
+                if (deadline_us - events[i].time_us > DEBOUNCE_US) {
+                    fail(c, "reported too late", event_cnt);
+                }
+            }
+            int64_t next_us = button_debounce_fsm_next_deadline(&fsm);
+            if (next_us <= deadline_us) {
+                fail(c, "deadline did not move", event_cnt);
+            }
+            deadline_us = next_us;
+            continue;
+        }
+        if (edge_index >= c->edge_cnt) {
+            break;
+        }
+
+        level = c->edges[edge_index].pressed;
+        if (button_debounce_fsm_edge(&fsm, edge_us)) {
+            deadline_us = button_debounce_fsm_next_deadline(&fsm);
+        }
+        edge_index++;
+    }
+
+    if (event_cnt != c->event_cnt) {
+        fail(c, "missing event", event_cnt);
+    }
+    if (fsm.pressed != level) {
+        fail(c, "debounced state differs from the input", event_cnt);
+    }
+}
+
+static void test_traces(void)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(trace_cases); i++) {
+        replay(&trace_cases[i]);
+    }
+}
+
+static void test_disabled_timings(void)
+{
+    const button_debounce_fsm_config_t config = {
+        .debounce_us = DEBOUNCE_US,
+    };
+    button_debounce_fsm_t fsm;
+    button_debounce_fsm_event_t events[BUTTON_DEBOUNCE_FSM_MAX_EVENTS];
+    button_debounce_fsm_init(&fsm, &config, false);
+
+    // No long press and no double click, only the press and release
+    for (int i = 0; i < 2; i++) {
+        int64_t t = i * 100000;
+        if (!button_debounce_fsm_edge(&fsm, t) ||
+                button_debounce_fsm_timeout(&fsm, t + DEBOUNCE_US, true, events) != 1 ||
+                events[0].type != BUTTON_DEBOUNCE_EVENT_PRESS ||
+                button_debounce_fsm_next_deadline(&fsm) != BUTTON_DEBOUNCE_FSM_NO_DEADLINE) {
+            printf("disabled timings: press %d failed\n", i);
+            exit(1);
+        }
+        if (!button_debounce_fsm_edge(&fsm, t + 50000) ||
+                button_debounce_fsm_timeout(&fsm, t + 50000 + DEBOUNCE_US, false, events) != 1 ||
+                events[0].type != BUTTON_DEBOUNCE_EVENT_RELEASE) {
+            printf("disabled timings: release %d failed\n", i);
+            exit(1);
+        }
+    }
+
+    // A bounce inside the window does not move the deadline
+    button_debounce_fsm_edge(&fsm, 1000000);
+    if (button_debounce_fsm_edge(&fsm, 1000500) || button_debounce_fsm_next_deadline(&fsm) != 1000000 + DEBOUNCE_US) {
+        printf("disabled timings: bounce moved the deadline\n");
+        exit(1);
+    }
+}
+
+int main(void)
+{
+    test_traces();
+    test_disabled_timings();
+    printf("button_debounce_fsm: all tests passed\n");
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+ * Filename: button_debounce.h
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: debounced push button with press, release, long press and double click events
+ *          edges are timestamped in the GPIO ISR and confirmed by an esp_timer, no task sleeps to debounce
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "button_debounce_fsm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Event of a debounced button
+ */
+typedef struct {
+    gpio_num_t gpio_num;               /*!< GPIO of the button, to tell buttons sharing a queue apart */
+    button_debounce_event_type_t type; /*!< Type of the event */
+    int64_t time_us;                   /*!< Time of the first edge of the change, from esp_timer_get_time() */
+} button_debounce_event_t;
+
+/**
+ * @brief Configuration of a debounced button
+ */
+typedef struct {
+    gpio_num_t gpio_num;         /*!< GPIO of the button */
+    int active_level;            /*!< Level of the GPIO while the button is pressed */
+    bool enable_internal_pull;   /*!< Pull the GPIO to the released level, leave it off with an external resistor */
+    uint32_t debounce_ms;        /*!< Debounce window, it is also the longest delay of an event */
+    uint32_t long_press_ms;      /*!< Hold time of a long press, 0 disables long presses */
+    uint32_t double_click_ms;    /*!< Longest release between the clicks of a double click, 0 disables double clicks */
+    QueueHandle_t event_queue;   /*!< Queue of button_debounce_event_t items the events are sent to, may be NULL */
+} button_debounce_config_t;
+
+typedef struct button_debounce_t *button_debounce_handle_t;
+
+/**
+ * @brief Callback run in the esp_timer task for each event, after it was sent to the queue
+ *
+ * @param[in] button Button handle
+ * @param[in] event The event
+ * @param[in] user_ctx User data, passed from `button_debounce_register_event_callback`
+ */
+typedef void (*button_debounce_event_cb_t)(button_debounce_handle_t button, const button_debounce_event_t *event, void *user_ctx);
+
+/**
+ * @brief Create a debounced button
+ *
+ * @note It installs the GPIO ISR service if it is not installed yet
+ *
+ * @param[in] config Button configuration
+ * @param[out] ret_button Returned handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_NO_MEM        if out of memory
+ *          - ESP_OK                on success
+ */
+esp_err_t button_debounce_new(const button_debounce_config_t *config, button_debounce_handle_t *ret_button);
+
+/**
+ * @brief Stop watching the button and free it
+ *
+ * @param[in] button Button handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t button_debounce_del(button_debounce_handle_t button);
+
+/**
+ * @brief Set the callback run for each event
+ *
+ * @note Set it right after `button_debounce_new`, before the button is used
+ *
+ * @param[in] button Button handle
+ * @param[in] cb Callback, NULL to remove it
+ * @param[in] user_ctx User data passed to the callback
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t button_debounce_register_event_callback(button_debounce_handle_t button, button_debounce_event_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Get the debounced state of the button
+ *
+ * @param[in] button Button handle
+ * @return true if the button is pressed
+ */
+bool button_debounce_is_pressed(button_debounce_handle_t button);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,112 @@
+/*
+ * Filename: button_debounce_fsm.h
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: debounce state machine of one push button
+ *          it is driven only by timestamps and levels, without ESP-IDF dependency,
+ *          so synthetic edge traces can be fed to it on a host
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Value of `button_debounce_fsm_next_deadline` when no timeout is needed
+ */
+#define BUTTON_DEBOUNCE_FSM_NO_DEADLINE INT64_MAX
+
+/**
+ * @brief Most events returned by one `button_debounce_fsm_timeout` call
+ */
+#define BUTTON_DEBOUNCE_FSM_MAX_EVENTS 2
+
+/**
+ * @brief Type of a debounced button event
+ */
+typedef enum {
+    BUTTON_DEBOUNCE_EVENT_PRESS,        /*!< The button was pressed */
+    BUTTON_DEBOUNCE_EVENT_RELEASE,      /*!< The button was released */
+    BUTTON_DEBOUNCE_EVENT_LONG_PRESS,   /*!< The button has been held for the long press time */
+    BUTTON_DEBOUNCE_EVENT_DOUBLE_CLICK, /*!< The button was released after a second short click */
+} button_debounce_event_type_t;
+
+/**
+ * @brief Event of the state machine
+ */
+typedef struct {
+    button_debounce_event_type_t type; /*!< Type of the event */
+    int64_t time_us;                   /*!< Time of the first edge of the change, or of the long press deadline */
+} button_debounce_fsm_event_t;
+
+/**
+ * @brief Timing of the state machine
+ */
+typedef struct {
+    uint32_t debounce_us;     /*!< Edges after the first one are ignored for this long, then the level is taken */
+    uint32_t long_press_us;   /*!< Hold time of a long press, 0 disables long presses */
+    uint32_t double_click_us; /*!< Longest release between two short clicks of a double click, 0 disables double clicks */
+} button_debounce_fsm_config_t;
+
+/**
+ * @brief State of one button
+ */
+typedef struct {
+    button_debounce_fsm_config_t config;
+    bool pressed;             /*!< Debounced state */
+    bool window_active;       /*!< An edge started a debounce window which has not ended yet */
+    int64_t window_start_us;  /*!< Time of the edge which started the window */
+    bool long_press_pending;  /*!< Pressed, and the long press event is not sent yet */
+    int64_t press_us;         /*!< Time of the last press */
+    bool click_pending;       /*!< A short click ended at `click_release_us`, the next one may complete a double click */
+    int64_t click_release_us; /*!< Time of the release of the pending click */
+} button_debounce_fsm_t;
+
+/**
+ * @brief Initialize the state machine
+ *
+ * @param[out] fsm State machine to initialize
+ * @param[in] config Timing of the state machine
+ * @param[in] pressed Current state of the button
+ */
+void button_debounce_fsm_init(button_debounce_fsm_t *fsm, const button_debounce_fsm_config_t *config, bool pressed);
+
+/**
+ * @brief Report an edge of the button input
+ *
+ * The first edge opens a debounce window, the edges inside the window are only bounces.
+ *
+ * @param[in,out] fsm State machine
+ * @param[in] time_us Time of the edge
+ * @return true if a window was opened and so the deadline moved
+ */
+bool button_debounce_fsm_edge(button_debounce_fsm_t *fsm, int64_t time_us);
+
+/**
+ * @brief Get when `button_debounce_fsm_timeout` has to be called next
+ *
+ * @param[in] fsm State machine
+ * @return Time of the deadline, BUTTON_DEBOUNCE_FSM_NO_DEADLINE if there is none
+ */
+int64_t button_debounce_fsm_next_deadline(const button_debounce_fsm_t *fsm);
+
+/**
+ * @brief Process the deadlines which passed
+ *
+ * A change is reported at most the debounce time after its first edge, a level which is back to the
+ * debounced state by the end of the window was a glitch and is not reported at all.
+ *
+ * @param[in,out] fsm State machine
+ * @param[in] now_us Current time
+ * @param[in] pressed Current state of the button input
+ * @param[out] events Returned events, room for BUTTON_DEBOUNCE_FSM_MAX_EVENTS
+ * @return Number of events returned
+ */
+int button_debounce_fsm_timeout(button_debounce_fsm_t *fsm, int64_t now_us, bool pressed, button_debounce_fsm_event_t *events);
+
+#ifdef __cplusplus
+}
+#endif
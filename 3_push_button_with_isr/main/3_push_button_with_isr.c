@@ -18,11 +18,15 @@
 #include "driver/gpio.h"       // header needed to interface with ESP32 GPIO pins
 #include "esp_err.h"           // header needed to use any macro and functions related to esp errors
 #include "esp_log.h"           // header needed to use any macro and functions related to esp logging
+#include "freertos/queue.h"    // header needed to receive the button events from a queue
+#include "button_debounce.h"   // header needed to debounce the button, see components/button_debounce
 
-static const char *ERROR_TAG = "push_button_with_isr_app";
-unsigned int button_push_count = 0; // variable to count button push
+#define BUTTON_DEBOUNCE_MS 20       // bounces after the first edge are ignored for this long, it is also the longest delay of an event
+#define BUTTON_LONG_PRESS_MS 800    // hold time of a long press
+#define BUTTON_DOUBLE_CLICK_MS 300  // longest release between the two clicks of a double click
+#define BUTTON_EVENT_QUEUE_LEN 8    // button events buffered until app_main reads them
 
-void ISR_handler_for_gpio8(void *arg); // function prototype for ISR
+static const char *ERROR_TAG = "push_button_with_isr_app";
 
 void app_main(void)
 {
@@ -42,18 +46,6 @@ void app_main(void)
         ESP_LOGI(ERROR_TAG, "Error resetting GPIO pin 8 at line %d of app_main() error id: %d", __LINE__, return_check);
     }
 
-    gpio_config_t io_conf = {0};
-    io_conf.pin_bit_mask = (1ULL << GPIO_NUM_8);   // Configure GPIO8
-    io_conf.mode = GPIO_MODE_INPUT;                // Set as input
-    io_conf.pull_up_en = GPIO_PULLUP_DISABLE;       // Enable internal pull-up
-    io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;  // Disable pull-down
-    io_conf.intr_type = GPIO_INTR_POSEDGE;         // Set interrupt type to positive edge
-
-    return_check = gpio_config(&io_conf);
-    if (return_check!=ESP_OK) {
-        ESP_LOGI(ERROR_TAG, "Error configuring GPIO 8 at line %d of app_main() error id: %d", __LINE__, return_check);
-    }
-
     // set GPIO pin 2 direction to output to set it for LED pin high and low output
     return_check = gpio_set_direction(GPIO_NUM_2, GPIO_MODE_OUTPUT);
 
@@ -61,32 +53,50 @@ void app_main(void)
         ESP_LOGI(ERROR_TAG, "Error setting GPIO pin 2 to output at line %d of app_main() error id: %d", __LINE__, return_check);
     }
     
-    // assign ISR to GPIO pin 8
-    gpio_install_isr_service(0); // install ISR service for all GPIO pins and use default config
-    gpio_isr_handler_add(GPIO_NUM_8, ISR_handler_for_gpio8, (void *) GPIO_NUM_8); // add ISR handler for GPIO pin 8; (void *) GPIO_NUM_8 is optional
+    // the debounce component configures GPIO 8, timestamps its edges in its ISR and sends clean events to this queue
+    QueueHandle_t button_event_queue = xQueueCreate(BUTTON_EVENT_QUEUE_LEN, sizeof(button_debounce_event_t));
+    button_debounce_handle_t button = NULL;
+    button_debounce_config_t button_config = {
+        .gpio_num = GPIO_NUM_8,                    // push button pin
+        .active_level = 0,                         // the button connects the pin to ground
+        .enable_internal_pull = false,             // external pull-up resistor is used
+        .debounce_ms = BUTTON_DEBOUNCE_MS,
+        .long_press_ms = BUTTON_LONG_PRESS_MS,
+        .double_click_ms = BUTTON_DOUBLE_CLICK_MS,
+        .event_queue = button_event_queue,
+    };
+    return_check = button_debounce_new(&button_config, &button);
+    if (return_check!=ESP_OK) {
+        ESP_LOGI(ERROR_TAG, "Error creating the debounced button on GPIO 8 at line %d of app_main() error id: %d", __LINE__, return_check);
+    }
 
     bool led_state = false; // variable to store LED state
-    int loop_value = 0; // variable to count loop
+    int button_push_count = 0; // variable to count button push
+    button_debounce_event_t button_event; // event received from the debounce component
 
     while (1) {
-        loop_value++;
-        printf("Reading the button state: Loop value: %d button push count: %d\n", loop_value, button_push_count);
-        if (button_push_count > 0) {
+        // sleep until the button does something, no delay is needed to debounce or to avoid over-running
+        xQueueReceive(button_event_queue, &button_event, portMAX_DELAY);
+        switch (button_event.type) {
+        case BUTTON_DEBOUNCE_EVENT_PRESS:
+            button_push_count++;
             led_state = !led_state;
-            printf("Button is pressed; toggling LED state\n");
+            printf("Button is pressed; toggling LED state. Button push count: %d\n", button_push_count);
             return_check = gpio_set_level(GPIO_NUM_2, led_state);
             if (return_check!=ESP_OK) {
                 ESP_LOGI(ERROR_TAG, "Error setting GPIO pin 2 to %d at line %d of app_main() error id: %d", led_state, __LINE__, return_check);
             }
-            button_push_count = 0; // reset button push count to 0
-            vTaskDelay(50/portTICK_PERIOD_MS); // delay to debounce button
+            break;
+        case BUTTON_DEBOUNCE_EVENT_RELEASE:
+            printf("Button is released\n");
+            break;
+        case BUTTON_DEBOUNCE_EVENT_LONG_PRESS:
+            printf("Button is long pressed\n");
+            break;
+        case BUTTON_DEBOUNCE_EVENT_DOUBLE_CLICK:
+            printf("Button is double clicked\n");
+            break;
         }
-        vTaskDelay(100/portTICK_PERIOD_MS); // delay to avoid over-running
     }
 
-}
-
-void ISR_handler_for_gpio8(void *arg)
-{
-    button_push_count++;
 }
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*
+ * Filename: test_rotary_encoder.c
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: host test of the Gray-code decoder and the event ring of the rotary encoder
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rotary_encoder_decoder.h"
+#include "rotary_encoder_ring.h"
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+// An input trace starting from the rest state and the detents it has to produce
+typedef struct {
+    const char *name;
+    uint8_t states[16];
+    int state_cnt;
+    int detents;        // Sum of the returned detents
+    int reports;        // Number of non-zero returns
+} decoder_case_t;
+
+static const decoder_case_t decoder_cases[] = {
+    // Valid full cycles, clockwise is 11 -> 01 -> 00 -> 10 -> 11
+    {"clockwise", {1, 0, 2, 3}, 4, 1, 1},
+    {"counter-clockwise", {2, 0, 1, 3}, 4, -1, 1},
+    {"two clockwise", {1, 0, 2, 3, 1, 0, 2, 3}, 8, 2, 2},
+    {"clockwise then back", {1, 0, 2, 3, 2, 0, 1, 3}, 8, 0, 2},
+    {"no change", {3, 3, 3}, 3, 0, 0},
+
+    // Bounce goes back and forth between two neighbouring states
+    {"bounce at rest", {1, 3, 1, 3, 2, 3}, 6, 0, 0},
+    {"bounce in the middle", {1, 0, 1, 0, 2, 0, 2, 3}, 8, 1, 1},
+    {"bounce before rest", {1, 0, 2, 3, 2, 3}, 6, 1, 1},
+    {"turned back before half", {1, 3}, 2, 0, 0},
+
+    // Both inputs changed: an edge was missed, nothing is counted for that transition
+    {"missed edge after half", {1, 0, 3}, 3, 1, 1},
+    {"missed edge counter-clockwise", {2, 0, 3}, 3, -1, 1},
+    {"missed edge in the middle", {1, 2, 3}, 3, 1, 1},
+    {"missed edge before half", {1, 2, 1, 3}, 4, 0, 0},
+    {"only illegal", {0, 3, 0, 3}, 4, 0, 0},
+};
+
+static void test_decoder_transitions(void)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(decoder_cases); i++) {
+        const decoder_case_t *c = &decoder_cases[i];
+        rotary_decoder_t decoder;
+        rotary_decoder_init(&decoder, ROTARY_DECODER_REST_STATE);
+
+        int detents = 0;
+        int reports = 0;
+        for (int s = 0; s < c->state_cnt; s++) {
+            int d = rotary_decoder_update(&decoder, c->states[s]);
+            CHECK(d >= -1 && d <= 1);
+            detents += d;
+            reports += d != 0;
+        }
+
+        if (detents != c->detents || reports != c->reports) {
+            printf("decoder case \"%s\": %d detents in %d reports, expected %d in %d\n",
+                   c->name, detents, reports, c->detents, c->reports);
+            exit(1);
+        }
+    }
+}
+
+static void test_decoder_table(void)
+{
+    // Every single step between neighbours counts one quarter step, the opposite step takes it back
+    static const uint8_t cycle[4] = {3, 1, 0, 2};
+    for (int i = 0; i < 4; i++) {
+        uint8_t from = cycle[i];
+        uint8_t to = cycle[(i + 1) % 4];
+        rotary_decoder_t decoder;
+
+        rotary_decoder_init(&decoder, from);
+        rotary_decoder_update(&decoder, to);
+        CHECK(decoder.state == to);
+        CHECK(decoder.steps == 1 || to == ROTARY_DECODER_REST_STATE);
+
+        rotary_decoder_init(&decoder, to);
+        rotary_decoder_update(&decoder, from);
+        CHECK(decoder.steps == -1 || from == ROTARY_DECODER_REST_STATE);
+
+        // The diagonal is illegal
+        uint8_t diagonal = cycle[(i + 2) % 4];
+        rotary_decoder_init(&decoder, from);
+        rotary_decoder_update(&decoder, diagonal);
+        CHECK(decoder.steps == 0);
+    }
+
+    // Only the two input bits are used
+    rotary_decoder_t decoder;
+    rotary_decoder_init(&decoder, 0xFF);
+    CHECK(decoder.state == ROTARY_DECODER_REST_STATE);
+    rotary_decoder_update(&decoder, 0xFD);
+    CHECK(decoder.state == 1 && decoder.steps == 1);
+}
+
+static void test_ring_order(void)
+{
+    rotary_encoder_event_t items[4];
+    rotary_encoder_ring_t ring;
+    rotary_encoder_event_t ev;
+    rotary_encoder_ring_init(&ring, items, ARRAY_SIZE(items));
+
+    CHECK(!rotary_encoder_ring_pop(&ring, &ev));
+
+    for (int i = 0; i < 3; i++) {
+        ev.time_us = 1000 * i;
+        ev.delta = i + 1;
+        CHECK(rotary_encoder_ring_push(&ring, &ev));
+    }
+    for (int i = 0; i < 3; i++) {
+        CHECK(rotary_encoder_ring_pop(&ring, &ev));
+        CHECK(ev.time_us == 1000 * i && ev.delta == i + 1);
+    }
+    CHECK(!rotary_encoder_ring_pop(&ring, &ev));
+}
+
+static void test_ring_overflow(void)
+{
+    rotary_encoder_event_t items[4];
+    rotary_encoder_ring_t ring;
+    rotary_encoder_event_t ev = {0};
+    rotary_encoder_ring_init(&ring, items, ARRAY_SIZE(items));
+
+    for (int i = 0; i < 4; i++) {
+        ev.delta = i;
+        CHECK(rotary_encoder_ring_push(&ring, &ev));
+    }
+
+    // A full ring keeps the old events and refuses the new one
+    ev.delta = 100;
+    CHECK(!rotary_encoder_ring_push(&ring, &ev));
+    CHECK(!rotary_encoder_ring_push(&ring, &ev));
+
+    CHECK(rotary_encoder_ring_pop(&ring, &ev));
+    CHECK(ev.delta == 0);
+
+    // One slot is free again
+    ev.delta = 4;
+    CHECK(rotary_encoder_ring_push(&ring, &ev));
+    CHECK(!rotary_encoder_ring_push(&ring, &ev));
+
+    for (int i = 1; i <= 4; i++) {
+        CHECK(rotary_encoder_ring_pop(&ring, &ev));
+        CHECK(ev.delta == i);
+    }
+    CHECK(!rotary_encoder_ring_pop(&ring, &ev));
+}
+
+static void test_ring_wrap(void)
+{
+    rotary_encoder_event_t items[4];
+    rotary_encoder_ring_t ring;
+    rotary_encoder_event_t ev = {0};
+    rotary_encoder_ring_init(&ring, items, ARRAY_SIZE(items));
+
+    // Many times around the storage
+    for (int i = 0; i < 1000; i++) {
+        ev.delta = i;
+        CHECK(rotary_encoder_ring_push(&ring, &ev));
+        if (i % 3 == 2) {
+            CHECK(rotary_encoder_ring_push(&ring, &ev));
+            CHECK(rotary_encoder_ring_pop(&ring, &ev));
+        }
+        CHECK(rotary_encoder_ring_pop(&ring, &ev));
+        CHECK(ev.delta == i);
+    }
+
+    // The free running indexes overflow the 32 bits
+    atomic_store(&ring.head, UINT32_MAX - 1);
+    atomic_store(&ring.tail, UINT32_MAX - 1);
+    for (int i = 0; i < 4; i++) {
+        ev.delta = i;
+        CHECK(rotary_encoder_ring_push(&ring, &ev));
+    }
+    CHECK(!rotary_encoder_ring_push(&ring, &ev));
+    CHECK(atomic_load(&ring.head) == 2);
+    for (int i = 0; i < 4; i++) {
+        CHECK(rotary_encoder_ring_pop(&ring, &ev));
+        CHECK(ev.delta == i);
+    }
+    CHECK(!rotary_encoder_ring_pop(&ring, &ev));
+}
+
+int main(void)
+{
+    test_decoder_transitions();
+    test_decoder_table();
+    test_ring_order();
+    test_ring_overflow();
+    test_ring_wrap();
+    printf("rotary_encoder: all tests passed\n");
+    return 0;
+}
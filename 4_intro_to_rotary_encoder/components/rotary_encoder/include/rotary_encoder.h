@@ -0,0 +1,116 @@
+/*
+ * Filename: rotary_encoder.h
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: quadrature decoder for rotary encoders like the HW-040
+ *          the rotation is decoded either by the PCNT peripheral or by a GPIO edge ISR
+ *          and reported as timestamped events a task can block on
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "rotary_encoder_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief How the quadrature signals are decoded
+ */
+typedef enum {
+    ROTARY_ENCODER_BACKEND_PCNT, /*!< Pulse counter peripheral in quadrature mode, one interrupt per detent */
+    ROTARY_ENCODER_BACKEND_GPIO, /*!< Gray-code table driven by GPIO edge interrupts, works on any pin below 32 */
+} rotary_encoder_backend_t;
+
+/**
+ * @brief Configuration of a rotary encoder
+ */
+typedef struct {
+    gpio_num_t pin_a;                 /*!< A (CLK) pin of the encoder */
+    gpio_num_t pin_b;                 /*!< B (DT) pin of the encoder */
+    rotary_encoder_backend_t backend; /*!< Decoder to use */
+    uint32_t event_queue_len;         /*!< Number of events buffered for the reading task, must be a power of 2 */
+    uint32_t glitch_filter_ns;        /*!< Pulses shorter than this are ignored by the PCNT backend, 0 disables the filter */
+} rotary_encoder_config_t;
+
+typedef struct rotary_encoder_t *rotary_encoder_handle_t;
+
+/**
+ * @brief Callback run in the ISR after an event was added, e.g. to wake up a task which waits for more than the encoder
+ *
+ * @param[in] encoder Encoder handle
+ * @param[in] user_ctx User data, passed from `rotary_encoder_register_event_callback`
+ * @return Whether a high priority task has been woken up by this function
+ */
+typedef bool (*rotary_encoder_event_cb_t)(rotary_encoder_handle_t encoder, void *user_ctx);
+
+/**
+ * @brief Create a rotary encoder and start decoding
+ *
+ * @note The GPIO backend installs the GPIO ISR service if it is not installed yet
+ *
+ * @param[in] config Encoder configuration
+ * @param[out] ret_encoder Returned handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_NO_MEM        if out of memory
+ *          - ESP_OK                on success
+ */
+esp_err_t rotary_encoder_new(const rotary_encoder_config_t *config, rotary_encoder_handle_t *ret_encoder);
+
+/**
+ * @brief Stop decoding and free the encoder
+ *
+ * @param[in] encoder Encoder handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t rotary_encoder_del(rotary_encoder_handle_t encoder);
+
+/**
+ * @brief Wait for the next rotation of the encoder
+ *
+ * Only one task may read the events of an encoder. When the queue was full, the detents which
+ * did not fit are added to the next event, so no rotation is lost, only its timing.
+ *
+ * @param[in] encoder Encoder handle
+ * @param[out] event Returned event
+ * @param[in] timeout Ticks to wait, portMAX_DELAY to wait forever
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_TIMEOUT       if the encoder was not rotated in time
+ *          - ESP_OK                on success
+ */
+esp_err_t rotary_encoder_wait_event(rotary_encoder_handle_t encoder, rotary_encoder_event_t *event, TickType_t timeout);
+
+/**
+ * @brief Set the callback run in the ISR after each event
+ *
+ * @note The events still have to be read with `rotary_encoder_wait_event`
+ * @note Set it right after `rotary_encoder_new`, the ISR may run on the other core while it changes
+ *
+ * @param[in] encoder Encoder handle
+ * @param[in] cb Callback, NULL to remove it
+ * @param[in] user_ctx User data passed to the callback
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t rotary_encoder_register_event_callback(rotary_encoder_handle_t encoder, rotary_encoder_event_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Get the detents counted since the encoder was created, positive is clockwise
+ *
+ * @param[in] encoder Encoder handle
+ * @return Position of the encoder
+ */
+int32_t rotary_encoder_get_position(rotary_encoder_handle_t encoder);
+
+#ifdef __cplusplus
+}
+#endif
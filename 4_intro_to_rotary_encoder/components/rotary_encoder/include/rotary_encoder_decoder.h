@@ -0,0 +1,81 @@
+/*
+ * Filename: rotary_encoder_decoder.h
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: table-driven Gray-code decoder for quadrature encoders
+ *          it has no ESP-IDF dependency so recorded edge sequences can be fed to it on a host
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Input state of the HW-040 when it sits in a detent, both A and B are pulled high
+ */
+#define ROTARY_DECODER_REST_STATE 0x3
+
+/**
+ * @brief State of the software quadrature decoder
+ */
+typedef struct {
+    uint8_t state; /*!< Last input state, bit 1 is A (CLK), bit 0 is B (DT) */
+    int8_t steps;  /*!< Quarter steps counted since the last detent */
+} rotary_decoder_t;
+
+/**
+ * @brief Initialize the decoder with the current input state
+ *
+ * @param[out] decoder Decoder to initialize
+ * @param[in] ab Input state, bit 1 is A (CLK), bit 0 is B (DT)
+ */
+static inline void rotary_decoder_init(rotary_decoder_t *decoder, uint8_t ab)
+{
+    decoder->state = ab & 0x3;
+    decoder->steps = 0;
+}
+
+/**
+ * @brief Feed a new input state to the decoder
+ *
+ * Every valid Gray-code transition counts a quarter step, impossible transitions (both inputs changed,
+ * e.g. because an edge was missed) count nothing. Contact bounce goes back and forth between two
+ * neighbouring states, so its quarter steps cancel out. A detent is reported only when the inputs
+ * return to the rest state after at least half a cycle in one direction.
+ *
+ * @param[in,out] decoder Decoder state
+ * @param[in] ab New input state, bit 1 is A (CLK), bit 0 is B (DT)
+ * @return +1 for a clockwise detent, -1 for a counter-clockwise detent, 0 otherwise
+ */
+static inline int rotary_decoder_update(rotary_decoder_t *decoder, uint8_t ab)
+{
+    // indexed by (previous state << 2) | new state; clockwise is 11 -> 01 -> 00 -> 10 -> 11
+    static const int8_t transition_table[16] = {
+        0, -1, +1, 0,
+        +1, 0, 0, -1,
+        -1, 0, 0, +1,
+        0, +1, -1, 0,
+    };
+
+    ab &= 0x3;
+    decoder->steps += transition_table[(decoder->state << 2) | ab];
+    decoder->state = ab;
+    if (ab != ROTARY_DECODER_REST_STATE) {
+        return 0;
+    }
+
+    int detent = 0;
+    if (decoder->steps >= 2) {
+        detent = 1;
+    } else if (decoder->steps <= -2) {
+        detent = -1;
+    }
+    decoder->steps = 0;
+    return detent;
+}
+
+#ifdef __cplusplus
+}
+#endif
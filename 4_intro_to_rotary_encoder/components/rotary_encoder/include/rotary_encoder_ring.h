@@ -0,0 +1,93 @@
+/*
+ * Filename: rotary_encoder_ring.h
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: lock-free single-producer/single-consumer ring of encoder events
+ *          the producer is the encoder ISR, the consumer is one task
+ *          it has no ESP-IDF dependency so it can be tested on a host
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Rotation of the encoder reported by the ISR
+ */
+typedef struct {
+    int64_t time_us; /*!< Time of the edge which completed the movement, from esp_timer_get_time() */
+    int32_t delta;   /*!< Detents moved, positive is clockwise */
+} rotary_encoder_event_t;
+
+/**
+ * @brief Ring buffer of events, `head` is only written by the producer and `tail` only by the consumer
+ */
+typedef struct {
+    rotary_encoder_event_t *items;
+    uint32_t mask;           /*!< Number of items - 1, the number of items is a power of 2 */
+    _Atomic uint32_t head;   /*!< Index of the next item to write, free running */
+    _Atomic uint32_t tail;   /*!< Index of the next item to read, free running */
+} rotary_encoder_ring_t;
+
+/**
+ * @brief Initialize an empty ring
+ *
+ * @param[out] ring Ring to initialize
+ * @param[in] items Storage of the events
+ * @param[in] size Number of events in `items`, must be a power of 2
+ */
+static inline void rotary_encoder_ring_init(rotary_encoder_ring_t *ring, rotary_encoder_event_t *items, uint32_t size)
+{
+    ring->items = items;
+    ring->mask = size - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+}
+
+/**
+ * @brief Add an event, called only from the producer
+ *
+ * @param[in] ring Ring
+ * @param[in] event Event to copy into the ring
+ * @return true if added, false if the ring is full
+ */
+static inline bool rotary_encoder_ring_push(rotary_encoder_ring_t *ring, const rotary_encoder_event_t *event)
+{
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail > ring->mask) {
+        return false;
+    }
+    ring->items[head & ring->mask] = *event;
+    // publish the item only after it was written
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Take the oldest event, called only from the consumer
+ *
+ * @param[in] ring Ring
+ * @param[out] event Returned event
+ * @return true if an event was returned, false if the ring is empty
+ */
+static inline bool rotary_encoder_ring_pop(rotary_encoder_ring_t *ring, rotary_encoder_event_t *event)
+{
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if (head == tail) {
+        return false;
+    }
+    *event = ring->items[tail & ring->mask];
+    // give the slot back to the producer only after it was read
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+#ifdef __cplusplus
+}
+#endif
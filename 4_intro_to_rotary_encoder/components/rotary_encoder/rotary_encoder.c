@@ -0,0 +1,295 @@
+/*
+ * Filename: rotary_encoder.c
+ * Author: Darshan Savaliya github@sadarshan
+ * Purpose: quadrature decoder for rotary encoders with a PCNT and a GPIO interrupt backend
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "driver/pulse_cnt.h"
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
+#include "esp_timer.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "rotary_encoder.h"
+#include "rotary_encoder_decoder.h"
+
+static const char *TAG = "rotary_encoder";
+
+// The HW-040 goes through a full Gray-code cycle, so 4 counts of the PCNT, between two detents
+#define ROTARY_ENCODER_PCNT_STEPS_PER_DETENT 4
+
+typedef struct rotary_encoder_t {
+    rotary_encoder_backend_t backend;
+    gpio_num_t pin_a;
+    gpio_num_t pin_b;
+    rotary_encoder_ring_t ring;
+    rotary_encoder_event_t *ring_items;
+    SemaphoreHandle_t event_sem;          // Given by the ISR after it pushed an event
+    rotary_encoder_event_cb_t on_event;
+    void *on_event_ctx;
+    volatile int32_t position;            // Written only by the ISR
+    int32_t pending_delta;                // Detents which did not fit in the ring, owned by the ISR
+    pcnt_unit_handle_t pcnt_unit;
+    pcnt_channel_handle_t pcnt_chan_a;
+    pcnt_channel_handle_t pcnt_chan_b;
+    rotary_decoder_t decoder;
+    bool gpio_isr_added;
+} rotary_encoder_t;
+
+static esp_err_t rotary_encoder_pcnt_init(rotary_encoder_t *encoder, const rotary_encoder_config_t *config);
+static void rotary_encoder_pcnt_deinit(rotary_encoder_t *encoder);
+static bool rotary_encoder_pcnt_on_reach(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *user_ctx);
+static esp_err_t rotary_encoder_gpio_init(rotary_encoder_t *encoder);
+static void rotary_encoder_gpio_deinit(rotary_encoder_t *encoder);
+static void rotary_encoder_gpio_isr(void *arg);
+static bool rotary_encoder_report_from_isr(rotary_encoder_t *encoder, int32_t delta, int64_t time_us);
+
+esp_err_t rotary_encoder_new(const rotary_encoder_config_t *config, rotary_encoder_handle_t *ret_encoder)
+{
+    esp_err_t ret = ESP_OK;
+    rotary_encoder_t *encoder = NULL;
+    ESP_GOTO_ON_FALSE(config && ret_encoder, ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+    ESP_GOTO_ON_FALSE(GPIO_IS_VALID_GPIO(config->pin_a) && GPIO_IS_VALID_GPIO(config->pin_b) &&
+                      config->pin_a != config->pin_b, ESP_ERR_INVALID_ARG, err, TAG, "invalid pins");
+    ESP_GOTO_ON_FALSE(config->event_queue_len > 0 && (config->event_queue_len & (config->event_queue_len - 1)) == 0,
+                      ESP_ERR_INVALID_ARG, err, TAG, "event queue length must be a power of 2");
+    encoder = calloc(1, sizeof(rotary_encoder_t));
+    ESP_GOTO_ON_FALSE(encoder, ESP_ERR_NO_MEM, err, TAG, "no mem for encoder");
+
+    encoder->ring_items = calloc(config->event_queue_len, sizeof(rotary_encoder_event_t));
+    ESP_GOTO_ON_FALSE(encoder->ring_items, ESP_ERR_NO_MEM, err, TAG, "no mem for event queue");
+    rotary_encoder_ring_init(&encoder->ring, encoder->ring_items, config->event_queue_len);
+    encoder->event_sem = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(encoder->event_sem, ESP_ERR_NO_MEM, err, TAG, "no mem for event semaphore");
+
+    encoder->backend = config->backend;
+    encoder->pin_a = config->pin_a;
+    encoder->pin_b = config->pin_b;
+
+    switch (config->backend) {
+    case ROTARY_ENCODER_BACKEND_PCNT:
+        ESP_GOTO_ON_ERROR(rotary_encoder_pcnt_init(encoder, config), err, TAG, "init pcnt backend failed");
+        break;
+    case ROTARY_ENCODER_BACKEND_GPIO:
+        ESP_GOTO_ON_ERROR(rotary_encoder_gpio_init(encoder), err, TAG, "init gpio backend failed");
+        break;
+    default:
+        ESP_GOTO_ON_FALSE(false, ESP_ERR_INVALID_ARG, err, TAG, "invalid backend");
+    }
+
+    *ret_encoder = encoder;
+    ESP_LOGD(TAG, "new encoder @%p", encoder);
+
+    return ESP_OK;
+
+err:
+    if (encoder) {
+        rotary_encoder_del(encoder);
+    }
+    return ret;
+}
+
+esp_err_t rotary_encoder_del(rotary_encoder_handle_t encoder)
+{
+    ESP_RETURN_ON_FALSE(encoder, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_LOGD(TAG, "del encoder @%p", encoder);
+    // Both backends tolerate a partly initialized encoder, so this is also the cleanup path of rotary_encoder_new
+    rotary_encoder_pcnt_deinit(encoder);
+    rotary_encoder_gpio_deinit(encoder);
+    if (encoder->event_sem) {
+        vSemaphoreDelete(encoder->event_sem);
+    }
+    free(encoder->ring_items);
+    free(encoder);
+    return ESP_OK;
+}
+
+esp_err_t rotary_encoder_wait_event(rotary_encoder_handle_t encoder, rotary_encoder_event_t *event, TickType_t timeout)
+{
+    ESP_RETURN_ON_FALSE(encoder && event, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    // The semaphore only wakes the task up, the ring holds the events. A give can be left over
+    // from events which were already popped, so check the ring again after every wake up.
+    while (!rotary_encoder_ring_pop(&encoder->ring, event)) {
+        if (xSemaphoreTake(encoder->event_sem, timeout) != pdTRUE) {
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t rotary_encoder_register_event_callback(rotary_encoder_handle_t encoder, rotary_encoder_event_cb_t cb, void *user_ctx)
+{
+    ESP_RETURN_ON_FALSE(encoder, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    encoder->on_event_ctx = user_ctx;
+    encoder->on_event = cb;
+    return ESP_OK;
+}
+
+int32_t rotary_encoder_get_position(rotary_encoder_handle_t encoder)
+{
+    return encoder->position;
+}
+
+/*********************************
+ * PCNT backend
+ *********************************/
+
+static esp_err_t rotary_encoder_pcnt_init(rotary_encoder_t *encoder, const rotary_encoder_config_t *config)
+{
+    // The counter goes back to 0 when it reaches a limit, so each limit event is exactly one detent
+    pcnt_unit_config_t unit_config = {
+        .high_limit = ROTARY_ENCODER_PCNT_STEPS_PER_DETENT,
+        .low_limit = -ROTARY_ENCODER_PCNT_STEPS_PER_DETENT,
+    };
+    ESP_RETURN_ON_ERROR(pcnt_new_unit(&unit_config, &encoder->pcnt_unit), TAG, "create pcnt unit failed");
+    if (config->glitch_filter_ns) {
+        pcnt_glitch_filter_config_t filter_config = {
+            .max_glitch_ns = config->glitch_filter_ns,
+        };
+        ESP_RETURN_ON_ERROR(pcnt_unit_set_glitch_filter(encoder->pcnt_unit, &filter_config), TAG, "set glitch filter failed");
+    }
+
+    // Count every edge of both pins (x4 decoding), the level of the other pin gives the direction.
+    // Clockwise is A falling while B is high, so an A edge counts up when A differs from B afterwards.
+    pcnt_chan_config_t chan_a_config = {
+        .edge_gpio_num = encoder->pin_a,
+        .level_gpio_num = encoder->pin_b,
+    };
+    ESP_RETURN_ON_ERROR(pcnt_new_channel(encoder->pcnt_unit, &chan_a_config, &encoder->pcnt_chan_a), TAG, "create channel A failed");
+    pcnt_chan_config_t chan_b_config = {
+        .edge_gpio_num = encoder->pin_b,
+        .level_gpio_num = encoder->pin_a,
+    };
+    ESP_RETURN_ON_ERROR(pcnt_new_channel(encoder->pcnt_unit, &chan_b_config, &encoder->pcnt_chan_b), TAG, "create channel B failed");
+    ESP_RETURN_ON_ERROR(pcnt_channel_set_edge_action(encoder->pcnt_chan_a, PCNT_CHANNEL_EDGE_ACTION_DECREASE, PCNT_CHANNEL_EDGE_ACTION_INCREASE),
+                        TAG, "set channel A edge action failed");
+    ESP_RETURN_ON_ERROR(pcnt_channel_set_level_action(encoder->pcnt_chan_a, PCNT_CHANNEL_LEVEL_ACTION_KEEP, PCNT_CHANNEL_LEVEL_ACTION_INVERSE),
+                        TAG, "set channel A level action failed");
+    ESP_RETURN_ON_ERROR(pcnt_channel_set_edge_action(encoder->pcnt_chan_b, PCNT_CHANNEL_EDGE_ACTION_INCREASE, PCNT_CHANNEL_EDGE_ACTION_DECREASE),
+                        TAG, "set channel B edge action failed");
+    ESP_RETURN_ON_ERROR(pcnt_channel_set_level_action(encoder->pcnt_chan_b, PCNT_CHANNEL_LEVEL_ACTION_KEEP, PCNT_CHANNEL_LEVEL_ACTION_INVERSE),
+                        TAG, "set channel B level action failed");
+
+    ESP_RETURN_ON_ERROR(pcnt_unit_add_watch_point(encoder->pcnt_unit, unit_config.high_limit), TAG, "add high watch point failed");
+    ESP_RETURN_ON_ERROR(pcnt_unit_add_watch_point(encoder->pcnt_unit, unit_config.low_limit), TAG, "add low watch point failed");
+    pcnt_event_callbacks_t cbs = {
+        .on_reach = rotary_encoder_pcnt_on_reach,
+    };
+    ESP_RETURN_ON_ERROR(pcnt_unit_register_event_callbacks(encoder->pcnt_unit, &cbs, encoder), TAG, "register pcnt callbacks failed");
+
+    ESP_RETURN_ON_ERROR(pcnt_unit_enable(encoder->pcnt_unit), TAG, "enable pcnt unit failed");
+    ESP_RETURN_ON_ERROR(pcnt_unit_clear_count(encoder->pcnt_unit), TAG, "clear pcnt count failed");
+    ESP_RETURN_ON_ERROR(pcnt_unit_start(encoder->pcnt_unit), TAG, "start pcnt unit failed");
+    return ESP_OK;
+}
+
+static void rotary_encoder_pcnt_deinit(rotary_encoder_t *encoder)
+{
+    if (!encoder->pcnt_unit) {
+        return;
+    }
+    // Stop and disable fail only if the unit was not started or enabled, which is fine here
+    pcnt_unit_stop(encoder->pcnt_unit);
+    pcnt_unit_disable(encoder->pcnt_unit);
+    if (encoder->pcnt_chan_a) {
+        pcnt_del_channel(encoder->pcnt_chan_a);
+    }
+    if (encoder->pcnt_chan_b) {
+        pcnt_del_channel(encoder->pcnt_chan_b);
+    }
+    pcnt_del_unit(encoder->pcnt_unit);
+}
+
+static bool rotary_encoder_pcnt_on_reach(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *user_ctx)
+{
+    rotary_encoder_t *encoder = user_ctx;
+    return rotary_encoder_report_from_isr(encoder, edata->watch_point_value > 0 ? 1 : -1, esp_timer_get_time());
+}
+
+/*********************************
+ * GPIO backend
+ *********************************/
+
+// Both pins from a single read of the input register, bit 1 is A and bit 0 is B
+static inline uint8_t rotary_encoder_gpio_read_ab(const rotary_encoder_t *encoder)
+{
+    uint32_t in = REG_READ(GPIO_IN_REG);
+    return (((in >> encoder->pin_a) & 1) << 1) | ((in >> encoder->pin_b) & 1);
+}
+
+static esp_err_t rotary_encoder_gpio_init(rotary_encoder_t *encoder)
+{
+    ESP_RETURN_ON_FALSE(encoder->pin_a < 32 && encoder->pin_b < 32, ESP_ERR_INVALID_ARG, TAG,
+                        "gpio backend supports pins below 32 only");
+
+    gpio_config_t io_conf = {
+        .pin_bit_mask = (1ULL << encoder->pin_a) | (1ULL << encoder->pin_b),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_ANYEDGE,
+    };
+    ESP_RETURN_ON_ERROR(gpio_config(&io_conf), TAG, "configure gpio failed");
+
+    // The application may have installed the ISR service already, e.g. for a button
+    esp_err_t ret = gpio_install_isr_service(0);
+    ESP_RETURN_ON_FALSE(ret == ESP_OK || ret == ESP_ERR_INVALID_STATE, ret, TAG, "install gpio isr service failed");
+
+    rotary_decoder_init(&encoder->decoder, rotary_encoder_gpio_read_ab(encoder));
+    ESP_RETURN_ON_ERROR(gpio_isr_handler_add(encoder->pin_a, rotary_encoder_gpio_isr, encoder), TAG, "add isr of pin A failed");
+    encoder->gpio_isr_added = true;
+    ESP_RETURN_ON_ERROR(gpio_isr_handler_add(encoder->pin_b, rotary_encoder_gpio_isr, encoder), TAG, "add isr of pin B failed");
+    return ESP_OK;
+}
+
+static void rotary_encoder_gpio_deinit(rotary_encoder_t *encoder)
+{
+    if (!encoder->gpio_isr_added) {
+        return;
+    }
+    gpio_isr_handler_remove(encoder->pin_a);
+    gpio_isr_handler_remove(encoder->pin_b);
+    gpio_set_intr_type(encoder->pin_a, GPIO_INTR_DISABLE);
+    gpio_set_intr_type(encoder->pin_b, GPIO_INTR_DISABLE);
+}
+
+static void rotary_encoder_gpio_isr(void *arg)
+{
+    rotary_encoder_t *encoder = arg;
+    // Sample both pins at once, reading them one by one could mix the states before and after a bounce
+    int detent = rotary_decoder_update(&encoder->decoder, rotary_encoder_gpio_read_ab(encoder));
+    if (detent && rotary_encoder_report_from_isr(encoder, detent, esp_timer_get_time())) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/*********************************
+ * Event reporting
+ *********************************/
+
+static bool rotary_encoder_report_from_isr(rotary_encoder_t *encoder, int32_t delta, int64_t time_us)
+{
+    BaseType_t high_task_wakeup = pdFALSE;
+    rotary_encoder_event_t event = {
+        .time_us = time_us,
+        .delta = encoder->pending_delta + delta,
+    };
+
+    encoder->position += delta;
+    if (!rotary_encoder_ring_push(&encoder->ring, &event)) {
+        // The reader is behind, keep the detents for the next event instead of dropping them
+        encoder->pending_delta = event.delta;
+        return false;
+    }
+    encoder->pending_delta = 0;
+    xSemaphoreGiveFromISR(encoder->event_sem, &high_task_wakeup);
+    if (encoder->on_event && encoder->on_event(encoder, encoder->on_event_ctx)) {
+        high_task_wakeup = pdTRUE;
+    }
+    return high_task_wakeup == pdTRUE;
+}
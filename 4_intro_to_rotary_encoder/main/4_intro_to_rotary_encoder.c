@@ -13,115 +13,115 @@
 
 
 #include <stdio.h>             // standard input output header to print anything 
+#include <inttypes.h>          // header needed to print int64_t and int32_t with PRId64 and PRId32
 #include "freertos/FreeRTOS.h" // this header is needed to use app_main() as app_main is a standart function to use when running freertos on esp32
 #include "freertos/task.h"     // header needed to use __LINE__ and portTICK_PERIOD_MS
+#include "freertos/queue.h"    // header needed to receive the button events from a queue
 #include "driver/gpio.h"       // header needed to interface with ESP32 GPIO pins
 #include "esp_err.h"           // header needed to use any macro and functions related to esp errors
 #include "esp_log.h"           // header needed to use any macro and functions related to esp logging
+#include "rotary_encoder.h"    // header needed to decode the encoder, see components/rotary_encoder
+#include "button_debounce.h"   // header needed to debounce the button, see ../3_push_button_with_isr/components/button_debounce
+
+#define ENCODER_BACKEND ROTARY_ENCODER_BACKEND_PCNT // use ROTARY_ENCODER_BACKEND_GPIO to decode with GPIO interrupts instead of the pulse counter
+#define ENCODER_EVENT_QUEUE_LEN 16                 // rotations buffered until the encoder task reads them, must be a power of 2
+#define ENCODER_GLITCH_FILTER_NS 1000              // pulses shorter than this are contact bounce, only used by the pulse counter
+#define ENCODER_TASK_STACK_SIZE (3 * 1024)         // stack of the task printing the rotations
+#define ENCODER_TASK_PRIORITY 5                    // priority of the task printing the rotations
+#define BUTTON_DEBOUNCE_MS 20                      // bounces after the first edge are ignored for this long, it is also the longest delay of an event
+#define BUTTON_LONG_PRESS_MS 800                   // hold time of a long press
+#define BUTTON_DOUBLE_CLICK_MS 300                 // longest release between the two clicks of a double click
+#define BUTTON_EVENT_QUEUE_LEN 8                   // button events buffered until app_main reads them
 
 static const char *ERROR_TAG = "intro_to_rotary_encoder_app";
-volatile unsigned int button_push_count = 0; // variable to count button push
-volatile unsigned int encoder_counter = 0; // variable to count encoder push
 
-void ISR_handler_for_gpio8(void *arg); // function prototype for ISR
-void ISR_handler_for_gpio10(void *arg); // function prototype for ISR
+void encoder_task(void *arg); // function prototype for the task printing the rotations
 
 void app_main(void)
 {
     esp_err_t return_check;
-    int previous_encoder_counter = 0;
+    rotary_encoder_handle_t encoder = NULL;
 
 
-    return_check = gpio_reset_pin(GPIO_NUM_10);  
-    if (return_check!=ESP_OK) {
-        ESP_LOGI(ERROR_TAG, "Error resetting GPIO pin 10 at line %d of app_main() error id: %d", __LINE__, return_check);
-    }
     return_check = gpio_reset_pin(GPIO_NUM_8);  
     if (return_check!=ESP_OK) {
         ESP_LOGI(ERROR_TAG, "Error resetting GPIO pin 8 at line %d of app_main() error id: %d", __LINE__, return_check);
     }
-    return_check = gpio_reset_pin(GPIO_NUM_11);  
-    if (return_check!=ESP_OK) {
-        ESP_LOGI(ERROR_TAG, "Error resetting GPIO pin 11 at line %d of app_main() error id: %d", __LINE__, return_check);
-    }
-
-    gpio_config_t io_conf = {0};
-    io_conf.pin_bit_mask = (1ULL << GPIO_NUM_8);   // Configure GPIO8
-    io_conf.mode = GPIO_MODE_INPUT;                // Set as input
-    io_conf.pull_up_en = GPIO_PULLUP_ENABLE;       // Enable internal pull-up
-    io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;  // Disable pull-down
-    io_conf.intr_type = GPIO_INTR_POSEDGE;         // Set interrupt type to positive edge
 
-    return_check = gpio_config(&io_conf);
+    // the debounce component configures GPIO 8, timestamps its edges in its ISR and sends clean events to this queue
+    QueueHandle_t button_event_queue = xQueueCreate(BUTTON_EVENT_QUEUE_LEN, sizeof(button_debounce_event_t));
+    button_debounce_handle_t button = NULL;
+    button_debounce_config_t button_config = {
+        .gpio_num = GPIO_NUM_8,                    // SW pin of the encoder
+        .active_level = 0,                         // the button connects the pin to ground
+        .enable_internal_pull = true,              // Enable internal pull-up
+        .debounce_ms = BUTTON_DEBOUNCE_MS,
+        .long_press_ms = BUTTON_LONG_PRESS_MS,
+        .double_click_ms = BUTTON_DOUBLE_CLICK_MS,
+        .event_queue = button_event_queue,
+    };
+    return_check = button_debounce_new(&button_config, &button);
     if (return_check!=ESP_OK) {
-        ESP_LOGI(ERROR_TAG, "Error configuring GPIO 8 at line %d of app_main() error id: %d", __LINE__, return_check);
+        ESP_LOGI(ERROR_TAG, "Error creating the debounced button on GPIO 8 at line %d of app_main() error id: %d", __LINE__, return_check);
     }
 
-    io_conf.pin_bit_mask = (1ULL << GPIO_NUM_10);   // Configure GPIO11
-    io_conf.intr_type = GPIO_INTR_ANYEDGE;         // Set interrupt type to any edge
-
-    return_check = gpio_config(&io_conf);
-    if (return_check!=ESP_OK) {
-        ESP_LOGI(ERROR_TAG, "Error configuring GPIO 10 at line %d of app_main() error id: %d", __LINE__, return_check);
-    }
-    return_check = gpio_set_direction(GPIO_NUM_11, GPIO_MODE_INPUT);
-    if (return_check!=ESP_OK) {
-        ESP_LOGI(ERROR_TAG, "Error setting GPIO pin 11 to input at line %d of app_main() error id: %d", __LINE__, return_check);
-    }
-    return_check = gpio_pullup_en(GPIO_NUM_11);
+    // the encoder component configures GPIO 10 and 11 and decodes the rotation in its own ISR
+    rotary_encoder_config_t encoder_config = {
+        .pin_a = GPIO_NUM_10,                          // CLK or A pin
+        .pin_b = GPIO_NUM_11,                          // DT or B pin
+        .backend = ENCODER_BACKEND,                    // pulse counter or GPIO interrupts
+        .event_queue_len = ENCODER_EVENT_QUEUE_LEN,    // size of the event ring
+        .glitch_filter_ns = ENCODER_GLITCH_FILTER_NS,  // hardware debounce of the pulse counter
+    };
+    return_check = rotary_encoder_new(&encoder_config, &encoder);
     if (return_check!=ESP_OK) {
-        ESP_LOGI(ERROR_TAG, "Error pulling up GPIO pin 11 at line %d of app_main() error id: %d", __LINE__, return_check);
+        ESP_LOGI(ERROR_TAG, "Error creating the rotary encoder at line %d of app_main() error id: %d", __LINE__, return_check);
+    } else {
+        // the rotations are printed by their own task, so app_main only has to wait for the button
+        xTaskCreate(encoder_task, "encoder_task", ENCODER_TASK_STACK_SIZE, encoder, ENCODER_TASK_PRIORITY, NULL);
     }
-    
-    // assign ISR to GPIO pin 8
-    gpio_install_isr_service(0); // install ISR service for all GPIO pins and use default config
-    gpio_isr_handler_add(GPIO_NUM_8, ISR_handler_for_gpio8, (void *) GPIO_NUM_8); // add ISR handler for GPIO pin 8; (void *) GPIO_NUM_8 is optional
-    gpio_isr_handler_add(GPIO_NUM_10, ISR_handler_for_gpio10, (void *) GPIO_NUM_10); // add ISR handler for GPIO pin 10; (void *) GPIO_NUM_10 is optional
-    
-    int loop_value = 0; // variable to count loop
+
     int button_loop_print_count = 0; // variable to count button push
-    int encoder_loop_print_count = 0; // variable to count encoder pin state change
+    button_debounce_event_t button_event; // event received from the debounce component
 
     while (1) {
-        loop_value++;
-        // printf("Reading the button state and encoder pins A and B: Loop value: %d button push count: %d\n", loop_value, button_push_count);
-        if (button_push_count > 0) {
+        // sleep until the button does something, no delay is needed to debounce or to avoid over-running
+        xQueueReceive(button_event_queue, &button_event, portMAX_DELAY);
+        switch (button_event.type) {
+        case BUTTON_DEBOUNCE_EVENT_PRESS:
             printf("----------\n");
             printf("Button is pressed; toggling LED state. Button print count: %d\n", button_loop_print_count);
             button_loop_print_count++;
-            button_push_count = 0; // reset button push count to 0
-            vTaskDelay(50/portTICK_PERIOD_MS); // delay to debounce button
-        }
-
-        if (encoder_counter > previous_encoder_counter) {
+            break;
+        case BUTTON_DEBOUNCE_EVENT_LONG_PRESS:
             printf("----------\n");
-            printf("Encoder clockwise rotation detected. Encoder counter: %d\n", encoder_counter);
-            previous_encoder_counter = encoder_counter;
-        }
-        else if (encoder_counter < previous_encoder_counter) {
+            printf("Button is long pressed\n");
+            break;
+        case BUTTON_DEBOUNCE_EVENT_DOUBLE_CLICK:
             printf("----------\n");
-            printf("Encoder anti-clockwise rotation detected. Encoder counter: %d\n", encoder_counter);
-            previous_encoder_counter = encoder_counter;
+            printf("Button is double clicked\n");
+            break;
+        default:
+            break; // releases are not printed
         }
-        vTaskDelay(100/portTICK_PERIOD_MS); // delay to avoid over-running
     }
 }
 
-void ISR_handler_for_gpio8(void *arg)
+void encoder_task(void *arg)
 {
-    button_push_count++;
-}
+    rotary_encoder_handle_t encoder = arg;
+    rotary_encoder_event_t encoder_event;
+    int64_t previous_event_time_us = 0;
 
-void ISR_handler_for_gpio10(void *arg)
-{
-    if (gpio_get_level(GPIO_NUM_10) == 0 && gpio_get_level(GPIO_NUM_11) == 0) {
-        encoder_counter--;
-    } else if (gpio_get_level(GPIO_NUM_10) == 1 && gpio_get_level(GPIO_NUM_11) == 1) {
-        encoder_counter--;
-    } else if (gpio_get_level(GPIO_NUM_10) == 0 && gpio_get_level(GPIO_NUM_11) == 1) {
-        encoder_counter++;
-    } else if (gpio_get_level(GPIO_NUM_10) == 1 && gpio_get_level(GPIO_NUM_11) == 0) {
-        encoder_counter++;
+    while (1) {
+        // block until the encoder is rotated
+        if (rotary_encoder_wait_event(encoder, &encoder_event, portMAX_DELAY) != ESP_OK) {
+            continue;
+        }
+        printf("----------\n");
+        printf("Encoder %s rotation detected. Detents: %" PRId32 " Encoder position: %" PRId32 " Time since last rotation: %" PRId64 " ms\n",
+               encoder_event.delta > 0 ? "clockwise" : "anti-clockwise", encoder_event.delta,
+               rotary_encoder_get_position(encoder), (encoder_event.time_us - previous_event_time_us) / 1000);
+        previous_event_time_us = encoder_event.time_us;
     }
 }
-
@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <string.h>
+#include <time.h>
+#include "fake_panel_io.h"
+
+static esp_err_t fake_panel_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size);
+static esp_err_t fake_panel_io_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size);
+
+void fake_panel_io_init(fake_panel_io_t *io, oled_delta_controller_t controller)
+{
+    memset(io, 0, sizeof(*io));
+    io->base.tx_param = fake_panel_io_tx_param;
+    io->base.tx_color = fake_panel_io_tx_color;
+    io->controller = controller;
+    io->fail_after_runs = -1;
+}
+
+void fake_panel_io_clear_log(fake_panel_io_t *io)
+{
+    io->run_cnt = 0;
+    io->cmd_bytes = 0;
+    io->data_bytes = 0;
+}
+
+static esp_err_t fake_panel_io_tx_param(esp_lcd_panel_io_t *base, int lcd_cmd, const void *param, size_t param_size)
+{
+    fake_panel_io_t *io = (fake_panel_io_t *)base;
+    const uint8_t *p = param;
+
+    io->cmd_bytes += 1 + param_size;
+
+    if (io->controller == OLED_DELTA_CONTROLLER_SH1107) {
+        // The control byte comes as the command, every parameter is a command of the controller
+        if (lcd_cmd != 0x00) {
+            io->protocol_error = true;
+        }
+        for (size_t i = 0; i < param_size; i++) {
+            if ((p[i] & 0xF0) == 0xB0) {
+                io->page = p[i] & 0x0F;
+            } else if ((p[i] & 0xF8) == 0x10) {
+                io->col = (io->col & 0x0F) | ((p[i] & 0x07) << 4);
+            } else if ((p[i] & 0xF0) == 0x00) {
+                io->col = (io->col & 0x70) | (p[i] & 0x0F);
+            } else {
+                io->protocol_error = true;
+            }
+        }
+    } else {
+        // Column range with the page range chained in its parameters
+        if (lcd_cmd != 0x21 || param_size != 5 || p[2] != 0x22 || p[3] != p[4] || p[0] > p[1]) {
+            io->protocol_error = true;
+            return ESP_OK;
+        }
+        io->col = p[0];
+        io->col_last = p[1];
+        io->page = p[3];
+    }
+    return ESP_OK;
+}
+
+static esp_err_t fake_panel_io_tx_color(esp_lcd_panel_io_t *base, int lcd_cmd, const void *color, size_t color_size)
+{
+    fake_panel_io_t *io = (fake_panel_io_t *)base;
+
+    if (io->fail_after_runs == 0) {
+        return ESP_FAIL;
+    }
+    if (io->fail_after_runs > 0) {
+        io->fail_after_runs--;
+    }
+
+    if (io->controller == OLED_DELTA_CONTROLLER_SH1107) {
+        if (lcd_cmd != 0x40) {
+            io->protocol_error = true;
+        }
+    } else {
+        // One page is addressed, a longer transfer would wrap to the start of the window
+        if (lcd_cmd != -1 || (int)color_size != io->col_last - io->col + 1) {
+            io->protocol_error = true;
+        }
+    }
+    if (io->page >= FAKE_PANEL_IO_PAGES || io->col + color_size > FAKE_PANEL_IO_COLUMNS) {
+        io->protocol_error = true;
+        return ESP_OK;
+    }
+
+    memcpy(&io->gddram[io->page][io->col], color, color_size);
+    if (io->run_cnt < FAKE_PANEL_IO_MAX_RUNS) {
+        io->runs[io->run_cnt] = (fake_panel_io_run_t) {
+            .page = io->page,
+            .col = io->col,
+            .len = color_size,
+            .data = color,
+        };
+    }
+    io->run_cnt++;
+    io->data_bytes += color_size;
+
+    if (io->tx_delay_us) {
+        // The bytes are on the bus until the transaction returns, the sender must not touch them
+        struct timespec ts = {
+            .tv_sec = io->tx_delay_us / 1000000,
+            .tv_nsec = (io->tx_delay_us % 1000000) * 1000L,
+        };
+        nanosleep(&ts, NULL);
+        if (memcmp(&io->gddram[io->page][io->col], color, color_size) != 0) {
+            io->buffer_modified = true;
+        }
+    }
+
+    io->col += color_size;
+    return ESP_OK;
+}
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_lcd_panel_io.h"
+#include "oled_delta.h"
+
+#define FAKE_PANEL_IO_COLUMNS  128
+#define FAKE_PANEL_IO_PAGES    16
+#define FAKE_PANEL_IO_MAX_RUNS 256
+
+/**
+ * @brief A data transaction, i.e. one column run
+ */
+typedef struct {
+    int page; /*!< Page the run was written to */
+    int col;  /*!< First column in the controller RAM */
+    int len;  /*!< Number of bytes */
+    const uint8_t *data; /*!< Buffer the bytes were sent from */
+} fake_panel_io_run_t;
+
+/**
+ * @brief Panel IO which decodes the address commands of the controller and keeps a copy of its GDDRAM
+ */
+typedef struct {
+    esp_lcd_panel_io_t base;
+    oled_delta_controller_t controller;
+    uint8_t gddram[FAKE_PANEL_IO_PAGES][FAKE_PANEL_IO_COLUMNS];
+    int page;                 /*!< Address set by the last command transaction */
+    int col;
+    int col_last;             /*!< End of the SSD1306 column window */
+    fake_panel_io_run_t runs[FAKE_PANEL_IO_MAX_RUNS];
+    int run_cnt;              /*!< Runs since the last `fake_panel_io_clear_log` */
+    uint32_t cmd_bytes;       /*!< Command and parameter bytes since the last `fake_panel_io_clear_log` */
+    uint32_t data_bytes;      /*!< GDDRAM bytes since the last `fake_panel_io_clear_log` */
+    int fail_after_runs;      /*!< The data transaction fails after this many runs, -1 never */
+    uint32_t tx_delay_us;     /*!< A data transaction returns only after this long, like a slow bus */
+    bool protocol_error;      /*!< A transaction did not match what the controller expects */
+    bool buffer_modified;     /*!< The data of a transaction changed before the transaction returned */
+} fake_panel_io_t;
+
+/**
+ * @brief Initialize the fake panel IO with an all-zero GDDRAM
+ *
+ * @param[out] io Fake panel IO
+ * @param[in] controller Controller whose command set is decoded
+ */
+void fake_panel_io_init(fake_panel_io_t *io, oled_delta_controller_t controller);
+
+/**
+ * @brief Forget the recorded runs and byte counters, the GDDRAM is kept
+ *
+ * @param[in,out] io Fake panel IO
+ */
+void fake_panel_io_clear_log(fake_panel_io_t *io);
@@ -0,0 +1,19 @@
+/**
+ * @file lv_conf.h
+ * Configuration of LVGL for the host tests, the display setup of the example with the C library.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH              16
+
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+
+#define LV_USE_LOG                  0
+
+#define LV_DRAW_SW_SUPPORT_I1       1
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,28 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+// Host stand-in of the ESP-IDF header, a panel IO is a table of the transmit functions like in esp_lcd_io_interface.h
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+
+typedef struct esp_lcd_panel_io_t esp_lcd_panel_io_t;
+typedef esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t;
+
+struct esp_lcd_panel_io_t {
+    esp_err_t (*tx_param)(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size);
+    esp_err_t (*tx_color)(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size);
+};
+
+static inline esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size)
+{
+    return io->tx_param(io, lcd_cmd, param, param_size);
+}
+
+static inline esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color, size_t color_size)
+{
+    return io->tx_color(io, lcd_cmd, color, color_size);
+}
@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+// Host stand-in of the FreeRTOS header, tasks are pthreads and a tick is 1 ms, see freertos_shim.c
+#pragma once
+
+#include <stdint.h>
+#include <pthread.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE             0
+#define pdTRUE              1
+#define pdPASS              pdTRUE
+#define pdFAIL              pdFALSE
+#define portMAX_DELAY       ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS  1
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+
+// A critical section only has to exclude the other threads
+typedef pthread_mutex_t portMUX_TYPE;
+
+#define portMUX_INITIALIZE(mux)     pthread_mutex_init(mux, NULL)
+#define portENTER_CRITICAL(mux)     pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL(mux)      pthread_mutex_unlock(mux)
+#define portENTER_CRITICAL_ISR(mux) pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL_ISR(mux)  pthread_mutex_unlock(mux)
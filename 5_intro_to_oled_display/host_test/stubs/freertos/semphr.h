@@ -0,0 +1,16 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+// Host stand-in of the FreeRTOS header, a binary semaphore is a queue of one item without data like in FreeRTOS
+#pragma once
+
+#include "freertos/queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+
+#define xSemaphoreCreateBinary()            xQueueCreate(1, 0)
+#define xSemaphoreGive(sem)                 xQueueSend(sem, NULL, 0)
+#define xSemaphoreTake(sem, ticks_to_wait)  xQueueReceive(sem, NULL, ticks_to_wait)
+#define vSemaphoreDelete(sem)               vQueueDelete(sem)
@@ -0,0 +1,378 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+// Host test of the delta stage: the fake panel IO decodes the address commands, so the runs on the bus
+// and the resulting GDDRAM can be checked against the frames
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fake_panel_io.h"
+#include "oled_delta.h"
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define SSD1306_H_RES 128
+#define SSD1306_V_RES 64
+#define SH1107_H_RES  64
+#define SH1107_V_RES  128
+#define SH1107_X_GAP  32
+
+typedef struct {
+    fake_panel_io_t io;
+    oled_delta_handle_t delta;
+    int h_res;
+    int pages;
+    int x_gap;
+    uint8_t frame[FAKE_PANEL_IO_PAGES][FAKE_PANEL_IO_COLUMNS]; // stride is FAKE_PANEL_IO_COLUMNS
+} fixture_t;
+
+static void fixture_init(fixture_t *f, oled_delta_controller_t controller, int h_res, int v_res, int x_gap)
+{
+    memset(f, 0, sizeof(*f));
+    fake_panel_io_init(&f->io, controller);
+    f->h_res = h_res;
+    f->pages = v_res / 8;
+    f->x_gap = x_gap;
+
+    oled_delta_config_t config = {
+        .controller = controller,
+        .h_res = h_res,
+        .v_res = v_res,
+        .x_gap = x_gap,
+    };
+    CHECK(oled_delta_new(&f->io.base, &config, &f->delta) == ESP_OK);
+}
+
+static void fixture_deinit(fixture_t *f)
+{
+    CHECK(oled_delta_del(f->delta) == ESP_OK);
+}
+
+static void set_pixel(fixture_t *f, int x, int y, bool on)
+{
+    if (on) {
+        f->frame[y / 8][x] |= 1 << (y % 8);
+    } else {
+        f->frame[y / 8][x] &= ~(1 << (y % 8));
+    }
+}
+
+static void fill_pattern(fixture_t *f, unsigned seed)
+{
+    srand(seed);
+    for (int page = 0; page < f->pages; page++) {
+        for (int x = 0; x < f->h_res; x++) {
+            f->frame[page][x] = rand();
+        }
+    }
+}
+
+// Flush the whole frame and return the number of runs it took
+static int flush_full(fixture_t *f)
+{
+    fake_panel_io_clear_log(&f->io);
+    CHECK(oled_delta_flush(f->delta, 0, 0, f->h_res, f->pages * 8, &f->frame[0][0], FAKE_PANEL_IO_COLUMNS) == ESP_OK);
+    CHECK(!f->io.protocol_error);
+    return f->io.run_cnt;
+}
+
+static void check_run(const fixture_t *f, int index, int page, int x, int len)
+{
+    CHECK(index < f->io.run_cnt);
+    CHECK(f->io.runs[index].page == page);
+    CHECK(f->io.runs[index].col == x + f->x_gap);
+    CHECK(f->io.runs[index].len == len);
+}
+
+// The panel shows the frame
+static void check_gddram(const fixture_t *f)
+{
+    for (int page = 0; page < f->pages; page++) {
+        CHECK(memcmp(&f->io.gddram[page][f->x_gap], f->frame[page], f->h_res) == 0);
+    }
+}
+
+// The counters of the stage agree with what the panel IO received
+static void check_stats(const fixture_t *f, uint32_t cmd_bytes, uint32_t data_bytes)
+{
+    oled_delta_stats_t stats;
+    oled_delta_get_stats(f->delta, &stats);
+    CHECK(stats.cmd_bytes == cmd_bytes);
+    CHECK(stats.data_bytes == data_bytes);
+}
+
+static void test_ssd1306_no_change(void)
+{
+    fixture_t f;
+    fixture_init(&f, OLED_DELTA_CONTROLLER_SSD1306, SSD1306_H_RES, SSD1306_V_RES, 0);
+
+    // The content of the panel is unknown, so the first frame is sent whole, one run per page
+    fill_pattern(&f, 1);
+    CHECK(flush_full(&f) == f.pages);
+    for (int page = 0; page < f.pages; page++) {
+        check_run(&f, page, page, 0, f.h_res);
+    }
+    CHECK(f.io.data_bytes == SSD1306_H_RES * SSD1306_V_RES / 8);
+    CHECK(f.io.cmd_bytes == (uint32_t)f.pages * 6);
+    check_gddram(&f);
+    check_stats(&f, f.io.cmd_bytes, f.io.data_bytes);
+
+    // Nothing changed, nothing is sent
+    CHECK(flush_full(&f) == 0);
+    CHECK(f.io.cmd_bytes == 0 && f.io.data_bytes == 0);
+
+    oled_delta_stats_t stats;
+    oled_delta_get_stats(f.delta, &stats);
+    CHECK(stats.flushes == 2);
+    CHECK(stats.runs == (uint32_t)f.pages);
+
+    fixture_deinit(&f);
+}
+
+static void test_ssd1306_single_pixel(void)
+{
+    fixture_t f;
+    fixture_init(&f, OLED_DELTA_CONTROLLER_SSD1306, SSD1306_H_RES, SSD1306_V_RES, 0);
+    flush_full(&f);
+
+    set_pixel(&f, 37, 21, true);
+    CHECK(flush_full(&f) == 1);
+    check_run(&f, 0, 2, 37, 1);
+    CHECK(f.io.cmd_bytes == 6 && f.io.data_bytes == 1);
+    check_gddram(&f);
+
+    // Clearing it again sends the same column
+    set_pixel(&f, 37, 21, false);
+    CHECK(flush_full(&f) == 1);
+    check_run(&f, 0, 2, 37, 1);
+    check_gddram(&f);
+
+    // The first and the last column
+    set_pixel(&f, 0, 0, true);
+    set_pixel(&f, SSD1306_H_RES - 1, SSD1306_V_RES - 1, true);
+    CHECK(flush_full(&f) == 2);
+    check_run(&f, 0, 0, 0, 1);
+    check_run(&f, 1, f.pages - 1, SSD1306_H_RES - 1, 1);
+    check_gddram(&f);
+
+    fixture_deinit(&f);
+}
+
+static void test_ssd1306_merge(void)
+{
+    fixture_t f;
+    fixture_init(&f, OLED_DELTA_CONTROLLER_SSD1306, SSD1306_H_RES, SSD1306_V_RES, 0);
+    flush_full(&f);
+
+    // 9 unchanged columns are cheaper to resend than a new address transaction
+    set_pixel(&f, 10, 3, true);
+    set_pixel(&f, 20, 3, true);
+    CHECK(flush_full(&f) == 1);
+    check_run(&f, 0, 0, 10, 11);
+    check_gddram(&f);
+
+    // 10 are not
+    set_pixel(&f, 40, 3, true);
+    set_pixel(&f, 51, 3, true);
+    CHECK(flush_full(&f) == 2);
+    check_run(&f, 0, 0, 40, 1);
+    check_run(&f, 1, 0, 51, 1);
+    check_gddram(&f);
+
+    fixture_deinit(&f);
+}
+
+static void test_ssd1306_page_boundary(void)
+{
+    fixture_t f;
+    fixture_init(&f, OLED_DELTA_CONTROLLER_SSD1306, SSD1306_H_RES, SSD1306_V_RES, 0);
+    flush_full(&f);
+
+    // Two vertically adjacent pixels on both sides of a page boundary
+    set_pixel(&f, 50, 7, true);
+    set_pixel(&f, 50, 8, true);
+    CHECK(flush_full(&f) == 2);
+    check_run(&f, 0, 0, 50, 1);
+    check_run(&f, 1, 1, 50, 1);
+    check_gddram(&f);
+
+    // The end of a page and the start of the next one are not merged
+    set_pixel(&f, SSD1306_H_RES - 1, 15, true);
+    set_pixel(&f, 0, 16, true);
+    CHECK(flush_full(&f) == 2);
+    check_run(&f, 0, 1, SSD1306_H_RES - 1, 1);
+    check_run(&f, 1, 2, 0, 1);
+    check_gddram(&f);
+
+    // A run up to the last column
+    for (int x = 120; x < SSD1306_H_RES; x++) {
+        set_pixel(&f, x, 60, true);
+    }
+    CHECK(flush_full(&f) == 1);
+    check_run(&f, 0, 7, 120, 8);
+    check_gddram(&f);
+
+    fixture_deinit(&f);
+}
+
+static void test_ssd1306_invalidate(void)
+{
+    fixture_t f;
+    fixture_init(&f, OLED_DELTA_CONTROLLER_SSD1306, SSD1306_H_RES, SSD1306_V_RES, 0);
+    fill_pattern(&f, 2);
+    flush_full(&f);
+    CHECK(flush_full(&f) == 0);
+
+    // E.g. the panel was reset: the same frame is sent whole again
+    memset(f.io.gddram, 0, sizeof(f.io.gddram));
+    oled_delta_invalidate(f.delta);
+    CHECK(flush_full(&f) == f.pages);
+    CHECK(f.io.data_bytes == SSD1306_H_RES * SSD1306_V_RES / 8);
+    check_gddram(&f);
+
+    CHECK(flush_full(&f) == 0);
+
+    fixture_deinit(&f);
+}
+
+static void test_ssd1306_partial_area(void)
+{
+    fixture_t f;
+    fixture_init(&f, OLED_DELTA_CONTROLLER_SSD1306, SSD1306_H_RES, SSD1306_V_RES, 0);
+    fill_pattern(&f, 3);
+
+    // The area is in its own buffer, pages 1 and 2, columns 16..47
+    uint8_t area[2][32];
+    memcpy(area[0], &f.frame[1][16], 32);
+    memcpy(area[1], &f.frame[2][16], 32);
+
+    // A partial flush does not make the page known, it is sent whole every time
+    for (int i = 0; i < 2; i++) {
+        fake_panel_io_clear_log(&f.io);
+        CHECK(oled_delta_flush(f.delta, 16, 8, 48, 24, &area[0][0], 32) == ESP_OK);
+        CHECK(f.io.run_cnt == 2);
+        check_run(&f, 0, 1, 16, 32);
+        check_run(&f, 1, 2, 16, 32);
+    }
+
+    // After a full flush only the changes are sent
+    flush_full(&f);
+    area[1][5] ^= 0x10;
+    f.frame[2][21] ^= 0x10;
+    fake_panel_io_clear_log(&f.io);
+    CHECK(oled_delta_flush(f.delta, 16, 8, 48, 24, &area[0][0], 32) == ESP_OK);
+    CHECK(f.io.run_cnt == 1);
+    check_run(&f, 0, 2, 21, 1);
+    check_gddram(&f);
+
+    fixture_deinit(&f);
+}
+
+static void test_ssd1306_io_error(void)
+{
+    fixture_t f;
+    fixture_init(&f, OLED_DELTA_CONTROLLER_SSD1306, SSD1306_H_RES, SSD1306_V_RES, 0);
+    flush_full(&f);
+
+    set_pixel(&f, 5, 30, true);
+    set_pixel(&f, 100, 30, true);
+    fake_panel_io_clear_log(&f.io);
+    f.io.fail_after_runs = 1;
+    CHECK(oled_delta_flush(f.delta, 0, 0, f.h_res, f.pages * 8, &f.frame[0][0], FAKE_PANEL_IO_COLUMNS) == ESP_FAIL);
+    CHECK(f.io.run_cnt == 1);
+
+    // The page is not trusted anymore, it is sent whole
+    f.io.fail_after_runs = -1;
+    CHECK(flush_full(&f) == 1);
+    check_run(&f, 0, 3, 0, SSD1306_H_RES);
+    check_gddram(&f);
+
+    fixture_deinit(&f);
+}
+
+static void test_sh1107(void)
+{
+    fixture_t f;
+    fixture_init(&f, OLED_DELTA_CONTROLLER_SH1107, SH1107_H_RES, SH1107_V_RES, SH1107_X_GAP);
+
+    fill_pattern(&f, 4);
+    CHECK(flush_full(&f) == f.pages);
+    for (int page = 0; page < f.pages; page++) {
+        check_run(&f, page, page, 0, f.h_res);
+    }
+    CHECK(f.io.cmd_bytes == (uint32_t)f.pages * 4);
+    check_gddram(&f);
+    CHECK(flush_full(&f) == 0);
+
+    set_pixel(&f, 5, 100, !(f.frame[12][5] & (1 << 4)));
+    CHECK(flush_full(&f) == 1);
+    check_run(&f, 0, 12, 5, 1);
+    CHECK(f.io.cmd_bytes == 4 && f.io.data_bytes == 1);
+    check_gddram(&f);
+
+    // The address transaction is shorter, so runs are merged over fewer columns
+    f.frame[0][10] ^= 1;
+    f.frame[0][17] ^= 1;
+    f.frame[1][10] ^= 1;
+    f.frame[1][18] ^= 1;
+    CHECK(flush_full(&f) == 3);
+    check_run(&f, 0, 0, 10, 8);
+    check_run(&f, 1, 1, 10, 1);
+    check_run(&f, 2, 1, 18, 1);
+    check_gddram(&f);
+
+    oled_delta_stats_t stats;
+    oled_delta_get_stats(f.delta, &stats);
+    CHECK(stats.runs == (uint32_t)f.pages + 4);
+
+    fixture_deinit(&f);
+}
+
+static void test_invalid_args(void)
+{
+    fake_panel_io_t io;
+    oled_delta_handle_t delta;
+    uint8_t buf[16] = {0};
+    oled_delta_config_t config = {
+        .controller = OLED_DELTA_CONTROLLER_SSD1306,
+        .h_res = 16,
+        .v_res = 12,
+    };
+    fake_panel_io_init(&io, OLED_DELTA_CONTROLLER_SSD1306);
+
+    CHECK(oled_delta_new(&io.base, &config, &delta) == ESP_ERR_INVALID_ARG);
+    config.v_res = 8;
+    CHECK(oled_delta_new(NULL, &config, &delta) == ESP_ERR_INVALID_ARG);
+    CHECK(oled_delta_new(&io.base, &config, &delta) == ESP_OK);
+
+    CHECK(oled_delta_flush(delta, 0, 0, 17, 8, buf, 16) == ESP_ERR_INVALID_ARG);
+    CHECK(oled_delta_flush(delta, 0, 0, 16, 16, buf, 16) == ESP_ERR_INVALID_ARG);
+    CHECK(oled_delta_flush(delta, 4, 0, 4, 8, buf, 16) == ESP_ERR_INVALID_ARG);
+    CHECK(oled_delta_flush(delta, 0, 0, 16, 8, NULL, 16) == ESP_ERR_INVALID_ARG);
+    CHECK(io.run_cnt == 0);
+
+    CHECK(oled_delta_del(delta) == ESP_OK);
+}
+
+int main(void)
+{
+    test_ssd1306_no_change();
+    test_ssd1306_single_pixel();
+    test_ssd1306_merge();
+    test_ssd1306_page_boundary();
+    test_ssd1306_invalidate();
+    test_ssd1306_partial_area();
+    test_ssd1306_io_error();
+    test_sh1107();
+    test_invalid_args();
+    printf("oled_delta: all tests passed\n");
+    return 0;
+}
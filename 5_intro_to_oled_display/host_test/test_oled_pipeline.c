@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+// Host test of the flush pipeline: LVGL renders into two buffers while the transfer task sends
+// the previous frame to a fake panel IO which holds every data transaction for a while
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "fake_panel_io.h"
+#include "oled_delta.h"
+#include "oled_pipeline.h"
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define H_RES         128
+#define V_RES         64
+#define PAGES         (V_RES / 8)
+#define BUF_SIZE      (H_RES * V_RES / 8)
+#define TX_DELAY_US   2000
+#define FRAME_TX_US   (PAGES * TX_DELAY_US) // A full-screen change is one run per page
+#define FRAME_CNT     8
+
+static fake_panel_io_t io;
+static uint8_t buf1[BUF_SIZE];
+static uint8_t buf2[BUF_SIZE];
+
+// Buffer of each flushed frame, in flush order
+static const uint8_t *flushed_bufs[FRAME_CNT];
+static int flushed_cnt;
+
+static uint32_t tick_get_cb(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+static void flush_start_cb(lv_event_t *e)
+{
+    lv_display_t *disp = lv_event_get_target(e);
+    // Sent right before the flush callback, the buffers are swapped after it
+    CHECK(flushed_cnt < FRAME_CNT);
+    flushed_bufs[flushed_cnt++] = lv_display_get_buf_active(disp)->data;
+}
+
+static const uint8_t *buf_of(const uint8_t *data)
+{
+    if (data >= buf1 && data < buf1 + BUF_SIZE) {
+        return buf1;
+    }
+    if (data >= buf2 && data < buf2 + BUF_SIZE) {
+        return buf2;
+    }
+    return NULL;
+}
+
+// Wait until the transfer task sent every frame, the statistics are summed up meanwhile
+static void wait_for_frames(oled_pipeline_handle_t pipeline, oled_pipeline_stats_t *sum)
+{
+    memset(sum, 0, sizeof(*sum));
+    for (int i = 0; i < 1000 && sum->frames < FRAME_CNT; i++) {
+        oled_pipeline_stats_t stats;
+        vTaskDelay(pdMS_TO_TICKS(2));
+        oled_pipeline_get_stats(pipeline, &stats);
+        sum->frames += stats.frames;
+        sum->overlapped_frames += stats.overlapped_frames;
+        sum->wait_max_us = LV_MAX(sum->wait_max_us, stats.wait_max_us);
+        sum->transfer_max_us = LV_MAX(sum->transfer_max_us, stats.transfer_max_us);
+    }
+}
+
+int main(void)
+{
+    fake_panel_io_init(&io, OLED_DELTA_CONTROLLER_SSD1306);
+    io.tx_delay_us = TX_DELAY_US;
+
+    oled_delta_handle_t delta = NULL;
+    oled_delta_config_t delta_config = {
+        .controller = OLED_DELTA_CONTROLLER_SSD1306,
+        .h_res = H_RES,
+        .v_res = V_RES,
+    };
+    CHECK(oled_delta_new(&io.base, &delta_config, &delta) == ESP_OK);
+
+    lv_init();
+    lv_tick_set_cb(tick_get_cb);
+    lv_display_t *disp = lv_display_create(H_RES, V_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_I1_PAGE);
+    lv_display_set_buffers(disp, buf1, buf2, BUF_SIZE, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_add_event_cb(disp, flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+
+    oled_pipeline_handle_t pipeline = NULL;
+    oled_pipeline_config_t pipeline_config = {
+        .task_priority = 3,
+        .task_stack_size = 4096,
+    };
+    CHECK(oled_pipeline_new(disp, delta, &pipeline_config, &pipeline) == ESP_OK);
+
+    // Every frame changes every pixel, so every frame is on the bus for FRAME_TX_US
+    lv_obj_t *scr = lv_screen_active();
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    int64_t refr_us[FRAME_CNT];
+    for (int i = 0; i < FRAME_CNT; i++) {
+        lv_obj_set_style_bg_color(scr, i % 2 ? lv_color_black() : lv_color_white(), 0);
+        int64_t start_us = esp_timer_get_time();
+        lv_refr_now(disp);
+        refr_us[i] = esp_timer_get_time() - start_us;
+    }
+
+    oled_pipeline_stats_t stats;
+    wait_for_frames(pipeline, &stats);
+    CHECK(stats.frames == FRAME_CNT);
+    CHECK(flushed_cnt == FRAME_CNT);
+
+    // The first frame was only queued, LVGL did not wait for the bus
+    CHECK(refr_us[0] < FRAME_TX_US / 2);
+
+    // Every later frame was rendered while the previous one was on the bus
+    CHECK(stats.overlapped_frames == FRAME_CNT - 1);
+    CHECK(stats.transfer_max_us >= FRAME_TX_US);
+
+    // Double buffering: the frames alternate between the two buffers
+    for (int i = 0; i < FRAME_CNT; i++) {
+        CHECK(flushed_bufs[i] == (i % 2 ? buf2 : buf1));
+    }
+    // and each frame was sent from the buffer it was rendered into, in order
+    int frame = 0;
+    CHECK(io.run_cnt == FRAME_CNT * PAGES);
+    for (int i = 0; i < io.run_cnt; i++) {
+        CHECK(io.runs[i].len == H_RES);
+        if (i > 0 && buf_of(io.runs[i].data) != buf_of(io.runs[i - 1].data)) {
+            frame++;
+        }
+        CHECK(frame < FRAME_CNT);
+        CHECK(buf_of(io.runs[i].data) == flushed_bufs[frame]);
+    }
+    CHECK(frame == FRAME_CNT - 1);
+
+    // LVGL had to wait for the bus before reusing a buffer, and it never drew into a buffer on the bus
+    CHECK(stats.wait_max_us >= FRAME_TX_US / 2);
+    for (int i = 2; i < FRAME_CNT; i++) {
+        CHECK(refr_us[i] >= FRAME_TX_US / 2);
+    }
+    CHECK(!io.buffer_modified);
+    CHECK(!io.protocol_error);
+
+    // The panel shows the last frame, black is 0
+    for (int page = 0; page < PAGES; page++) {
+        for (int x = 0; x < H_RES; x++) {
+            CHECK(io.gddram[page][x] == ((FRAME_CNT - 1) % 2 ? 0x00 : 0xFF));
+        }
+    }
+
+    printf("oled_pipeline: all tests passed\n");
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "encoder_indev.h"
+
+static const char *TAG = "encoder_indev";
+
+typedef struct encoder_indev_t {
+    rotary_encoder_handle_t encoder;
+    button_debounce_handle_t button;
+    _lock_t *lvgl_api_lock;
+    int64_t accel_interval_us;
+    uint32_t accel_max;
+    lv_indev_t *indev;
+    TaskHandle_t task;
+    bool button_pressed;          // Last state reported to LVGL, only used in the input task
+    int64_t last_event_us;
+    int32_t last_delta;
+} encoder_indev_t;
+
+static void encoder_indev_read_cb(lv_indev_t *indev, lv_indev_data_t *data);
+static int32_t encoder_indev_accelerate(encoder_indev_t *encoder_indev, const rotary_encoder_event_t *event);
+static bool encoder_indev_on_encoder_event(rotary_encoder_handle_t encoder, void *user_ctx);
+static void encoder_indev_on_button_event(button_debounce_handle_t button, const button_debounce_event_t *event, void *user_ctx);
+static void encoder_indev_task(void *arg);
+
+esp_err_t encoder_indev_new(const encoder_indev_config_t *config, encoder_indev_handle_t *ret_indev)
+{
+    esp_err_t ret = ESP_OK;
+    encoder_indev_t *encoder_indev = NULL;
+    ESP_GOTO_ON_FALSE(config && config->encoder && config->lvgl_api_lock && ret_indev, ESP_ERR_INVALID_ARG, err, TAG,
+                      "invalid argument");
+    encoder_indev = calloc(1, sizeof(encoder_indev_t));
+    ESP_GOTO_ON_FALSE(encoder_indev, ESP_ERR_NO_MEM, err, TAG, "no mem for encoder input device");
+
+    encoder_indev->encoder = config->encoder;
+    encoder_indev->button = config->button;
+    encoder_indev->lvgl_api_lock = config->lvgl_api_lock;
+    encoder_indev->accel_interval_us = config->accel_interval_ms * 1000LL;
+    encoder_indev->accel_max = config->accel_max;
+
+    // The read timer is paused in event mode, only the input task reads the device
+    encoder_indev->indev = lv_indev_create();
+    ESP_GOTO_ON_FALSE(encoder_indev->indev, ESP_ERR_NO_MEM, err, TAG, "no mem for lvgl input device");
+    lv_indev_set_type(encoder_indev->indev, LV_INDEV_TYPE_ENCODER);
+    lv_indev_set_read_cb(encoder_indev->indev, encoder_indev_read_cb);
+    lv_indev_set_driver_data(encoder_indev->indev, encoder_indev);
+    lv_indev_set_mode(encoder_indev->indev, LV_INDEV_MODE_EVENT);
+
+    lv_group_t *group = lv_group_create();
+    lv_group_set_default(group);
+    lv_indev_set_group(encoder_indev->indev, group);
+
+    ESP_GOTO_ON_FALSE(xTaskCreate(encoder_indev_task, "encoder_indev", config->task_stack_size, encoder_indev,
+                                  config->task_priority, &encoder_indev->task) == pdPASS,
+                      ESP_ERR_NO_MEM, err, TAG, "create input task failed");
+
+    // Only wake up the task once it exists
+    ESP_GOTO_ON_ERROR(rotary_encoder_register_event_callback(config->encoder, encoder_indev_on_encoder_event, encoder_indev),
+                      err, TAG, "register encoder callback failed");
+    if (config->button) {
+        ESP_GOTO_ON_ERROR(button_debounce_register_event_callback(config->button, encoder_indev_on_button_event, encoder_indev),
+                          err, TAG, "register button callback failed");
+    }
+
+    *ret_indev = encoder_indev;
+    ESP_LOGD(TAG, "new encoder input device @%p", encoder_indev);
+
+    return ESP_OK;
+
+err:
+    if (encoder_indev) {
+        if (config->encoder) {
+            rotary_encoder_register_event_callback(config->encoder, NULL, NULL);
+        }
+        if (config->button) {
+            button_debounce_register_event_callback(config->button, NULL, NULL);
+        }
+        if (encoder_indev->task) {
+            vTaskDelete(encoder_indev->task);
+        }
+        if (encoder_indev->indev) {
+            lv_indev_delete(encoder_indev->indev);
+        }
+        free(encoder_indev);
+    }
+    return ret;
+}
+
+lv_indev_t *encoder_indev_get_indev(encoder_indev_handle_t indev)
+{
+    return indev->indev;
+}
+
+static void encoder_indev_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    encoder_indev_t *encoder_indev = lv_indev_get_driver_data(indev);
+    rotary_encoder_event_t event;
+    int32_t diff = 0;
+
+    // Drain the ring, everything turned since the previous read is reported at once
+    while (rotary_encoder_wait_event(encoder_indev->encoder, &event, 0) == ESP_OK) {
+        diff += encoder_indev_accelerate(encoder_indev, &event);
+    }
+    data->enc_diff = LV_CLAMP(INT16_MIN, diff, INT16_MAX);
+
+    if (encoder_indev->button) {
+        encoder_indev->button_pressed = button_debounce_is_pressed(encoder_indev->button);
+    }
+    data->state = encoder_indev->button_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static int32_t encoder_indev_accelerate(encoder_indev_t *encoder_indev, const rotary_encoder_event_t *event)
+{
+    int64_t interval_us = event->time_us - encoder_indev->last_event_us;
+    bool same_direction = (event->delta > 0) == (encoder_indev->last_delta > 0);
+
+    encoder_indev->last_event_us = event->time_us;
+    encoder_indev->last_delta = event->delta;
+    if (!same_direction || interval_us >= encoder_indev->accel_interval_us || encoder_indev->accel_max <= 1) {
+        return event->delta;
+    }
+
+    // The timestamps come from the ISR, so the speed does not depend on when the task got to read them
+    int64_t scale = 1 + (encoder_indev->accel_interval_us - interval_us) * (encoder_indev->accel_max - 1) /
+                    encoder_indev->accel_interval_us;
+    return event->delta * (int32_t)scale;
+}
+
+static bool encoder_indev_on_encoder_event(rotary_encoder_handle_t encoder, void *user_ctx)
+{
+    encoder_indev_t *encoder_indev = user_ctx;
+    BaseType_t high_task_wakeup = pdFALSE;
+
+    vTaskNotifyGiveFromISR(encoder_indev->task, &high_task_wakeup);
+    return high_task_wakeup == pdTRUE;
+}
+
+static void encoder_indev_on_button_event(button_debounce_handle_t button, const button_debounce_event_t *event, void *user_ctx)
+{
+    encoder_indev_t *encoder_indev = user_ctx;
+
+    // Runs in the esp_timer task, the press or release is already debounced
+    xTaskNotifyGive(encoder_indev->task);
+}
+
+static void encoder_indev_task(void *arg)
+{
+    encoder_indev_t *encoder_indev = arg;
+    TickType_t timeout = portMAX_DELAY;
+
+    ESP_LOGI(TAG, "Starting encoder input task");
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, timeout);
+
+        _lock_acquire(encoder_indev->lvgl_api_lock);
+        lv_indev_read(encoder_indev->indev);
+        _lock_release(encoder_indev->lvgl_api_lock);
+
+        // LVGL times long presses only while it keeps reading, so poll just as long as the button is held
+        timeout = encoder_indev->button_pressed ? pdMS_TO_TICKS(LV_DEF_REFR_PERIOD) : portMAX_DELAY;
+    }
+}
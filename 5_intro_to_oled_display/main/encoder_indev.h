@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <sys/lock.h>
+#include "esp_err.h"
+#include "lvgl.h"
+#include "rotary_encoder.h"
+#include "button_debounce.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the encoder input device
+ */
+typedef struct {
+    rotary_encoder_handle_t encoder; /*!< Rotary encoder, its events are read only by the input device afterwards */
+    button_debounce_handle_t button; /*!< Debounced push button of the encoder, NULL if there is none */
+    _lock_t *lvgl_api_lock;          /*!< Lock taken around the LVGL calls, shared with the LVGL task */
+    uint32_t accel_interval_ms;      /*!< Detents closer in time than this are multiplied, 0 disables the acceleration */
+    uint32_t accel_max;              /*!< Multiplier of detents which come at once, it decreases linearly to 1 at `accel_interval_ms` */
+    int task_priority;               /*!< Priority of the input task, should be higher than the one of the LVGL task */
+    int task_stack_size;             /*!< Stack size of the input task in bytes */
+} encoder_indev_config_t;
+
+typedef struct encoder_indev_t *encoder_indev_handle_t;
+
+/**
+ * @brief Create an LVGL encoder input device fed by a rotary encoder
+ *
+ * The input device runs in event mode: there is no read timer, an input task calls `lv_indev_read`
+ * as soon as the encoder ISR or the debounced button reports something. While the button is held it is
+ * also read periodically, so LVGL can detect long presses. A default group is created and set
+ * to the input device, widgets created afterwards can be focused by the encoder.
+ *
+ * @note Call it with the LVGL lock held
+ *
+ * @param[in] config Input device configuration
+ * @param[out] ret_indev Returned handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_NO_MEM        if out of memory
+ *          - ESP_OK                on success
+ */
+esp_err_t encoder_indev_new(const encoder_indev_config_t *config, encoder_indev_handle_t *ret_indev);
+
+/**
+ * @brief Get the LVGL input device
+ *
+ * @param[in] indev Encoder input device handle
+ * @return LVGL input device
+ */
+lv_indev_t *encoder_indev_get_indev(encoder_indev_handle_t indev);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,7 +5,7 @@
  */
 
 #include <stdio.h>
-#include <unistd.h>
+#include <inttypes.h>
 #include <sys/lock.h>
 #include <sys/param.h>
 #include "freertos/FreeRTOS.h"
@@ -18,6 +18,11 @@
 #include "driver/i2c_master.h"
 #include "lvgl.h"
 #include "esp_lcd_panel_vendor.h"
+#include "oled_delta.h"
+#include "oled_pipeline.h"
+#include "rotary_encoder.h"
+#include "button_debounce.h"
+#include "encoder_indev.h"
 
 static const char *TAG = "example";
 
@@ -31,6 +36,9 @@ static const char *TAG = "example";
 #define EXAMPLE_PIN_NUM_SCL           GPIO_NUM_7
 #define EXAMPLE_PIN_NUM_RST           -1
 #define EXAMPLE_I2C_HW_ADDR           0x3C
+#define EXAMPLE_PIN_NUM_ENCODER_A     GPIO_NUM_10
+#define EXAMPLE_PIN_NUM_ENCODER_B     GPIO_NUM_11
+#define EXAMPLE_PIN_NUM_ENCODER_SW    GPIO_NUM_8
 
 
 #define EXAMPLE_LCD_H_RES              128
@@ -40,71 +48,62 @@ static const char *TAG = "example";
 #define EXAMPLE_LCD_CMD_BITS           8
 #define EXAMPLE_LCD_PARAM_BITS         8
 
-#define EXAMPLE_LVGL_TICK_PERIOD_MS    5
 #define EXAMPLE_LVGL_TASK_STACK_SIZE   (8 * 1024)
 #define EXAMPLE_LVGL_TASK_PRIORITY     2
-#define EXAMPLE_LVGL_PALETTE_SIZE      8
-#define EXAMPLE_LVGL_TASK_MAX_DELAY_MS 500
-#define EXAMPLE_LVGL_TASK_MIN_DELAY_MS 1000 / CONFIG_FREERTOS_HZ
+#define EXAMPLE_OLED_FLUSH_TASK_STACK_SIZE (4 * 1024)
+#define EXAMPLE_OLED_FLUSH_TASK_PRIORITY   3
+#define EXAMPLE_OLED_STATS_PERIOD_MS   5000
+#define EXAMPLE_ENCODER_TASK_STACK_SIZE (4 * 1024)
+#define EXAMPLE_ENCODER_TASK_PRIORITY  4
+#define EXAMPLE_ENCODER_EVENT_QUEUE_LEN 16
+#define EXAMPLE_ENCODER_GLITCH_FILTER_NS 1000
+#define EXAMPLE_ENCODER_ACCEL_INTERVAL_MS 100
+#define EXAMPLE_ENCODER_ACCEL_MAX      8
+#define EXAMPLE_BUTTON_DEBOUNCE_MS     20
 
-// To use LV_COLOR_FORMAT_I1, we need an extra buffer to hold the converted data
-static uint8_t oled_buffer[EXAMPLE_LCD_H_RES * EXAMPLE_LCD_V_RES / 8];
 // LVGL library is not thread-safe, this example will call LVGL APIs from different tasks, so use a mutex to protect it
 static _lock_t lvgl_api_lock;
 
 extern void example_lvgl_demo_ui(lv_disp_t *disp);
 extern void example_lvgl_custom_ui(lv_disp_t *disp);
+extern void example_lvgl_encoder_ui(lv_disp_t *disp);
 extern void lv_log_esp32_print_cb(lv_log_level_t level, const char * buf);
 
-static bool example_notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t io_panel, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+static void example_lvgl_stats_timer_cb(lv_timer_t *timer)
 {
-    lv_display_t *disp = (lv_display_t *)user_ctx;
-    lv_display_flush_ready(disp);
-    return false;
+    oled_pipeline_handle_t pipeline = lv_timer_get_user_data(timer);
+    oled_pipeline_stats_t stats;
+
+    oled_pipeline_get_stats(pipeline, &stats);
+    ESP_LOGI(TAG, "%"PRIu32" frames (%"PRIu32" rendered during a transfer), period %"PRIu32" us, "
+             "render %"PRIu32"/%"PRIu32" us, transfer %"PRIu32"/%"PRIu32" us, wait %"PRIu32"/%"PRIu32" us (avg/max)",
+             stats.frames, stats.overlapped_frames, stats.period_avg_us,
+             stats.render_avg_us, stats.render_max_us, stats.transfer_avg_us, stats.transfer_max_us,
+             stats.wait_avg_us, stats.wait_max_us);
 }
 
-static void example_lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+static uint32_t example_lvgl_tick_get_cb(void)
 {
-    esp_lcd_panel_handle_t panel_handle = lv_display_get_user_data(disp);
-
-    // This is necessary because LVGL reserves 2 x 4 bytes in the buffer, as these are assumed to be used as a palette. Skip the palette here
-    // More information about the monochrome, please refer to https://docs.lvgl.io/9.2/porting/display.html#monochrome-displays
-    px_map += EXAMPLE_LVGL_PALETTE_SIZE;
-
-    uint16_t hor_res = lv_display_get_physical_horizontal_resolution(disp);
-    int x1 = area->x1;
-    int x2 = area->x2;
-    int y1 = area->y1;
-    int y2 = area->y2;
-
-    for (int y = y1; y <= y2; y++) {
-        for (int x = x1; x <= x2; x++) {
-            /* The order of bits is MSB first
-                        MSB           LSB
-               bits      7 6 5 4 3 2 1 0
-               pixels    0 1 2 3 4 5 6 7
-                        Left         Right
-            */
-            bool chroma_color = (px_map[(hor_res >> 3) * y  + (x >> 3)] & 1 << (7 - x % 8));
-
-            /* Write to the buffer as required for the display.
-            * It writes only 1-bit for monochrome displays mapped vertically.*/
-            uint8_t *buf = oled_buffer + hor_res * (y >> 3) + (x);
-            if (chroma_color) {
-                (*buf) &= ~(1 << (y % 8));
-            } else {
-                (*buf) |= (1 << (y % 8));
-            }
-        }
+    /* LVGL reads the time when it needs it, so no periodic tick interrupt has to run */
+    return esp_timer_get_time() / 1000;
+}
+
+static void example_lvgl_resume_cb(void *arg)
+{
+    TaskHandle_t lvgl_task = arg;
+    /* A timer was created, resumed or reset, e.g. by an invalidation or an input read in another task.
+     * The LVGL task runs lv_timer_handler() again right after it returns, so it does not notify itself. */
+    if (xTaskGetCurrentTaskHandle() != lvgl_task) {
+        xTaskNotifyGive(lvgl_task);
     }
-    // pass the draw buffer to the driver
-    esp_lcd_panel_draw_bitmap(panel_handle, x1, y1, x2 + 1, y2 + 1, oled_buffer);
 }
 
-static void example_increase_lvgl_tick(void *arg)
+static void example_lvgl_refr_start_cb(lv_event_t *e)
 {
-    /* Tell LVGL how many milliseconds has elapsed */
-    lv_tick_inc(EXAMPLE_LVGL_TICK_PERIOD_MS);
+    lv_display_t *disp = lv_event_get_target(e);
+    /* The refresh timer would run every LV_DEF_REFR_PERIOD even if nothing is invalid.
+     * Pause it when a refresh starts, an invalidation during or after the refresh resumes it. */
+    lv_timer_pause(lv_display_get_refr_timer(disp));
 }
 
 static void example_lvgl_port_task(void *arg)
@@ -115,11 +114,14 @@ static void example_lvgl_port_task(void *arg)
         _lock_acquire(&lvgl_api_lock);
         time_till_next_ms = lv_timer_handler();
         _lock_release(&lvgl_api_lock);
-        // in case of triggering a task watch dog time out
-        time_till_next_ms = MAX(time_till_next_ms, EXAMPLE_LVGL_TASK_MIN_DELAY_MS);
-        // in case of lvgl display not ready yet
-        time_till_next_ms = MIN(time_till_next_ms, EXAMPLE_LVGL_TASK_MAX_DELAY_MS);
-        usleep(1000 * time_till_next_ms);
+        // sleep until the next timer is due, or forever if all timers are paused, unless another task wakes a timer up.
+        // A notification given since lv_timer_handler() returned is kept, so the wake up is not lost.
+        TickType_t wait_ticks = portMAX_DELAY;
+        if (time_till_next_ms != LV_NO_TIMER_READY) {
+            // round up, and wait at least one tick so the idle task can run
+            wait_ticks = MAX((time_till_next_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS, 1);
+        }
+        ulTaskNotifyTake(pdTRUE, wait_ticks);
     }
 }
 
@@ -164,52 +166,100 @@ void app_main(void)
     ESP_ERROR_CHECK(esp_lcd_panel_reset(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true));
+    // LVGL renders light pixels as 1, invert the panel so that the white theme background stays dark on the OLED
+    ESP_ERROR_CHECK(esp_lcd_panel_invert_color(panel_handle, true));
+
+    ESP_LOGI(TAG, "Install OLED delta stage");
+    oled_delta_handle_t delta = NULL;
+    oled_delta_config_t delta_config = {
+        .controller = OLED_DELTA_CONTROLLER_SSD1306,
+        .h_res = EXAMPLE_LCD_H_RES,
+        .v_res = EXAMPLE_LCD_V_RES,
+    };
+    ESP_ERROR_CHECK(oled_delta_new(io_handle, &delta_config, &delta));
 
     ESP_LOGI(TAG, "Initialize LVGL");
     lv_init();
+    // LVGL gets the time from esp_timer instead of a periodic tick timer
+    lv_tick_set_cb(example_lvgl_tick_get_cb);
     // register log callback
     lv_log_register_print_cb(lv_log_esp32_print_cb);
     // create a lvgl display
     lv_display_t *display = lv_display_create(EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES);
-    // associate the i2c panel handle to the display
-    lv_display_set_user_data(display, panel_handle);
-    // create draw buffer
-    void *buf = NULL;
+    // create draw buffers
+    void *buf1 = NULL;
+    void *buf2 = NULL;
     ESP_LOGI(TAG, "Allocate separate LVGL draw buffers");
-    // LVGL reserves 2 x 4 bytes in the buffer, as these are assumed to be used as a palette.
-    size_t draw_buffer_sz = EXAMPLE_LCD_H_RES * EXAMPLE_LCD_V_RES / 8 + EXAMPLE_LVGL_PALETTE_SIZE;
-    buf = heap_caps_calloc(1, draw_buffer_sz, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-    assert(buf);
-
-    // LVGL9 suooprt new monochromatic format.
-    lv_display_set_color_format(display, LV_COLOR_FORMAT_I1);
-    // initialize LVGL draw buffers
-    lv_display_set_buffers(display, buf, NULL, draw_buffer_sz, LV_DISPLAY_RENDER_MODE_FULL);
-    // set the callback which can copy the rendered image to an area of the display
-    lv_display_set_flush_cb(display, example_lvgl_flush_cb);
-
-    ESP_LOGI(TAG, "Register io panel event callback for LVGL flush ready notification");
-    const esp_lcd_panel_io_callbacks_t cbs = {
-        .on_color_trans_done = example_notify_lvgl_flush_ready,
-    };
-    /* Register done callback */
-    esp_lcd_panel_io_register_event_callbacks(io_handle, &cbs, display);
+    // The page format has no palette, the buffer is exactly one frame of the panel's GDDRAM
+    size_t draw_buffer_sz = EXAMPLE_LCD_H_RES * EXAMPLE_LCD_V_RES / 8;
+    buf1 = heap_caps_calloc(1, draw_buffer_sz, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    assert(buf1);
+    buf2 = heap_caps_calloc(1, draw_buffer_sz, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    assert(buf2);
+
+    // Render directly in the vertical page layout of the OLED controller
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_I1_PAGE);
+    // initialize LVGL draw buffers, one is sent to the panel while the next frame is rendered into the other
+    lv_display_set_buffers(display, buf1, buf2, draw_buffer_sz, LV_DISPLAY_RENDER_MODE_FULL);
+#if !LV_USE_PERF_MONITOR
+    // refresh only when something was invalidated, so a static screen does not wake up the LVGL task
+    lv_display_add_event_cb(display, example_lvgl_refr_start_cb, LV_EVENT_REFR_START, NULL);
+#endif
 
-    ESP_LOGI(TAG, "Use esp_timer as LVGL tick timer");
-    const esp_timer_create_args_t lvgl_tick_timer_args = {
-        .callback = &example_increase_lvgl_tick,
-        .name = "lvgl_tick"
+    ESP_LOGI(TAG, "Install OLED flush pipeline");
+    // The pipeline sets the flush callbacks of the display and sends the frames from its own task through the delta stage
+    oled_pipeline_handle_t pipeline = NULL;
+    oled_pipeline_config_t pipeline_config = {
+        .task_priority = EXAMPLE_OLED_FLUSH_TASK_PRIORITY,
+        .task_stack_size = EXAMPLE_OLED_FLUSH_TASK_STACK_SIZE,
     };
-    esp_timer_handle_t lvgl_tick_timer = NULL;
-    ESP_ERROR_CHECK(esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, EXAMPLE_LVGL_TICK_PERIOD_MS * 1000));
+    ESP_ERROR_CHECK(oled_pipeline_new(display, delta, &pipeline_config, &pipeline));
 
     ESP_LOGI(TAG, "Create LVGL task");
-    xTaskCreate(example_lvgl_port_task, "LVGL", EXAMPLE_LVGL_TASK_STACK_SIZE, NULL, EXAMPLE_LVGL_TASK_PRIORITY, NULL);
+    TaskHandle_t lvgl_task = NULL;
+    xTaskCreate(example_lvgl_port_task, "LVGL", EXAMPLE_LVGL_TASK_STACK_SIZE, NULL, EXAMPLE_LVGL_TASK_PRIORITY, &lvgl_task);
+    // wake up the LVGL task whenever another task makes a timer ready
+    _lock_acquire(&lvgl_api_lock);
+    lv_timer_handler_set_resume_cb(example_lvgl_resume_cb, lvgl_task);
+    _lock_release(&lvgl_api_lock);
 
-    ESP_LOGI(TAG, "Display LVGL Scroll Text");
+    ESP_LOGI(TAG, "Install rotary encoder");
+    rotary_encoder_handle_t encoder = NULL;
+    rotary_encoder_config_t encoder_config = {
+        .pin_a = EXAMPLE_PIN_NUM_ENCODER_A,
+        .pin_b = EXAMPLE_PIN_NUM_ENCODER_B,
+        .backend = ROTARY_ENCODER_BACKEND_PCNT,
+        .event_queue_len = EXAMPLE_ENCODER_EVENT_QUEUE_LEN,
+        .glitch_filter_ns = EXAMPLE_ENCODER_GLITCH_FILTER_NS,
+    };
+    ESP_ERROR_CHECK(rotary_encoder_new(&encoder_config, &encoder));
+    // LVGL times long presses by itself, the debounced button only reports clean presses and releases
+    button_debounce_handle_t encoder_button = NULL;
+    button_debounce_config_t encoder_button_config = {
+        .gpio_num = EXAMPLE_PIN_NUM_ENCODER_SW,
+        .active_level = 0,
+        .enable_internal_pull = true,
+        .debounce_ms = EXAMPLE_BUTTON_DEBOUNCE_MS,
+    };
+    ESP_ERROR_CHECK(button_debounce_new(&encoder_button_config, &encoder_button));
+
+    ESP_LOGI(TAG, "Display LVGL encoder UI");
     // Lock the mutex due to the LVGL APIs are not thread-safe
     _lock_acquire(&lvgl_api_lock);
-    example_lvgl_custom_ui(display);
+    // register the encoder before creating the UI, so the widgets join its default group
+    encoder_indev_handle_t encoder_indev = NULL;
+    encoder_indev_config_t encoder_indev_config = {
+        .encoder = encoder,
+        .button = encoder_button,
+        .lvgl_api_lock = &lvgl_api_lock,
+        .accel_interval_ms = EXAMPLE_ENCODER_ACCEL_INTERVAL_MS,
+        .accel_max = EXAMPLE_ENCODER_ACCEL_MAX,
+        .task_priority = EXAMPLE_ENCODER_TASK_PRIORITY,
+        .task_stack_size = EXAMPLE_ENCODER_TASK_STACK_SIZE,
+    };
+    ESP_ERROR_CHECK(encoder_indev_new(&encoder_indev_config, &encoder_indev));
+    example_lvgl_encoder_ui(display);
+    // report the frame pacing periodically
+    lv_timer_create(example_lvgl_stats_timer_cb, EXAMPLE_OLED_STATS_PERIOD_MS, pipeline);
     _lock_release(&lvgl_api_lock);
 }
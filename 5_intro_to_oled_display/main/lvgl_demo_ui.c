@@ -50,6 +50,30 @@ void example_lvgl_custom_ui(lv_display_t *disp)
     lv_obj_align(img, LV_ALIGN_CENTER, 0, 0);
 }
 
+void example_lvgl_encoder_ui(lv_display_t *disp)
+{
+    // A long list of options, the encoder acceleration scrolls through it with a few fast detents
+    static char options[100 * 4];
+    size_t len = 0;
+    for (int i = 0; i < 100; i++) {
+        len += lv_snprintf(options + len, sizeof(options) - len, i ? "\n%d" : "%d", i);
+    }
+
+    lv_obj_t *scr = lv_display_get_screen_active(disp);
+    lv_obj_t *roller = lv_roller_create(scr);
+    lv_roller_set_options(roller, options, LV_ROLLER_MODE_NORMAL);
+    lv_roller_set_visible_row_count(roller, 3);
+    lv_obj_set_width(roller, lv_display_get_horizontal_resolution(disp) / 2);
+    lv_obj_center(roller);
+
+    // The roller joined the default group of the encoder, turning the knob scrolls it right away
+    lv_group_t *group = lv_obj_get_group(roller);
+    if (group) {
+        lv_group_focus_obj(roller);
+        lv_group_set_editing(group, true);
+    }
+}
+
 void lv_log_esp32_print_cb(lv_log_level_t level, const char * buf) {
     
     ESP_LOGI(LVGL_TAG, "LVGL log level: %d, log message: %s", level, buf);
@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "esp_check.h"
+#include "esp_log.h"
+#include "oled_delta.h"
+
+static const char *TAG = "oled_delta";
+
+#define OLED_DELTA_SSD1306_CMD_SET_COLUMN_RANGE 0x21
+#define OLED_DELTA_SSD1306_CMD_SET_PAGE_RANGE   0x22
+
+#define OLED_DELTA_SH1107_I2C_CMD               0x00
+#define OLED_DELTA_SH1107_I2C_RAM               0x40
+#define OLED_DELTA_SH1107_CMD_COLUMN_LOW        0x00
+#define OLED_DELTA_SH1107_CMD_COLUMN_HIGH       0x10
+#define OLED_DELTA_SH1107_CMD_PAGE              0xB0
+
+// Bytes on the bus needed to start a new run: I2C address + control byte + address commands of
+// the command transaction, then I2C address + control byte of the data transaction.
+// Unchanged columns shorter than this are cheaper to resend than to skip.
+#define OLED_DELTA_SSD1306_RUN_OVERHEAD         (2 + 6 + 2)
+#define OLED_DELTA_SH1107_RUN_OVERHEAD          (2 + 3 + 2)
+
+typedef struct oled_delta_t {
+    esp_lcd_panel_io_handle_t io;
+    oled_delta_controller_t controller;
+    int h_res;
+    int pages;
+    int x_gap;
+    int merge_gap;
+    uint8_t *shadow;      // What the GDDRAM holds, in the same page layout as the frames
+    bool *page_synced;    // The shadow of the page matches the GDDRAM in every column
+    oled_delta_stats_t stats;
+} oled_delta_t;
+
+static esp_err_t oled_delta_send_run(oled_delta_t *delta, int page, int col_start, int col_end, const uint8_t *data);
+
+esp_err_t oled_delta_new(esp_lcd_panel_io_handle_t io, const oled_delta_config_t *config, oled_delta_handle_t *ret_delta)
+{
+    esp_err_t ret = ESP_OK;
+    oled_delta_t *delta = NULL;
+    ESP_GOTO_ON_FALSE(io && config && ret_delta, ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+    ESP_GOTO_ON_FALSE(config->h_res > 0 && config->v_res > 0 && (config->v_res % 8) == 0,
+                      ESP_ERR_INVALID_ARG, err, TAG, "invalid resolution");
+    delta = calloc(1, sizeof(oled_delta_t));
+    ESP_GOTO_ON_FALSE(delta, ESP_ERR_NO_MEM, err, TAG, "no mem for delta stage");
+
+    delta->pages = config->v_res / 8;
+    delta->shadow = calloc(1, config->h_res * delta->pages);
+    ESP_GOTO_ON_FALSE(delta->shadow, ESP_ERR_NO_MEM, err, TAG, "no mem for shadow buffer");
+    delta->page_synced = calloc(delta->pages, sizeof(bool));
+    ESP_GOTO_ON_FALSE(delta->page_synced, ESP_ERR_NO_MEM, err, TAG, "no mem for page states");
+
+    delta->io = io;
+    delta->controller = config->controller;
+    delta->h_res = config->h_res;
+    delta->x_gap = config->x_gap;
+    delta->merge_gap = config->controller == OLED_DELTA_CONTROLLER_SH1107 ?
+                       OLED_DELTA_SH1107_RUN_OVERHEAD : OLED_DELTA_SSD1306_RUN_OVERHEAD;
+    *ret_delta = delta;
+    ESP_LOGD(TAG, "new delta stage @%p", delta);
+
+    return ESP_OK;
+
+err:
+    if (delta) {
+        free(delta->shadow);
+        free(delta->page_synced);
+        free(delta);
+    }
+    return ret;
+}
+
+esp_err_t oled_delta_del(oled_delta_handle_t delta)
+{
+    ESP_RETURN_ON_FALSE(delta, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_LOGD(TAG, "del delta stage @%p", delta);
+    free(delta->shadow);
+    free(delta->page_synced);
+    free(delta);
+    return ESP_OK;
+}
+
+esp_err_t oled_delta_flush(oled_delta_handle_t delta, int x_start, int y_start, int x_end, int y_end,
+                           const uint8_t *page_data, int stride)
+{
+    ESP_RETURN_ON_FALSE(delta && page_data, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(x_start >= 0 && x_start < x_end && x_end <= delta->h_res &&
+                        y_start >= 0 && y_start < y_end && y_end <= delta->pages * 8,
+                        ESP_ERR_INVALID_ARG, TAG, "area out of the panel");
+    ESP_RETURN_ON_FALSE((y_start % 8) == 0 && (y_end % 8) == 0, ESP_ERR_INVALID_ARG, TAG, "area is not page aligned");
+
+    delta->stats.flushes++;
+
+    for (int page = y_start / 8; page < y_end / 8; page++) {
+        // Shift the pointers so both can be indexed with the column
+        const uint8_t *src = page_data + (page - y_start / 8) * stride - x_start;
+        const uint8_t *shadow = delta->shadow + page * delta->h_res;
+        bool synced = delta->page_synced[page];
+
+        int x = x_start;
+        while (x < x_end) {
+            // Skip the columns the panel already shows
+            while (synced && x < x_end && src[x] == shadow[x]) {
+                x++;
+            }
+            if (x == x_end) {
+                break;
+            }
+
+            // Extend the run until the next change is too far to be worth to be sent together
+            int run_start = x;
+            int run_end = x + 1;
+            for (x = run_end; x < x_end; x++) {
+                if (!synced || src[x] != shadow[x]) {
+                    if (x - run_end >= delta->merge_gap) {
+                        break;
+                    }
+                    run_end = x + 1;
+                }
+            }
+
+            esp_err_t ret = oled_delta_send_run(delta, page, run_start, run_end, src + run_start);
+            if (ret != ESP_OK) {
+                // The panel might have received only a part of the run
+                delta->page_synced[page] = false;
+                return ret;
+            }
+        }
+
+        if (x_start == 0 && x_end == delta->h_res) {
+            delta->page_synced[page] = true;
+        }
+    }
+
+    return ESP_OK;
+}
+
+void oled_delta_invalidate(oled_delta_handle_t delta)
+{
+    memset(delta->page_synced, 0, delta->pages * sizeof(bool));
+}
+
+void oled_delta_get_stats(oled_delta_handle_t delta, oled_delta_stats_t *stats)
+{
+    *stats = delta->stats;
+}
+
+static esp_err_t oled_delta_send_run(oled_delta_t *delta, int page, int col_start, int col_end, const uint8_t *data)
+{
+    esp_lcd_panel_io_handle_t io = delta->io;
+    int len = col_end - col_start;
+    int col_first = col_start + delta->x_gap;
+    int col_last = col_end - 1 + delta->x_gap;
+
+    // Set the whole address in a single command transaction, then stream the column bytes
+    if (delta->controller == OLED_DELTA_CONTROLLER_SH1107) {
+        const uint8_t cmds[] = {
+            OLED_DELTA_SH1107_CMD_PAGE | (page & 0x0F),
+            OLED_DELTA_SH1107_CMD_COLUMN_HIGH | ((col_first >> 4) & 0x0F),
+            OLED_DELTA_SH1107_CMD_COLUMN_LOW | (col_first & 0x0F),
+        };
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, OLED_DELTA_SH1107_I2C_CMD, cmds, sizeof(cmds)),
+                            TAG, "io tx param failed");
+        delta->stats.cmd_bytes += 1 + sizeof(cmds);
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, OLED_DELTA_SH1107_I2C_RAM, data, len),
+                            TAG, "io tx color failed");
+    } else {
+        // The page range command is chained as parameters of the column range command,
+        // the controller keeps parsing command bytes until the end of the transaction
+        const uint8_t params[] = {
+            col_first & 0x7F,
+            col_last & 0x7F,
+            OLED_DELTA_SSD1306_CMD_SET_PAGE_RANGE,
+            page & 0x07,
+            page & 0x07,
+        };
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, OLED_DELTA_SSD1306_CMD_SET_COLUMN_RANGE, params, sizeof(params)),
+                            TAG, "io tx param failed");
+        delta->stats.cmd_bytes += 1 + sizeof(params);
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, -1, data, len), TAG, "io tx color failed");
+    }
+
+    memcpy(delta->shadow + page * delta->h_res + col_start, data, len);
+    delta->stats.runs++;
+    delta->stats.data_bytes += len;
+
+    return ESP_OK;
+}
@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Controllers supported by the delta stage
+ *
+ * Both use the vertical page layout (8 rows per byte, LSB on top), they differ in how
+ * the RAM window is addressed and how the I2C control byte is produced.
+ */
+typedef enum {
+    OLED_DELTA_CONTROLLER_SSD1306, /*!< Horizontal addressing mode, control byte added by the panel IO */
+    OLED_DELTA_CONTROLLER_SH1107,  /*!< Page addressing mode, control byte sent as `lcd_cmd` (control phase disabled) */
+} oled_delta_controller_t;
+
+/**
+ * @brief Configuration of the delta stage
+ */
+typedef struct {
+    oled_delta_controller_t controller; /*!< Controller model */
+    int h_res;                          /*!< Horizontal resolution in pixels */
+    int v_res;                          /*!< Vertical resolution in pixels, multiple of 8 */
+    int x_gap;                          /*!< Offset of the first visible column in the controller RAM */
+} oled_delta_config_t;
+
+/**
+ * @brief Counters of the data that went to the panel IO
+ */
+typedef struct {
+    uint32_t flushes;    /*!< Number of `oled_delta_flush` calls */
+    uint32_t runs;       /*!< Number of column runs sent, one address and one data transaction each */
+    uint32_t cmd_bytes;  /*!< Command and parameter bytes passed to `esp_lcd_panel_io_tx_param` */
+    uint32_t data_bytes; /*!< GDDRAM bytes passed to `esp_lcd_panel_io_tx_color` */
+} oled_delta_stats_t;
+
+typedef struct oled_delta_t *oled_delta_handle_t;
+
+/**
+ * @brief Create a delta stage with a shadow copy of the panel GDDRAM
+ *
+ * The stage only talks to the panel through `esp_lcd_panel_io_tx_param` and `esp_lcd_panel_io_tx_color`
+ * which are synchronous for I2C, so it can be exercised on a host with a recording fake panel IO.
+ *
+ * @param[in] io Panel IO handle, configured the same way as for the panel driver
+ * @param[in] config Delta stage configuration
+ * @param[out] ret_delta Returned handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_NO_MEM        if out of memory
+ *          - ESP_OK                on success
+ */
+esp_err_t oled_delta_new(esp_lcd_panel_io_handle_t io, const oled_delta_config_t *config, oled_delta_handle_t *ret_delta);
+
+/**
+ * @brief Delete the delta stage and free the shadow buffer
+ *
+ * @param[in] delta Delta stage handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t oled_delta_del(oled_delta_handle_t delta);
+
+/**
+ * @brief Send the changed part of an area to the panel
+ *
+ * Every page of the area is compared with the shadow buffer, only the runs of changed columns are sent.
+ * Runs closer to each other than the cost of a new address transaction are merged.
+ *
+ * @param[in] delta Delta stage handle
+ * @param[in] x_start Start column of the area
+ * @param[in] y_start Start row of the area, multiple of 8
+ * @param[in] x_end End column of the area (exclusive)
+ * @param[in] y_end End row of the area (exclusive), multiple of 8
+ * @param[in] page_data Page bytes of the area, the first byte belongs to (x_start, y_start)
+ * @param[in] stride Distance of two pages in `page_data` in bytes
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ *          - other error codes from the panel IO
+ */
+esp_err_t oled_delta_flush(oled_delta_handle_t delta, int x_start, int y_start, int x_end, int y_end,
+                           const uint8_t *page_data, int stride);
+
+/**
+ * @brief Forget the content of the panel, the next flush sends every byte of its area
+ *
+ * Call it when the GDDRAM was changed behind the stage, e.g. after a reset of the panel.
+ *
+ * @param[in] delta Delta stage handle
+ */
+void oled_delta_invalidate(oled_delta_handle_t delta);
+
+/**
+ * @brief Get the transfer counters
+ *
+ * @param[in] delta Delta stage handle
+ * @param[out] stats Returned counters
+ */
+void oled_delta_get_stats(oled_delta_handle_t delta, oled_delta_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "oled_pipeline.h"
+
+static const char *TAG = "oled_pipeline";
+
+typedef struct {
+    lv_area_t area;
+    const uint8_t *px_map;
+} oled_pipeline_frame_t;
+
+// Sum and maximum of a duration, averaged when the statistics are read
+typedef struct {
+    uint64_t sum_us;
+    uint32_t max_us;
+    uint32_t count;
+} oled_pipeline_timing_t;
+
+typedef struct oled_pipeline_t {
+    oled_delta_handle_t delta;
+    QueueHandle_t frame_queue;
+    SemaphoreHandle_t done_sem;
+    TaskHandle_t task;
+    portMUX_TYPE lock;              // Protects the fields below, they are written by both tasks
+    bool transferring;
+    bool render_overlapped;
+    int64_t render_start_us;
+    int64_t wait_start_us;
+    int64_t last_transfer_start_us;
+    uint32_t frames;
+    uint32_t overlapped_frames;
+    oled_pipeline_timing_t render;
+    oled_pipeline_timing_t transfer;
+    oled_pipeline_timing_t wait;
+    oled_pipeline_timing_t period;
+} oled_pipeline_t;
+
+static void oled_pipeline_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+static void oled_pipeline_flush_wait_cb(lv_display_t *disp);
+static void oled_pipeline_event_cb(lv_event_t *e);
+static void oled_pipeline_task(void *arg);
+static void oled_pipeline_timing_add(oled_pipeline_timing_t *timing, int64_t duration_us);
+static void oled_pipeline_timing_get(const oled_pipeline_timing_t *timing, uint32_t *avg_us, uint32_t *max_us);
+
+esp_err_t oled_pipeline_new(lv_display_t *disp, oled_delta_handle_t delta, const oled_pipeline_config_t *config,
+                            oled_pipeline_handle_t *ret_pipeline)
+{
+    esp_err_t ret = ESP_OK;
+    oled_pipeline_t *pipeline = NULL;
+    ESP_GOTO_ON_FALSE(disp && delta && config && ret_pipeline, ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+    pipeline = calloc(1, sizeof(oled_pipeline_t));
+    ESP_GOTO_ON_FALSE(pipeline, ESP_ERR_NO_MEM, err, TAG, "no mem for pipeline");
+
+    // One frame can wait in the queue while LVGL renders into the other buffer
+    pipeline->frame_queue = xQueueCreate(1, sizeof(oled_pipeline_frame_t));
+    ESP_GOTO_ON_FALSE(pipeline->frame_queue, ESP_ERR_NO_MEM, err, TAG, "no mem for frame queue");
+    pipeline->done_sem = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(pipeline->done_sem, ESP_ERR_NO_MEM, err, TAG, "no mem for done semaphore");
+
+    pipeline->delta = delta;
+    portMUX_INITIALIZE(&pipeline->lock);
+
+    ESP_GOTO_ON_FALSE(xTaskCreate(oled_pipeline_task, "oled_flush", config->task_stack_size, pipeline,
+                                  config->task_priority, &pipeline->task) == pdPASS,
+                      ESP_ERR_NO_MEM, err, TAG, "create transfer task failed");
+
+    lv_display_set_driver_data(disp, pipeline);
+    lv_display_set_flush_cb(disp, oled_pipeline_flush_cb);
+    lv_display_set_flush_wait_cb(disp, oled_pipeline_flush_wait_cb);
+    lv_display_add_event_cb(disp, oled_pipeline_event_cb, LV_EVENT_REFR_START, pipeline);
+    lv_display_add_event_cb(disp, oled_pipeline_event_cb, LV_EVENT_RENDER_READY, pipeline);
+    lv_display_add_event_cb(disp, oled_pipeline_event_cb, LV_EVENT_FLUSH_WAIT_START, pipeline);
+    lv_display_add_event_cb(disp, oled_pipeline_event_cb, LV_EVENT_FLUSH_WAIT_FINISH, pipeline);
+
+    *ret_pipeline = pipeline;
+    ESP_LOGD(TAG, "new pipeline @%p", pipeline);
+
+    return ESP_OK;
+
+err:
+    if (pipeline) {
+        if (pipeline->frame_queue) {
+            vQueueDelete(pipeline->frame_queue);
+        }
+        if (pipeline->done_sem) {
+            vSemaphoreDelete(pipeline->done_sem);
+        }
+        free(pipeline);
+    }
+    return ret;
+}
+
+void oled_pipeline_get_stats(oled_pipeline_handle_t pipeline, oled_pipeline_stats_t *stats)
+{
+    uint32_t unused_max_us;
+
+    portENTER_CRITICAL(&pipeline->lock);
+    stats->frames = pipeline->frames;
+    stats->overlapped_frames = pipeline->overlapped_frames;
+    oled_pipeline_timing_get(&pipeline->render, &stats->render_avg_us, &stats->render_max_us);
+    oled_pipeline_timing_get(&pipeline->transfer, &stats->transfer_avg_us, &stats->transfer_max_us);
+    oled_pipeline_timing_get(&pipeline->wait, &stats->wait_avg_us, &stats->wait_max_us);
+    oled_pipeline_timing_get(&pipeline->period, &stats->period_avg_us, &unused_max_us);
+
+    pipeline->frames = 0;
+    pipeline->overlapped_frames = 0;
+    memset(&pipeline->render, 0, sizeof(pipeline->render));
+    memset(&pipeline->transfer, 0, sizeof(pipeline->transfer));
+    memset(&pipeline->wait, 0, sizeof(pipeline->wait));
+    memset(&pipeline->period, 0, sizeof(pipeline->period));
+    portEXIT_CRITICAL(&pipeline->lock);
+}
+
+static void oled_pipeline_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    oled_pipeline_t *pipeline = lv_display_get_driver_data(disp);
+    oled_pipeline_frame_t frame = {
+        .area = *area,
+        .px_map = px_map,
+    };
+
+    portENTER_CRITICAL(&pipeline->lock);
+    pipeline->transferring = true;
+    portEXIT_CRITICAL(&pipeline->lock);
+
+    // Return at once, LVGL swaps the buffers and keeps rendering while the task sends this one
+    xQueueSend(pipeline->frame_queue, &frame, portMAX_DELAY);
+}
+
+static void oled_pipeline_flush_wait_cb(lv_display_t *disp)
+{
+    oled_pipeline_t *pipeline = lv_display_get_driver_data(disp);
+
+    // With a wait callback LVGL never looks at the flushing flag, it calls this once for every flush.
+    // So each completion is taken exactly once, and blocking lets the transfer task run on a single core too.
+    xSemaphoreTake(pipeline->done_sem, portMAX_DELAY);
+}
+
+static void oled_pipeline_event_cb(lv_event_t *e)
+{
+    oled_pipeline_t *pipeline = lv_event_get_user_data(e);
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&pipeline->lock);
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        pipeline->render_start_us = now;
+        pipeline->render_overlapped = pipeline->transferring;
+        break;
+    case LV_EVENT_RENDER_READY:
+        oled_pipeline_timing_add(&pipeline->render, now - pipeline->render_start_us);
+        if (pipeline->render_overlapped) {
+            pipeline->overlapped_frames++;
+        }
+        break;
+    case LV_EVENT_FLUSH_WAIT_START:
+        pipeline->wait_start_us = now;
+        break;
+    case LV_EVENT_FLUSH_WAIT_FINISH:
+        oled_pipeline_timing_add(&pipeline->wait, now - pipeline->wait_start_us);
+        break;
+    default:
+        break;
+    }
+    portEXIT_CRITICAL(&pipeline->lock);
+}
+
+static void oled_pipeline_task(void *arg)
+{
+    oled_pipeline_t *pipeline = arg;
+    oled_pipeline_frame_t frame;
+
+    ESP_LOGI(TAG, "Starting OLED transfer task");
+    while (1) {
+        xQueueReceive(pipeline->frame_queue, &frame, portMAX_DELAY);
+
+        int64_t start_us = esp_timer_get_time();
+        uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(&frame.area), LV_COLOR_FORMAT_I1_PAGE);
+        esp_err_t ret = oled_delta_flush(pipeline->delta, frame.area.x1, frame.area.y1, frame.area.x2 + 1, frame.area.y2 + 1,
+                                         frame.px_map, stride);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "flush area failed: %s", esp_err_to_name(ret));
+        }
+        int64_t end_us = esp_timer_get_time();
+
+        portENTER_CRITICAL(&pipeline->lock);
+        pipeline->frames++;
+        oled_pipeline_timing_add(&pipeline->transfer, end_us - start_us);
+        if (pipeline->last_transfer_start_us) {
+            oled_pipeline_timing_add(&pipeline->period, start_us - pipeline->last_transfer_start_us);
+        }
+        pipeline->last_transfer_start_us = start_us;
+        pipeline->transferring = false;
+        portEXIT_CRITICAL(&pipeline->lock);
+
+        // The buffer is free again, LVGL may render into it
+        xSemaphoreGive(pipeline->done_sem);
+    }
+}
+
+static void oled_pipeline_timing_add(oled_pipeline_timing_t *timing, int64_t duration_us)
+{
+    timing->sum_us += duration_us;
+    timing->count++;
+    if (duration_us > timing->max_us) {
+        timing->max_us = duration_us;
+    }
+}
+
+static void oled_pipeline_timing_get(const oled_pipeline_timing_t *timing, uint32_t *avg_us, uint32_t *max_us)
+{
+    *avg_us = timing->count ? timing->sum_us / timing->count : 0;
+    *max_us = timing->max_us;
+}
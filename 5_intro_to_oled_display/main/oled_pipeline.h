@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+#include "oled_delta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the flush pipeline
+ */
+typedef struct {
+    int task_priority;   /*!< Priority of the transfer task, should not be lower than the one of the LVGL task */
+    int task_stack_size; /*!< Stack size of the transfer task in bytes */
+} oled_pipeline_config_t;
+
+/**
+ * @brief Frame pacing statistics, collected since the previous `oled_pipeline_get_stats` call
+ */
+typedef struct {
+    uint32_t frames;             /*!< Frames sent to the panel */
+    uint32_t overlapped_frames;  /*!< Rendered frames which were drawn while the previous frame was on the bus */
+    uint32_t render_avg_us;      /*!< Average time of rendering a frame */
+    uint32_t render_max_us;      /*!< Longest time of rendering a frame */
+    uint32_t transfer_avg_us;    /*!< Average time of sending a frame */
+    uint32_t transfer_max_us;    /*!< Longest time of sending a frame */
+    uint32_t wait_avg_us;        /*!< Average time LVGL was blocked waiting for the bus before a flush */
+    uint32_t wait_max_us;        /*!< Longest time LVGL was blocked waiting for the bus before a flush */
+    uint32_t period_avg_us;      /*!< Average time between the start of two transfers */
+} oled_pipeline_stats_t;
+
+typedef struct oled_pipeline_t *oled_pipeline_handle_t;
+
+/**
+ * @brief Create a flush pipeline for an LVGL display
+ *
+ * The flush callback of the display only queues the rendered buffer, a transfer task sends it
+ * through the delta stage and reports flush ready. With two draw buffers set on the display,
+ * LVGL renders frame N+1 into one of them while frame N is still being sent from the other.
+ * The flush, flush wait callbacks and the driver data of the display are taken by the pipeline.
+ *
+ * @param[in] disp LVGL display, its draw buffers have to use `LV_COLOR_FORMAT_I1_PAGE`
+ * @param[in] delta Delta stage of the panel, used only from the transfer task afterwards
+ * @param[in] config Pipeline configuration
+ * @param[out] ret_pipeline Returned handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_NO_MEM        if out of memory
+ *          - ESP_OK                on success
+ */
+esp_err_t oled_pipeline_new(lv_display_t *disp, oled_delta_handle_t delta, const oled_pipeline_config_t *config,
+                            oled_pipeline_handle_t *ret_pipeline);
+
+/**
+ * @brief Get the frame pacing statistics and start a new measurement window
+ *
+ * @param[in] pipeline Pipeline handle
+ * @param[out] stats Returned statistics
+ */
+void oled_pipeline_get_stats(oled_pipeline_handle_t pipeline, oled_pipeline_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
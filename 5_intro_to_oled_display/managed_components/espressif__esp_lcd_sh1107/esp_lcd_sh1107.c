@@ -219,17 +219,10 @@ static esp_err_t panel_sh1107_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     size = (x_end - x_start);
 
     for (int i = row_start; i < row_end; i++) {
-        /* Start column */
+        /* Start column and page in one transaction, the control byte marks all of them as commands */
         esp_lcd_panel_io_tx_param(io, LCD_SH1107_I2C_CMD, (uint8_t[]) {
-            0x10 | column_high
-        }, 1);
-        esp_lcd_panel_io_tx_param(io, LCD_SH1107_I2C_CMD, (uint8_t[]) {
-            0x00 | column_low
-        }, 1);
-        /* Page */
-        esp_lcd_panel_io_tx_param(io, LCD_SH1107_I2C_CMD, (uint8_t[]) {
-            0xB0 | i
-        }, 1);
+            0x10 | column_high, 0x00 | column_low, 0xB0 | i
+        }, 3);
 
         ptr = color_data + i * x_end;
         esp_lcd_panel_io_tx_color(io, LCD_SH1107_I2C_RAM, (uint8_t *)ptr, size);
@@ -423,6 +423,8 @@ static scene_dsc_t scenes[] = {
 
 static uint32_t scene_act;
 static uint32_t rnd_act;
+static lv_demo_benchmark_end_cb_t end_cb;
+static lv_demo_benchmark_result_t results[sizeof(scenes) / sizeof(scenes[0]) - 1];
 
 /**********************
  *      MACROS
@@ -463,6 +465,11 @@ void lv_demo_benchmark(void)
 #endif
 }
 
+void lv_demo_benchmark_set_end_cb(lv_demo_benchmark_end_cb_t cb)
+{
+    end_cb = cb;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -614,6 +621,8 @@ static void summary_create(void)
     int32_t valid_scene_cnt = 0;
     for(i = 0; scenes[i].create_cb; i++) {
         lv_table_set_cell_value(table, i + 2, 0, scenes[i].name);
+        results[i].name = scenes[i].name;
+        results[i].valid = scenes[i].measurement_cnt > 1;
 
         /*the first measurement was ignored as it contains data from the previous scene*/
         if(scenes[i].measurement_cnt <= 1) {
@@ -631,6 +640,11 @@ static void summary_create(void)
             lv_table_set_cell_value_fmt(table, i + 2, 3, "%"LV_PRIu32" ms (%"LV_PRIu32" + %"LV_PRIu32")",
                                         render_time + flush_time, render_time, flush_time);
 
+            results[i].cpu_avg_usage = scenes[i].cpu_avg_usage / cnt;
+            results[i].fps_avg = scenes[i].fps_avg / cnt;
+            results[i].render_avg_time = render_time;
+            results[i].flush_avg_time = flush_time;
+
             /* csv log */
             LV_LOG("%s, %"LV_PRIu32"%%, %"LV_PRIu32", %"LV_PRIu32", %"LV_PRIu32", %"LV_PRIu32"\r\n",
                    scenes[i].name,
@@ -671,6 +685,8 @@ static void summary_create(void)
                render_time,
                flush_time);
     }
+
+    if(end_cb) end_cb(results, i);
 }
 
 /*----------------
@@ -25,6 +25,23 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Averaged measurement of one scene */
+typedef struct {
+    const char * name;
+    bool valid;                 /**< false if the scene was too short to be measured */
+    uint32_t cpu_avg_usage;     /**< [%] */
+    uint32_t fps_avg;
+    uint32_t render_avg_time;   /**< [ms] */
+    uint32_t flush_avg_time;    /**< [ms] */
+} lv_demo_benchmark_result_t;
+
+/**
+ * Called when all the scenes were run
+ * @param results       the result of each scene in order of running them
+ * @param result_cnt    number of elements in `results`
+ */
+typedef void (*lv_demo_benchmark_end_cb_t)(const lv_demo_benchmark_result_t * results, uint32_t result_cnt);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -50,6 +67,13 @@ extern "C" {
  */
 void lv_demo_benchmark(void);
 
+/**
+ * Set a callback to get the results once the last scene has ended, e.g. to compare
+ * configurations from a script. The summary screen is created anyway.
+ * @param end_cb    the callback, NULL to remove it
+ */
+void lv_demo_benchmark_set_end_cb(lv_demo_benchmark_end_cb_t end_cb);
+
 /**********************
  *      MACROS
  **********************/
@@ -65,6 +65,14 @@
         #undef LV_MEM_POOL_INCLUDE
         #undef LV_MEM_POOL_ALLOC
     #endif
+
+    /*Serve the allocations up to 128 bytes from 1 kB pages of same sized slots instead of TLSF.
+     *The pages are in a fixed area at the beginning of the heap so the small objects don't
+     *fragment the rest of the heap. If all pages are used, TLSF serves the small allocations too.*/
+    #define LV_MEM_SLAB 0
+    #if LV_MEM_SLAB
+        #define LV_MEM_SLAB_SIZE (16 * 1024U)   /*[bytes] Size of the area of the pages, taken from `LV_MEM_SIZE`*/
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
 /*====================
@@ -120,6 +128,10 @@
 /*The target buffer size for simple layer chunks.*/
 #define LV_DRAW_LAYER_SIMPLE_BUF_SIZE    (24 * 1024)   /*[bytes]*/
 
+/*The draw tasks and their descriptors are allocated from per layer chunks of this size and freed at once
+ *when all the draw tasks of the layer are ready. 0: allocate each of them with `lv_malloc`*/
+#define LV_DRAW_TASK_ARENA_SIZE    (2 * 1024)   /*[bytes]*/
+
 /* The stack size of the drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -145,11 +157,39 @@
 	#define LV_DRAW_SW_SUPPORT_A8			1
 	#define LV_DRAW_SW_SUPPORT_I1			1
 
+    /* Dither on I1 layers instead of setting only the pixels whose luminance is above 50%.
+     * Fills, gradients, anti-aliased edges and images get an ordered pattern aligned to the screen.
+     * - LV_DRAW_SW_I1_DITHER_NONE:   no dithering
+     * - LV_DRAW_SW_I1_DITHER_BAYER4: 4x4 Bayer matrix, 17 levels of gray
+     * - LV_DRAW_SW_I1_DITHER_BAYER8: 8x8 Bayer matrix, 65 levels of gray */
+    #define LV_DRAW_SW_I1_DITHER    LV_DRAW_SW_I1_DITHER_NONE
+
+    /* Blend images in NORMAL mode with the kernels generated by `scripts/blend_kernel_gen.py`.
+     * They have no per-pixel conditions and can be vectorized but use more flash than the
+     * hand-written kernels, so they can be enabled per source and destination color format. */
+    #define LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565        0
+    #define LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565      0
+    #define LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565        0
+    #define LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565    0
+    #define LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565    0
+    #define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565  0
+    #define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565  0
+    #define LV_DRAW_SW_BLEND_GEN_AL88_TO_I1          0
+    #define LV_DRAW_SW_BLEND_GEN_L8_TO_I1            0
+    #define LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1        0
+    #define LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1        0
+    #define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1      0
+    #define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1      0
+
 	/* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
      * > 1 means multiple threads will render the screen in parallel */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /* Pin the thread of draw unit N to CPU core N (modulo the number of cores).
+     * Only the FreeRTOS (ESP-IDF) and pthread (Linux) OSAL can pin threads, others ignore it */
+    #define LV_DRAW_SW_PIN_UNITS_TO_CORES   0
+
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -348,7 +388,8 @@
 /*Default cache size in bytes.
  *Used by image decoders such as `lv_lodepng` to keep the decoded image in the memory.
  *If size is not set to 0, the decoder will fail to decode when the cache is full.
- *If size is 0, the cache function is not enabled and the decoded mem will be released immediately after use.*/
+ *If size is 0, the cache function is not enabled and the decoded mem will be released immediately after use.
+ *On I1 displays the software renderer also caches images converted to 1 bpp, see `LV_DRAW_SW_SUPPORT_I1`.*/
 #define LV_CACHE_DEF_SIZE       0
 
 /*Default number of image header cache entries. The cache is used to store the headers of images
@@ -366,6 +407,19 @@
 /* Add 2 x 32 bit variables to each lv_obj_t to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/* Store the already resolved style properties of the objects in a table per part
+ * to get them in O(1) time. Adds about 150 bytes + 1 value per used property to each styled object part */
+#define LV_OBJ_STYLE_TABLE      0
+
+/* Styles with at least this many properties find the built-in properties in O(1) time from an index.
+ * Each such style gains an index of about 140 bytes (1 byte per built-in property).
+ * Set it to 255 to never use the index. */
+#define LV_STYLE_PROP_INDEX_MIN_CNT     8
+
+/* Get the steps of `lv_anim_path_ease_in/out/in_out` and `lv_anim_path_overshoot` from tables
+ * instead of solving the cubic Bezier curve in each frame. The values are the same. Adds about 8 kB ROM */
+#define LV_ANIM_PATH_TABLES     0
+
 /* Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -515,6 +569,17 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Size of the cache of the expanded glyph bitmaps of `lv_font_fmt_txt` fonts in bytes.
+ *Glyphs are expanded to A8 (or kept as A1 on 1 bpp layers) only once and reused while they fit.
+ *0: to disable caching*/
+#define LV_FONT_FMT_TXT_CACHE_SIZE 0
+
+/*Number of `lv_font_fmt_txt` fonts which get a page table to look up the glyphs of the characters
+ *and a kerning matrix when they are first used. It makes fonts with many or sparse character maps
+ *(e.g. CJK fonts) much faster, and needs about 2 bytes per 256 characters of a font's Unicode range.
+ *0: to disable*/
+#define LV_FONT_FMT_TXT_LOOKUP_CNT 0
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -545,6 +610,11 @@
  *Depends on LV_TXT_LINE_BREAK_LONG_LEN.*/
 #define LV_TXT_LINE_BREAK_LONG_POST_MIN_LEN 3
 
+/*Size of the cache of text sizes in bytes (the texts are copied into it).
+ *Tables, span groups and labels measure a text only once while it, its font and width don't change.
+ *0: to disable caching*/
+#define LV_TEXT_CACHE_SIZE 0
+
 /*Support bidirectional texts. Allows mixing Left-to-Right and Right-to-Left texts.
  *The direction will be processed according to the Unicode Bidirectional Algorithm:
  *https://www.w3.org/International/articles/inline-bidi-markup/uba-basics*/
@@ -613,6 +683,7 @@
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
     #define LV_LABEL_WAIT_CHAR_COUNT 3  /*The count of wait chart*/
+    #define LV_LABEL_LINE_CACHE 0   /*Store the line breaks and line widths (12 bytes per line) to not wrap the text on every draw*/
 #endif
 
 #define LV_USE_LED        1
@@ -692,6 +763,10 @@
 /*A layout similar to Grid in CSS.*/
 #define LV_USE_GRID 1
 
+/*Keep the style properties of the children and the track sizes of the grid in the containers
+ *to not read them again on each layout update. Uses about 48 bytes per child.*/
+#define LV_LAYOUT_CACHE 0
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
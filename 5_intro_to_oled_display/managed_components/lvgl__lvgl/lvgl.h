@@ -33,6 +33,7 @@ extern "C" {
 #include "src/misc/lv_profiler_builtin.h"
 #include "src/misc/lv_rb.h"
 #include "src/misc/lv_utils.h"
+#include "src/misc/cache/lv_text_cache.h"
 
 #include "src/tick/lv_tick.h"
 
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+
+# Generate the tables of the built-in cubic Bezier animation paths.
+#
+# For every time step of `lv_anim_path_ease_in/out/in_out` and `lv_anim_path_overshoot`
+# the table stores the result of `lv_cubic_bezier()`, calculated the same way with
+# integers, so the animations get exactly the same values as without the tables.
+#
+# Usage: python3 anim_path_table_gen.py
+# The generated file is committed, run this script after changing `lv_cubic_bezier()`.
+
+import os
+
+BEZIER_VAL_SHIFT = 10
+BEZIER_VAL_MAX = 1 << BEZIER_VAL_SHIFT
+CUBIC_NEWTON_ITERATIONS = 8
+CUBIC_PRECISION_BITS = 10
+
+
+def bezier_val_float(f):
+    # LV_BEZIER_VAL_FLOAT(): truncated towards zero
+    return int(f * BEZIER_VAL_MAX)
+
+
+# name of the table, control points
+paths = [
+    ('ease_in', bezier_val_float(0.42), bezier_val_float(0), bezier_val_float(1), bezier_val_float(1)),
+    ('ease_out', bezier_val_float(0), bezier_val_float(0), bezier_val_float(0.58), bezier_val_float(1)),
+    ('ease_in_out', bezier_val_float(0.42), bezier_val_float(0), bezier_val_float(0.58), bezier_val_float(1)),
+    ('overshoot', 341, 0, 683, 1300),
+]
+
+
+def c_div(a, b):
+    # Integer division of C: truncated towards zero
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def do_cubic_bezier(t, a, b, c):
+    ret = (a * t) >> CUBIC_PRECISION_BITS
+    ret = ((ret + b) * t) >> CUBIC_PRECISION_BITS
+    ret = ((ret + c) * t) >> CUBIC_PRECISION_BITS
+    return ret
+
+
+def cubic_bezier(x, x1, y1, x2, y2):
+    # A copy of `lv_cubic_bezier()` in lv_math.c
+    if x == 0 or x == BEZIER_VAL_MAX:
+        return x
+
+    cx = 3 * x1
+    bx = 3 * (x2 - x1) - cx
+    ax = (1 << CUBIC_PRECISION_BITS) - cx - bx
+
+    cy = 3 * y1
+    by = 3 * (y2 - y1) - cy
+    ay = (1 << CUBIC_PRECISION_BITS) - cy - by
+
+    # Newton's method
+    t = x
+    for _ in range(CUBIC_NEWTON_ITERATIONS):
+        xs = do_cubic_bezier(t, ax, bx, cx) - x
+        if abs(xs) <= 1:
+            return do_cubic_bezier(t, ay, by, cy)
+
+        d = (3 * ax * t) >> CUBIC_PRECISION_BITS
+        d = ((d + 2 * bx) * t) >> CUBIC_PRECISION_BITS
+        d += cx
+
+        if abs(d) <= 1:
+            break
+
+        d = c_div(xs * (1 << CUBIC_PRECISION_BITS), d)
+        if d == 0:
+            break
+        t -= d
+
+    # Bisection
+    tl = 0
+    tr = 1 << CUBIC_PRECISION_BITS
+    t = x
+    if t < tl:
+        t = tl
+    elif t > tr:
+        t = tr
+    else:
+        while tl < tr:
+            xs = do_cubic_bezier(t, ax, bx, cx)
+            if abs(xs - x) <= 1:
+                break
+            if x > xs:
+                tl = t
+            else:
+                tr = t
+            t = (tr - tl) // 2 + tl
+            if t == tl:
+                break
+
+    return do_cubic_bezier(t, ay, by, cy)
+
+
+def table(name, x1, y1, x2, y2):
+    values = [cubic_bezier(x, x1, y1, x2, y2) for x in range(BEZIER_VAL_MAX + 1)]
+    out = []
+    out.append('static const int16_t anim_path_{}_table[LV_BEZIER_VAL_MAX + 1] = {{'.format(name))
+    for i in range(0, len(values), 16):
+        out.append('    ' + ', '.join(str(v) for v in values[i:i + 16]) + ',')
+    out.append('};')
+    out.append('')
+    return out
+
+
+def header():
+    out = []
+    out.append('/**')
+    out.append(' * @file lv_anim_path_table.h')
+    out.append(' *')
+    out.append(' * The steps of the built-in cubic Bezier animation paths for each time in [0..LV_BEZIER_VAL_MAX].')
+    out.append(' * Included only by `lv_anim.c`.')
+    out.append(' */')
+    out.append('')
+    out.append('/*')
+    out.append(' **********************************************************************')
+    out.append(' *                            DO NOT EDIT')
+    out.append(' * This file is automatically generated by "anim_path_table_gen.py"')
+    out.append(' **********************************************************************')
+    out.append(' */')
+    out.append('')
+    out.append('#ifndef LV_ANIM_PATH_TABLE_H')
+    out.append('#define LV_ANIM_PATH_TABLE_H')
+    out.append('')
+    out.append('/**********************')
+    out.append(' *  STATIC VARIABLES')
+    out.append(' **********************/')
+    out.append('')
+    for p in paths:
+        out += table(*p)
+    out.append('#endif /*LV_ANIM_PATH_TABLE_H*/')
+    return out
+
+
+base_dir = os.path.abspath(os.path.dirname(__file__))
+path = os.path.join(base_dir, '..', 'src', 'misc', 'lv_anim_path_table.h')
+with open(path, 'w') as f:
+    f.write('\n'.join(header()) + '\n')
@@ -0,0 +1,400 @@
+#!/usr/bin/env python3
+
+# Generate the NORMAL blend mode image kernels of the software renderer.
+#
+# Every (source color format, destination color format, opacity, mask) combination
+# gets its own loop without any run time condition in it, so that the compiler can
+# unroll and vectorize it. They are faster than the hand-written kernels but larger, so
+# each (source, destination) pair is compiled only if its `LV_DRAW_SW_BLEND_GEN_<SRC>_TO_<DEST>`
+# option and the `LV_DRAW_SW_SUPPORT_...` option of the source are enabled. Otherwise
+# the hand-written kernels are used.
+#
+# Usage: python3 blend_kernel_gen.py
+# The generated files are committed, run this script after changing the templates.
+
+import os
+
+# The 4 variants of each kernel: the suffix of the ASM hook and the function name,
+# whether `opa` and the mask are used
+variants = [
+    {'hook': '',              'name': '',               'opa': False, 'mask': False},
+    {'hook': '_WITH_OPA',     'name': '_with_opa',      'opa': True,  'mask': False},
+    {'hook': '_WITH_MASK',    'name': '_with_mask',     'opa': False, 'mask': True},
+    {'hook': '_MIX_MASK_OPA', 'name': '_mix_mask_opa',  'opa': True,  'mask': True},
+]
+
+# Source color formats
+#  name:     prefix of the kernels
+#  cf:       LV_COLOR_FORMAT_...
+#  guard:    the kernels are compiled only if this is enabled
+#  hook:     the color format in the name of the ASM hooks
+#  hook_arg: extra argument of the ASM hooks
+#  type:     type of the source buffer
+#  bit_ofs:  the first pixel of the rows is at the `src_bit_ofs`th bit of `src_buf`
+#  step:     for sources read byte by byte: `src_buf` is moved by this many bytes after each pixel
+#  alpha:    per pixel alpha of the source pixel at `x` or None
+#  px:       expression of the source pixel at `x` for the `mix` templates
+#  opaque:   the destination pixel if the source pixel is fully opaque. None for `memcpy`
+#  lumi:     luminance of the source pixel at `x` for the I1 destination
+#  i1:       the fields above which are different for the I1 destination
+srcs = [
+    {'name': 'i1', 'cf': 'I1', 'guard': 'LV_DRAW_SW_SUPPORT_I1', 'hook': 'I1', 'hook_arg': '',
+     'type': 'uint8_t', 'bit_ofs': True, 'alpha': None,
+     'px': 'get_bit(src_buf, x + src_bit_ofs) * 255',
+     'opaque': 'l8_to_rgb565(get_bit(src_buf, x + src_bit_ofs) * 255)'},
+
+    {'name': 'al88', 'cf': 'AL88', 'guard': 'LV_DRAW_SW_SUPPORT_AL88', 'hook': 'AL88', 'hook_arg': '',
+     'type': 'lv_color16a_t', 'alpha': 'src_buf[x].alpha',
+     'px': 'src_buf[x].lumi',
+     'opaque': None,
+     'lumi': 'src_buf[x].lumi'},
+
+    {'name': 'l8', 'cf': 'L8', 'guard': 'LV_DRAW_SW_SUPPORT_L8', 'hook': 'L8', 'hook_arg': '',
+     'type': 'uint8_t', 'alpha': None,
+     'px': 'src_buf[x]',
+     'opaque': 'l8_to_rgb565(src_buf[x])',
+     'lumi': 'src_buf[x]'},
+
+    {'name': 'rgb565', 'cf': 'RGB565', 'guard': None, 'hook': 'RGB565', 'hook_arg': '',
+     'type': 'uint16_t', 'alpha': None,
+     'px': 'src_buf[x]',
+     'opaque': None,
+     'i1': {'guard': 'LV_DRAW_SW_SUPPORT_RGB565', 'type': 'lv_color16_t',
+            'lumi': 'lv_color16_luminance(src_buf[x])'}},
+
+    {'name': 'rgb888', 'cf': 'RGB888', 'guard': 'LV_DRAW_SW_SUPPORT_RGB888', 'hook': 'RGB888', 'hook_arg': ', 3',
+     'type': 'uint8_t', 'step': 3, 'alpha': None,
+     'px': 'src_buf',
+     'opaque': 'rgb888_to_rgb565(src_buf)',
+     'i1': {'hook_arg': '', 'lumi': 'lv_color24_luminance(src_buf)'}},
+
+    {'name': 'xrgb8888', 'cf': 'XRGB8888', 'guard': 'LV_DRAW_SW_SUPPORT_XRGB8888', 'hook': 'RGB888', 'hook_arg': ', 4',
+     'type': 'uint8_t', 'step': 4, 'alpha': None,
+     'px': 'src_buf',
+     'opaque': 'rgb888_to_rgb565(src_buf)',
+     'i1': {'hook_arg': '', 'lumi': 'lv_color24_luminance(src_buf)'}},
+
+    {'name': 'argb8888', 'cf': 'ARGB8888', 'guard': 'LV_DRAW_SW_SUPPORT_ARGB8888', 'hook': 'ARGB8888', 'hook_arg': '',
+     'type': 'uint8_t', 'step': 4, 'alpha': 'src_buf[3]',
+     'px': 'src_buf',
+     'opaque': None,
+     'i1': {'type': 'lv_color32_t', 'step': None, 'alpha': 'src_buf[x].alpha',
+            'lumi': 'lv_color32_luminance(src_buf[x])'}},
+]
+
+# Destination color formats
+#  srcs:         names of the source color formats with generated kernels
+#  mix:          templates by the type of the source pixel mixing `{px}` into the destination
+#                pixel at `x` with `{mix}`
+#  mix_partial:  the same for 0 < `{mix}` < 255. Used in the `_with_opa` kernels of sources without
+#                alpha as `lv_draw_sw_blend()` calls them only with LV_OPA_MIN < opa < LV_OPA_MAX
+#  threshold:    the pixels are set if their luminance is greater than the dithering threshold.
+#                The mixing is done on the luminance with `lv_color_8_8_mix()`
+dests = [
+    {'name': 'rgb565', 'cf': 'RGB565', 'hook': 'RGB565', 'type': 'uint16_t', 'px_size': 2,
+     'file': 'lv_draw_sw_blend_to_rgb565_gen.h',
+     'srcs': ['i1', 'al88', 'l8', 'rgb565', 'rgb888', 'xrgb8888', 'argb8888'],
+     'threshold': False,
+     'mix': {
+         'uint8_t': 'lv_color_8_16_mix({px}, dest_buf[x], {mix})',
+         'lv_color16a_t': 'lv_color_8_16_mix({px}, dest_buf[x], {mix})',
+         'uint16_t': 'color_16_16_mix({px}, dest_buf[x], {mix})',
+         'uint8_t *': 'lv_color_24_16_mix({px}, dest_buf[x], {mix})',
+     },
+     'mix_partial': {
+         'uint8_t': 'lv_color_8_16_mix_partial({px}, dest_buf[x], {mix})',
+         'lv_color16a_t': 'lv_color_8_16_mix_partial({px}, dest_buf[x], {mix})',
+         'uint16_t': 'color_16_16_mix({px}, dest_buf[x], {mix})',
+         'uint8_t *': 'lv_color_24_16_mix_partial({px}, dest_buf[x], {mix})',
+     }},
+
+    # I1 sources keep the hand-written kernels as they copy whole bytes
+    {'name': 'i1', 'cf': 'I1', 'hook': 'I1', 'type': 'uint8_t',
+     'file': 'lv_draw_sw_blend_to_i1_gen.h',
+     'srcs': ['al88', 'l8', 'rgb565', 'rgb888', 'xrgb8888', 'argb8888'],
+     'threshold': True},
+]
+
+
+def src_for(src, dest):
+    """The fields of `src` with the ones specific to `dest`"""
+    res = dict(src)
+    res.update(src.get(dest['name'], {}))
+    return res
+
+
+def option(src, dest):
+    """The config option enabling the kernels of `src` blended to `dest`"""
+    return 'LV_DRAW_SW_BLEND_GEN_{}_TO_{}'.format(src['cf'], dest['cf'])
+
+
+def condition(src, dest):
+    """The preprocessor condition of compiling the kernels of `src` blended to `dest`"""
+    if src['guard'] is None:
+        return option(src, dest)
+    return '{} && {}'.format(src['guard'], option(src, dest))
+
+
+def mix_type(src):
+    """The type of the source pixel as seen by the mix functions"""
+    if src.get('step'):
+        return 'uint8_t *'
+    return src['type']
+
+
+def mix_value(src, variant):
+    """The mix ratio of the source pixel at `x`"""
+    alpha = src['alpha']
+    if variant['opa'] and variant['mask']:
+        return 'LV_OPA_MIX3({}, mask_buf[x], opa)'.format(alpha) if alpha else 'LV_OPA_MIX2(mask_buf[x], opa)'
+    if variant['opa']:
+        return 'LV_OPA_MIX2({}, opa)'.format(alpha) if alpha else 'opa'
+    if variant['mask']:
+        return 'LV_OPA_MIX2({}, mask_buf[x])'.format(alpha) if alpha else 'mask_buf[x]'
+    return alpha
+
+
+def kernel_name(src, dest, variant):
+    return '{}_blend_normal_to_{}{}'.format(src['name'], dest['name'], variant['name'])
+
+
+def wrap(head, items, tail):
+    """Join `items` after `head` and wrap them to 120 columns aligned after `head`"""
+    lines = [head]
+    for i, item in enumerate(items):
+        item += tail if i == len(items) - 1 else ','
+        if i == 0:
+            lines[-1] += item
+        elif len(lines[-1]) + 1 + len(item) > 120:
+            lines.append(' ' * len(head) + item)
+        else:
+            lines[-1] += ' ' + item
+    return '\n'.join(lines)
+
+
+def split_last_arg(line):
+    """Move the last argument of the outermost call in `line` to a new line aligned to the other arguments"""
+    depth = 0
+    for i, c in enumerate(line):
+        depth += (c == '(') - (c == ')')
+        if depth == 1 and line.startswith(', ', i):
+            split = i
+    return line[:split + 1] + '\n' + ' ' * (line.index('(') + 1) + line[split + 2:]
+
+
+def row_body(src, dest, variant):
+    """The lines of the loop body writing the destination pixel at `x`. None if the rows are copied"""
+    mix = mix_value(src, variant)
+
+    if dest['threshold']:
+        out = []
+        if mix is None:
+            out.append('        uint8_t lumi = {};'.format(src['lumi']))
+        else:
+            out.append('        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;')
+            line = '        lv_color_8_8_mix({}, &lumi, {});'.format(src['lumi'], mix)
+            out.append(split_last_arg(line) if len(line) > 120 else line)
+        out.append('        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);')
+        out.append('        else clear_bit(dest_buf, x + bit_ofs);')
+        return out
+
+    if mix is None and src['opaque'] is None:
+        return None
+    elif mix is None:
+        value = src['opaque']
+    elif variant['opa'] and not variant['mask'] and src['alpha'] is None:
+        value = dest['mix_partial'][mix_type(src)].format(px=src['px'], mix=mix)
+    else:
+        value = dest['mix'][mix_type(src)].format(px=src['px'], mix=mix)
+
+    line = '        dest_buf[x] = {};'.format(value)
+    return [split_last_arg(line) if len(line) > 120 else line]
+
+
+def kernel(src, dest, variant):
+    name = kernel_name(src, dest, variant)
+    hook = 'LV_DRAW_SW_{}_BLEND_NORMAL_TO_{}{}(dsc{})'.format(src['hook'], dest['hook'], variant['hook'], src['hook_arg'])
+    body = row_body(src, dest, variant)
+
+    out = []
+
+    # The loop of a row gets its buffers as restrict parameters as compilers ignore
+    # restrict on local variables, but keep it when the function is inlined
+    if body is not None:
+        params = ['{} * LV_DRAW_SW_RESTRICT dest_buf'.format(dest['type'])]
+        if dest['threshold']:
+            params.append('int32_t bit_ofs')
+        params.append('const {} * LV_DRAW_SW_RESTRICT src_buf'.format(src['type']))
+        if src.get('bit_ofs'):
+            params.append('int32_t src_bit_ofs')
+        if variant['mask']:
+            params.append('const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf')
+        params.append('int32_t w')
+        if variant['opa']:
+            params.append('lv_opa_t opa')
+        if dest['threshold']:
+            params.append('const uint8_t * th_row')
+        out.append(wrap('static inline void {}_row('.format(name), params, ')'))
+        out.append('{')
+        out.append('    int32_t x;')
+        if src.get('step'):
+            out.append('    for(x = 0; x < w; x++, src_buf += {}) {{'.format(src['step']))
+        else:
+            out.append('    for(x = 0; x < w; x++) {')
+        out += body
+        out.append('    }')
+        out.append('}')
+        out.append('')
+
+    out.append('static void LV_ATTRIBUTE_FAST_MEM {}(lv_draw_sw_blend_image_dsc_t * dsc)'.format(name))
+    out.append('{')
+    out.append('    if(LV_RESULT_INVALID != {}) return;'.format(hook))
+    out.append('')
+    out.append('    int32_t w = dsc->dest_w;')
+    out.append('    int32_t h = dsc->dest_h;')
+    if variant['opa']:
+        out.append('    lv_opa_t opa = dsc->opa;')
+    out.append('    {} * dest_buf = dsc->dest_buf;'.format(dest['type']))
+    out.append('    int32_t dest_stride = dsc->dest_stride;')
+    out.append('    const {} * src_buf = dsc->src_buf;'.format(src['type']))
+    out.append('    int32_t src_stride = dsc->src_stride;')
+    if src.get('bit_ofs'):
+        out.append('    int32_t src_bit_ofs = dsc->src_bit_ofs;')
+    if variant['mask']:
+        out.append('    const lv_opa_t * mask_buf = dsc->mask_buf;')
+        out.append('    int32_t mask_stride = dsc->mask_stride;')
+    if dest['threshold']:
+        out.append('    int32_t bit_ofs = dsc->relative_area.x1 % 8;')
+        out.append('    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;')
+        out.append('    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;')
+    out.append('')
+    if body is None:
+        out.append('    uint32_t line_in_bytes = w * {};'.format(dest['px_size']))
+    out.append('    int32_t y;')
+    out.append('    for(y = 0; y < h; y++) {')
+    if body is None:
+        out.append('        lv_memcpy(dest_buf, src_buf, line_in_bytes);')
+    else:
+        args = ['dest_buf']
+        if dest['threshold']:
+            args.append('bit_ofs')
+        args.append('src_buf')
+        if src.get('bit_ofs'):
+            args.append('src_bit_ofs')
+        if variant['mask']:
+            args.append('mask_buf')
+        args.append('w')
+        if variant['opa']:
+            args.append('opa')
+        if dest['threshold']:
+            args.append('th_row')
+            out.append('        const uint8_t * th_row = dither_row(abs_x, abs_y + y);')
+        out.append(wrap('        {}_row('.format(name), args, ');'))
+    out.append('        dest_buf = drawbuf_next_row(dest_buf, dest_stride);')
+    out.append('        src_buf = drawbuf_next_row(src_buf, src_stride);')
+    if variant['mask']:
+        out.append('        mask_buf += mask_stride;')
+    out.append('    }')
+    out.append('}')
+    out.append('')
+    return out
+
+
+def table_name(src, dest):
+    return '{}_blend_normal_to_{}_kernels'.format(src['name'], dest['name'])
+
+
+def dest_file(dest):
+    dest_srcs = [src_for(src, dest) for src in srcs if src['name'] in dest['srcs']]
+
+    out = []
+    guard = os.path.splitext(dest['file'])[0].upper() + '_H'
+    out.append('/**')
+    out.append(' * @file {}'.format(dest['file']))
+    out.append(' *')
+    out.append(' * The NORMAL blend mode image kernels of `lv_draw_sw_blend_to_{}.c`.'.format(dest['name']))
+    out.append(' * Included only by that file as it uses its ASM hooks and static helpers.')
+    out.append(' */')
+    out.append('')
+    out.append('/*')
+    out.append(' **********************************************************************')
+    out.append(' *                            DO NOT EDIT')
+    out.append(' * This file is automatically generated by "blend_kernel_gen.py"')
+    out.append(' **********************************************************************')
+    out.append(' */')
+    out.append('')
+    out.append('#ifndef ' + guard)
+    out.append('#define ' + guard)
+    out.append('')
+    out.append('/*********************')
+    out.append(' *      DEFINES')
+    out.append(' *********************/')
+    out.append('')
+    out.append('/*1 if the kernels of any source color format are compiled*/')
+    head = '#define BLEND_NORMAL_GEN_ENABLED ('
+    conds = ['({})'.format(condition(src, dest)) for src in dest_srcs]
+    out.append(head + (' || \\\n' + ' ' * len(head)).join(conds) + ')')
+    out.append('')
+    out.append('#if BLEND_NORMAL_GEN_ENABLED')
+    out.append('')
+    out.append('/*Index of a kernel in the tables by the used opacity and mask*/')
+    out.append('#define BLEND_NORMAL_KERNEL_INDEX(dsc) (((dsc)->mask_buf ? 2 : 0) + ((dsc)->opa < LV_OPA_MAX ? 1 : 0))')
+    out.append('')
+    out.append('/**********************')
+    out.append(' *      TYPEDEFS')
+    out.append(' **********************/')
+    out.append('')
+    out.append('typedef void (*blend_normal_kernel_t)(lv_draw_sw_blend_image_dsc_t * dsc);')
+    out.append('')
+    out.append('/**********************')
+    out.append(' *   STATIC FUNCTIONS')
+    out.append(' **********************/')
+    out.append('')
+
+    for src in dest_srcs:
+        out.append('#if ' + condition(src, dest))
+        out.append('')
+        for variant in variants:
+            out += kernel(src, dest, variant)
+        out.append('static const blend_normal_kernel_t {}[4] = {{'.format(table_name(src, dest)))
+        for variant in variants:
+            out.append('    {},'.format(kernel_name(src, dest, variant)))
+        out.append('};')
+        out.append('')
+        out.append('#endif /*{}*/'.format(condition(src, dest)))
+        out.append('')
+
+    out.append('/**')
+    out.append(' * Get the kernel to blend an image in NORMAL mode')
+    out.append(' * @param dsc       the blend descriptor')
+    out.append(' * @return          the kernel or NULL if the source color format has no generated kernels')
+    out.append(' */')
+    out.append('static inline blend_normal_kernel_t get_blend_normal_kernel(const lv_draw_sw_blend_image_dsc_t * dsc)')
+    out.append('{')
+    out.append('    const blend_normal_kernel_t * kernels;')
+    out.append('    switch(dsc->src_color_format) {')
+    for src in dest_srcs:
+        out.append('#if ' + condition(src, dest))
+        out.append('        case LV_COLOR_FORMAT_{}:'.format(src['cf']))
+        out.append('            kernels = {};'.format(table_name(src, dest)))
+        out.append('            break;')
+        out.append('#endif')
+    out.append('        default:')
+    out.append('            return NULL;')
+    out.append('    }')
+    out.append('')
+    out.append('    return kernels[BLEND_NORMAL_KERNEL_INDEX(dsc)];')
+    out.append('}')
+    out.append('')
+    out.append('#endif /*BLEND_NORMAL_GEN_ENABLED*/')
+    out.append('')
+    out.append('#endif /*{}*/'.format(guard))
+    return out
+
+
+base_dir = os.path.abspath(os.path.dirname(__file__))
+
+for dest in dests:
+    path = os.path.join(base_dir, '..', 'src', 'draw', 'sw', 'blend', dest['file'])
+    with open(path, 'w') as f:
+        f.write('\n'.join(dest_file(dest)) + '\n')
@@ -51,6 +51,10 @@ fout.write(
 #define LV_DRAW_SW_ASM_HELIUM       2
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
+#define LV_DRAW_SW_I1_DITHER_NONE   0
+#define LV_DRAW_SW_I1_DITHER_BAYER4 1
+#define LV_DRAW_SW_I1_DITHER_BAYER8 2
+
 /* Handle special Kconfig options */
 #ifndef LV_KCONFIG_IGNORE
     #include "lv_conf_kconfig.h"
@@ -86,6 +86,8 @@ typedef struct lv_global_t {
 
     lv_ll_t style_trans_ll;
     bool style_refresh;
+    bool style_trans_refr_pending;
+    uint32_t style_trans_remove_cnt;    /**< Incremented when a transition is freed*/
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
@@ -120,6 +122,9 @@ typedef struct lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_TEXT_CACHE_SIZE > 0
+    lv_cache_t * text_cache;
+#endif
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -189,6 +194,17 @@ typedef struct lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_cache_t * font_fmt_txt_cache;
+    uint32_t font_fmt_txt_cache_hit_cnt;
+    uint32_t font_fmt_txt_cache_miss_cnt;
+#endif
+
+#if LV_FONT_FMT_TXT_LOOKUP_CNT > 0
+    struct lv_font_fmt_txt_lookup_t * font_fmt_txt_lookups[LV_FONT_FMT_TXT_LOOKUP_CNT];
+    lv_mutex_t font_fmt_txt_lookup_lock;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
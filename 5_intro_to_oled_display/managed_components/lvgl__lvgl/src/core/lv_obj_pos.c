@@ -10,6 +10,7 @@
 #include "../layouts/lv_layout_private.h"
 #include "lv_obj_event_private.h"
 #include "lv_obj_draw_private.h"
+#include "lv_obj_style_private.h"
 #include "lv_obj_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -299,6 +300,9 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     LV_PROFILER_BEGIN;
     update_layout_mutex = true;
 
+    /*Apply the changes of the style transitions first as they might change the layout*/
+    lv_obj_style_refresh_transitions();
+
     lv_obj_t * scr = lv_obj_get_screen(obj);
     /*Repeat until there are no more layout invalidations*/
     while(scr->scr_layout_inv) {
@@ -44,6 +44,9 @@ struct lv_obj_spec_attr_t {
     uint16_t scroll_snap_y : 2;     /**< Where to align the snappable children vertically*/
     uint16_t scroll_dir : 4;        /**< The allowed scroll direction(s), see `lv_dir_t`*/
     uint16_t layer_type : 2;        /**< Cache the layer type here. Element of lv_intermediate_layer_type_t */
+#if LV_LAYOUT_CACHE
+    struct lv_layout_cache_t * layout_cache;    /**< Style properties of the children and track sizes of the layout*/
+#endif
 };
 
 struct lv_obj_t {
@@ -54,6 +57,9 @@ struct lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_TABLE
+    struct lv_obj_style_table_t * style_table;
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -70,6 +76,9 @@ struct lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+#if LV_LAYOUT_CACHE
+    uint16_t layout_item_cached : 1;
+#endif
 };
 
 
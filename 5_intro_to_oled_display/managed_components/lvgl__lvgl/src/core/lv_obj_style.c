@@ -24,6 +24,12 @@
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
 
+/*Special values in `lv_obj_style_table_t::index`, the others are the index of the value + TABLE_FIRST_VALUE*/
+#define TABLE_UNKNOWN           0
+#define TABLE_NOT_SET           1
+#define TABLE_FIRST_VALUE       2
+#define TABLE_VALUE_STEP        8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,8 +40,21 @@ typedef struct {
     lv_style_selector_t selector;
     lv_style_value_t start_value;
     lv_style_value_t end_value;
+    uint8_t refr_pending : 1;   /**< The new value is set but the object is not refreshed yet*/
 } trans_t;
 
+/*The resolved style properties of a part of an object in its current state.
+ *The properties are resolved when they are first read.*/
+typedef struct lv_obj_style_table_t {
+    struct lv_obj_style_table_t * next;
+    lv_style_value_t * values;
+    lv_part_t part;
+    lv_state_t state;
+    uint8_t value_cnt;
+    uint8_t value_size;
+    uint8_t index[LV_STYLE_NUM_BUILT_IN_PROPS];
+} lv_obj_style_table_t;
+
 typedef enum {
     CACHE_ZERO = 0,
     CACHE_TRUE = 1,
@@ -55,8 +74,13 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_part_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
+static lv_style_res_t get_prop_table(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                     lv_style_value_t * v);
+static void style_table_reset(lv_obj_t * obj);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
+static void refresh_style_core(lv_obj_t * obj, lv_part_t part, uint8_t prop_flags);
+static void trans_refresh(trans_t * tr);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
@@ -276,46 +300,44 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The style has changed, even if the object is not refreshed now*/
+    style_table_reset(obj);
+
     if(!style_refr) return;
 
-    lv_obj_invalidate(obj);
+    /*`LV_STYLE_PROP_ANY` has all the flags*/
+    refresh_style_core(obj, lv_obj_style_get_selector_part(selector), lv_style_prop_lookup_flags(prop));
+}
 
-    lv_part_t part = lv_obj_style_get_selector_part(selector);
+void lv_obj_style_refresh_transitions(void)
+{
+    if(!LV_GLOBAL_DEFAULT()->style_trans_refr_pending) return;
 
-    bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYOUT_UPDATE);
-    bool is_ext_draw = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE);
-    bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE);
-    bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYER_UPDATE);
+    LV_PROFILER_BEGIN;
 
-    if(is_layout_refr) {
-        if(part == LV_PART_ANY ||
-           part == LV_PART_MAIN ||
-           lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
-           lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
-            lv_obj_send_event(obj, LV_EVENT_STYLE_CHANGED, NULL);
-            lv_obj_mark_layout_as_dirty(obj);
-        }
-    }
-    if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
-        lv_obj_t * parent = lv_obj_get_parent(obj);
-        if(parent) lv_obj_mark_layout_as_dirty(parent);
-    }
+    /*The events sent while refreshing could mark transitions before the current one too*/
+    while(LV_GLOBAL_DEFAULT()->style_trans_refr_pending) {
+        LV_GLOBAL_DEFAULT()->style_trans_refr_pending = false;
 
-    /*Cache the layer type*/
-    if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layer_refr) {
-        lv_obj_update_layer_type(obj);
-    }
+        /*The transitions of an object are added together so the ones to refresh together are adjacent*/
+        trans_t * tr = lv_ll_get_head(style_trans_ll_p);
+        while(tr) {
+            if(tr->refr_pending == 0) {
+                tr = lv_ll_get_next(style_trans_ll_p, tr);
+                continue;
+            }
 
-    if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
-        lv_obj_refresh_ext_draw_size(obj);
-    }
-    lv_obj_invalidate(obj);
+            uint32_t remove_cnt = LV_GLOBAL_DEFAULT()->style_trans_remove_cnt;
+            trans_refresh(tr);
 
-    if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
-        if(part != LV_PART_SCROLLBAR) {
-            refresh_children_style(obj);
+            /*The events sent while refreshing could delete any transitions so start again then.
+             *Else `tr` is still valid and the transitions refreshed with it are already cleared.*/
+            if(remove_cnt == LV_GLOBAL_DEFAULT()->style_trans_remove_cnt) tr = lv_ll_get_next(style_trans_ll_p, tr);
+            else tr = lv_ll_get_head(style_trans_ll_p);
         }
     }
+
+    LV_PROFILER_END;
 }
 
 void lv_obj_enable_style_refresh(bool en)
@@ -615,6 +637,22 @@ void lv_obj_update_layer_type(lv_obj_t * obj)
     }
 }
 
+void lv_obj_style_table_delete(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_TABLE
+    lv_obj_style_table_t * table = obj->style_table;
+    while(table) {
+        lv_obj_style_table_t * next = table->next;
+        lv_free(table->values);
+        lv_free(table);
+        table = next;
+    }
+    obj->style_table = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -745,6 +783,92 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Get a style property from the style table of the object's part.
+ * If the property is not resolved yet, get it with `get_prop_core` and store it in the table.
+ * Only the current state of the object is stored, other states are always resolved again.
+ */
+static lv_style_res_t get_prop_table(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                     lv_style_value_t * v)
+{
+#if LV_OBJ_STYLE_TABLE
+    /*Transitions are skipped only temporarily, e.g. to get the start value of a transition*/
+    if(prop >= LV_STYLE_NUM_BUILT_IN_PROPS || obj->skip_trans ||
+       lv_obj_style_get_selector_state(selector) != obj->state) {
+        return get_prop_core(obj, selector, prop, v);
+    }
+
+    lv_part_t part = lv_obj_style_get_selector_part(selector);
+    lv_obj_style_table_t * table = obj->style_table;
+    while(table && table->part != part) table = table->next;
+
+    if(table == NULL) {
+        table = lv_malloc_zeroed(sizeof(lv_obj_style_table_t));
+        if(table == NULL) return get_prop_core(obj, selector, prop, v);
+        table->part = part;
+        table->state = obj->state;
+        table->next = obj->style_table;
+        ((lv_obj_t *)obj)->style_table = table;
+    }
+    else if(table->state != obj->state) {
+        lv_memzero(table->index, sizeof(table->index));
+        table->value_cnt = 0;
+        table->state = obj->state;
+    }
+
+    uint32_t idx = table->index[prop];
+    if(idx == TABLE_NOT_SET) return LV_STYLE_RES_NOT_FOUND;
+    if(idx != TABLE_UNKNOWN) {
+        *v = table->values[idx - TABLE_FIRST_VALUE];
+        return LV_STYLE_RES_FOUND;
+    }
+
+    lv_style_res_t found = get_prop_core(obj, selector, prop, v);
+    if(found != LV_STYLE_RES_FOUND) {
+        table->index[prop] = TABLE_NOT_SET;
+        return found;
+    }
+
+    if(table->value_cnt == table->value_size) {
+        lv_style_value_t * values = lv_realloc(table->values,
+                                               (table->value_size + TABLE_VALUE_STEP) * sizeof(lv_style_value_t));
+        /*Not stored, but the value is still valid*/
+        if(values == NULL) return found;
+        table->values = values;
+        table->value_size += TABLE_VALUE_STEP;
+    }
+
+    table->values[table->value_cnt] = *v;
+    table->index[prop] = table->value_cnt + TABLE_FIRST_VALUE;
+    table->value_cnt++;
+    return found;
+#else
+    return get_prop_core(obj, selector, prop, v);
+#endif
+}
+
+/**
+ * Forget the resolved style properties of an object as its styles have changed
+ * @param obj   pointer to an object
+ */
+static void style_table_reset(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_TABLE
+    lv_obj_style_table_t * table;
+    for(table = obj->style_table; table; table = table->next) {
+        lv_memzero(table->index, sizeof(table->index));
+        table->value_cnt = 0;
+    }
+#endif
+
+#if LV_LAYOUT_CACHE
+    /*The parent's layout needs to read the properties again too*/
+    obj->layout_item_cached = 0;
+#endif
+
+    LV_UNUSED(obj);
+}
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -778,6 +902,10 @@ static void refresh_children_style(lv_obj_t * obj)
     uint32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
+#if LV_LAYOUT_CACHE
+        /*The inherited base direction might have changed*/
+        child->layout_item_cached = 0;
+#endif
         lv_obj_invalidate(child);
         lv_obj_send_event(child, LV_EVENT_STYLE_CHANGED, NULL);
         lv_obj_invalidate(child);
@@ -786,6 +914,88 @@ static void refresh_children_style(lv_obj_t * obj)
     }
 }
 
+/**
+ * Refresh an object after some of its style properties have changed
+ * @param obj           pointer to an object
+ * @param part          the part whose properties have changed or `LV_PART_ANY`
+ * @param prop_flags    the `LV_STYLE_PROP_FLAG_...` flags of the changed properties
+ */
+static void refresh_style_core(lv_obj_t * obj, lv_part_t part, uint8_t prop_flags)
+{
+    lv_obj_invalidate(obj);
+
+    bool is_layout_refr = prop_flags & LV_STYLE_PROP_FLAG_LAYOUT_UPDATE;
+    bool is_ext_draw = prop_flags & LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE;
+    bool is_inheritable = prop_flags & LV_STYLE_PROP_FLAG_INHERITABLE;
+    bool is_layer_refr = prop_flags & LV_STYLE_PROP_FLAG_LAYER_UPDATE;
+
+    if(is_layout_refr) {
+        if(part == LV_PART_ANY ||
+           part == LV_PART_MAIN ||
+           lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
+           lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
+            lv_obj_send_event(obj, LV_EVENT_STYLE_CHANGED, NULL);
+            lv_obj_mark_layout_as_dirty(obj);
+        }
+    }
+    if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layout_refr) {
+        lv_obj_t * parent = lv_obj_get_parent(obj);
+        if(parent) lv_obj_mark_layout_as_dirty(parent);
+    }
+
+    /*Cache the layer type*/
+    if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layer_refr) {
+        lv_obj_update_layer_type(obj);
+    }
+
+    if(is_ext_draw) {
+        lv_obj_refresh_ext_draw_size(obj);
+    }
+    lv_obj_invalidate(obj);
+
+    if(is_inheritable && (is_ext_draw || is_layout_refr)) {
+        if(part != LV_PART_SCROLLBAR) {
+            refresh_children_style(obj);
+        }
+    }
+}
+
+/**
+ * Refresh the object of a transition once for the pending changes of
+ * all its transitions on the same part
+ * @param tr    a transition with pending refresh
+ */
+static void trans_refresh(trans_t * tr)
+{
+    lv_obj_t * obj = tr->obj;
+    lv_style_selector_t selector = tr->selector;
+
+    /*Find the first of the adjacent transitions of the object*/
+    trans_t * tr_i = tr;
+    trans_t * tr_prev = lv_ll_get_prev(style_trans_ll_p, tr_i);
+    while(tr_prev && tr_prev->obj == obj) {
+        tr_i = tr_prev;
+        tr_prev = lv_ll_get_prev(style_trans_ll_p, tr_i);
+    }
+
+    /*Collect the flags of the pending changes on the same part*/
+    uint8_t prop_flags = 0;
+    while(tr_i && tr_i->obj == obj) {
+        if(tr_i->refr_pending && tr_i->selector == selector) {
+            uint8_t f = lv_style_prop_lookup_flags(tr_i->prop);
+            /*The children are refreshed only if an inherited property changes the size or layout*/
+            if((f & (LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE | LV_STYLE_PROP_FLAG_LAYOUT_UPDATE)) == 0) {
+                f &= ~LV_STYLE_PROP_FLAG_INHERITABLE;
+            }
+            prop_flags |= f;
+            tr_i->refr_pending = 0;
+        }
+        tr_i = lv_ll_get_next(style_trans_ll_p, tr_i);
+    }
+
+    refresh_style_core(obj, lv_obj_style_get_selector_part(selector), prop_flags);
+}
+
 /**
  * Remove the transition from object's part's property.
  * - Remove the transition from `lv_obj_style_trans_ll` and free it
@@ -821,6 +1031,8 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
             lv_anim_delete(tr, NULL);
             lv_ll_remove(style_trans_ll_p, tr);
             lv_free(tr);
+            LV_GLOBAL_DEFAULT()->style_trans_remove_cnt++;
+            style_table_reset(obj);
             removed = true;
 
         }
@@ -886,7 +1098,20 @@ static void trans_anim_cb(void * _tr, int32_t v)
             }
         }
         lv_style_set_prop((lv_style_t *)obj->styles[i].style, tr->prop, value_final);
-        if(refr) lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
+        if(refr) {
+            /*Only forget the old values now. Invalidating and updating the object is done once for all
+             *the transitions of the object when the next frame is prepared. See `lv_obj_update_layout()`*/
+            style_table_reset(obj);
+            if(style_refr && tr->refr_pending == 0) {
+                /*Be sure the next frame will be prepared*/
+                if(LV_GLOBAL_DEFAULT()->style_trans_refr_pending == false) {
+                    lv_display_t * disp = lv_obj_get_display(obj);
+                    if(disp && disp->refr_timer) lv_timer_resume(disp->refr_timer);
+                }
+                tr->refr_pending = 1;
+                LV_GLOBAL_DEFAULT()->style_trans_refr_pending = true;
+            }
+        }
         break;
 
     }
@@ -925,6 +1150,9 @@ static void trans_anim_completed_cb(lv_anim_t * a)
     /*Remove the transitioned property from trans. style
      *if there no more transitions for this property
      *It allows changing it by normal styles*/
+    /*Apply the last value before the transition is freed*/
+    if(tr->refr_pending) trans_refresh(tr);
+
     bool running = false;
     trans_t * tr_i;
     LV_LL_READ(style_trans_ll_p, tr_i) {
@@ -940,9 +1168,11 @@ static void trans_anim_completed_cb(lv_anim_t * a)
             if(obj->styles[i].is_trans && obj->styles[i].selector == tr->selector) {
                 lv_ll_remove(style_trans_ll_p, tr);
                 lv_free(tr);
+                LV_GLOBAL_DEFAULT()->style_trans_remove_cnt++;
 
                 lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                style_table_reset(obj);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
@@ -969,6 +1199,8 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+    style_table_reset(obj);
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1062,7 +1294,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
     if((part == LV_PART_MAIN ? obj->style_main_prop_is_set : obj->style_other_prop_is_set) & prop_shifted)
 #endif
     {
-        found = get_prop_core(obj, selector, prop, value_act);
+        found = get_prop_table(obj, selector, prop, value_act);
         if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
     }
 
@@ -1089,7 +1321,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 #endif
             {
                 selector = part | obj->state;
-                found = get_prop_core(obj, selector, prop, value_act);
+                found = get_prop_table(obj, selector, prop, value_act);
                 if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
             }
             /*Check the parent too.*/
@@ -57,6 +57,13 @@ void lv_obj_style_init(void);
  */
 void lv_obj_style_deinit(void);
 
+/**
+ * Refresh the objects whose style properties were changed by transitions since the last call.
+ * The changes of an object are applied together to invalidate and update it only once per frame.
+ * Called by LVGL in `lv_obj_update_layout()`
+ */
+void lv_obj_style_refresh_transitions(void);
+
 /**
  * Used internally to create a style transition
  * @param obj
@@ -77,6 +84,13 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
  */
 lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
+/**
+ * Free the tables of the resolved style properties of an object.
+ * Called when the object is deleted.
+ * @param obj   pointer to an object
+ */
+void lv_obj_style_table_delete(lv_obj_t * obj);
+
 /**
  * Update the layer type of a widget bayed on its current styles.
  * The result will be stored in `obj->spec_attr->layer_type`
@@ -186,6 +186,10 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     parent->spec_attr->children[lv_obj_get_child_count(parent) - 1] = obj;
 
     obj->parent = parent;
+#if LV_LAYOUT_CACHE
+    /*Filled by the old parent's layout*/
+    obj->layout_item_cached = 0;
+#endif
 
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
@@ -39,7 +39,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void lv_refr_join_area(void);
+static void inv_area_add(lv_display_t * disp, const lv_area_t * area_p);
+static bool inv_area_cut(lv_area_t * area_p, const lv_area_t * cut_p);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
@@ -297,6 +298,12 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
         com_area.x1 &= ~0x7; /*Round down: Nx8*/
         com_area.x2 |= 0x7;    /*Round up: Nx8 - 1*/
     }
+    else if(LV_COLOR_FORMAT_IS_PAGED(disp->color_format)) {
+        /*Pages are 8 px high so make sure that the Y coordinates are page aligned.*/
+        com_area.y1 &= ~0x7;
+        com_area.y2 |= 0x7;
+        if(com_area.y2 > scr_area.y2) com_area.y2 = scr_area.y2;
+    }
 
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
@@ -309,20 +316,7 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_result_t res = lv_display_send_event(disp, LV_EVENT_INVALIDATE_AREA, &com_area);
     if(res != LV_RESULT_OK) return;
 
-    /*Save only if this area is not in one of the saved areas*/
-    uint16_t i;
-    for(i = 0; i < disp->inv_p; i++) {
-        if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
-    }
-
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
-    }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
+    inv_area_add(disp, &com_area);
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -393,7 +387,6 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         goto refr_finish;
     }
 
-    lv_refr_join_area();
     refr_sync_areas();
     refr_invalid_areas();
 
@@ -436,42 +429,118 @@ refr_finish:
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Add an area to the invalid areas and coalesce it with the saved ones right away.
+ * The saved areas are kept so that joining any two of them would render more pixels,
+ * therefore they don't need to be joined again before refreshing.
+ * If the buffer is full the area is joined with the area which adds the fewest pixels,
+ * instead of redrawing the whole screen.
+ * @param disp      pointer to a display
+ * @param area_p    the new invalid area, already clipped to the screen
  */
-static void lv_refr_join_area(void)
+static void inv_area_add(lv_display_t * disp, const lv_area_t * area_p)
 {
     LV_PROFILER_BEGIN;
-    uint32_t join_from;
-    uint32_t join_in;
+    lv_area_t area = *area_p;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
+    lv_area_t ext_area;
+    uint32_t i;
+
+    while(1) {
+        /*Consider the neighbors too, not only the overlapping areas*/
+        ext_area = area;
+        lv_area_increase(&ext_area, 1, 1);
+
+        int32_t best_i = -1;
+        int64_t best_gain = -1;
+        bool shrunk = false;
+        for(i = 0; i < disp->inv_p; i++) {
+            lv_area_t * saved = &disp->inv_areas[i];
+            if(lv_area_is_in(&area, saved, 0)) {
+                LV_PROFILER_END;
+                return;
+            }
+            if(!lv_area_is_on(&ext_area, saved)) continue;
+
+            /*Join if the joined area has no more pixels than the two areas (counting the common part twice).
+             *Joining neighbors with no extra pixels still saves refreshing an area.*/
+            lv_area_join(&joined_area, &area, saved);
+            int64_t gain = (int64_t)lv_area_get_size(&area) + lv_area_get_size(saved) - lv_area_get_size(&joined_area);
+            if(gain > best_gain) {
+                best_gain = gain;
+                best_i = i;
+            }
+        }
 
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
+        if(best_i < 0) {
+            /*Don't draw the common parts twice if cutting them leaves a single rectangle*/
+            for(i = 0; i < disp->inv_p; i++) {
+                if(inv_area_cut(&area, &disp->inv_areas[i])) shrunk = true;
             }
+            if(shrunk) continue;
+        }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
+        if(best_i < 0 && disp->inv_p >= LV_INV_BUF_SIZE) {
+            /*No place for the area, join it with the area which adds the fewest pixels*/
+            int64_t best_cost = INT64_MAX;
+            for(i = 0; i < disp->inv_p; i++) {
+                lv_area_join(&joined_area, &area, &disp->inv_areas[i]);
+                int64_t cost = (int64_t)lv_area_get_size(&joined_area) - lv_area_get_size(&area) -
+                               lv_area_get_size(&disp->inv_areas[i]);
+                if(cost < best_cost) {
+                    best_cost = cost;
+                    best_i = i;
+                }
             }
+        }
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+        if(best_i < 0) break;
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+        /*Remove the saved area and add the joined one again, as it might be joined with others too*/
+        lv_area_join(&area, &area, &disp->inv_areas[best_i]);
+        disp->inv_p--;
+        disp->inv_areas[best_i] = disp->inv_areas[disp->inv_p];
+    }
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
-            }
+    disp->inv_areas[disp->inv_p] = area;
+    disp->inv_p++;
+    LV_PROFILER_END;
+}
+
+/**
+ * Remove the common part of two areas from the first one if what remains is a single rectangle,
+ * i.e. `cut_p` covers a full edge of `area_p`
+ * @param area_p    the area to shrink
+ * @param cut_p     the area to remove from `area_p`
+ * @return          true if `area_p` was changed
+ */
+static bool inv_area_cut(lv_area_t * area_p, const lv_area_t * cut_p)
+{
+    lv_area_t common;
+    if(!lv_area_intersect(&common, area_p, cut_p)) return false;
+
+    if(common.x1 == area_p->x1 && common.x2 == area_p->x2) {
+        if(common.y1 == area_p->y1 && common.y2 < area_p->y2) {
+            area_p->y1 = common.y2 + 1;
+            return true;
+        }
+        if(common.y2 == area_p->y2 && common.y1 > area_p->y1) {
+            area_p->y2 = common.y1 - 1;
+            return true;
         }
     }
-    LV_PROFILER_END;
+
+    if(common.y1 == area_p->y1 && common.y2 == area_p->y2) {
+        if(common.x1 == area_p->x1 && common.x2 < area_p->x2) {
+            area_p->x1 = common.x2 + 1;
+            return true;
+        }
+        if(common.x2 == area_p->x2 && common.x1 > area_p->x1) {
+            area_p->x2 = common.x1 - 1;
+            return true;
+        }
+    }
+
+    return false;
 }
 
 /**
@@ -1114,6 +1183,9 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 
     int32_t max_row = (uint32_t)(disp->buf_act->data_size - overhead) / stride;
 
+    /*Each line stores a whole page of 8 rows*/
+    if(LV_COLOR_FORMAT_IS_PAGED(cf)) max_row *= 8;
+
     if(max_row > area_h) max_row = area_h;
 
     /*Round down the lines of draw_buf if rounding is added*/
@@ -80,6 +80,7 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->layer_head = lv_malloc_zeroed(sizeof(lv_layer_t));
     LV_ASSERT_MALLOC(disp->layer_head);
     if(disp->layer_head == NULL) return NULL;
+    disp->layer_tail = disp->layer_head;
 
     if(disp->layer_init) disp->layer_init(disp, disp->layer_head);
     disp->layer_head->buf_area.x1 = 0;
@@ -431,10 +432,12 @@ void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint3
     if(render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
         /* for partial mode, we calculate the height based on the buf_size and stride */
         h = buf_size / stride;
+        /* a line holds 8 rows of pixels in the vertical page formats */
+        if(LV_COLOR_FORMAT_IS_PAGED(cf)) h *= 8;
         LV_ASSERT_MSG(h != 0, "the buffer is too small");
     }
     else {
-        LV_ASSERT_FORMAT_MSG(stride * h <= buf_size, "%s mode requires screen sized buffer(s)",
+        LV_ASSERT_FORMAT_MSG(stride * lv_draw_buf_height_to_lines(h, cf) <= buf_size, "%s mode requires screen sized buffer(s)",
                              render_mode == LV_DISPLAY_RENDER_MODE_FULL ? "FULL" : "DIRECT");
     }
 
@@ -112,6 +112,7 @@ struct lv_display_t {
      * Layer
      *--------------------*/
     lv_layer_t * layer_head;
+    lv_layer_t * layer_tail;    /**< The last layer, new layers are added after it*/
     void (*layer_init)(lv_display_t * disp, lv_layer_t * layer);
     void (*layer_deinit)(lv_display_t * disp, lv_layer_t * layer);
 
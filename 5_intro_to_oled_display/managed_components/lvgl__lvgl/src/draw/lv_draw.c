@@ -23,14 +23,72 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*Index the draw tasks of a layer only if it has at least this many tasks*/
+#ifndef LV_DRAW_TASK_INDEX_MIN_TASKS
+    #define LV_DRAW_TASK_INDEX_MIN_TASKS    32
+#endif
+
+/*The layer is divided to at most this many tiles in both directions*/
+#define TASK_INDEX_GRID_MAX     16
+
+/*Smallest width and height of a tile*/
+#define TASK_INDEX_TILE_MIN     16
+
+/*Number of nodes allocated at once*/
+#define TASK_INDEX_NODE_BLOCK   64
+
+/*Alignment of the memory allocated from the arena*/
+#define ARENA_ALIGN             8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct task_index_node_t {
+    lv_draw_task_t * task;
+    struct task_index_node_t * next;
+} task_index_node_t;
+
+typedef struct task_index_block_t {
+    struct task_index_block_t * next;
+    task_index_node_t nodes[TASK_INDEX_NODE_BLOCK];
+} task_index_block_t;
+
+typedef struct {
+    task_index_node_t * head;
+    task_index_node_t * tail;
+} task_index_tile_t;
+
+/**
+ * Tile grid over the layer. Each tile lists the tasks whose `_real_area` touches it in creation order,
+ * so only the tasks around a task need to be checked for overlap.
+ */
+struct lv_draw_task_index_t {
+    lv_area_t area;
+    int32_t tile_w;
+    int32_t tile_h;
+    int32_t cols;
+    int32_t rows;
+    uint32_t next_seq;
+    task_index_node_t * free_nodes;
+    task_index_block_t * blocks;
+    task_index_tile_t tiles[];
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+static void task_index_create(lv_layer_t * layer);
+static void task_index_delete(lv_layer_t * layer);
+static bool task_index_add(lv_layer_t * layer, lv_draw_task_t * t);
+static void task_index_remove(lv_layer_t * layer, lv_draw_task_t * t);
+static void task_index_get_tiles(const struct lv_draw_task_index_t * index, const lv_area_t * area, lv_area_t * tiles);
+static void * arena_alloc(lv_layer_t * layer, size_t size);
+#if LV_DRAW_TASK_ARENA_SIZE
+static lv_draw_arena_chunk_t * arena_chunk_create(size_t size);
+static void arena_reset(lv_layer_t * layer);
+#endif
 
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 {
@@ -57,6 +115,12 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+#if LV_DRAW_TASK_ARENA_SIZE
+    /*A chunk is always kept for the next layer, allocate it early to have a stable memory usage*/
+    _draw_info.arena_spare = arena_chunk_create(LV_DRAW_TASK_ARENA_SIZE);
+    _draw_info.arena_reserved = _draw_info.arena_spare;
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -74,6 +138,10 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+    lv_free(_draw_info.arena_spare);
+    _draw_info.arena_spare = NULL;
+    _draw_info.arena_reserved = NULL;
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -90,7 +158,9 @@ void * lv_draw_create_unit(size_t size)
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 {
     LV_PROFILER_BEGIN;
-    lv_draw_task_t * new_task = lv_malloc_zeroed(sizeof(lv_draw_task_t));
+    lv_draw_task_t * new_task = arena_alloc(layer, sizeof(lv_draw_task_t));
+    LV_ASSERT_MALLOC(new_task);
+    lv_memzero(new_task, sizeof(lv_draw_task_t));
 
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -100,16 +170,15 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 #endif
     new_task->state = LV_DRAW_TASK_STATE_QUEUED;
 
-    /*Find the tail*/
-    if(layer->draw_task_head == NULL) {
-        layer->draw_task_head = new_task;
-    }
-    else {
-        lv_draw_task_t * tail = layer->draw_task_head;
-        while(tail->next) tail = tail->next;
+    /*The existing tasks have their final area already, the new one is indexed when it's finalized*/
+    if(layer->_task_index == NULL && layer->_task_cnt >= LV_DRAW_TASK_INDEX_MIN_TASKS) task_index_create(layer);
 
-        tail->next = new_task;
-    }
+    if(layer->draw_task_head == NULL) layer->draw_task_head = new_task;
+    else layer->_task_tail->next = new_task;
+    layer->_task_tail = new_task;
+    layer->_task_cnt++;
+
+    if(layer->_task_index) new_task->_index_seq = layer->_task_index->next_seq++;
 
     LV_PROFILER_END;
     return new_task;
@@ -121,6 +190,9 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
     lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
     base_dsc->layer = layer;
 
+    /*Without the index the dependencies are checked on the whole task list*/
+    if(layer->_task_index && !task_index_add(layer, t)) task_index_delete(layer);
+
     lv_draw_global_info_t * info = &_draw_info;
 
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
@@ -204,6 +276,10 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         if(t->state == LV_DRAW_TASK_STATE_READY) {
             if(t_prev) t_prev->next = t->next;      /*Remove it by assigning the next task to the previous*/
             else layer->draw_task_head = t_next;    /*If it was the head, set the next as head*/
+            if(layer->_task_tail == t) layer->_task_tail = t_prev;
+            layer->_task_cnt--;
+
+            if(layer->_task_index) task_index_remove(layer, t);
 
             /*If it was layer drawing free the layer too*/
             if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
@@ -226,6 +302,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
                     while(l2) {
                         if(l2->next == layer_drawn) {
                             l2->next = layer_drawn->next;
+                            if(disp->layer_tail == layer_drawn) disp->layer_tail = l2;
                             break;
                         }
                         l2 = l2->next;
@@ -241,8 +318,13 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
                 draw_label_dsc->text = NULL;
             }
 
+#if LV_DRAW_TASK_ARENA_SIZE
+            /*The task is always in the arena but the application might have replaced the descriptor*/
+            if(t->draw_dsc != t->_arena_dsc) lv_free(t->draw_dsc);
+#else
             lv_free(t->draw_dsc);
             lv_free(t);
+#endif
         }
         else {
             t_prev = t;
@@ -250,6 +332,16 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+    if(layer->draw_task_head == NULL) {
+        /*The index is created again if the layer gets many tasks again*/
+        if(layer->_task_index) task_index_delete(layer);
+
+#if LV_DRAW_TASK_ARENA_SIZE
+        /*Nothing refers to the arena of the layer anymore*/
+        if(layer->_arena_chunks) arena_reset(layer);
+#endif
+    }
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -378,14 +470,9 @@ lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t c
     lv_matrix_identity(&new_layer->matrix);
 #endif
 
-    if(disp->layer_head) {
-        lv_layer_t * tail = disp->layer_head;
-        while(tail->next) tail = tail->next;
-        tail->next = new_layer;
-    }
-    else {
-        disp->layer_head = new_layer;
-    }
+    if(disp->layer_head) disp->layer_tail->next = new_layer;
+    else disp->layer_head = new_layer;
+    disp->layer_tail = new_layer;
 
     return new_layer;
 }
@@ -424,6 +511,15 @@ void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
     return lv_draw_buf_goto_xy(layer->draw_buf, x, y);
 }
 
+void * lv_draw_task_alloc_dsc(lv_layer_t * layer, lv_draw_task_t * t, size_t size)
+{
+    t->draw_dsc = arena_alloc(layer, size);
+#if LV_DRAW_TASK_ARENA_SIZE
+    t->_arena_dsc = t->draw_dsc;
+#endif
+    return t->draw_dsc;
+}
+
 lv_draw_task_type_t lv_draw_task_get_type(const lv_draw_task_t * t)
 {
     return t->type;
@@ -452,6 +548,33 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 {
     LV_PROFILER_BEGIN;
+
+    /*Check only the older tasks in the tiles of t_check. A task spanning more tiles might be checked more times.*/
+    struct lv_draw_task_index_t * index = layer->_task_index;
+    if(index) {
+        lv_area_t tiles;
+        task_index_get_tiles(index, &t_check->_real_area, &tiles);
+        int32_t tx;
+        int32_t ty;
+        for(ty = tiles.y1; ty <= tiles.y2; ty++) {
+            for(tx = tiles.x1; tx <= tiles.x2; tx++) {
+                task_index_node_t * node = index->tiles[ty * index->cols + tx].head;
+                for(; node && node->task->_index_seq < t_check->_index_seq; node = node->next) {
+                    lv_draw_task_t * t = node->task;
+                    if(t->state != LV_DRAW_TASK_STATE_READY) {
+                        lv_area_t a;
+                        if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
+                            LV_PROFILER_END;
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        LV_PROFILER_END;
+        return true;
+    }
+
     lv_draw_task_t * t = layer->draw_task_head;
 
     /*If t_check is outside of the older tasks then it's independent*/
@@ -469,3 +592,226 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 
     return true;
 }
+
+static void task_index_create(lv_layer_t * layer)
+{
+    int32_t w = lv_area_get_width(&layer->buf_area);
+    int32_t h = lv_area_get_height(&layer->buf_area);
+    int32_t cols = LV_CLAMP(1, w / TASK_INDEX_TILE_MIN, TASK_INDEX_GRID_MAX);
+    int32_t rows = LV_CLAMP(1, h / TASK_INDEX_TILE_MIN, TASK_INDEX_GRID_MAX);
+
+    struct lv_draw_task_index_t * index = lv_malloc_zeroed(sizeof(struct lv_draw_task_index_t) +
+                                                           cols * rows * sizeof(task_index_tile_t));
+    if(index == NULL) return;
+
+    index->area = layer->buf_area;
+    index->cols = cols;
+    index->rows = rows;
+    index->tile_w = (w + cols - 1) / cols;
+    index->tile_h = (h + rows - 1) / rows;
+    layer->_task_index = index;
+
+    /*The list is in creation order*/
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        t->_index_seq = index->next_seq++;
+        if(!task_index_add(layer, t)) {
+            task_index_delete(layer);
+            return;
+        }
+        t = t->next;
+    }
+}
+
+static void task_index_delete(lv_layer_t * layer)
+{
+    struct lv_draw_task_index_t * index = layer->_task_index;
+    task_index_block_t * block = index->blocks;
+    while(block) {
+        task_index_block_t * next = block->next;
+        lv_free(block);
+        block = next;
+    }
+
+    lv_free(index);
+    layer->_task_index = NULL;
+}
+
+static bool task_index_add(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    struct lv_draw_task_index_t * index = layer->_task_index;
+    lv_area_t tiles;
+    task_index_get_tiles(index, &t->_real_area, &tiles);
+
+    int32_t tx;
+    int32_t ty;
+    for(ty = tiles.y1; ty <= tiles.y2; ty++) {
+        for(tx = tiles.x1; tx <= tiles.x2; tx++) {
+            if(index->free_nodes == NULL) {
+                task_index_block_t * block = lv_malloc(sizeof(task_index_block_t));
+                if(block == NULL) return false;
+                block->next = index->blocks;
+                index->blocks = block;
+
+                uint32_t i;
+                for(i = 0; i < TASK_INDEX_NODE_BLOCK; i++) {
+                    block->nodes[i].next = index->free_nodes;
+                    index->free_nodes = &block->nodes[i];
+                }
+            }
+
+            task_index_node_t * node = index->free_nodes;
+            index->free_nodes = node->next;
+
+            /*Keep the creation order. Normally the tasks are finalized in the order they were added.*/
+            task_index_tile_t * tile = &index->tiles[ty * index->cols + tx];
+            node->task = t;
+            if(tile->tail == NULL || tile->tail->task->_index_seq < t->_index_seq) {
+                node->next = NULL;
+                if(tile->tail) tile->tail->next = node;
+                else tile->head = node;
+                tile->tail = node;
+            }
+            else {
+                task_index_node_t ** node_p = &tile->head;
+                while((*node_p)->task->_index_seq < t->_index_seq) node_p = &(*node_p)->next;
+                node->next = *node_p;
+                *node_p = node;
+            }
+        }
+    }
+
+    return true;
+}
+
+static void task_index_remove(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    struct lv_draw_task_index_t * index = layer->_task_index;
+    lv_area_t tiles;
+    task_index_get_tiles(index, &t->_real_area, &tiles);
+
+    int32_t tx;
+    int32_t ty;
+    for(ty = tiles.y1; ty <= tiles.y2; ty++) {
+        for(tx = tiles.x1; tx <= tiles.x2; tx++) {
+            task_index_tile_t * tile = &index->tiles[ty * index->cols + tx];
+            task_index_node_t * node_prev = NULL;
+            task_index_node_t * node = tile->head;
+            while(node) {
+                if(node->task == t) {
+                    if(node_prev) node_prev->next = node->next;
+                    else tile->head = node->next;
+                    if(tile->tail == node) tile->tail = node_prev;
+
+                    node->next = index->free_nodes;
+                    index->free_nodes = node;
+                    break;
+                }
+                node_prev = node;
+                node = node->next;
+            }
+        }
+    }
+}
+
+/**
+ * Get the range of tiles an area touches.
+ * Areas out of the layer (e.g. shadows) are clamped to the edge tiles,
+ * so two overlapping areas always share at least one tile.
+ */
+static void task_index_get_tiles(const struct lv_draw_task_index_t * index, const lv_area_t * area, lv_area_t * tiles)
+{
+    tiles->x1 = LV_CLAMP(0, (area->x1 - index->area.x1) / index->tile_w, index->cols - 1);
+    tiles->y1 = LV_CLAMP(0, (area->y1 - index->area.y1) / index->tile_h, index->rows - 1);
+    tiles->x2 = LV_CLAMP(0, (area->x2 - index->area.x1) / index->tile_w, index->cols - 1);
+    tiles->y2 = LV_CLAMP(0, (area->y2 - index->area.y1) / index->tile_h, index->rows - 1);
+}
+
+/**
+ * Allocate memory for a draw task or descriptor from the arena of a layer.
+ * @param layer     the layer whose arena should be used
+ * @param size      size of the memory in bytes
+ * @return          pointer to the memory or NULL on error
+ */
+static void * arena_alloc(lv_layer_t * layer, size_t size)
+{
+#if LV_DRAW_TASK_ARENA_SIZE
+    size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+
+    lv_draw_arena_chunk_t * c = layer->_arena_chunks;
+    if(c && c->used + size <= c->size) {
+        void * p = c->buf + c->used;
+        c->used += size;
+        return p;
+    }
+
+    c = arena_chunk_create(LV_MAX(size, LV_DRAW_TASK_ARENA_SIZE));
+    if(c == NULL) return NULL;
+    c->used = size;
+
+    /*Keep allocating from the current chunk if the new one was only for a large allocation*/
+    lv_draw_arena_chunk_t * head = layer->_arena_chunks;
+    if(head && size > LV_DRAW_TASK_ARENA_SIZE) {
+        c->next = head->next;
+        head->next = c;
+    }
+    else {
+        c->next = head;
+        layer->_arena_chunks = c;
+    }
+
+    return c->buf;
+#else
+    LV_UNUSED(layer);
+    return lv_malloc(size);
+#endif
+}
+
+#if LV_DRAW_TASK_ARENA_SIZE
+/**
+ * Create a chunk for the arena. The spare chunk is used if it's large enough.
+ * @param size      size of the usable memory in bytes
+ * @return          the new chunk or NULL on error
+ */
+static lv_draw_arena_chunk_t * arena_chunk_create(size_t size)
+{
+    lv_draw_arena_chunk_t * c;
+    if(size == LV_DRAW_TASK_ARENA_SIZE && _draw_info.arena_spare) {
+        c = _draw_info.arena_spare;
+        _draw_info.arena_spare = NULL;
+    }
+    else {
+        c = lv_malloc(sizeof(lv_draw_arena_chunk_t) + ARENA_ALIGN - 1 + size);
+        if(c == NULL) return NULL;
+        c->buf = (uint8_t *)(((lv_uintptr_t)(c + 1) + ARENA_ALIGN - 1) & ~((lv_uintptr_t)ARENA_ALIGN - 1));
+        c->size = size;
+    }
+
+    c->next = NULL;
+    c->used = 0;
+    return c;
+}
+
+/**
+ * Free the whole arena of a layer. The chunk allocated in `lv_draw_init` is kept as spare
+ * for the next layer, the others are freed to not hold the memory of the largest frame.
+ * Always keeping the same chunk leaves the heap the same as before drawing.
+ * @param layer     the layer whose draw tasks are all deleted
+ */
+static void arena_reset(lv_layer_t * layer)
+{
+    lv_draw_arena_chunk_t * c = layer->_arena_chunks;
+    while(c) {
+        lv_draw_arena_chunk_t * c_next = c->next;
+        if(c == _draw_info.arena_reserved) {
+            _draw_info.arena_spare = c;
+            c->next = NULL;
+        }
+        else {
+            lv_free(c);
+        }
+        c = c_next;
+    }
+    layer->_arena_chunks = NULL;
+}
+#endif
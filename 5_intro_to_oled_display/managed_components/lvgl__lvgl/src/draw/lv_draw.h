@@ -101,6 +101,16 @@ struct lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** The last draw task and the number of draw tasks. Used internally. */
+    lv_draw_task_t * _task_tail;
+    uint32_t _task_cnt;
+
+    /** Spatial index of the pending draw tasks, created for layers with many tasks. Used internally. */
+    struct lv_draw_task_index_t * _task_index;
+
+    /** Chunks of memory for the draw tasks and descriptors of this layer. Used internally. */
+    struct lv_draw_arena_chunk_t * _arena_chunks;
+
     lv_layer_t * parent;
     lv_layer_t * next;
     bool all_tasks_added;
@@ -95,6 +95,12 @@ uint32_t lv_draw_buf_width_to_stride_ex(const lv_draw_buf_handlers_t * handlers,
     else return 0;
 }
 
+uint32_t lv_draw_buf_height_to_lines(uint32_t h, lv_color_format_t color_format)
+{
+    if(LV_COLOR_FORMAT_IS_PAGED(color_format)) return (h + 7) >> 3;
+    return h;
+}
+
 void * lv_draw_buf_align(void * data, lv_color_format_t color_format)
 {
     return lv_draw_buf_align_ex(&default_handlers, data, color_format);
@@ -153,7 +159,7 @@ void lv_draw_buf_clear(lv_draw_buf_t * draw_buf, const lv_area_t * a)
 
     if(a == NULL) {
         uint8_t * buf = lv_draw_buf_goto_xy(draw_buf, 0, 0);
-        lv_memzero(buf, header->h * stride);
+        lv_memzero(buf, lv_draw_buf_height_to_lines(header->h, header->cf) * stride);
         return;
     }
 
@@ -168,6 +174,22 @@ void lv_draw_buf_clear(lv_draw_buf_t * draw_buf, const lv_area_t * a)
     if(lv_area_get_width(&a_clipped) <= 0) return;
     if(lv_area_get_height(&a_clipped) <= 0) return;
 
+    if(LV_COLOR_FORMAT_IS_PAGED(header->cf)) {
+        /*Clear only the bits of the affected rows in each page*/
+        int32_t w = lv_area_get_width(&a_clipped);
+        int32_t y = a_clipped.y1;
+        while(y <= a_clipped.y2) {
+            int32_t bit = y & 0x7;
+            int32_t rows = LV_MIN(8 - bit, a_clipped.y2 - y + 1);
+            uint8_t keep = (uint8_t)~(((1 << rows) - 1) << bit);
+            uint8_t * page = lv_draw_buf_goto_xy(draw_buf, a_clipped.x1, y);
+            int32_t x;
+            for(x = 0; x < w; x++) page[x] &= keep;
+            y += rows;
+        }
+        return;
+    }
+
     uint8_t * buf = lv_draw_buf_goto_xy(draw_buf, a_clipped.x1, a_clipped.y1);
     uint8_t bpp = lv_color_format_get_bpp(header->cf);
     uint32_t line_length = (lv_area_get_width(&a_clipped) * bpp + 7) >> 3;
@@ -226,6 +248,14 @@ void lv_draw_buf_copy(lv_draw_buf_t * dest, const lv_area_t * dest_area,
     uint32_t src_stride = src->header.stride;
     uint32_t line_bytes = (line_width * lv_color_format_get_bpp(dest->header.cf) + 7) >> 3;
 
+    if(LV_COLOR_FORMAT_IS_PAGED(dest->header.cf)) {
+        /*Copy whole pages. The areas are expected to be page aligned
+         *which is guaranteed by the invalidation of the display.*/
+        line_bytes = line_width;
+        start_y = start_y >> 3;
+        end_y = end_y >> 3;
+    }
+
     for(; start_y <= end_y; start_y++) {
         lv_memcpy(dest_bufc, src_bufc, line_bytes);
         dest_bufc += dest_stride;
@@ -241,8 +271,9 @@ lv_result_t lv_draw_buf_init(lv_draw_buf_t * draw_buf, uint32_t w, uint32_t h, l
 
     lv_memzero(draw_buf, sizeof(lv_draw_buf_t));
     if(stride == 0) stride = lv_draw_buf_width_to_stride(w, cf);
-    if(stride * h > data_size) {
-        LV_LOG_WARN("Data size too small, required: %" LV_PRId32 ", provided: %" LV_PRId32, stride * h,
+    uint32_t lines = lv_draw_buf_height_to_lines(h, cf);
+    if(stride * lines > data_size) {
+        LV_LOG_WARN("Data size too small, required: %" LV_PRId32 ", provided: %" LV_PRId32, stride * lines,
                     data_size);
         return LV_RESULT_INVALID;
     }
@@ -372,6 +403,11 @@ void * lv_draw_buf_goto_xy(const lv_draw_buf_t * buf, uint32_t x, uint32_t y)
 
     uint8_t * data = buf->data;
 
+    /*Pixels are stored column wise in 8 px high pages*/
+    if(LV_COLOR_FORMAT_IS_PAGED(buf->header.cf)) {
+        return data + buf->header.stride * (y >> 3) + x;
+    }
+
     /*Skip palette*/
     data += LV_COLOR_INDEXED_PALETTE_SIZE(buf->header.cf) * sizeof(lv_color32_t);
     data += buf->header.stride * y;
@@ -612,8 +648,9 @@ static void * buf_align(void * buf, lv_color_format_t color_format)
 static uint32_t width_to_stride(uint32_t w, lv_color_format_t color_format)
 {
     uint32_t width_byte;
-    width_byte = w * lv_color_format_get_bpp(color_format);
-    width_byte = (width_byte + 7) >> 3; /*Round up*/
+    /*In page formats a byte stores 8 vertical pixels, so a page line has one byte per column*/
+    if(LV_COLOR_FORMAT_IS_PAGED(color_format)) width_byte = w;
+    else width_byte = (w * lv_color_format_get_bpp(color_format) + 7) >> 3; /*Round up*/
 
     return LV_ROUND_UP(width_byte, LV_DRAW_BUF_STRIDE_ALIGN);
 }
@@ -640,7 +677,7 @@ static uint32_t _calculate_draw_buf_size(uint32_t w, uint32_t h, lv_color_format
 
     if(stride == 0) stride = lv_draw_buf_width_to_stride(w, cf);
 
-    size = stride * h;
+    size = stride * lv_draw_buf_height_to_lines(h, cf);
     if(cf == LV_COLOR_FORMAT_RGB565A8) {
         size += (stride / 2) * h; /*A8 mask*/
     }
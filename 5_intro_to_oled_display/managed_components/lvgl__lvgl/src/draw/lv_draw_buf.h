@@ -172,6 +172,16 @@ void lv_draw_buf_flush_cache(const lv_draw_buf_t * draw_buf, const lv_area_t * a
  */
 uint32_t lv_draw_buf_width_to_stride(uint32_t w, lv_color_format_t color_format);
 
+/**
+ * Get how many stride long lines are required to store a given number of pixel rows.
+ * It's the same as the height except for the vertical page formats (`LV_COLOR_FORMAT_I1_PAGE`)
+ * where 8 pixel rows are packed into one line.
+ * @param h                 the height in pixels
+ * @param color_format      the color format
+ * @return                  number of lines
+ */
+uint32_t lv_draw_buf_height_to_lines(uint32_t h, lv_color_format_t color_format);
+
 /**
  * Calculate the stride in bytes based on a width and color format
  * @param handlers          the draw buffer handlers
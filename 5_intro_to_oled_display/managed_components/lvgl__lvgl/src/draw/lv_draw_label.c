@@ -20,6 +20,7 @@
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../font/lv_font_fmt_txt.h"
 
 /*********************
  *      DEFINES
@@ -38,6 +39,11 @@
  **********************/
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb);
+static const lv_text_line_t * get_lines(const lv_draw_label_dsc_t * dsc);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_text_line_t * lines, uint32_t line_idx,
+                             uint32_t line_start, int32_t w);
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_text_line_t * lines, uint32_t line_idx,
+                              uint32_t line_start, uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -92,7 +98,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_layer_t * layer, const lv_draw_label
     LV_PROFILER_BEGIN;
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
+    lv_draw_task_alloc_dsc(layer, t, sizeof(*dsc));
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_LABEL;
 
@@ -100,6 +106,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_layer_t * layer, const lv_draw_label
     if(dsc->text_local) {
         lv_draw_label_dsc_t * new_dsc = t->draw_dsc;
         new_dsc->text = lv_strdup(dsc->text);
+        if(dsc->lines_text == dsc->text) new_dsc->lines_text = new_dsc->text;
     }
 
     lv_draw_finalize_task_creation(layer, t);
@@ -162,8 +169,9 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 
     lv_bidi_calculate_align(&align, &base_dir, dsc->text);
 
-    if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
-        /*Normally use the label's width as width*/
+    const lv_text_line_t * lines = get_lines(dsc);
+    if(lines || (dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
+        /*Normally use the label's width as width. Not used with pre-calculated lines*/
         w = lv_area_get_width(coords);
     }
     else {
@@ -189,10 +197,11 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_idx       = 0;
     int32_t last_line_start = -1;
 
-    /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+    /*Check the hint to use the cached info. Not needed with pre-calculated lines.*/
+    if(dsc->hint && lines == NULL && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             dsc->hint->line_start = -1;
@@ -206,14 +215,14 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
         pos.y += dsc->hint->y;
     }
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL,
-                                                           dsc->flag);
+    uint32_t line_end = get_line_end(dsc, lines, line_idx, line_start, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_unit->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, lines, line_idx, line_start, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -228,14 +237,14 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -346,20 +355,19 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, lines, line_idx, line_start, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -378,6 +386,47 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the pre-calculated lines of the descriptor if they were wrapped with its current text and font
+ * @param dsc           the label draw descriptor
+ * @return              the lines or NULL if the text needs to be wrapped while drawing
+ */
+static const lv_text_line_t * get_lines(const lv_draw_label_dsc_t * dsc)
+{
+    if(dsc->lines == NULL) return NULL;
+    if(dsc->lines_text != dsc->text || dsc->lines_font != dsc->font) return NULL;
+
+    return dsc->lines;
+}
+
+/**
+ * Get where the next line starts
+ * @param dsc           the label draw descriptor
+ * @param lines         the pre-calculated lines from `get_lines` or NULL
+ * @param line_idx      index of the line
+ * @param line_start    byte index of the line's first character
+ * @param w             the max. width of the line
+ * @return              byte index of the next line's first character
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_text_line_t * lines, uint32_t line_idx,
+                             uint32_t line_start, int32_t w)
+{
+    if(lines) {
+        /*The text ends after the last line*/
+        return line_idx < dsc->line_cnt ? lines[line_idx].end : line_start;
+    }
+
+    return line_start + lv_text_get_next_line(&dsc->text[line_start], dsc->font, dsc->letter_space, w, NULL, dsc->flag);
+}
+
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_text_line_t * lines, uint32_t line_idx,
+                              uint32_t line_start, uint32_t line_end)
+{
+    if(lines) return line_idx < dsc->line_cnt ? lines[line_idx].width : 0;
+
+    return lv_text_get_width(&dsc->text[line_start], line_end - line_start, dsc->font, dsc->letter_space);
+}
+
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
 {
@@ -415,14 +464,23 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
     if(g.resolved_font) {
         lv_draw_buf_t * draw_buf = NULL;
         if(LV_FONT_GLYPH_FORMAT_NONE < g.format && g.format < LV_FONT_GLYPH_FORMAT_IMAGE) {
+            /*Uncompressed 1 bpp glyphs of the built-in font format can be drawn as they are to 1 bpp layers*/
+            lv_color_format_t glyph_cf = LV_COLOR_FORMAT_A8;
+            lv_color_format_t layer_cf = draw_unit->target_layer->color_format;
+            if(g.format == LV_FONT_GLYPH_FORMAT_A1 && g.resolved_font->get_glyph_bitmap == lv_font_get_bitmap_fmt_txt &&
+               (layer_cf == LV_COLOR_FORMAT_I1 || layer_cf == LV_COLOR_FORMAT_I1_PAGE)) {
+                const lv_font_fmt_txt_dsc_t * fdsc = g.resolved_font->dsc;
+                if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) glyph_cf = LV_COLOR_FORMAT_A1;
+            }
+
             /*Only check draw buf for bitmap glyph*/
-            draw_buf = lv_draw_buf_reshape(dsc->_draw_buf, 0, g.box_w, g.box_h, LV_STRIDE_AUTO);
+            draw_buf = lv_draw_buf_reshape(dsc->_draw_buf, glyph_cf, g.box_w, g.box_h, LV_STRIDE_AUTO);
             if(draw_buf == NULL) {
                 if(dsc->_draw_buf) lv_draw_buf_destroy(dsc->_draw_buf);
 
                 uint32_t h = g.box_h;
                 if(h * g.box_w < 64) h *= 2; /*Alloc a slightly larger buffer*/
-                draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, g.box_w, h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+                draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, g.box_w, h, glyph_cf, LV_STRIDE_AUTO);
                 LV_ASSERT_MALLOC(draw_buf);
                 draw_buf->header.h = g.box_h;
                 dsc->_draw_buf = draw_buf;
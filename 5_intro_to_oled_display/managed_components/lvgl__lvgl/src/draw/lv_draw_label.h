@@ -54,6 +54,19 @@ typedef struct {
      * 0: `text` is const and it's pointer will be valid during rendering.*/
     uint8_t text_local : 1;
     lv_draw_label_hint_t * hint;
+
+    /**
+     * The lines of `text` already wrapped to the width of `coords` with `font`, `letter_space` and `flag`.
+     * If not NULL, the text is not wrapped and measured again while drawing.
+     * It should be valid during rendering, like `text` if `text_local == 0`.*/
+    const lv_text_line_t * lines;
+    uint32_t line_cnt;
+
+    /**
+     * The text and font `lines` were wrapped with. `lines` is not used if `text` or `font` is different,
+     * e.g. because they were changed in `LV_EVENT_DRAW_TASK_ADDED`.*/
+    const char * lines_text;
+    const lv_font_t * lines_font;
 } lv_draw_label_dsc_t;
 
 /**
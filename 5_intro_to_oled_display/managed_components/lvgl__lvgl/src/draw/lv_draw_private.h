@@ -75,8 +75,25 @@ struct lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /** Creation order in the layer, used only if the layer has a task index */
+    uint32_t _index_seq;
+
+    /** The draw descriptor allocated from the arena. If `draw_dsc` is replaced it's freed by `lv_free`*/
+    void * _arena_dsc;
+
 };
 
+/**
+ * A block of memory from where the draw tasks and descriptors of a layer are allocated by increasing `used`.
+ * Allocations larger than `LV_DRAW_TASK_ARENA_SIZE` get a chunk with their own size.
+ */
+typedef struct lv_draw_arena_chunk_t {
+    struct lv_draw_arena_chunk_t * next;
+    uint8_t * buf;
+    size_t size;
+    size_t used;
+} lv_draw_arena_chunk_t;
+
 struct lv_draw_mask_t {
     void * user_data;
 };
@@ -179,12 +196,25 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+    lv_draw_arena_chunk_t * arena_spare;    /**< A free chunk kept for the next layer*/
+    lv_draw_arena_chunk_t * arena_reserved; /**< The chunk which is kept as spare, allocated in `lv_draw_init`*/
 } lv_draw_global_info_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Allocate the draw descriptor of a draw task from the arena of the layer and set it as `t->draw_dsc`.
+ * It's freed automatically when all the draw tasks of the layer are deleted,
+ * so it shouldn't be freed with `lv_free`.
+ * @param layer     the layer to which the draw task was added
+ * @param t         the draw task
+ * @param size      size of the descriptor in bytes
+ * @return          pointer to the descriptor or NULL on error
+ */
+void * lv_draw_task_alloc_dsc(lv_layer_t * layer, lv_draw_task_t * t, size_t size);
+
 /**********************
  *      MACROS
  **********************/
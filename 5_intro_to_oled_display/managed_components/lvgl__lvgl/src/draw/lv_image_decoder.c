@@ -400,6 +400,7 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
+    search_key.converted_cf = LV_COLOR_FORMAT_UNKNOWN;
 
     lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
 
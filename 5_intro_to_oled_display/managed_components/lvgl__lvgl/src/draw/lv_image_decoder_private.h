@@ -57,6 +57,8 @@ struct lv_image_cache_data_t {
 
     const void * src;
     lv_image_src_t src_type;
+    lv_color_format_t converted_cf; /**< LV_COLOR_FORMAT_UNKNOWN for the decoded image, else the color format
+                                     *   the image was converted to, see `lv_image_cache_add_converted`*/
 
     const lv_draw_buf_t * decoded;
     const lv_image_decoder_t * decoder;
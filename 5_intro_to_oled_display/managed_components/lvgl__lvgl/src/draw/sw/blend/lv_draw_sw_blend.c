@@ -81,9 +81,26 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
 
         fill_dsc.relative_area  = blend_area;
         lv_area_move(&fill_dsc.relative_area, -layer->buf_area.x1, -layer->buf_area.y1);
+        fill_dsc.layer_ofs.x = layer->buf_area.x1;
+        fill_dsc.layer_ofs.y = layer->buf_area.y1;
         fill_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
                                                    blend_area.y1 - layer->buf_area.y1);
-        if(fill_dsc.mask_buf) {
+        fill_dsc.mask_color_format = LV_COLOR_FORMAT_A8;
+        fill_dsc.mask_bit_ofs = 0;
+        if(fill_dsc.mask_buf && blend_dsc->mask_color_format == LV_COLOR_FORMAT_A1) {
+            if(layer->color_format != LV_COLOR_FORMAT_I1 && layer->color_format != LV_COLOR_FORMAT_I1_PAGE) {
+                LV_LOG_WARN("A1 masks are supported only on I1 layers");
+                LV_PROFILER_END;
+                return;
+            }
+
+            int32_t mask_ofs_x = blend_area.x1 - blend_dsc->mask_area->x1;
+            fill_dsc.mask_color_format = LV_COLOR_FORMAT_A1;
+            fill_dsc.mask_stride = blend_dsc->mask_stride;
+            fill_dsc.mask_buf += fill_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) + mask_ofs_x / 8;
+            fill_dsc.mask_bit_ofs = mask_ofs_x % 8;
+        }
+        else if(fill_dsc.mask_buf) {
             fill_dsc.mask_stride = blend_dsc->mask_stride == 0  ? lv_area_get_width(blend_dsc->mask_area) : blend_dsc->mask_stride;
             fill_dsc.mask_buf += fill_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
                                  (blend_area.x1 - blend_dsc->mask_area->x1);
@@ -124,6 +141,9 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
             case LV_COLOR_FORMAT_I1:
                 lv_draw_sw_blend_color_to_i1(&fill_dsc);
                 break;
+            case LV_COLOR_FORMAT_I1_PAGE:
+                lv_draw_sw_blend_color_to_i1_page(&fill_dsc);
+                break;
 #endif
             default:
                 break;
@@ -155,6 +175,7 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
         src_buf += image_dsc.src_stride * (blend_area.y1 - blend_dsc->src_area->y1);
         src_buf += ((blend_area.x1 - blend_dsc->src_area->x1) * src_px_size) >> 3;
         image_dsc.src_buf = src_buf;
+        image_dsc.src_bit_ofs = ((blend_area.x1 - blend_dsc->src_area->x1) * src_px_size) & 0x7;
 
 
         if(blend_dsc->mask_buf == NULL) image_dsc.mask_buf = NULL;
@@ -170,6 +191,8 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
 
         image_dsc.relative_area  = blend_area;
         lv_area_move(&image_dsc.relative_area, -layer->buf_area.x1, -layer->buf_area.y1);
+        image_dsc.layer_ofs.x = layer->buf_area.x1;
+        image_dsc.layer_ofs.y = layer->buf_area.y1;
 
         image_dsc.src_area  = *blend_dsc->src_area;
         lv_area_move(&image_dsc.src_area, -layer->buf_area.x1, -layer->buf_area.y1);
@@ -213,6 +236,9 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
             case LV_COLOR_FORMAT_I1:
                 lv_draw_sw_blend_image_to_i1(&image_dsc);
                 break;
+            case LV_COLOR_FORMAT_I1_PAGE:
+                lv_draw_sw_blend_image_to_i1_page(&image_dsc);
+                break;
 #endif
             default:
                 break;
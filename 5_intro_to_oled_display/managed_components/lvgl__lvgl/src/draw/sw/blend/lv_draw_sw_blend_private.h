@@ -22,6 +22,13 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*Tell the compiler that the buffers of a blend kernel don't overlap so it can vectorize the loops*/
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#define LV_DRAW_SW_RESTRICT __restrict
+#else
+#define LV_DRAW_SW_RESTRICT
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -44,6 +51,8 @@ struct lv_draw_sw_blend_dsc_t {
     const lv_area_t * mask_area;    /**< The area of `mask_buf` with absolute coordinates*/
     int32_t mask_stride;
     lv_blend_mode_t blend_mode;     /**< E.g. LV_BLEND_MODE_ADDITIVE*/
+    lv_color_format_t mask_color_format;    /**< LV_COLOR_FORMAT_A1 if `mask_buf` has 1 bit per pixel
+                                             *   (only for fills on I1 layers), else A8 is assumed*/
 };
 
 struct lv_draw_sw_blend_fill_dsc_t {
@@ -56,6 +65,11 @@ struct lv_draw_sw_blend_fill_dsc_t {
     lv_color_t color;
     lv_opa_t opa;
     lv_area_t relative_area;
+    lv_color_format_t mask_color_format;    /**< LV_COLOR_FORMAT_A1 or LV_COLOR_FORMAT_A8*/
+    int32_t mask_bit_ofs;                   /**< With A1 masks the bit of the first pixel in `mask_buf`'s
+                                             *   first byte in each row (0: MSB)*/
+    lv_point_t layer_ofs;                   /**< The absolute coordinates of the layer buffer's first pixel.
+                                             *   Used to align the dithering of I1 layers to the screen.*/
 };
 
 struct lv_draw_sw_blend_image_dsc_t {
@@ -68,10 +82,14 @@ struct lv_draw_sw_blend_image_dsc_t {
     const void * src_buf;
     int32_t src_stride;
     lv_color_format_t src_color_format;
+    int32_t src_bit_ofs;            /**< With I1 sources the bit of the first pixel in `src_buf`'s
+                                     *   first byte in each row (0: MSB)*/
     lv_opa_t opa;
     lv_blend_mode_t blend_mode;
     lv_area_t relative_area;    /**< The blend area relative to the layer's buffer area. */
     lv_area_t src_area;             /**< The original src area. */
+    lv_point_t layer_ofs;           /**< The absolute coordinates of the layer buffer's first pixel.
+                                     *   Used to align the dithering of I1 layers to the screen.*/
 };
 
 
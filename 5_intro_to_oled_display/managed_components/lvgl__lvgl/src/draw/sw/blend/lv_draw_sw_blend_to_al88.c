@@ -361,6 +361,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
     int32_t dest_stride = dsc->dest_stride;
     const uint8_t * src_buf_i1 = dsc->src_buf;
     int32_t src_stride = dsc->src_stride;
+    int32_t src_bit_ofs = dsc->src_bit_ofs;
     const lv_opa_t * mask_buf = dsc->mask_buf;
     int32_t mask_stride = dsc->mask_stride;
 
@@ -374,7 +375,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_AL88(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
-                        dest_buf_al88[x].lumi = get_bit(src_buf_i1, x) * 255;
+                        dest_buf_al88[x].lumi = get_bit(src_buf_i1, x + src_bit_ofs) * 255;
                         dest_buf_al88[x].alpha = 255;
                     }
                     dest_buf_al88 = drawbuf_next_row(dest_buf_al88, dest_stride);
@@ -387,7 +388,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
                         lv_color16a_t src_color;
-                        src_color.lumi = get_bit(src_buf_i1, x) * 255;
+                        src_color.lumi = get_bit(src_buf_i1, x + src_bit_ofs) * 255;
                         src_color.alpha = opa;
                         lv_color_16a_16a_mix(src_color, &dest_buf_al88[x], &cache);
                     }
@@ -401,7 +402,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
                         lv_color16a_t src_color;
-                        src_color.lumi = get_bit(src_buf_i1, x) * 255;
+                        src_color.lumi = get_bit(src_buf_i1, x + src_bit_ofs) * 255;
                         src_color.alpha = mask_buf[x];
                         lv_color_16a_16a_mix(src_color, &dest_buf_al88[x], &cache);
                     }
@@ -416,7 +417,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
                         lv_color16a_t src_color;
-                        src_color.lumi = get_bit(src_buf_i1, x) * 255;
+                        src_color.lumi = get_bit(src_buf_i1, x + src_bit_ofs) * 255;
                         src_color.alpha = LV_OPA_MIX2(mask_buf[x], opa);
                         lv_color_16a_16a_mix(src_color, &dest_buf_al88[x], &cache);
                     }
@@ -430,7 +431,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             for(y = 0; y < h; y++) {
                 for(x = 0; x < w; x++) {
                     lv_color16a_t src_color;
-                    src_color.lumi = get_bit(src_buf_i1, x) * 255;
+                    src_color.lumi = get_bit(src_buf_i1, x + src_bit_ofs) * 255;
                     if(mask_buf == NULL) src_color.alpha = opa;
                     else src_color.alpha = LV_OPA_MIX2(mask_buf[x], opa);
                     blend_non_normal_pixel(&dest_buf_al88[x], src_color, dsc->blend_mode, &cache);
@@ -36,7 +36,15 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void /* LV_ATTRIBUTE_FAST_MEM */ color_fill_i1(lv_draw_sw_blend_fill_dsc_t * dsc, uint8_t src_lumi,
+                                                      uint32_t min_white, uint32_t min_black);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ a1_mask_color_to_i1(lv_draw_sw_blend_fill_dsc_t * dsc, uint8_t src_lumi);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ a1_mask_color_to_i1_page(lv_draw_sw_blend_fill_dsc_t * dsc, uint8_t src_lumi);
+
 static void /* LV_ATTRIBUTE_FAST_MEM */ i1_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+static void /* LV_ATTRIBUTE_FAST_MEM */ i1_unaligned_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 
 #if LV_DRAW_SW_SUPPORT_L8
     static void /* LV_ATTRIBUTE_FAST_MEM */ l8_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
@@ -63,8 +71,35 @@ static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_8_mix(const uint8_t sr
 
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ blend_non_normal_pixel(uint8_t * dest_buf, int32_t dest_x,
                                                                       lv_color32_t src,
-                                                                      lv_blend_mode_t mode);
+                                                                      lv_blend_mode_t mode, uint8_t threshold);
+
+static inline uint8_t /* LV_ATTRIBUTE_FAST_MEM */ blend_non_normal_lumi(uint8_t dest_lumi, uint8_t src_lumi,
+                                                                        lv_opa_t opa, lv_blend_mode_t mode);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ get_src_lumi_opa(const uint8_t * src_buf, int32_t src_x,
+                                                                lv_color_format_t src_cf,
+                                                                uint8_t * lumi, lv_opa_t * opa);
+
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ blend_row_i1(uint8_t * dest, int32_t bit_ofs, const uint8_t * src, uint8_t fill,
+                                                     const uint8_t * sel, int32_t w);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ mask_blend_i1(uint8_t * dest_buf, int32_t dest_stride, int32_t bit_ofs,
+                                                      const uint8_t * src_buf, int32_t src_stride,
+                                                      const lv_opa_t * mask, int32_t mask_stride, uint32_t min_opa,
+                                                      int32_t w, int32_t h);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ mask_to_sel(uint8_t * sel, const lv_opa_t * mask, int32_t len,
+                                                           const uint32_t * min_opa, uint8_t full_sel);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ a1_to_sel(uint8_t * sel, const uint8_t * mask, int32_t mask_bit_ofs,
+                                                         int32_t len);
+
+static inline const uint8_t * /* LV_ATTRIBUTE_FAST_MEM */ dither_row(int32_t abs_x, int32_t abs_y);
 
+static inline uint8_t /* LV_ATTRIBUTE_FAST_MEM */ dither_pattern(uint8_t lumi, const uint8_t * th_row);
+
+static inline uint32_t /* LV_ATTRIBUTE_FAST_MEM */ read_u32(const uint8_t * buf);
 
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ set_bit(uint8_t * buf, int32_t bit_idx);
 
@@ -78,12 +113,65 @@ static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * b
  *  STATIC VARIABLES
  **********************/
 
+#if LV_DRAW_SW_I1_DITHER != LV_DRAW_SW_I1_DITHER_NONE
+/* A pixel is set if its luminance is greater than the threshold at its position on the screen.
+ * The values of the Bayer matrix are spread evenly in 0..255 and each row is stored twice
+ * to read 8 thresholds from any pixel. */
+#if LV_DRAW_SW_I1_DITHER == LV_DRAW_SW_I1_DITHER_BAYER4
+#define BAYER_TH(v)             ((v) * 16 + 8)
+#define BAYER_ROW(a, b, c, d)   BAYER_TH(a), BAYER_TH(b), BAYER_TH(c), BAYER_TH(d), \
+    BAYER_TH(a), BAYER_TH(b), BAYER_TH(c), BAYER_TH(d), \
+    BAYER_TH(a), BAYER_TH(b), BAYER_TH(c), BAYER_TH(d), \
+    BAYER_TH(a), BAYER_TH(b), BAYER_TH(c), BAYER_TH(d)
+
+static const uint8_t dither_thresholds[8][16] = {
+    {BAYER_ROW(0, 8, 2, 10)},
+    {BAYER_ROW(12, 4, 14, 6)},
+    {BAYER_ROW(3, 11, 1, 9)},
+    {BAYER_ROW(15, 7, 13, 5)},
+    {BAYER_ROW(0, 8, 2, 10)},
+    {BAYER_ROW(12, 4, 14, 6)},
+    {BAYER_ROW(3, 11, 1, 9)},
+    {BAYER_ROW(15, 7, 13, 5)},
+};
+#else
+#define BAYER_TH(v)             ((v) * 4 + 2)
+#define BAYER_ROW(a, b, c, d, e, f, g, h)   BAYER_TH(a), BAYER_TH(b), BAYER_TH(c), BAYER_TH(d), \
+    BAYER_TH(e), BAYER_TH(f), BAYER_TH(g), BAYER_TH(h), \
+    BAYER_TH(a), BAYER_TH(b), BAYER_TH(c), BAYER_TH(d), \
+    BAYER_TH(e), BAYER_TH(f), BAYER_TH(g), BAYER_TH(h)
+
+static const uint8_t dither_thresholds[8][16] = {
+    {BAYER_ROW(0, 32, 8, 40, 2, 34, 10, 42)},
+    {BAYER_ROW(48, 16, 56, 24, 50, 18, 58, 26)},
+    {BAYER_ROW(12, 44, 4, 36, 14, 46, 6, 38)},
+    {BAYER_ROW(60, 28, 52, 20, 62, 30, 54, 22)},
+    {BAYER_ROW(3, 35, 11, 43, 1, 33, 9, 41)},
+    {BAYER_ROW(51, 19, 59, 27, 49, 17, 57, 25)},
+    {BAYER_ROW(15, 47, 7, 39, 13, 45, 5, 37)},
+    {BAYER_ROW(63, 31, 55, 23, 61, 29, 53, 21)},
+};
+#endif
+#undef BAYER_TH
+#undef BAYER_ROW
+#endif /*LV_DRAW_SW_I1_DITHER != LV_DRAW_SW_I1_DITHER_NONE*/
+
 /**********************
  *      MACROS
  **********************/
 
 #define I1_LUM_THRESHOLD 127
 
+/*The threshold of the `x`th pixel of a row returned by `dither_row`*/
+#if LV_DRAW_SW_I1_DITHER == LV_DRAW_SW_I1_DITHER_NONE
+    #define DITHER_TH(th_row, x)    ((void)(th_row), I1_LUM_THRESHOLD)
+#else
+    #define DITHER_TH(th_row, x)    ((th_row)[(x) & 0x7])
+#endif
+
+/*Masks are converted to 1 bit per pixel in chunks of this many pixels. Must be a multiple of 8.*/
+#define SEL_CHUNK_PX    256
+
 #ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1
     #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1(...)                    LV_RESULT_INVALID
 #endif
@@ -196,118 +284,69 @@ static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * b
     #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(...)  LV_RESULT_INVALID
 #endif
 
+/*The NORMAL blend mode image kernels. Generated by `scripts/blend_kernel_gen.py`*/
+#include "lv_draw_sw_blend_to_i1_gen.h"
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_i1(lv_draw_sw_blend_fill_dsc_t * dsc)
 {
-    int32_t w = dsc->dest_w;
-    int32_t h = dsc->dest_h;
     lv_opa_t opa = dsc->opa;
     const lv_opa_t * mask = dsc->mask_buf;
-    int32_t mask_stride = dsc->mask_stride;
-    int32_t dest_stride = dsc->dest_stride;
 
-    uint8_t src_color = lv_color_luminance(dsc->color) / (I1_LUM_THRESHOLD + 1);
-    uint8_t * dest_buf = dsc->dest_buf;
+    uint8_t src_lumi = lv_color_luminance(dsc->color);
 
-    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    if(mask && dsc->mask_color_format == LV_COLOR_FORMAT_A1) {
+        a1_mask_color_to_i1(dsc, src_lumi);
+        return;
+    }
+
+    /* The pixels are mixed as `(px_opa * src_color + (255 - px_opa) * current_bit) / 255`, so
+     * white sets only the fully covered pixels and black clears all the not transparent ones.
+     * Therefore a few whole bytes can be written at once.
+     * With dithering `src_color` is the pixel's bit in the dithered pattern of the color.*/
 
     /* Simple fill */
     if(mask == NULL && opa >= LV_OPA_MAX) {
         if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_I1(dsc)) {
-            for(int32_t y = 0; y < h; y++) {
-                for(int32_t x = 0; x < w; x++) {
-                    if(src_color) {
-                        set_bit(dest_buf, x + bit_ofs);
-                    }
-                    else {
-                        clear_bit(dest_buf, x + bit_ofs);
-                    }
-                }
-                dest_buf = drawbuf_next_row(dest_buf, dest_stride);
-            }
+            color_fill_i1(dsc, src_lumi, 1, 1);
         }
     }
     /* Opacity only */
     else if(mask == NULL && opa < LV_OPA_MAX) {
         if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_I1_WITH_OPA(dsc)) {
-            for(int32_t y = 0; y < h; y++) {
-                for(int32_t x = 0; x < w; x++) {
-                    uint8_t * dest_bit = &dest_buf[(x + bit_ofs) / 8];
-                    uint8_t current_bit = (*dest_bit >> (7 - ((x + bit_ofs) % 8))) & 0x01;
-                    uint8_t new_bit = (opa * src_color + (255 - opa) * current_bit) / 255;
-                    if(new_bit) {
-                        set_bit(dest_buf, x + bit_ofs);
-                    }
-                    else {
-                        clear_bit(dest_buf, x + bit_ofs);
-                    }
-                }
-                dest_buf = drawbuf_next_row(dest_buf, dest_stride);
-            }
+            if(opa > LV_OPA_TRANSP) color_fill_i1(dsc, src_lumi, LV_OPA_COVER + 1, 1);
         }
     }
     /* Masked with full opacity */
     else if(mask && opa >= LV_OPA_MAX) {
         if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_I1_WITH_MASK(dsc)) {
-            for(int32_t y = 0; y < h; y++) {
-                for(int32_t x = 0; x < w; x++) {
-                    uint8_t mask_val = mask[x];
-                    if(mask_val == LV_OPA_TRANSP) continue;
-                    if(mask_val == LV_OPA_COVER) {
-                        if(src_color) {
-                            set_bit(dest_buf, x + bit_ofs);
-                        }
-                        else {
-                            clear_bit(dest_buf, x + bit_ofs);
-                        }
-                    }
-                    else {
-                        uint8_t * dest_bit = &dest_buf[(x + bit_ofs) / 8];
-                        uint8_t current_bit = (*dest_bit >> (7 - ((x + bit_ofs) % 8))) & 0x01;
-                        uint8_t new_bit = (mask_val * src_color + (255 - mask_val) * current_bit) / 255;
-                        if(new_bit) {
-                            set_bit(dest_buf, x + bit_ofs);
-                        }
-                        else {
-                            clear_bit(dest_buf, x + bit_ofs);
-                        }
-                    }
-                }
-                dest_buf = drawbuf_next_row(dest_buf, dest_stride);
-                mask += mask_stride;
-            }
+            color_fill_i1(dsc, src_lumi, LV_OPA_COVER, 1);
         }
     }
     /* Masked with opacity */
     else {
         if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_I1_MIX_MASK_OPA(dsc)) {
-            for(int32_t y = 0; y < h; y++) {
-                for(int32_t x = 0; x < w; x++) {
-                    uint8_t mask_val = mask[x];
-                    if(mask_val == LV_OPA_TRANSP) continue;
-                    uint8_t * dest_bit = &dest_buf[(x + bit_ofs) / 8];
-                    uint8_t current_bit = (*dest_bit >> (7 - ((x  + bit_ofs) % 8))) & 0x01;
-                    uint8_t blended_opa = (mask_val * opa) / 255;
-                    uint8_t new_bit = (blended_opa * src_color + (255 - blended_opa) * current_bit) / 255;
-                    if(new_bit) {
-                        set_bit(dest_buf, x + bit_ofs);
-                    }
-                    else {
-                        clear_bit(dest_buf, x + bit_ofs);
-                    }
-                }
-                dest_buf = drawbuf_next_row(dest_buf, dest_stride);
-                mask += mask_stride;
-            }
+            /*`mask * opa / 255` is not 0 if `mask * opa >= 255`*/
+            if(opa > LV_OPA_TRANSP) color_fill_i1(dsc, src_lumi, LV_OPA_COVER + 1, (255 + opa - 1) / opa);
         }
     }
 }
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_i1(lv_draw_sw_blend_image_dsc_t * dsc)
 {
+#if BLEND_NORMAL_GEN_ENABLED
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        blend_normal_kernel_t kernel = get_blend_normal_kernel(dsc);
+        if(kernel) {
+            kernel(dsc);
+            return;
+        }
+    }
+#endif
+
     switch(dsc->src_color_format) {
 #if LV_DRAW_SW_SUPPORT_RGB565
         case LV_COLOR_FORMAT_RGB565:
@@ -340,7 +379,8 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_i1(lv_draw_sw_blend_image_d
             break;
 #endif
         case LV_COLOR_FORMAT_I1:
-            i1_image_blend(dsc);
+            if(dsc->src_bit_ofs) i1_unaligned_image_blend(dsc);
+            else i1_image_blend(dsc);
             break;
         default:
             LV_LOG_WARN("Not supported source color format");
@@ -348,10 +388,309 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_i1(lv_draw_sw_blend_image_d
     }
 }
 
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_i1_page(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t dest_stride = dsc->dest_stride;
+
+    uint8_t src_lumi = lv_color_luminance(dsc->color);
+    uint8_t * dest_buf = dsc->dest_buf;
+
+    if(mask && dsc->mask_color_format == LV_COLOR_FORMAT_A1) {
+        a1_mask_color_to_i1_page(dsc, src_lumi);
+        return;
+    }
+
+    /*The bit of the first row in the first page*/
+    int32_t bit = dsc->relative_area.y1 & 0x7;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+    int32_t x;
+    int32_t y;
+
+    /* Simple fill: write up to 8 rows with a single byte operation */
+    if(mask == NULL && opa >= LV_OPA_MAX) {
+        /*The bits of the rows in a page of a column. The dithered pattern repeats after 8 columns.*/
+        uint8_t column_bits[8];
+        y = 0;
+        while(y < h) {
+            int32_t rows = LV_MIN(8 - bit, h - y);
+            uint8_t page_mask = (uint8_t)(((1 << rows) - 1) << bit);
+            lv_memzero(column_bits, sizeof(column_bits));
+            for(int32_t r = 0; r < rows; r++) {
+                uint8_t row_bits = dither_pattern(src_lumi, dither_row(abs_x, abs_y + y + r));
+                for(x = 0; x < 8; x++) {
+                    if(row_bits & (0x80 >> x)) column_bits[x] |= (uint8_t)(1 << (bit + r));
+                }
+            }
+
+            page_mask = (uint8_t)~page_mask;
+            for(x = 0; x < w; x++) dest_buf[x] = (dest_buf[x] & page_mask) | column_bits[x & 0x7];
+            y += rows;
+            bit = 0;
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        }
+        return;
+    }
+
+    /* Opacity and/or mask: same rounding as `lv_draw_sw_blend_color_to_i1` */
+    for(y = 0; y < h; y++) {
+        uint8_t bit_mask = (uint8_t)(1 << bit);
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        for(x = 0; x < w; x++) {
+            lv_opa_t px_opa;
+            if(mask == NULL) px_opa = opa;
+            else if(mask[x] == LV_OPA_TRANSP) continue;
+            else if(opa >= LV_OPA_MAX) px_opa = mask[x];
+            else px_opa = (mask[x] * opa) / 255;
+
+            uint8_t src_color = src_lumi > DITHER_TH(th_row, x);
+            uint8_t current_bit = (dest_buf[x] & bit_mask) ? 1 : 0;
+            uint8_t new_bit = (px_opa * src_color + (255 - px_opa) * current_bit) / 255;
+            if(new_bit) dest_buf[x] |= bit_mask;
+            else dest_buf[x] &= (uint8_t)~bit_mask;
+        }
+        if(mask) mask += mask_stride;
+
+        bit++;
+        if(bit == 8) {
+            bit = 0;
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        }
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_i1_page(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_color_format_t src_cf = dsc->src_color_format;
+    switch(src_cf) {
+        case LV_COLOR_FORMAT_I1:
+#if LV_DRAW_SW_SUPPORT_L8
+        case LV_COLOR_FORMAT_L8:
+#endif
+#if LV_DRAW_SW_SUPPORT_AL88
+        case LV_COLOR_FORMAT_AL88:
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_ARGB8888:
+#endif
+            break;
+        default:
+            LV_LOG_WARN("Not supported source color format");
+            return;
+    }
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    lv_blend_mode_t blend_mode = dsc->blend_mode;
+    bool src_has_alpha = src_cf == LV_COLOR_FORMAT_AL88 || src_cf == LV_COLOR_FORMAT_ARGB8888;
+    int32_t src_bit_ofs = dsc->src_bit_ofs;    /*Not 0 only for I1 sources*/
+
+    int32_t bit = dsc->relative_area.y1 & 0x7;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        uint8_t bit_mask = (uint8_t)(1 << bit);
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        for(x = 0; x < w; x++) {
+            uint8_t src_lumi;
+            lv_opa_t src_opa;
+            lv_opa_t px_opa;
+            get_src_lumi_opa(src_buf, x + src_bit_ofs, src_cf, &src_lumi, &src_opa);
+            /*Mix the opacities the same way as the row-major I1 kernels to get identical pixels*/
+            if(src_has_alpha) {
+                if(mask_buf == NULL) px_opa = opa >= LV_OPA_MAX ? src_opa : LV_OPA_MIX2(src_opa, opa);
+                else if(opa >= LV_OPA_MAX) px_opa = LV_OPA_MIX2(src_opa, mask_buf[x]);
+                else px_opa = LV_OPA_MIX3(src_opa, mask_buf[x], opa);
+            }
+            else {
+                if(mask_buf == NULL) px_opa = opa;
+                else if(opa >= LV_OPA_MAX) px_opa = mask_buf[x];
+                else px_opa = LV_OPA_MIX2(mask_buf[x], opa);
+            }
+            if(px_opa == LV_OPA_TRANSP) continue;
+
+            uint8_t dest_lumi = (dest_buf[x] & bit_mask) ? 255 : 0;
+            if(blend_mode == LV_BLEND_MODE_NORMAL) lv_color_8_8_mix(src_lumi, &dest_lumi, px_opa);
+            else dest_lumi = blend_non_normal_lumi(dest_lumi, src_lumi, px_opa, blend_mode);
+
+            if(dest_lumi > DITHER_TH(th_row, x)) dest_buf[x] |= bit_mask;
+            else dest_buf[x] &= (uint8_t)~bit_mask;
+        }
+        if(mask_buf) mask_buf += mask_stride;
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+
+        bit++;
+        if(bit == 8) {
+            bit = 0;
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        }
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Fill with the color, or with its dithered pattern, through an optional A8 mask:
+ * write the pixels whose bit in the pattern is 1 where the mask is at least `min_white`
+ * and the other pixels where it's at least `min_black`. No mask means a fully covering mask.
+ * @param min_white     1..256, 256: never
+ * @param min_black     1..256, 256: never
+ */
+static void LV_ATTRIBUTE_FAST_MEM color_fill_i1(lv_draw_sw_blend_fill_dsc_t * dsc, uint8_t src_lumi,
+                                                uint32_t min_white, uint32_t min_black)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t dest_stride = dsc->dest_stride;
+    uint8_t * dest_buf = dsc->dest_buf;
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    uint8_t sel[SEL_CHUNK_PX / 8];
+    uint32_t min_opa[8];
+    for(int32_t y = 0; y < h; y++) {
+        /*The pattern aligned to the bytes of `dest_buf`, and to the first pixel like `sel`*/
+        uint8_t fill = dither_pattern(src_lumi, dither_row(abs_x - bit_ofs, abs_y + y));
+        uint8_t pattern = dither_pattern(src_lumi, dither_row(abs_x, abs_y + y));
+        uint8_t full_sel = (uint8_t)((min_white <= LV_OPA_COVER ? pattern : 0) |
+                                     (min_black <= LV_OPA_COVER ? ~pattern : 0));
+
+        if(mask == NULL && full_sel == 0xFF) {
+            blend_row_i1(dest_buf, bit_ofs, NULL, fill, NULL, w);
+        }
+        else if(full_sel != 0x00) {
+            if(mask == NULL) {
+                lv_memset(sel, full_sel, sizeof(sel));
+            }
+            else {
+                for(int32_t k = 0; k < 8; k++) min_opa[k] = (pattern & (0x80 >> k)) ? min_white : min_black;
+            }
+
+            for(int32_t x = 0; x < w; x += SEL_CHUNK_PX) {
+                int32_t len = LV_MIN(w - x, SEL_CHUNK_PX);
+                if(mask) mask_to_sel(sel, &mask[x], len, min_opa, full_sel);
+                blend_row_i1(&dest_buf[x / 8], bit_ofs, NULL, fill, sel, len);
+            }
+        }
+
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+/**
+ * Fill through an A1 mask, e.g. a 1 bpp glyph which wasn't expanded to A8.
+ * The pixels are either fully covered or transparent, so only the overall opacity is mixed.
+ */
+static void LV_ATTRIBUTE_FAST_MEM a1_mask_color_to_i1(lv_draw_sw_blend_fill_dsc_t * dsc, uint8_t src_lumi)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const uint8_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t mask_bit_ofs = dsc->mask_bit_ofs;
+    int32_t dest_stride = dsc->dest_stride;
+    uint8_t * dest_buf = dsc->dest_buf;
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    if(opa == LV_OPA_TRANSP) return;
+
+    uint8_t sel[SEL_CHUNK_PX / 8];
+    for(int32_t y = 0; y < h; y++) {
+        uint8_t fill = dither_pattern(src_lumi, dither_row(abs_x - bit_ofs, abs_y + y));
+        uint8_t pattern = dither_pattern(src_lumi, dither_row(abs_x, abs_y + y));
+
+        /*With `opa < LV_OPA_MAX` white doesn't change the pixels and black clears them*/
+        if(opa >= LV_OPA_MAX || pattern != 0xFF) {
+            for(int32_t x = 0; x < w; x += SEL_CHUNK_PX) {
+                int32_t len = LV_MIN(w - x, SEL_CHUNK_PX);
+                a1_to_sel(sel, &mask[x / 8], mask_bit_ofs, len);
+                if(opa < LV_OPA_MAX) {
+                    for(int32_t i = 0; i < (len + 7) / 8; i++) sel[i] &= (uint8_t)~pattern;
+                }
+                blend_row_i1(&dest_buf[x / 8], bit_ofs, NULL, fill, sel, len);
+            }
+        }
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        mask += mask_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM a1_mask_color_to_i1_page(lv_draw_sw_blend_fill_dsc_t * dsc, uint8_t src_lumi)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const uint8_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t mask_bit_ofs = dsc->mask_bit_ofs;
+    int32_t dest_stride = dsc->dest_stride;
+    uint8_t * dest_buf = dsc->dest_buf;
+
+    /*The bit of the first row in the first page*/
+    int32_t bit = dsc->relative_area.y1 & 0x7;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    for(int32_t y = 0; y < h; y++) {
+        uint8_t bit_mask = (uint8_t)(1 << bit);
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        for(int32_t x = 0; x < w; x++) {
+            if(get_bit(mask, x + mask_bit_ofs) == 0) continue;
+
+            uint8_t new_bit = src_lumi > DITHER_TH(th_row, x);
+            if(opa < LV_OPA_MAX) {
+                uint8_t current_bit = (dest_buf[x] & bit_mask) ? 1 : 0;
+                new_bit = (opa * new_bit + (255 - opa) * current_bit) / 255;
+            }
+
+            if(new_bit) dest_buf[x] |= bit_mask;
+            else dest_buf[x] &= (uint8_t)~bit_mask;
+        }
+        mask += mask_stride;
+
+        bit++;
+        if(bit == 8) {
+            bit = 0;
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        }
+    }
+}
+
 static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
 {
     int32_t w = dsc->dest_w;
@@ -369,19 +708,16 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
     int32_t y;
 
     int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
 
+    /* A source pixel is copied if its opacity is at least 128, else the destination pixel is kept.
+     * So whole bytes can be copied, selecting the pixels by the mask if needed.*/
     if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
         if(mask_buf == NULL && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1(dsc)) {
                 for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        if(get_bit(src_buf_i1, src_x)) {
-                            set_bit(dest_buf_i1, dest_x + bit_ofs);
-                        }
-                        else {
-                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
-                        }
-                    }
+                    blend_row_i1(dest_buf_i1, bit_ofs, src_buf_i1, 0, NULL, w);
                     dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
                     src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
                 }
@@ -389,64 +725,30 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
         }
         else if(mask_buf == NULL && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        uint8_t src = get_bit(src_buf_i1, src_x);
-                        uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs);
-                        uint8_t blended = (src * opa + dest * (255 - opa));
-                        if(blended > I1_LUM_THRESHOLD) {
-                            set_bit(dest_buf_i1, dest_x + bit_ofs);
-                        }
-                        else  {
-                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
-                        }
+                if(opa > I1_LUM_THRESHOLD) {
+                    for(y = 0; y < h; y++) {
+                        blend_row_i1(dest_buf_i1, bit_ofs, src_buf_i1, 0, NULL, w);
+                        dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                        src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
                     }
-                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
-                    src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
                 }
             }
         }
         else if(mask_buf && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        uint8_t mask_val = mask_buf[src_x];
-                        uint8_t src = get_bit(src_buf_i1, src_x);
-                        uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs);
-                        uint8_t blended = (src * mask_val + dest * (255 - mask_val));
-                        if(blended > I1_LUM_THRESHOLD) {
-                            set_bit(dest_buf_i1, dest_x + bit_ofs);
-                        }
-                        else  {
-                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
-                        }
-                    }
-                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
-                    src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
-                    mask_buf += mask_stride;
-                }
+                mask_blend_i1(dest_buf_i1, dest_stride, bit_ofs, src_buf_i1, src_stride, mask_buf, mask_stride,
+                              I1_LUM_THRESHOLD + 1, w, h);
             }
         }
         else if(mask_buf && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        uint8_t mask_val = mask_buf[src_x];
-                        if(mask_val == LV_OPA_TRANSP) continue;
-                        uint8_t src = get_bit(src_buf_i1, src_x);
-                        uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs);
-                        uint8_t blend_opa = LV_OPA_MIX2(mask_val, opa);
-                        uint8_t blended = (src * blend_opa + dest * (255 - blend_opa));
-                        if(blended > I1_LUM_THRESHOLD) {
-                            set_bit(dest_buf_i1, dest_x + bit_ofs);
-                        }
-                        else  {
-                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
-                        }
+                /*`LV_OPA_MIX2(mask, opa)` is at least 128 if `mask * opa >= 128 * 256`*/
+                if(opa > LV_OPA_TRANSP) {
+                    uint32_t min_opa = ((I1_LUM_THRESHOLD + 1) * 256 + opa - 1) / opa;
+                    if(min_opa <= LV_OPA_COVER) {
+                        mask_blend_i1(dest_buf_i1, dest_stride, bit_ofs, src_buf_i1, src_stride, mask_buf, mask_stride,
+                                      min_opa, w, h);
                     }
-                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
-                    src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
-                    mask_buf += mask_stride;
                 }
             }
         }
@@ -454,13 +756,15 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
     else {
         lv_color32_t src_argb;
         for(y = 0; y < h; y++) {
+            const uint8_t * th_row = dither_row(abs_x, abs_y + y);
             for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                 src_argb.red = get_bit(src_buf_i1, src_x) * 255;
                 src_argb.green = src_argb.red;
                 src_argb.blue = src_argb.red;
                 if(mask_buf == NULL) src_argb.alpha = opa;
                 else src_argb.alpha = LV_OPA_MIX2(mask_buf[dest_x], opa);
-                blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode);
+                blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode,
+                                       DITHER_TH(th_row, dest_x));
             }
             if(mask_buf) mask_buf += mask_stride;
             dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
@@ -469,6 +773,43 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
     }
 }
 
+/**
+ * Blend an I1 image whose rows don't start at the MSB of a byte, e.g. because it's clipped on the left.
+ * The rows are shifted to start at the MSB in chunks and blended by `i1_image_blend`.
+ */
+static void LV_ATTRIBUTE_FAST_MEM i1_unaligned_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf_i1 = dsc->dest_buf;
+    const uint8_t * src_buf_i1 = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+
+    uint8_t src_aligned[SEL_CHUNK_PX / 8];
+    lv_draw_sw_blend_image_dsc_t chunk_dsc = *dsc;
+    chunk_dsc.src_buf = src_aligned;
+    chunk_dsc.src_bit_ofs = 0;
+    chunk_dsc.dest_h = 1;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        /*The chunks start at whole bytes of the destination as `SEL_CHUNK_PX` is a multiple of 8*/
+        for(x = 0; x < w; x += SEL_CHUNK_PX) {
+            chunk_dsc.dest_w = LV_MIN(w - x, SEL_CHUNK_PX);
+            chunk_dsc.dest_buf = &dest_buf_i1[x / 8];
+            chunk_dsc.mask_buf = mask_buf ? &mask_buf[x] : NULL;
+            lv_area_set(&chunk_dsc.relative_area, dsc->relative_area.x1 + x, dsc->relative_area.y1 + y,
+                        dsc->relative_area.x1 + x + chunk_dsc.dest_w - 1, dsc->relative_area.y1 + y);
+            a1_to_sel(src_aligned, &src_buf_i1[x / 8], dsc->src_bit_ofs, chunk_dsc.dest_w);
+            i1_image_blend(&chunk_dsc);
+        }
+        dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dsc->dest_stride);
+        src_buf_i1 = drawbuf_next_row(src_buf_i1, dsc->src_stride);
+        if(mask_buf) mask_buf += dsc->mask_stride;
+    }
+}
+
 #if LV_DRAW_SW_SUPPORT_L8
 static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
 {
@@ -486,13 +827,16 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t *
     int32_t y;
 
     int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
 
     if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
         if(mask_buf == NULL && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
-                        if(src_buf_l8[src_x] > I1_LUM_THRESHOLD) {
+                        if(src_buf_l8[src_x] > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -507,10 +851,11 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t *
         else if(mask_buf == NULL && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src_buf_l8[src_x], &dest_val, opa);
-                        if(dest_val > I1_LUM_THRESHOLD) {
+                        if(dest_val > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -525,11 +870,12 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t *
         else if(mask_buf && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t src_luminance = src_buf_l8[src_x];
                         uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src_luminance, &dest_val, mask_buf[src_x]);
-                        if(dest_val > I1_LUM_THRESHOLD) {
+                        if(dest_val > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -545,11 +891,12 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t *
         else if(mask_buf && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t src_luminance = src_buf_l8[src_x];
                         uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src_luminance, &dest_val, LV_OPA_MIX2(mask_buf[src_x], opa));
-                        if(dest_val > I1_LUM_THRESHOLD) {
+                        if(dest_val > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -566,13 +913,15 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t *
     else {
         lv_color32_t src_argb;
         for(y = 0; y < h; y++) {
+            const uint8_t * th_row = dither_row(abs_x, abs_y + y);
             for(src_x = 0; src_x < w; src_x++) {
                 src_argb.red = src_buf_l8[src_x];
                 src_argb.green = src_buf_l8[src_x];
                 src_argb.blue = src_buf_l8[src_x];
                 if(mask_buf == NULL) src_argb.alpha = opa;
                 else src_argb.alpha = LV_OPA_MIX2(mask_buf[src_x], opa);
-                blend_non_normal_pixel(dest_buf_i1, src_x + bit_ofs, src_argb, dsc->blend_mode);
+                blend_non_normal_pixel(dest_buf_i1, src_x + bit_ofs, src_argb, dsc->blend_mode,
+                                       DITHER_TH(th_row, src_x));
             }
             if(mask_buf) mask_buf += mask_stride;
             dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
@@ -600,15 +949,18 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(lv_draw_sw_blend_image_dsc_t
     int32_t y;
 
     int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
 
     if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
         if(mask_buf == NULL && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src_buf_al88[src_x].lumi, &dest_val, src_buf_al88[src_x].alpha);
-                        if(dest_val > I1_LUM_THRESHOLD) {
+                        if(dest_val > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -623,10 +975,11 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(lv_draw_sw_blend_image_dsc_t
         else if(mask_buf == NULL && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src_buf_al88[src_x].lumi, &dest_val, LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa));
-                        if(dest_val > I1_LUM_THRESHOLD) {
+                        if(dest_val > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -641,10 +994,11 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(lv_draw_sw_blend_image_dsc_t
         else if(mask_buf && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src_buf_al88[src_x].lumi, &dest_val,  LV_OPA_MIX2(src_buf_al88[src_x].alpha, mask_buf[src_x]));
-                        if(dest_val > I1_LUM_THRESHOLD) {
+                        if(dest_val > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -660,10 +1014,11 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(lv_draw_sw_blend_image_dsc_t
         else if(mask_buf && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src_buf_al88[src_x].lumi, &dest_val, LV_OPA_MIX3(src_buf_al88[src_x].alpha, mask_buf[src_x], opa));
-                        if(dest_val > I1_LUM_THRESHOLD) {
+                        if(dest_val > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -680,13 +1035,15 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(lv_draw_sw_blend_image_dsc_t
     else {
         lv_color32_t src_argb;
         for(y = 0; y < h; y++) {
+            const uint8_t * th_row = dither_row(abs_x, abs_y + y);
             for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
                 src_argb.red = src_buf_al88[src_x].lumi;
                 src_argb.green = src_buf_al88[src_x].lumi;
                 src_argb.blue = src_buf_al88[src_x].lumi;
                 if(mask_buf == NULL) src_argb.alpha = LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa);
                 else src_argb.alpha = LV_OPA_MIX3(src_buf_al88[src_x].alpha, mask_buf[src_x], opa);
-                blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode);
+                blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode,
+                                       DITHER_TH(th_row, dest_x));
             }
             if(mask_buf) mask_buf += mask_stride;
             dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
@@ -713,16 +1070,19 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
     int32_t y;
 
     int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
 
     if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
         if(mask_buf == NULL && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(x = 0; x < w; x++) {
                         uint8_t src = lv_color32_luminance(src_buf_c32[x]);
                         uint8_t dest = get_bit(dest_buf_i1, x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, src_buf_c32[x].alpha);
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, x)) {
                             set_bit(dest_buf_i1, x + bit_ofs);
                         }
                         else {
@@ -737,11 +1097,12 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
         else if(mask_buf == NULL && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(x = 0; x < w; x++) {
                         uint8_t src = lv_color32_luminance(src_buf_c32[x]);
                         uint8_t dest = get_bit(dest_buf_i1, x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, LV_OPA_MIX2(opa, src_buf_c32[x].alpha));
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, x)) {
                             set_bit(dest_buf_i1, x + bit_ofs);
                         }
                         else {
@@ -756,11 +1117,12 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
         else if(mask_buf && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(x = 0; x < w; x++) {
                         uint8_t src = lv_color32_luminance(src_buf_c32[x]);
                         uint8_t dest = get_bit(dest_buf_i1, x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, LV_OPA_MIX2(mask_buf[x], src_buf_c32[x].alpha));
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, x)) {
                             set_bit(dest_buf_i1, x + bit_ofs);
                         }
                         else {
@@ -776,11 +1138,12 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
         else if(mask_buf && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(x = 0; x < w; x++) {
                         uint8_t src = lv_color32_luminance(src_buf_c32[x]);
                         uint8_t dest = get_bit(dest_buf_i1, x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, LV_OPA_MIX3(opa, mask_buf[x], src_buf_c32[x].alpha));
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, x)) {
                             set_bit(dest_buf_i1, x + bit_ofs);
                         }
                         else {
@@ -796,11 +1159,13 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
     }
     else {
         for(y = 0; y < h; y++) {
+            const uint8_t * th_row = dither_row(abs_x, abs_y + y);
             for(x = 0; x < w; x++) {
                 lv_color32_t color_argb = src_buf_c32[x];
                 if(mask_buf == NULL) color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, opa);
                 else color_argb.alpha = LV_OPA_MIX3(color_argb.alpha, mask_buf[x], opa);
-                blend_non_normal_pixel(dest_buf_i1, x + bit_ofs, color_argb, dsc->blend_mode);
+                blend_non_normal_pixel(dest_buf_i1, x + bit_ofs, color_argb, dsc->blend_mode,
+                                       DITHER_TH(th_row, x));
             }
             if(mask_buf) mask_buf += mask_stride;
             dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
@@ -830,15 +1195,18 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_
 
 
     int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
 
     if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
         /*Special case*/
         if(mask_buf == NULL && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
                         uint8_t src = lv_color24_luminance(&src_buf_rgb888[src_x]);
-                        if(src > I1_LUM_THRESHOLD) {
+                        if(src > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -853,11 +1221,12 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_
         else if(mask_buf == NULL && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
                         uint8_t src = lv_color24_luminance(&src_buf_rgb888[src_x]);
                         uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, opa);
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -873,11 +1242,12 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
                 uint32_t mask_x;
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x++, src_x += src_px_size) {
                         uint8_t src = lv_color24_luminance(&src_buf_rgb888[src_x]);
                         uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, mask_buf[mask_x]);
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -894,11 +1264,12 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
                 uint32_t mask_x;
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x++, src_x += src_px_size) {
                         uint8_t src = lv_color24_luminance(&src_buf_rgb888[src_x]);
                         uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, LV_OPA_MIX2(mask_buf[mask_x], opa));
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_i1, dest_x + bit_ofs);
                         }
                         else {
@@ -914,6 +1285,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_
         else {
             lv_color32_t src_argb;
             for(y = 0; y < h; y++) {
+                const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                 for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
                     src_argb.red = src_buf_rgb888[src_x + 2];
                     src_argb.green = src_buf_rgb888[src_x + 1];
@@ -921,7 +1293,8 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_
                     if(mask_buf == NULL) src_argb.alpha = opa;
                     else src_argb.alpha = LV_OPA_MIX2(mask_buf[dest_x], opa);
 
-                    blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode);
+                    blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode,
+                                           DITHER_TH(th_row, dest_x));
                 }
                 if(mask_buf) mask_buf += mask_stride;
                 dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
@@ -945,6 +1318,8 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
     const lv_opa_t * mask_buf = dsc->mask_buf;
     int32_t mask_stride = dsc->mask_stride;
     int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
 
     int32_t src_x;
     int32_t dest_x;
@@ -954,9 +1329,10 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
         if(mask_buf == NULL && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(src_x = 0, dest_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t src = lv_color16_luminance(src_buf_c16[src_x]);
-                        if(src > I1_LUM_THRESHOLD) {
+                        if(src > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_u8, dest_x + bit_ofs);
                         }
                         else {
@@ -971,11 +1347,12 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
         else if(mask_buf == NULL && opa < LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(src_x = 0, dest_x = 0; src_x < w; dest_x++, src_x++) {
                         uint8_t src = lv_color16_luminance(src_buf_c16[src_x]);
                         uint8_t dest = get_bit(dest_buf_u8, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, opa);
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_u8, dest_x  + bit_ofs);
                         }
                         else {
@@ -991,11 +1368,12 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
                 uint32_t mask_x;
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x++, src_x++) {
                         uint8_t src = lv_color16_luminance(src_buf_c16[src_x]);
                         uint8_t dest = get_bit(dest_buf_u8, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, mask_buf[mask_x]);
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_u8, dest_x + bit_ofs);
                         }
                         else {
@@ -1012,11 +1390,12 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
                 uint32_t mask_x;
                 for(y = 0; y < h; y++) {
+                    const uint8_t * th_row = dither_row(abs_x, abs_y + y);
                     for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x++, src_x++) {
                         uint8_t src = lv_color16_luminance(src_buf_c16[src_x]);
                         uint8_t dest = get_bit(dest_buf_u8, dest_x + bit_ofs) * 255;
                         lv_color_8_8_mix(src, &dest, LV_OPA_MIX2(mask_buf[mask_x], opa));
-                        if(dest > I1_LUM_THRESHOLD) {
+                        if(dest > DITHER_TH(th_row, dest_x)) {
                             set_bit(dest_buf_u8, dest_x + bit_ofs);
                         }
                         else {
@@ -1033,6 +1412,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
     else {
         lv_color32_t src_argb;
         for(y = 0; y < h; y++) {
+            const uint8_t * th_row = dither_row(abs_x, abs_y + y);
             for(src_x = 0, dest_x = 0; src_x < w; src_x++, dest_x++) {
                 src_argb.red = (src_buf_c16[src_x].red * 2106) >> 8;
                 src_argb.green = (src_buf_c16[src_x].green * 1037) >> 8;
@@ -1040,7 +1420,8 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
                 if(mask_buf == NULL) src_argb.alpha = opa;
                 else src_argb.alpha = LV_OPA_MIX2(mask_buf[src_x], opa);
 
-                blend_non_normal_pixel(dest_buf_u8, dest_x + bit_ofs, src_argb, dsc->blend_mode);
+                blend_non_normal_pixel(dest_buf_u8, dest_x + bit_ofs, src_argb, dsc->blend_mode,
+                                       DITHER_TH(th_row, dest_x));
             }
             if(mask_buf) mask_buf += mask_stride;
             dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
@@ -1051,11 +1432,22 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
 #endif
 
 static inline void LV_ATTRIBUTE_FAST_MEM blend_non_normal_pixel(uint8_t * dest_buf, int32_t dest_x, lv_color32_t src,
-                                                                lv_blend_mode_t mode)
+                                                                lv_blend_mode_t mode, uint8_t threshold)
 {
-    uint8_t res;
-    int32_t src_lumi = lv_color32_luminance(src);
     uint8_t dest_lumi = get_bit(dest_buf, dest_x) * 255;
+    dest_lumi = blend_non_normal_lumi(dest_lumi, lv_color32_luminance(src), src.alpha, mode);
+    if(dest_lumi > threshold) {
+        set_bit(dest_buf, dest_x);
+    }
+    else {
+        clear_bit(dest_buf, dest_x);
+    }
+}
+
+static inline uint8_t LV_ATTRIBUTE_FAST_MEM blend_non_normal_lumi(uint8_t dest_lumi, uint8_t src_lumi,
+                                                                  lv_opa_t opa, lv_blend_mode_t mode)
+{
+    uint8_t res;
     switch(mode) {
         case LV_BLEND_MODE_ADDITIVE:
             res = LV_MIN(dest_lumi + src_lumi, 255);
@@ -1068,15 +1460,55 @@ static inline void LV_ATTRIBUTE_FAST_MEM blend_non_normal_pixel(uint8_t * dest_b
             break;
         default:
             LV_LOG_WARN("Not supported blend mode: %d", mode);
-            return;
+            return dest_lumi;
     }
 
-    lv_color_8_8_mix(res, &dest_lumi, src.alpha);
-    if(dest_lumi > I1_LUM_THRESHOLD) {
-        set_bit(dest_buf, dest_x);
-    }
-    else {
-        clear_bit(dest_buf, dest_x);
+    lv_color_8_8_mix(res, &dest_lumi, opa);
+    return dest_lumi;
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM get_src_lumi_opa(const uint8_t * src_buf, int32_t src_x,
+                                                          lv_color_format_t src_cf,
+                                                          uint8_t * lumi, lv_opa_t * opa)
+{
+    *opa = LV_OPA_COVER;
+    switch(src_cf) {
+#if LV_DRAW_SW_SUPPORT_L8
+        case LV_COLOR_FORMAT_L8:
+            *lumi = src_buf[src_x];
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_AL88
+        case LV_COLOR_FORMAT_AL88:
+            *lumi = ((const lv_color16a_t *)src_buf)[src_x].lumi;
+            *opa = ((const lv_color16a_t *)src_buf)[src_x].alpha;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+            *lumi = lv_color16_luminance(((const lv_color16_t *)src_buf)[src_x]);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+            *lumi = lv_color24_luminance(&src_buf[src_x * 3]);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+            *lumi = lv_color24_luminance(&src_buf[src_x * 4]);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_ARGB8888:
+            *lumi = lv_color32_luminance(((const lv_color32_t *)src_buf)[src_x]);
+            *opa = ((const lv_color32_t *)src_buf)[src_x].alpha;
+            break;
+#endif
+        case LV_COLOR_FORMAT_I1:
+        default:
+            *lumi = get_bit(src_buf, src_x) * 255;
+            break;
     }
 }
 
@@ -1094,6 +1526,193 @@ static inline void LV_ATTRIBUTE_FAST_MEM lv_color_8_8_mix(const uint8_t src, uin
     }
 }
 
+/**
+ * Write `w` pixels of an I1 row starting at the `bit_ofs`th bit of `dest`.
+ * A pixel gets the same bit of `src`, or if `src == NULL` the bit of `fill` at the same position
+ * as in its byte of `dest` (e.g. 0xFF for white).
+ * Only the pixels whose bit is set in `sel` are written, or all pixels if `sel == NULL`.
+ * The first pixel of `src` and `sel` is their first byte's MSB.
+ */
+static void LV_ATTRIBUTE_FAST_MEM blend_row_i1(uint8_t * dest, int32_t bit_ofs, const uint8_t * src, uint8_t fill,
+                                               const uint8_t * sel, int32_t w)
+{
+    int32_t last = (bit_ofs + w - 1) >> 3;  /*The last byte of `dest`*/
+    int32_t src_last = (w - 1) >> 3;        /*The last byte of `src` and `sel`*/
+    uint8_t head = (uint8_t)(0xFF >> bit_ofs);
+    uint8_t tail = (uint8_t)(0xFF << (7 - ((bit_ofs + w - 1) & 0x7)));
+    int32_t i;
+
+    if(sel == NULL && src == NULL) {
+        if(last == 0) {
+            dest[0] = (dest[0] & ~(head & tail)) | (fill & head & tail);
+            return;
+        }
+        dest[0] = (dest[0] & ~head) | (fill & head);
+        if(last > 1) lv_memset(&dest[1], fill, last - 1);
+        dest[last] = (dest[last] & ~tail) | (fill & tail);
+        return;
+    }
+
+    if(sel == NULL && bit_ofs == 0) {
+        int32_t full = w >> 3;
+        lv_memcpy(dest, src, full);
+        if(w & 0x7) dest[full] = (dest[full] & ~tail) | (src[full] & tail);
+        return;
+    }
+
+    /*The bits of the previous byte of `src` and `sel` shifted into the current byte of `dest`*/
+    uint8_t src_prev = 0;
+    uint8_t sel_prev = 0;
+    for(i = 0; i <= last; i++) {
+        /*Copy 4 bytes at once in the middle of shifted copies*/
+        if(sel == NULL && i > 0) {
+            for(; i + 4 <= last && i + 3 <= src_last; i += 4) {
+                uint32_t src32 = ((uint32_t)src[i] << 24) | ((uint32_t)src[i + 1] << 16) |
+                                 ((uint32_t)src[i + 2] << 8) | src[i + 3];
+                uint32_t dest32 = ((uint32_t)src_prev << (32 - bit_ofs)) | (src32 >> bit_ofs);
+                dest[i] = (uint8_t)(dest32 >> 24);
+                dest[i + 1] = (uint8_t)(dest32 >> 16);
+                dest[i + 2] = (uint8_t)(dest32 >> 8);
+                dest[i + 3] = (uint8_t)dest32;
+                src_prev = src[i + 3];
+            }
+        }
+
+        uint8_t m = 0xFF;
+        if(i == 0) m &= head;
+        if(i == last) m &= tail;
+
+        uint8_t px = fill;
+        if(src) {
+            uint8_t cur = i <= src_last ? src[i] : 0;
+            px = (uint8_t)((src_prev << (8 - bit_ofs)) | (cur >> bit_ofs));
+            src_prev = cur;
+        }
+        if(sel) {
+            uint8_t cur = i <= src_last ? sel[i] : 0;
+            m &= (uint8_t)((sel_prev << (8 - bit_ofs)) | (cur >> bit_ofs));
+            sel_prev = cur;
+        }
+
+        dest[i] = (dest[i] & ~m) | (px & m);
+    }
+}
+
+/**
+ * Copy rows of an I1 image through an A8 mask: write the pixels whose mask is at least `min_opa` (1..255)
+ */
+static void LV_ATTRIBUTE_FAST_MEM mask_blend_i1(uint8_t * dest_buf, int32_t dest_stride, int32_t bit_ofs,
+                                                const uint8_t * src_buf, int32_t src_stride,
+                                                const lv_opa_t * mask, int32_t mask_stride, uint32_t min_opa,
+                                                int32_t w, int32_t h)
+{
+    uint8_t sel[SEL_CHUNK_PX / 8];
+    uint32_t min_opa_px[8];
+    for(int32_t k = 0; k < 8; k++) min_opa_px[k] = min_opa;
+
+    for(int32_t y = 0; y < h; y++) {
+        for(int32_t x = 0; x < w; x += SEL_CHUNK_PX) {
+            int32_t len = LV_MIN(w - x, SEL_CHUNK_PX);
+            mask_to_sel(sel, &mask[x], len, min_opa_px, 0xFF);
+            blend_row_i1(&dest_buf[x / 8], bit_ofs, &src_buf[x / 8], 0, sel, len);
+        }
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask += mask_stride;
+    }
+}
+
+/**
+ * Set the bits of the pixels whose mask is at least their `min_opa` (1..256), MSB first
+ * @param min_opa   the minimal mask of the 1st, 2nd, ... 8th pixel of every 8 pixels
+ * @param full_sel  the bits of 8 pixels with fully covering mask, i.e. where `min_opa <= 255`
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM mask_to_sel(uint8_t * sel, const lv_opa_t * mask, int32_t len,
+                                                     const uint32_t * min_opa, uint8_t full_sel)
+{
+    int32_t x;
+    int32_t k;
+    for(x = 0; x + 8 <= len; x += 8) {
+        /*Typically most of the mask is fully transparent or fully covered*/
+        uint32_t m1 = read_u32(&mask[x]);
+        uint32_t m2 = read_u32(&mask[x + 4]);
+        if((m1 | m2) == 0) {
+            *sel++ = 0x00;
+            continue;
+        }
+        if((m1 & m2) == 0xFFFFFFFF) {
+            *sel++ = full_sel;
+            continue;
+        }
+
+        uint8_t bits = 0;
+        for(k = 0; k < 8; k++) bits = (uint8_t)((bits << 1) | (mask[x + k] >= min_opa[k]));
+        *sel++ = bits;
+    }
+
+    if(x < len) {
+        uint8_t bits = 0;
+        for(k = 0; x + k < len; k++) bits |= (uint8_t)((mask[x + k] >= min_opa[k]) << (7 - k));
+        *sel = bits;
+    }
+}
+
+/**
+ * Shift the bits of an A1 mask starting at the `mask_bit_ofs`th bit to start at the MSB
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM a1_to_sel(uint8_t * sel, const uint8_t * mask, int32_t mask_bit_ofs,
+                                                   int32_t len)
+{
+    int32_t sel_last = (len - 1) >> 3;
+    int32_t mask_last = (mask_bit_ofs + len - 1) >> 3;
+    int32_t i;
+    for(i = 0; i <= sel_last; i++) {
+        uint8_t next = i + 1 <= mask_last ? mask[i + 1] : 0;
+        sel[i] = (uint8_t)((mask[i] << mask_bit_ofs) | (next >> (8 - mask_bit_ofs)));
+    }
+}
+
+/**
+ * Get the dithering thresholds of the pixels in a row
+ * @param abs_x     the absolute X coordinate of the first pixel
+ * @param abs_y     the absolute Y coordinate of the row
+ * @return          the thresholds to get with `DITHER_TH(th_row, x)`, where `x` is relative to `abs_x`
+ */
+static inline const uint8_t * LV_ATTRIBUTE_FAST_MEM dither_row(int32_t abs_x, int32_t abs_y)
+{
+#if LV_DRAW_SW_I1_DITHER == LV_DRAW_SW_I1_DITHER_NONE
+    LV_UNUSED(abs_x);
+    LV_UNUSED(abs_y);
+    return NULL;
+#else
+    return &dither_thresholds[abs_y & 0x7][abs_x & 0x7];
+#endif
+}
+
+/**
+ * Get the bits of 8 pixels with a given luminance, MSB first
+ * @param lumi      the luminance of the pixels
+ * @param th_row    the thresholds of the row from the first pixel, see `dither_row`
+ * @return          e.g. 0xFF for white or 0x55 for 50% gray with dithering
+ */
+static inline uint8_t LV_ATTRIBUTE_FAST_MEM dither_pattern(uint8_t lumi, const uint8_t * th_row)
+{
+#if LV_DRAW_SW_I1_DITHER == LV_DRAW_SW_I1_DITHER_NONE
+    LV_UNUSED(th_row);
+    return lumi > I1_LUM_THRESHOLD ? 0xFF : 0x00;
+#else
+    uint8_t bits = 0;
+    for(int32_t k = 0; k < 8; k++) bits = (uint8_t)((bits << 1) | (lumi > th_row[k]));
+    return bits;
+#endif
+}
+
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM read_u32(const uint8_t * buf)
+{
+    /*Compiled to a single load where unaligned access is allowed*/
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
 static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
 {
     return (void *)((uint8_t *)buf + stride);
@@ -32,6 +32,21 @@ void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color_to_i1(lv_draw_sw_blend_f
 
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_image_to_i1(lv_draw_sw_blend_image_dsc_t * dsc);
 
+/**
+ * Fill an area of an `LV_COLOR_FORMAT_I1_PAGE` buffer.
+ * `dsc->dest_buf` points to the page byte of the top left pixel and
+ * `dsc->relative_area.y1 % 8` tells which bit of that byte is the first row.
+ * @param dsc       the fill descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color_to_i1_page(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+/**
+ * Blend an image to an `LV_COLOR_FORMAT_I1_PAGE` buffer.
+ * The destination is addressed the same way as in `lv_draw_sw_blend_color_to_i1_page`.
+ * @param dsc       the image blend descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_image_to_i1_page(lv_draw_sw_blend_image_dsc_t * dsc);
+
 /**********************
  *      MACROS
  **********************/
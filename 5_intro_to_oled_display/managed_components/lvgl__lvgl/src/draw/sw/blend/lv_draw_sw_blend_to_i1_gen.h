@@ -0,0 +1,1079 @@
+/**
+ * @file lv_draw_sw_blend_to_i1_gen.h
+ *
+ * The NORMAL blend mode image kernels of `lv_draw_sw_blend_to_i1.c`.
+ * Included only by that file as it uses its ASM hooks and static helpers.
+ */
+
+/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "blend_kernel_gen.py"
+ **********************************************************************
+ */
+
+#ifndef LV_DRAW_SW_BLEND_TO_I1_GEN_H
+#define LV_DRAW_SW_BLEND_TO_I1_GEN_H
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*1 if the kernels of any source color format are compiled*/
+#define BLEND_NORMAL_GEN_ENABLED ((LV_DRAW_SW_SUPPORT_AL88 && LV_DRAW_SW_BLEND_GEN_AL88_TO_I1) || \
+                                  (LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_BLEND_GEN_L8_TO_I1) || \
+                                  (LV_DRAW_SW_SUPPORT_RGB565 && LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1) || \
+                                  (LV_DRAW_SW_SUPPORT_RGB888 && LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1) || \
+                                  (LV_DRAW_SW_SUPPORT_XRGB8888 && LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1) || \
+                                  (LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1))
+
+#if BLEND_NORMAL_GEN_ENABLED
+
+/*Index of a kernel in the tables by the used opacity and mask*/
+#define BLEND_NORMAL_KERNEL_INDEX(dsc) (((dsc)->mask_buf ? 2 : 0) + ((dsc)->opa < LV_OPA_MAX ? 1 : 0))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef void (*blend_normal_kernel_t)(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_SW_SUPPORT_AL88 && LV_DRAW_SW_BLEND_GEN_AL88_TO_I1
+
+static inline void al88_blend_normal_to_i1_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                               const lv_color16a_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                               const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(src_buf[x].lumi, &lumi, src_buf[x].alpha);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM al88_blend_normal_to_i1(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        al88_blend_normal_to_i1_row(dest_buf, bit_ofs, src_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void al88_blend_normal_to_i1_with_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                        const lv_color16a_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                        lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(src_buf[x].lumi, &lumi, LV_OPA_MIX2(src_buf[x].alpha, opa));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM al88_blend_normal_to_i1_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        al88_blend_normal_to_i1_with_opa_row(dest_buf, bit_ofs, src_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void al88_blend_normal_to_i1_with_mask_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                         const lv_color16a_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                         const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                         const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(src_buf[x].lumi, &lumi, LV_OPA_MIX2(src_buf[x].alpha, mask_buf[x]));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM al88_blend_normal_to_i1_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        al88_blend_normal_to_i1_with_mask_row(dest_buf, bit_ofs, src_buf, mask_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void al88_blend_normal_to_i1_mix_mask_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                            const lv_color16a_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                            const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                            lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(src_buf[x].lumi, &lumi, LV_OPA_MIX3(src_buf[x].alpha, mask_buf[x], opa));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM al88_blend_normal_to_i1_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        al88_blend_normal_to_i1_mix_mask_opa_row(dest_buf, bit_ofs, src_buf, mask_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t al88_blend_normal_to_i1_kernels[4] = {
+    al88_blend_normal_to_i1,
+    al88_blend_normal_to_i1_with_opa,
+    al88_blend_normal_to_i1_with_mask,
+    al88_blend_normal_to_i1_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_AL88 && LV_DRAW_SW_BLEND_GEN_AL88_TO_I1*/
+
+#if LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_BLEND_GEN_L8_TO_I1
+
+static inline void l8_blend_normal_to_i1_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                             const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                             const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = src_buf[x];
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM l8_blend_normal_to_i1(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        l8_blend_normal_to_i1_row(dest_buf, bit_ofs, src_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void l8_blend_normal_to_i1_with_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                      const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                      lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(src_buf[x], &lumi, opa);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM l8_blend_normal_to_i1_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        l8_blend_normal_to_i1_with_opa_row(dest_buf, bit_ofs, src_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void l8_blend_normal_to_i1_with_mask_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                       const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                       const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                       const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(src_buf[x], &lumi, mask_buf[x]);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM l8_blend_normal_to_i1_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        l8_blend_normal_to_i1_with_mask_row(dest_buf, bit_ofs, src_buf, mask_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void l8_blend_normal_to_i1_mix_mask_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                          const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                          const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                          lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(src_buf[x], &lumi, LV_OPA_MIX2(mask_buf[x], opa));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM l8_blend_normal_to_i1_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        l8_blend_normal_to_i1_mix_mask_opa_row(dest_buf, bit_ofs, src_buf, mask_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t l8_blend_normal_to_i1_kernels[4] = {
+    l8_blend_normal_to_i1,
+    l8_blend_normal_to_i1_with_opa,
+    l8_blend_normal_to_i1_with_mask,
+    l8_blend_normal_to_i1_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_BLEND_GEN_L8_TO_I1*/
+
+#if LV_DRAW_SW_SUPPORT_RGB565 && LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1
+
+static inline void rgb565_blend_normal_to_i1_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                 const lv_color16_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                 const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = lv_color16_luminance(src_buf[x]);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_normal_to_i1(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        rgb565_blend_normal_to_i1_row(dest_buf, bit_ofs, src_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void rgb565_blend_normal_to_i1_with_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                          const lv_color16_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                          lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color16_luminance(src_buf[x]), &lumi, opa);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_normal_to_i1_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        rgb565_blend_normal_to_i1_with_opa_row(dest_buf, bit_ofs, src_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void rgb565_blend_normal_to_i1_with_mask_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                           const lv_color16_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                           const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                           const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color16_luminance(src_buf[x]), &lumi, mask_buf[x]);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_normal_to_i1_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        rgb565_blend_normal_to_i1_with_mask_row(dest_buf, bit_ofs, src_buf, mask_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void rgb565_blend_normal_to_i1_mix_mask_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                              const lv_color16_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                              const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                              lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color16_luminance(src_buf[x]), &lumi, LV_OPA_MIX2(mask_buf[x], opa));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_normal_to_i1_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        rgb565_blend_normal_to_i1_mix_mask_opa_row(dest_buf, bit_ofs, src_buf, mask_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t rgb565_blend_normal_to_i1_kernels[4] = {
+    rgb565_blend_normal_to_i1,
+    rgb565_blend_normal_to_i1_with_opa,
+    rgb565_blend_normal_to_i1_with_mask,
+    rgb565_blend_normal_to_i1_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_RGB565 && LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1*/
+
+#if LV_DRAW_SW_SUPPORT_RGB888 && LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1
+
+static inline void rgb888_blend_normal_to_i1_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                 const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                 const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 3) {
+        uint8_t lumi = lv_color24_luminance(src_buf);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_normal_to_i1(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        rgb888_blend_normal_to_i1_row(dest_buf, bit_ofs, src_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void rgb888_blend_normal_to_i1_with_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                          const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                          lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 3) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color24_luminance(src_buf), &lumi, opa);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_normal_to_i1_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        rgb888_blend_normal_to_i1_with_opa_row(dest_buf, bit_ofs, src_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void rgb888_blend_normal_to_i1_with_mask_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                           const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                           const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                           const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 3) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color24_luminance(src_buf), &lumi, mask_buf[x]);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_normal_to_i1_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        rgb888_blend_normal_to_i1_with_mask_row(dest_buf, bit_ofs, src_buf, mask_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void rgb888_blend_normal_to_i1_mix_mask_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                              const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                              const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                              lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 3) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color24_luminance(src_buf), &lumi, LV_OPA_MIX2(mask_buf[x], opa));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_normal_to_i1_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        rgb888_blend_normal_to_i1_mix_mask_opa_row(dest_buf, bit_ofs, src_buf, mask_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t rgb888_blend_normal_to_i1_kernels[4] = {
+    rgb888_blend_normal_to_i1,
+    rgb888_blend_normal_to_i1_with_opa,
+    rgb888_blend_normal_to_i1_with_mask,
+    rgb888_blend_normal_to_i1_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_RGB888 && LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1*/
+
+#if LV_DRAW_SW_SUPPORT_XRGB8888 && LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1
+
+static inline void xrgb8888_blend_normal_to_i1_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                   const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                   const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        uint8_t lumi = lv_color24_luminance(src_buf);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM xrgb8888_blend_normal_to_i1(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        xrgb8888_blend_normal_to_i1_row(dest_buf, bit_ofs, src_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void xrgb8888_blend_normal_to_i1_with_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                            const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                            lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color24_luminance(src_buf), &lumi, opa);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM xrgb8888_blend_normal_to_i1_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        xrgb8888_blend_normal_to_i1_with_opa_row(dest_buf, bit_ofs, src_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void xrgb8888_blend_normal_to_i1_with_mask_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                             const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                             const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                             const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color24_luminance(src_buf), &lumi, mask_buf[x]);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM xrgb8888_blend_normal_to_i1_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        xrgb8888_blend_normal_to_i1_with_mask_row(dest_buf, bit_ofs, src_buf, mask_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void xrgb8888_blend_normal_to_i1_mix_mask_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                                const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                int32_t w, lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color24_luminance(src_buf), &lumi, LV_OPA_MIX2(mask_buf[x], opa));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM xrgb8888_blend_normal_to_i1_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        xrgb8888_blend_normal_to_i1_mix_mask_opa_row(dest_buf, bit_ofs, src_buf, mask_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t xrgb8888_blend_normal_to_i1_kernels[4] = {
+    xrgb8888_blend_normal_to_i1,
+    xrgb8888_blend_normal_to_i1_with_opa,
+    xrgb8888_blend_normal_to_i1_with_mask,
+    xrgb8888_blend_normal_to_i1_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_XRGB8888 && LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1*/
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1
+
+static inline void argb8888_blend_normal_to_i1_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                   const lv_color32_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                   const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color32_luminance(src_buf[x]), &lumi, src_buf[x].alpha);
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_normal_to_i1(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        argb8888_blend_normal_to_i1_row(dest_buf, bit_ofs, src_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void argb8888_blend_normal_to_i1_with_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                            const lv_color32_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                            lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color32_luminance(src_buf[x]), &lumi, LV_OPA_MIX2(src_buf[x].alpha, opa));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_normal_to_i1_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        argb8888_blend_normal_to_i1_with_opa_row(dest_buf, bit_ofs, src_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void argb8888_blend_normal_to_i1_with_mask_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                             const lv_color32_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                             const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                             const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color32_luminance(src_buf[x]), &lumi, LV_OPA_MIX2(src_buf[x].alpha, mask_buf[x]));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_normal_to_i1_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        argb8888_blend_normal_to_i1_with_mask_row(dest_buf, bit_ofs, src_buf, mask_buf, w, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void argb8888_blend_normal_to_i1_mix_mask_opa_row(uint8_t * LV_DRAW_SW_RESTRICT dest_buf, int32_t bit_ofs,
+                                                                const lv_color32_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                int32_t w, lv_opa_t opa, const uint8_t * th_row)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+        lv_color_8_8_mix(lv_color32_luminance(src_buf[x]), &lumi, LV_OPA_MIX3(src_buf[x].alpha, mask_buf[x], opa));
+        if(lumi > DITHER_TH(th_row, x)) set_bit(dest_buf, x + bit_ofs);
+        else clear_bit(dest_buf, x + bit_ofs);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_normal_to_i1_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    int32_t abs_x = dsc->layer_ofs.x + dsc->relative_area.x1;
+    int32_t abs_y = dsc->layer_ofs.y + dsc->relative_area.y1;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * th_row = dither_row(abs_x, abs_y + y);
+        argb8888_blend_normal_to_i1_mix_mask_opa_row(dest_buf, bit_ofs, src_buf, mask_buf, w, opa, th_row);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t argb8888_blend_normal_to_i1_kernels[4] = {
+    argb8888_blend_normal_to_i1,
+    argb8888_blend_normal_to_i1_with_opa,
+    argb8888_blend_normal_to_i1_with_mask,
+    argb8888_blend_normal_to_i1_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1*/
+
+/**
+ * Get the kernel to blend an image in NORMAL mode
+ * @param dsc       the blend descriptor
+ * @return          the kernel or NULL if the source color format has no generated kernels
+ */
+static inline blend_normal_kernel_t get_blend_normal_kernel(const lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    const blend_normal_kernel_t * kernels;
+    switch(dsc->src_color_format) {
+#if LV_DRAW_SW_SUPPORT_AL88 && LV_DRAW_SW_BLEND_GEN_AL88_TO_I1
+        case LV_COLOR_FORMAT_AL88:
+            kernels = al88_blend_normal_to_i1_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_BLEND_GEN_L8_TO_I1
+        case LV_COLOR_FORMAT_L8:
+            kernels = l8_blend_normal_to_i1_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB565 && LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1
+        case LV_COLOR_FORMAT_RGB565:
+            kernels = rgb565_blend_normal_to_i1_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888 && LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1
+        case LV_COLOR_FORMAT_RGB888:
+            kernels = rgb888_blend_normal_to_i1_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888 && LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1
+        case LV_COLOR_FORMAT_XRGB8888:
+            kernels = xrgb8888_blend_normal_to_i1_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1
+        case LV_COLOR_FORMAT_ARGB8888:
+            kernels = argb8888_blend_normal_to_i1_kernels;
+            break;
+#endif
+        default:
+            return NULL;
+    }
+
+    return kernels[BLEND_NORMAL_KERNEL_INDEX(dsc)];
+}
+
+#endif /*BLEND_NORMAL_GEN_ENABLED*/
+
+#endif /*LV_DRAW_SW_BLEND_TO_I1_GEN_H*/
@@ -65,10 +65,20 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_imag
 
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ l8_to_rgb565(const uint8_t c1);
 
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ rgb888_to_rgb565(const uint8_t * c1);
+
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_16_mix(const uint8_t c1, uint16_t c2, uint8_t mix);
 
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_16_mix_partial(const uint8_t c1, uint16_t c2,
+                                                                              uint8_t mix);
+
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix);
 
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_16_mix_partial(const uint8_t * c1, uint16_t c2,
+                                                                               uint8_t mix);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ color_16_16_mix(uint16_t c1, uint16_t c2, uint8_t mix);
+
 static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * buf, uint32_t stride);
 
 /**********************
@@ -191,6 +201,9 @@ static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * b
     #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(...)  LV_RESULT_INVALID
 #endif
 
+/*The NORMAL blend mode image kernels. Generated by `scripts/blend_kernel_gen.py`*/
+#include "lv_draw_sw_blend_to_rgb565_gen.h"
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -361,6 +374,16 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565(lv_draw_sw_blend_fil
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
 {
+#if BLEND_NORMAL_GEN_ENABLED
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        blend_normal_kernel_t kernel = get_blend_normal_kernel(dsc);
+        if(kernel) {
+            kernel(dsc);
+            return;
+        }
+    }
+#endif
+
     switch(dsc->src_color_format) {
         case LV_COLOR_FORMAT_RGB565:
             rgb565_image_blend(dsc);
@@ -415,6 +438,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
     int32_t dest_stride = dsc->dest_stride;
     const uint8_t * src_buf_i1 = dsc->src_buf;
     int32_t src_stride = dsc->src_stride;
+    int32_t src_bit_ofs = dsc->src_bit_ofs;
     const lv_opa_t * mask_buf = dsc->mask_buf;
     int32_t mask_stride = dsc->mask_stride;
 
@@ -427,7 +451,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                        uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                         dest_buf_u16[dest_x] = l8_to_rgb565(chan_val);
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -439,7 +463,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                        uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                         dest_buf_u16[dest_x] = lv_color_8_16_mix(chan_val, dest_buf_u16[dest_x], opa);
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -452,7 +476,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
 
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                        uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                         dest_buf_u16[dest_x] = lv_color_8_16_mix(chan_val, dest_buf_u16[dest_x], mask_buf[dest_x]);
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -465,7 +489,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
-                        uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                        uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                         dest_buf_u16[dest_x] = lv_color_8_16_mix(chan_val, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -477,9 +501,9 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
     }
     else {
         for(y = 0; y < h; y++) {
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
+            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x++) {
                 uint16_t res = 0;
-                uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                 switch(dsc->blend_mode) {
                     case LV_BLEND_MODE_ADDITIVE:
                         // Additive blending mode
@@ -1096,6 +1120,11 @@ static inline uint16_t LV_ATTRIBUTE_FAST_MEM l8_to_rgb565(const uint8_t c1)
     return ((c1 & 0xF8) << 8) + ((c1 & 0xFC) << 3) + ((c1 & 0xF8) >> 3);
 }
 
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb888_to_rgb565(const uint8_t * c1)
+{
+    return ((c1[2] & 0xF8) << 8) + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+}
+
 static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_8_16_mix(const uint8_t c1, uint16_t c2, uint8_t mix)
 {
 
@@ -1103,34 +1132,61 @@ static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_8_16_mix(const uint8_t c1,
         return c2;
     }
     else if(mix == 255) {
-        return ((c1 & 0xF8) << 8) + ((c1 & 0xFC) << 3) + ((c1 & 0xF8) >> 3);
+        return l8_to_rgb565(c1);
     }
     else {
-        lv_opa_t mix_inv = 255 - mix;
-
-        return ((((c1 >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
-               ((((c1 >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
-               (((c1 >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+        return lv_color_8_16_mix_partial(c1, c2, mix);
     }
 }
 
+/*Mix without checking for a fully transparent or opaque `mix`. Used when `mix` is known to be in 1..254*/
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_8_16_mix_partial(const uint8_t c1, uint16_t c2, uint8_t mix)
+{
+    lv_opa_t mix_inv = 255 - mix;
+
+    return ((((c1 >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+           ((((c1 >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+           (((c1 >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+}
+
 static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix)
 {
     if(mix == 0) {
         return c2;
     }
     else if(mix == 255) {
-        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+        return rgb888_to_rgb565(c1);
     }
     else {
-        lv_opa_t mix_inv = 255 - mix;
-
-        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
-               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
-               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+        return lv_color_24_16_mix_partial(c1, c2, mix);
     }
 }
 
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_24_16_mix_partial(const uint8_t * c1, uint16_t c2, uint8_t mix)
+{
+    lv_opa_t mix_inv = 255 - mix;
+
+    return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+           ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+           (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+}
+
+/**
+ * The same as `lv_color_16_16_mix()` but it can be inlined into the kernels and has no branches.
+ * The early returns of `lv_color_16_16_mix()` are only shortcuts: `mix == 0`, `mix == 255`
+ * and `c1 == c2` give the same result with the formula too.
+ */
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM color_16_16_mix(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+
+    /*0x7E0F81F = 0b00000111111000001111100000011111*/
+    uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+    uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
+    return (uint16_t)(result >> 16) | result;
+}
+
 #if LV_DRAW_SW_SUPPORT_I1
 
 static inline uint8_t LV_ATTRIBUTE_FAST_MEM get_bit(const uint8_t * buf, int32_t bit_idx)
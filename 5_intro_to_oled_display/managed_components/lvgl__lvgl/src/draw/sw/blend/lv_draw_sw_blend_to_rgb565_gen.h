@@ -0,0 +1,1046 @@
+/**
+ * @file lv_draw_sw_blend_to_rgb565_gen.h
+ *
+ * The NORMAL blend mode image kernels of `lv_draw_sw_blend_to_rgb565.c`.
+ * Included only by that file as it uses its ASM hooks and static helpers.
+ */
+
+/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "blend_kernel_gen.py"
+ **********************************************************************
+ */
+
+#ifndef LV_DRAW_SW_BLEND_TO_RGB565_GEN_H
+#define LV_DRAW_SW_BLEND_TO_RGB565_GEN_H
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*1 if the kernels of any source color format are compiled*/
+#define BLEND_NORMAL_GEN_ENABLED ((LV_DRAW_SW_SUPPORT_I1 && LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565) || \
+                                  (LV_DRAW_SW_SUPPORT_AL88 && LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565) || \
+                                  (LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565) || \
+                                  (LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565) || \
+                                  (LV_DRAW_SW_SUPPORT_RGB888 && LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565) || \
+                                  (LV_DRAW_SW_SUPPORT_XRGB8888 && LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565) || \
+                                  (LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565))
+
+#if BLEND_NORMAL_GEN_ENABLED
+
+/*Index of a kernel in the tables by the used opacity and mask*/
+#define BLEND_NORMAL_KERNEL_INDEX(dsc) (((dsc)->mask_buf ? 2 : 0) + ((dsc)->opa < LV_OPA_MAX ? 1 : 0))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef void (*blend_normal_kernel_t)(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_SW_SUPPORT_I1 && LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565
+
+static inline void i1_blend_normal_to_rgb565_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                 const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t src_bit_ofs,
+                                                 int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = l8_to_rgb565(get_bit(src_buf, x + src_bit_ofs) * 255);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM i1_blend_normal_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t src_bit_ofs = dsc->src_bit_ofs;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        i1_blend_normal_to_rgb565_row(dest_buf, src_buf, src_bit_ofs, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void i1_blend_normal_to_rgb565_with_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                          const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                          int32_t src_bit_ofs, int32_t w, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix_partial(get_bit(src_buf, x + src_bit_ofs) * 255, dest_buf[x], opa);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM i1_blend_normal_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t src_bit_ofs = dsc->src_bit_ofs;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        i1_blend_normal_to_rgb565_with_opa_row(dest_buf, src_buf, src_bit_ofs, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void i1_blend_normal_to_rgb565_with_mask_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                           const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                           int32_t src_bit_ofs,
+                                                           const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix(get_bit(src_buf, x + src_bit_ofs) * 255, dest_buf[x], mask_buf[x]);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM i1_blend_normal_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t src_bit_ofs = dsc->src_bit_ofs;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        i1_blend_normal_to_rgb565_with_mask_row(dest_buf, src_buf, src_bit_ofs, mask_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void i1_blend_normal_to_rgb565_mix_mask_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                              const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                              int32_t src_bit_ofs,
+                                                              const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                              lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix(get_bit(src_buf, x + src_bit_ofs) * 255, dest_buf[x],
+                                        LV_OPA_MIX2(mask_buf[x], opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM i1_blend_normal_to_rgb565_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    int32_t src_bit_ofs = dsc->src_bit_ofs;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        i1_blend_normal_to_rgb565_mix_mask_opa_row(dest_buf, src_buf, src_bit_ofs, mask_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t i1_blend_normal_to_rgb565_kernels[4] = {
+    i1_blend_normal_to_rgb565,
+    i1_blend_normal_to_rgb565_with_opa,
+    i1_blend_normal_to_rgb565_with_mask,
+    i1_blend_normal_to_rgb565_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_I1 && LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565*/
+
+#if LV_DRAW_SW_SUPPORT_AL88 && LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565
+
+static inline void al88_blend_normal_to_rgb565_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                   const lv_color16a_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix(src_buf[x].lumi, dest_buf[x], src_buf[x].alpha);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM al88_blend_normal_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        al88_blend_normal_to_rgb565_row(dest_buf, src_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void al88_blend_normal_to_rgb565_with_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                            const lv_color16a_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                            int32_t w, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix(src_buf[x].lumi, dest_buf[x], LV_OPA_MIX2(src_buf[x].alpha, opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM al88_blend_normal_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        al88_blend_normal_to_rgb565_with_opa_row(dest_buf, src_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void al88_blend_normal_to_rgb565_with_mask_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                             const lv_color16a_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                             const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix(src_buf[x].lumi, dest_buf[x], LV_OPA_MIX2(src_buf[x].alpha, mask_buf[x]));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM al88_blend_normal_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        al88_blend_normal_to_rgb565_with_mask_row(dest_buf, src_buf, mask_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void al88_blend_normal_to_rgb565_mix_mask_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                const lv_color16a_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                int32_t w, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix(src_buf[x].lumi, dest_buf[x], LV_OPA_MIX3(src_buf[x].alpha, mask_buf[x], opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM al88_blend_normal_to_rgb565_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        al88_blend_normal_to_rgb565_mix_mask_opa_row(dest_buf, src_buf, mask_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t al88_blend_normal_to_rgb565_kernels[4] = {
+    al88_blend_normal_to_rgb565,
+    al88_blend_normal_to_rgb565_with_opa,
+    al88_blend_normal_to_rgb565_with_mask,
+    al88_blend_normal_to_rgb565_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_AL88 && LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565*/
+
+#if LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565
+
+static inline void l8_blend_normal_to_rgb565_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                 const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = l8_to_rgb565(src_buf[x]);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM l8_blend_normal_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        l8_blend_normal_to_rgb565_row(dest_buf, src_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void l8_blend_normal_to_rgb565_with_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                          const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                          lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix_partial(src_buf[x], dest_buf[x], opa);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM l8_blend_normal_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        l8_blend_normal_to_rgb565_with_opa_row(dest_buf, src_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void l8_blend_normal_to_rgb565_with_mask_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                           const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                           const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix(src_buf[x], dest_buf[x], mask_buf[x]);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM l8_blend_normal_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        l8_blend_normal_to_rgb565_with_mask_row(dest_buf, src_buf, mask_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void l8_blend_normal_to_rgb565_mix_mask_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                              const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                              const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w,
+                                                              lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = lv_color_8_16_mix(src_buf[x], dest_buf[x], LV_OPA_MIX2(mask_buf[x], opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM l8_blend_normal_to_rgb565_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        l8_blend_normal_to_rgb565_mix_mask_opa_row(dest_buf, src_buf, mask_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t l8_blend_normal_to_rgb565_kernels[4] = {
+    l8_blend_normal_to_rgb565,
+    l8_blend_normal_to_rgb565_with_opa,
+    l8_blend_normal_to_rgb565_with_mask,
+    l8_blend_normal_to_rgb565_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565*/
+
+#if LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_normal_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint16_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    uint32_t line_in_bytes = w * 2;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        lv_memcpy(dest_buf, src_buf, line_in_bytes);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void rgb565_blend_normal_to_rgb565_with_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                              const uint16_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                              lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = color_16_16_mix(src_buf[x], dest_buf[x], opa);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_normal_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint16_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        rgb565_blend_normal_to_rgb565_with_opa_row(dest_buf, src_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void rgb565_blend_normal_to_rgb565_with_mask_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                               const uint16_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                               const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = color_16_16_mix(src_buf[x], dest_buf[x], mask_buf[x]);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_normal_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint16_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        rgb565_blend_normal_to_rgb565_with_mask_row(dest_buf, src_buf, mask_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void rgb565_blend_normal_to_rgb565_mix_mask_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                  const uint16_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                  const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                  int32_t w, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest_buf[x] = color_16_16_mix(src_buf[x], dest_buf[x], LV_OPA_MIX2(mask_buf[x], opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_normal_to_rgb565_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint16_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        rgb565_blend_normal_to_rgb565_mix_mask_opa_row(dest_buf, src_buf, mask_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t rgb565_blend_normal_to_rgb565_kernels[4] = {
+    rgb565_blend_normal_to_rgb565,
+    rgb565_blend_normal_to_rgb565_with_opa,
+    rgb565_blend_normal_to_rgb565_with_mask,
+    rgb565_blend_normal_to_rgb565_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565*/
+
+#if LV_DRAW_SW_SUPPORT_RGB888 && LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565
+
+static inline void rgb888_blend_normal_to_rgb565_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                     const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 3) {
+        dest_buf[x] = rgb888_to_rgb565(src_buf);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_normal_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, 3)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        rgb888_blend_normal_to_rgb565_row(dest_buf, src_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void rgb888_blend_normal_to_rgb565_with_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                              const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                              lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 3) {
+        dest_buf[x] = lv_color_24_16_mix_partial(src_buf, dest_buf[x], opa);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_normal_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, 3)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        rgb888_blend_normal_to_rgb565_with_opa_row(dest_buf, src_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void rgb888_blend_normal_to_rgb565_with_mask_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                               const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                               const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 3) {
+        dest_buf[x] = lv_color_24_16_mix(src_buf, dest_buf[x], mask_buf[x]);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_normal_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, 3)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        rgb888_blend_normal_to_rgb565_with_mask_row(dest_buf, src_buf, mask_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void rgb888_blend_normal_to_rgb565_mix_mask_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                  const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                  const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                  int32_t w, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 3) {
+        dest_buf[x] = lv_color_24_16_mix(src_buf, dest_buf[x], LV_OPA_MIX2(mask_buf[x], opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_normal_to_rgb565_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, 3)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        rgb888_blend_normal_to_rgb565_mix_mask_opa_row(dest_buf, src_buf, mask_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t rgb888_blend_normal_to_rgb565_kernels[4] = {
+    rgb888_blend_normal_to_rgb565,
+    rgb888_blend_normal_to_rgb565_with_opa,
+    rgb888_blend_normal_to_rgb565_with_mask,
+    rgb888_blend_normal_to_rgb565_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_RGB888 && LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565*/
+
+#if LV_DRAW_SW_SUPPORT_XRGB8888 && LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565
+
+static inline void xrgb8888_blend_normal_to_rgb565_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                       const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        dest_buf[x] = rgb888_to_rgb565(src_buf);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM xrgb8888_blend_normal_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, 4)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        xrgb8888_blend_normal_to_rgb565_row(dest_buf, src_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void xrgb8888_blend_normal_to_rgb565_with_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                                lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        dest_buf[x] = lv_color_24_16_mix_partial(src_buf, dest_buf[x], opa);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM xrgb8888_blend_normal_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, 4)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        xrgb8888_blend_normal_to_rgb565_with_opa_row(dest_buf, src_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void xrgb8888_blend_normal_to_rgb565_with_mask_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                 const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                 const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                 int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        dest_buf[x] = lv_color_24_16_mix(src_buf, dest_buf[x], mask_buf[x]);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM xrgb8888_blend_normal_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, 4)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        xrgb8888_blend_normal_to_rgb565_with_mask_row(dest_buf, src_buf, mask_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void xrgb8888_blend_normal_to_rgb565_mix_mask_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                    const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                    const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                    int32_t w, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        dest_buf[x] = lv_color_24_16_mix(src_buf, dest_buf[x], LV_OPA_MIX2(mask_buf[x], opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM xrgb8888_blend_normal_to_rgb565_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, 4)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        xrgb8888_blend_normal_to_rgb565_mix_mask_opa_row(dest_buf, src_buf, mask_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t xrgb8888_blend_normal_to_rgb565_kernels[4] = {
+    xrgb8888_blend_normal_to_rgb565,
+    xrgb8888_blend_normal_to_rgb565_with_opa,
+    xrgb8888_blend_normal_to_rgb565_with_mask,
+    xrgb8888_blend_normal_to_rgb565_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_XRGB8888 && LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565*/
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565
+
+static inline void argb8888_blend_normal_to_rgb565_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                       const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        dest_buf[x] = lv_color_24_16_mix(src_buf, dest_buf[x], src_buf[3]);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_normal_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        argb8888_blend_normal_to_rgb565_row(dest_buf, src_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void argb8888_blend_normal_to_rgb565_with_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                const uint8_t * LV_DRAW_SW_RESTRICT src_buf, int32_t w,
+                                                                lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        dest_buf[x] = lv_color_24_16_mix(src_buf, dest_buf[x], LV_OPA_MIX2(src_buf[3], opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_normal_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        argb8888_blend_normal_to_rgb565_with_opa_row(dest_buf, src_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+    }
+}
+
+static inline void argb8888_blend_normal_to_rgb565_with_mask_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                 const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                 const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                 int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        dest_buf[x] = lv_color_24_16_mix(src_buf, dest_buf[x], LV_OPA_MIX2(src_buf[3], mask_buf[x]));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_normal_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        argb8888_blend_normal_to_rgb565_with_mask_row(dest_buf, src_buf, mask_buf, w);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static inline void argb8888_blend_normal_to_rgb565_mix_mask_opa_row(uint16_t * LV_DRAW_SW_RESTRICT dest_buf,
+                                                                    const uint8_t * LV_DRAW_SW_RESTRICT src_buf,
+                                                                    const lv_opa_t * LV_DRAW_SW_RESTRICT mask_buf,
+                                                                    int32_t w, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < w; x++, src_buf += 4) {
+        dest_buf[x] = lv_color_24_16_mix(src_buf, dest_buf[x], LV_OPA_MIX3(src_buf[3], mask_buf[x], opa));
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_normal_to_rgb565_mix_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID != LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        argb8888_blend_normal_to_rgb565_mix_mask_opa_row(dest_buf, src_buf, mask_buf, w, opa);
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        mask_buf += mask_stride;
+    }
+}
+
+static const blend_normal_kernel_t argb8888_blend_normal_to_rgb565_kernels[4] = {
+    argb8888_blend_normal_to_rgb565,
+    argb8888_blend_normal_to_rgb565_with_opa,
+    argb8888_blend_normal_to_rgb565_with_mask,
+    argb8888_blend_normal_to_rgb565_mix_mask_opa,
+};
+
+#endif /*LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565*/
+
+/**
+ * Get the kernel to blend an image in NORMAL mode
+ * @param dsc       the blend descriptor
+ * @return          the kernel or NULL if the source color format has no generated kernels
+ */
+static inline blend_normal_kernel_t get_blend_normal_kernel(const lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    const blend_normal_kernel_t * kernels;
+    switch(dsc->src_color_format) {
+#if LV_DRAW_SW_SUPPORT_I1 && LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565
+        case LV_COLOR_FORMAT_I1:
+            kernels = i1_blend_normal_to_rgb565_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_AL88 && LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565
+        case LV_COLOR_FORMAT_AL88:
+            kernels = al88_blend_normal_to_rgb565_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565
+        case LV_COLOR_FORMAT_L8:
+            kernels = l8_blend_normal_to_rgb565_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+            kernels = rgb565_blend_normal_to_rgb565_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888 && LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565
+        case LV_COLOR_FORMAT_RGB888:
+            kernels = rgb888_blend_normal_to_rgb565_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888 && LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565
+        case LV_COLOR_FORMAT_XRGB8888:
+            kernels = xrgb8888_blend_normal_to_rgb565_kernels;
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565
+        case LV_COLOR_FORMAT_ARGB8888:
+            kernels = argb8888_blend_normal_to_rgb565_kernels;
+            break;
+#endif
+        default:
+            return NULL;
+    }
+
+    return kernels[BLEND_NORMAL_KERNEL_INDEX(dsc)];
+}
+
+#endif /*BLEND_NORMAL_GEN_ENABLED*/
+
+#endif /*LV_DRAW_SW_BLEND_TO_RGB565_GEN_H*/
@@ -365,6 +365,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
     int32_t dest_stride = dsc->dest_stride;
     const uint8_t * src_buf_i1 = dsc->src_buf;
     int32_t src_stride = dsc->src_stride;
+    int32_t src_bit_ofs = dsc->src_bit_ofs;
     const lv_opa_t * mask_buf = dsc->mask_buf;
     int32_t mask_stride = dsc->mask_stride;
 
@@ -377,7 +378,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_888(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                        uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                         dest_buf_u8[dest_x + 2] = chan_val;
                         dest_buf_u8[dest_x + 1] = chan_val;
                         dest_buf_u8[dest_x + 0] = chan_val;
@@ -391,7 +392,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_888_WITH_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                        uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                         lv_color_8_24_mix(chan_val, &dest_buf_u8[dest_x], opa);
                     }
                     dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
@@ -403,7 +404,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_888_WITH_MASK(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                        uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                         lv_color_8_24_mix(chan_val, &dest_buf_u8[dest_x], mask_buf[src_x]);
                     }
                     dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
@@ -416,7 +417,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
             if(LV_RESULT_INVALID == LV_DRAW_SW_I1_BLEND_NORMAL_TO_888_MIX_MASK_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
-                        uint8_t chan_val = get_bit(src_buf_i1, src_x) * 255;
+                        uint8_t chan_val = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                         lv_color_8_24_mix(chan_val, &dest_buf_u8[dest_x], LV_OPA_MIX2(opa, mask_buf[src_x]));
                     }
                     dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
@@ -430,7 +431,7 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
         for(y = 0; y < h; y++) {
             for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
                 lv_color32_t src_argb;
-                src_argb.red = get_bit(src_buf_i1, src_x) * 255;
+                src_argb.red = get_bit(src_buf_i1, src_x + src_bit_ofs) * 255;
                 src_argb.green = src_argb.red;
                 src_argb.blue = src_argb.red;
                 if(mask_buf == NULL) src_argb.alpha = opa;
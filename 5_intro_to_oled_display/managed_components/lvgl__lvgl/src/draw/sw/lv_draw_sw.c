@@ -13,6 +13,7 @@
 #include "../../core/lv_refr.h"
 #include "../../display/lv_display_private.h"
 #include "../../stdlib/lv_string.h"
+#include "../../stdlib/lv_mem.h"
 #include "../../core/lv_global.h"
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
@@ -107,6 +108,8 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit);
 
+static inline uint8_t get_lumi(const uint8_t * src_row, int32_t x, lv_color_format_t cf);
+
 #if LV_DRAW_SW_SUPPORT_ARGB8888
 static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
                               int32_t src_stride,
@@ -176,7 +179,10 @@ void lv_draw_sw_init(void)
         draw_sw_unit->idx = i;
         draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
 
-#if LV_USE_OS
+#if LV_USE_OS && LV_DRAW_SW_PIN_UNITS_TO_CORES
+        lv_thread_init_pinned(&draw_sw_unit->thread, LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACK_SIZE, i,
+                              draw_sw_unit);
+#elif LV_USE_OS
         lv_thread_init(&draw_sw_unit->thread, LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACK_SIZE, draw_sw_unit);
 #endif
     }
@@ -281,6 +287,74 @@ void lv_draw_sw_i1_invert(void * buf, uint32_t buf_size)
     }
 }
 
+lv_result_t lv_draw_sw_i1_dither(const void * src, void * dest, int32_t w, int32_t h, int32_t src_stride,
+                                 int32_t dest_stride, lv_color_format_t src_cf)
+{
+    if(src == NULL || dest == NULL || w <= 0 || h <= 0) return LV_RESULT_INVALID;
+
+    switch(src_cf) {
+        case LV_COLOR_FORMAT_L8:
+        case LV_COLOR_FORMAT_AL88:
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_ARGB8888:
+            break;
+        default:
+            LV_LOG_WARN("Not supported source color format");
+            return LV_RESULT_INVALID;
+    }
+
+    /*The errors to add to the current and to the next row, with a pixel of margin on both sides*/
+    int16_t * err_buf = lv_malloc_zeroed((w + 2) * 2 * sizeof(int16_t));
+    if(err_buf == NULL) {
+        LV_LOG_WARN("Out of memory");
+        return LV_RESULT_INVALID;
+    }
+    int16_t * err_cur = err_buf + 1;
+    int16_t * err_next = err_buf + w + 3;
+
+    const uint8_t * src_row = src;
+    uint8_t * dest_row = dest;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        lv_memzero(dest_row, (w + 7) / 8);
+
+        /*Go right to left in every second row to avoid "worms" in the same direction*/
+        int32_t dir = (y & 1) ? -1 : 1;
+        int32_t x = (y & 1) ? w - 1 : 0;
+        int32_t i;
+        for(i = 0; i < w; i++, x += dir) {
+            int32_t lumi = get_lumi(src_row, x, src_cf) + err_cur[x];
+            int32_t err = lumi;
+            if(lumi > 127) {
+                dest_row[x >> 3] |= (uint8_t)(0x80 >> (x & 0x7));
+                err = lumi - 255;
+            }
+
+            /*Spread 7/16, 3/16, 5/16 and 1/16 of the error to the next pixel and the pixels below*/
+            int32_t err7 = err * 7 / 16;
+            int32_t err3 = err * 3 / 16;
+            int32_t err5 = err * 5 / 16;
+            err_cur[x + dir] += (int16_t)err7;
+            err_next[x - dir] += (int16_t)err3;
+            err_next[x] += (int16_t)err5;
+            err_next[x + dir] += (int16_t)(err - err7 - err3 - err5);
+        }
+
+        int16_t * tmp = err_cur;
+        err_cur = err_next;
+        err_next = tmp;
+        lv_memzero(err_next - 1, (w + 2) * sizeof(int16_t));
+
+        src_row += src_stride;
+        dest_row += dest_stride;
+    }
+
+    lv_free(err_buf);
+    return LV_RESULT_OK;
+}
+
 void lv_draw_sw_rotate(const void * src, void * dest, int32_t src_width, int32_t src_height, int32_t src_stride,
                        int32_t dest_stride, lv_display_rotation_t rotation, lv_color_format_t color_format)
 {
@@ -832,4 +906,23 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
 
 #endif
 
+static inline uint8_t get_lumi(const uint8_t * src_row, int32_t x, lv_color_format_t cf)
+{
+    switch(cf) {
+        case LV_COLOR_FORMAT_L8:
+            return src_row[x];
+        case LV_COLOR_FORMAT_AL88:
+            return ((const lv_color16a_t *)src_row)[x].lumi;
+        case LV_COLOR_FORMAT_RGB565:
+            return lv_color16_luminance(((const lv_color16_t *)src_row)[x]);
+        case LV_COLOR_FORMAT_RGB888:
+            return lv_color24_luminance(&src_row[x * 3]);
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_ARGB8888:
+            return lv_color24_luminance(&src_row[x * 4]);
+        default:
+            return 0;
+    }
+}
+
 #endif /*LV_USE_DRAW_SW*/
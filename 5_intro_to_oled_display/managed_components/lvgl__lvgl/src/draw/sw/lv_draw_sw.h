@@ -171,6 +171,23 @@ void lv_draw_sw_rgb565_swap(void * buf, uint32_t buf_size_px);
  */
 void lv_draw_sw_i1_invert(void * buf, uint32_t buf_size);
 
+/**
+ * Convert an image to I1 with Floyd-Steinberg error diffusion.
+ * It keeps more details of photos and smooth gradients than the ordered dithering of
+ * `LV_DRAW_SW_I1_DITHER`, but it's too slow to run on each refresh, so it's meant to
+ * convert static images once, e.g. after decoding them. The alpha channel is ignored.
+ * @param src           the source buffer
+ * @param dest          the destination buffer in I1 color format (without palette)
+ * @param w             width in pixels
+ * @param h             height in pixels
+ * @param src_stride    source stride in bytes (number of bytes in a row)
+ * @param dest_stride   destination stride in bytes (number of bytes in a row)
+ * @param src_cf        LV_COLOR_FORMAT_L8/AL88/RGB565/RGB888/XRGB8888/ARGB8888
+ * @return              LV_RESULT_OK: converted; LV_RESULT_INVALID: not supported color format or out of memory
+ */
+lv_result_t lv_draw_sw_i1_dither(const void * src, void * dest, int32_t w, int32_t h, int32_t src_stride,
+                                 int32_t dest_stride, lv_color_format_t src_cf);
+
 /**
  * Rotate a buffer into another buffer
  * @param src           the source buffer
@@ -23,6 +23,8 @@
 #include "../../misc/lv_color.h"
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_global.h"
+#include "../../misc/cache/lv_cache.h"
+#include "blend/lv_draw_sw_blend_to_i1.h"
 
 #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "arm2d/lv_draw_sw_helium.h"
@@ -33,6 +35,8 @@
 /*********************
  *      DEFINES
  *********************/
+#define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
+
 #define MAX_BUF_SIZE (uint32_t) (4 * lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing()) * lv_color_format_get_size(lv_display_get_color_format(lv_refr_get_disp_refreshing())))
 
 #ifndef LV_DRAW_SW_IMAGE
@@ -58,6 +62,11 @@
 static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                           const lv_image_decoder_dsc_t * decoder_dsc, lv_draw_image_sup_t * sup,
                           const lv_area_t * img_coords, const lv_area_t * clipped_img_area);
+#if LV_DRAW_SW_SUPPORT_I1
+static lv_result_t img_draw_converted_i1(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                                         const lv_area_t * coords);
+static lv_draw_buf_t * convert_for_i1(const lv_draw_buf_t * decoded, lv_color_format_t cf);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -165,6 +174,10 @@ void lv_draw_sw_layer(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * dr
 void lv_draw_sw_image(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                       const lv_area_t * coords)
 {
+#if LV_DRAW_SW_SUPPORT_I1
+    if(!draw_dsc->tile && img_draw_converted_i1(draw_unit, draw_dsc, coords) == LV_RESULT_OK) return;
+#endif
+
     if(!draw_dsc->tile) {
         lv_draw_image_normal_helper(draw_unit, draw_dsc, coords, img_draw_core);
     }
@@ -462,4 +475,181 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
     }
 }
 
+#if LV_DRAW_SW_SUPPORT_I1
+
+/**
+ * Draw an image to an I1 layer from a copy converted to 1 bpp and stored in the image cache,
+ * so only bytes need to be copied instead of converting every pixel on every redraw.
+ * Opaque images are converted to I1 and A1 images to A1 masks.
+ * @return  LV_RESULT_OK: drawn; LV_RESULT_INVALID: the image needs to be drawn normally
+ */
+static lv_result_t img_draw_converted_i1(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                                         const lv_area_t * coords)
+{
+    lv_color_format_t layer_cf = draw_unit->target_layer->color_format;
+    if(layer_cf != LV_COLOR_FORMAT_I1 && layer_cf != LV_COLOR_FORMAT_I1_PAGE) return LV_RESULT_INVALID;
+    if(!lv_image_cache_is_enabled()) return LV_RESULT_INVALID;
+
+    if(draw_dsc->rotation != 0 || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE ||
+       draw_dsc->bitmap_mask_src != NULL || draw_dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        return LV_RESULT_INVALID;
+    }
+
+    /*Draw buffers, e.g. of layers and canvases, can be changed any time*/
+    lv_image_src_t src_type = lv_image_src_get_type(draw_dsc->src);
+    if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t * img_dsc = draw_dsc->src;
+        if(img_dsc->header.flags & LV_IMAGE_FLAGS_MODIFIABLE) return LV_RESULT_INVALID;
+    }
+    else if(src_type != LV_IMAGE_SRC_FILE) {
+        return LV_RESULT_INVALID;
+    }
+
+    /*Only where the converted image gives the same pixels as the blend kernels*/
+    lv_color_format_t converted_cf;
+    switch(draw_dsc->header.cf) {
+        case LV_COLOR_FORMAT_A1:
+            converted_cf = LV_COLOR_FORMAT_A1;
+            break;
+        case LV_COLOR_FORMAT_L8:
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_XRGB8888:
+            if(draw_dsc->opa < LV_OPA_MAX || draw_dsc->recolor_opa > LV_OPA_MIN) return LV_RESULT_INVALID;
+            converted_cf = LV_COLOR_FORMAT_I1;
+            break;
+        default:
+            return LV_RESULT_INVALID;
+    }
+
+    lv_area_t clipped_img_area;
+    if(!lv_area_intersect(&clipped_img_area, coords, draw_unit->clip_area)) return LV_RESULT_OK;
+
+    lv_draw_buf_t * converted = NULL;
+    lv_cache_entry_t * entry = lv_image_cache_acquire_converted(draw_dsc->src, converted_cf);
+    if(entry) {
+        lv_image_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+        converted = (lv_draw_buf_t *)cached_data->decoded;
+    }
+    else {
+        /*Don't cache the decoded image too, only the much smaller converted one*/
+        lv_image_decoder_args_t args = {
+            .stride_align = false,
+            .premultiply = false,
+            .no_cache = true,
+            .use_indexed = false,
+            .flush_cache = false,
+        };
+        lv_image_decoder_dsc_t decoder_dsc;
+        if(lv_image_decoder_open(&decoder_dsc, draw_dsc->src, &args) != LV_RESULT_OK) return LV_RESULT_INVALID;
+        if(decoder_dsc.decoded) converted = convert_for_i1(decoder_dsc.decoded, converted_cf);
+        lv_image_decoder_close(&decoder_dsc);
+        if(converted == NULL) return LV_RESULT_INVALID;
+
+        /*If it doesn't fit into the cache it's still drawn from the converted image to look the same*/
+        entry = lv_image_cache_add_converted(draw_dsc->src, converted);
+    }
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(lv_draw_sw_blend_dsc_t));
+    blend_dsc.opa = draw_dsc->opa;
+    blend_dsc.blend_mode = draw_dsc->blend_mode;
+    blend_dsc.blend_area = coords;
+    if(converted_cf == LV_COLOR_FORMAT_A1) {
+        blend_dsc.mask_buf = converted->data;
+        blend_dsc.mask_area = coords;
+        blend_dsc.mask_stride = converted->header.stride;
+        blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+        blend_dsc.mask_color_format = LV_COLOR_FORMAT_A1;
+        blend_dsc.color = draw_dsc->recolor;
+    }
+    else {
+        blend_dsc.src_buf = lv_draw_buf_goto_xy(converted, 0, 0);
+        blend_dsc.src_area = coords;
+        blend_dsc.src_stride = converted->header.stride;
+        blend_dsc.src_color_format = LV_COLOR_FORMAT_I1;
+    }
+    lv_draw_sw_blend(draw_unit, &blend_dsc);
+
+    if(entry) lv_image_cache_release(entry);
+    else lv_draw_buf_destroy(converted);
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Convert a decoded image for `img_draw_converted_i1`
+ * @param decoded   the decoded image
+ * @param cf        LV_COLOR_FORMAT_I1 for opaque images or LV_COLOR_FORMAT_A1 for alpha only images
+ * @return          the converted image or NULL if the decoded image's color format isn't supported
+ */
+static lv_draw_buf_t * convert_for_i1(const lv_draw_buf_t * decoded, lv_color_format_t cf)
+{
+    lv_color_format_t src_cf = decoded->header.cf;
+    int32_t w = decoded->header.w;
+    int32_t h = decoded->header.h;
+    int32_t src_stride = decoded->header.stride;
+
+    if(cf == LV_COLOR_FORMAT_A1) {
+        if(src_cf != LV_COLOR_FORMAT_A8) return NULL;
+    }
+    else if(src_cf != LV_COLOR_FORMAT_L8 && src_cf != LV_COLOR_FORMAT_RGB565 &&
+            src_cf != LV_COLOR_FORMAT_RGB888 && src_cf != LV_COLOR_FORMAT_XRGB8888) {
+        return NULL;
+    }
+
+    /*Used only by the software blend, so the rows don't need to be aligned. It keeps the cache entries small.*/
+    lv_draw_buf_t * converted = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, w, h, cf, (w + 7) / 8);
+    if(converted == NULL) return NULL;
+
+    uint8_t * dest = lv_draw_buf_goto_xy(converted, 0, 0);
+    int32_t dest_stride = converted->header.stride;
+
+    if(cf == LV_COLOR_FORMAT_A1) {
+        /*Expanded from A1 by the decoder so the pixels are either transparent or fully covered*/
+        const uint8_t * src = decoded->data;
+        int32_t x, y;
+        for(y = 0; y < h; y++) {
+            lv_memzero(dest, dest_stride);
+            for(x = 0; x < w; x++) {
+                if(src[x] & 0x80) dest[x >> 3] |= (uint8_t)(0x80 >> (x & 0x7));
+            }
+            src += src_stride;
+            dest += dest_stride;
+        }
+        return converted;
+    }
+
+    lv_draw_buf_set_palette(converted, 0, lv_color32_make(0x00, 0x00, 0x00, 0xff));
+    lv_draw_buf_set_palette(converted, 1, lv_color32_make(0xff, 0xff, 0xff, 0xff));
+
+#if LV_DRAW_SW_I1_DITHER != LV_DRAW_SW_I1_DITHER_NONE
+    /*It's done only once, so use error diffusion which looks better than the kernels' ordered dithering*/
+    if(lv_draw_sw_i1_dither(decoded->data, dest, w, h, src_stride, dest_stride, src_cf) != LV_RESULT_OK) {
+        lv_draw_buf_destroy(converted);
+        return NULL;
+    }
+#else
+    /*Let the blend kernel convert it to have the same pixels as the directly drawn image*/
+    lv_draw_sw_blend_image_dsc_t image_dsc;
+    lv_memzero(&image_dsc, sizeof(image_dsc));
+    image_dsc.dest_buf = dest;
+    image_dsc.dest_w = w;
+    image_dsc.dest_h = h;
+    image_dsc.dest_stride = dest_stride;
+    image_dsc.src_buf = decoded->data;
+    image_dsc.src_stride = src_stride;
+    image_dsc.src_color_format = src_cf;
+    image_dsc.opa = LV_OPA_COVER;
+    image_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_area_set(&image_dsc.relative_area, 0, 0, w - 1, h - 1);
+    image_dsc.src_area = image_dsc.relative_area;
+    lv_draw_sw_blend_image_to_i1(&image_dsc);
+#endif
+
+    return converted;
+}
+
+#endif /*LV_DRAW_SW_SUPPORT_I1*/
+
 #endif /*LV_USE_DRAW_SW*/
@@ -85,13 +85,19 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_unit_t * draw_unit, lv_
             case LV_FONT_GLYPH_FORMAT_A2:
             case LV_FONT_GLYPH_FORMAT_A4:
             case LV_FONT_GLYPH_FORMAT_A8: {
+                    lv_draw_buf_t * draw_buf = glyph_draw_dsc->glyph_data;
                     lv_area_t mask_area = *glyph_draw_dsc->letter_coords;
-                    mask_area.x2 = mask_area.x1 + lv_draw_buf_width_to_stride(lv_area_get_width(&mask_area), LV_COLOR_FORMAT_A8) - 1;
                     lv_draw_sw_blend_dsc_t blend_dsc;
                     lv_memzero(&blend_dsc, sizeof(blend_dsc));
+                    if(draw_buf->header.cf == LV_COLOR_FORMAT_A1) {
+                        /*A 1 bpp glyph for a 1 bpp layer, used without expanding it to A8*/
+                        blend_dsc.mask_color_format = LV_COLOR_FORMAT_A1;
+                    }
+                    else {
+                        mask_area.x2 = mask_area.x1 + lv_draw_buf_width_to_stride(lv_area_get_width(&mask_area), LV_COLOR_FORMAT_A8) - 1;
+                    }
                     blend_dsc.color = glyph_draw_dsc->color;
                     blend_dsc.opa = glyph_draw_dsc->opa;
-                    lv_draw_buf_t * draw_buf = glyph_draw_dsc->glyph_data;
                     blend_dsc.mask_buf = draw_buf->data;
                     blend_dsc.mask_area = &mask_area;
                     blend_dsc.mask_stride = draw_buf->header.stride;
@@ -8,6 +8,7 @@
  *********************/
 
 #include "lv_font.h"
+#include "lv_font_fmt_txt.h"
 #include "../misc/lv_text_private.h"
 #include "../misc/lv_utils.h"
 #include "../misc/lv_log.h"
@@ -53,9 +54,15 @@ void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc)
 {
     const lv_font_t * font = g_dsc->resolved_font;
 
-    if(font != NULL && font->release_glyph) {
+    if(font == NULL) return;
+
+    if(font->release_glyph) {
         font->release_glyph(font, g_dsc);
     }
+    else if(font->get_glyph_bitmap == lv_font_get_bitmap_fmt_txt) {
+        /*The built-in fonts are converted without `release_glyph` but their glyphs might be cached*/
+        lv_font_release_glyph_fmt_txt(font, g_dsc);
+    }
 }
 
 bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
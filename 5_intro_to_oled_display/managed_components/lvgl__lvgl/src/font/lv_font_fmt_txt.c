@@ -13,6 +13,7 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache_private.h"
 #include "../stdlib/lv_mem.h"
 
 /*********************
@@ -22,6 +23,23 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    #define CACHE_NAME  "FONT_FMT_TXT"
+
+    #define glyph_cache_p (LV_GLOBAL_DEFAULT()->font_fmt_txt_cache)
+    #define glyph_cache_hit_cnt (LV_GLOBAL_DEFAULT()->font_fmt_txt_cache_hit_cnt)
+    #define glyph_cache_miss_cnt (LV_GLOBAL_DEFAULT()->font_fmt_txt_cache_miss_cnt)
+    #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+#if LV_FONT_FMT_TXT_LOOKUP_CNT > 0
+    #define lookups (LV_GLOBAL_DEFAULT()->font_fmt_txt_lookups)
+    #define lookup_lock (LV_GLOBAL_DEFAULT()->font_fmt_txt_lookup_lock)
+
+    /*Don't convert the kern pairs to a matrix larger than this*/
+    #define KERN_MATRIX_MAX_SIZE    (16 * 1024)
+#endif /*LV_FONT_FMT_TXT_LOOKUP_CNT > 0*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,11 +48,53 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_font_t * font;
+    uint32_t gid;
+    lv_color_format_t cf;       /**< LV_COLOR_FORMAT_A8, or LV_COLOR_FORMAT_A1 for 1 bpp glyphs drawn to 1 bpp layers*/
+    lv_draw_buf_t * draw_buf;   /**< The expanded bitmap*/
+} glyph_cache_data_t;
+#endif
+
+/**
+ * Speeds up finding the glyph of a character in the cmaps and the kern value of a glyph pair.
+ * Created for a font when it's first used.
+ */
+typedef struct lv_font_fmt_txt_lookup_t {
+    const lv_font_fmt_txt_dsc_t * fdsc;
+
+    /*The first cmap which might contain the characters of a 256 character page.
+     *If there is no such cmap it's `cmap_num`. NULL if the cmaps are not sorted.*/
+    uint16_t * page_cmap;
+    uint32_t first_page;
+    uint32_t page_cnt;
+
+    /*Per cmap, the index of the first item of `unicode_list` in each 256 character page of the cmap,
+     *plus the length of the list at the end. NULL for the cmaps which have no `unicode_list`.*/
+    uint16_t ** list_pages;
+
+    /*The kern pairs converted to classes. `kern_values` is NULL if there are no kern pairs
+     *or there are too many of them.*/
+    uint8_t * kern_left_class;
+    uint8_t * kern_right_class;
+    int8_t * kern_values;
+    uint32_t kern_gid_cnt;
+    uint32_t kern_right_class_cnt;
+} lv_font_fmt_txt_lookup_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
-static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static bool expand_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         lv_draw_buf_t * draw_buf);
+static void copy_bits(uint8_t * out, const uint8_t * in, uint32_t bit_ofs, int32_t w);
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, const lv_font_fmt_txt_lookup_t * lookup, uint32_t letter);
+static uint32_t get_cmap_glyph_id(const lv_font_fmt_txt_cmap_t * cmap, uint32_t rcp, uint32_t list_start,
+                                  uint32_t list_end);
+static int8_t get_kern_value(const lv_font_t * font, const lv_font_fmt_txt_lookup_t * lookup, uint32_t gid_left,
+                             uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
@@ -47,6 +107,19 @@ static int kern_pair_16_compare(const void * ref, const void * element);
     static inline uint8_t rle_next(void);
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_LOOKUP_CNT > 0
+    static lv_font_fmt_txt_lookup_t * get_lookup(const lv_font_fmt_txt_dsc_t * fdsc);
+    static lv_font_fmt_txt_lookup_t * lookup_create(const lv_font_fmt_txt_dsc_t * fdsc);
+    static void lookup_create_kern_matrix(lv_font_fmt_txt_lookup_t * lookup, const lv_font_fmt_txt_kern_pair_t * kdsc);
+    static void lookup_delete(lv_font_fmt_txt_lookup_t * lookup);
+#endif /*LV_FONT_FMT_TXT_LOOKUP_CNT > 0*/
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+    static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -58,6 +131,7 @@ static const uint8_t opa4_table[16] = {0,  17, 34,  51,
                                       };
 
 #if LV_USE_FONT_COMPRESSED
+static const uint8_t opa1_table[2] = {0, 255};
 static const uint8_t opa3_table[8] = {0, 36, 73, 109, 146, 182, 218, 255};
 #endif
 
@@ -78,7 +152,6 @@ static const uint8_t opa2_table[4] = {0, 85, 170, 255};
 const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
 {
     const lv_font_t * font = g_dsc->resolved_font;
-    uint8_t * bitmap_out = draw_buf->data;
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
     uint32_t gid = g_dsc->gid.index;
@@ -89,6 +162,198 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    if(glyph_cache_p) {
+        glyph_cache_data_t search_key;
+        search_key.font = font;
+        search_key.gid = gid;
+        search_key.cf = draw_buf->header.cf == LV_COLOR_FORMAT_A1 ? LV_COLOR_FORMAT_A1 : LV_COLOR_FORMAT_A8;
+        search_key.slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, search_key.cf) * gdsc->box_h;
+
+        lv_cache_entry_t * entry = lv_cache_acquire(glyph_cache_p, &search_key, NULL);
+
+        /*The glyphs can be rendered by more draw units in parallel*/
+        lv_mutex_lock(&glyph_cache_p->lock);
+        if(entry) glyph_cache_hit_cnt++;
+        else glyph_cache_miss_cnt++;
+        lv_mutex_unlock(&glyph_cache_p->lock);
+
+        if(entry == NULL) entry = lv_cache_acquire_or_create(glyph_cache_p, &search_key, NULL);
+
+        if(entry) {
+            g_dsc->entry = entry;
+            glyph_cache_data_t * cached = lv_cache_entry_get_data(entry);
+            return cached->draw_buf;
+        }
+
+        /*E.g. the glyph is larger than the whole cache. Expand it to `draw_buf` as usual.*/
+    }
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+    return expand_glyph(fdsc, gdsc, draw_buf) ? draw_buf : NULL;
+}
+
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(glyph_cache_p, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+#else
+    LV_UNUSED(g_dsc);
+#endif
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+#if LV_FONT_FMT_TXT_LOOKUP_CNT > 0
+    const lv_font_fmt_txt_lookup_t * lookup = get_lookup(fdsc);
+#else
+    const lv_font_fmt_txt_lookup_t * lookup = NULL;
+#endif
+    uint32_t gid = get_glyph_dsc_id(font, lookup, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, lookup, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, lookup, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+    dsc_out->entry = NULL;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+void lv_font_fmt_txt_init(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    if(glyph_cache_p != NULL) return;
+
+    glyph_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(glyph_cache_data_t), LV_FONT_FMT_TXT_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) glyph_cache_free_cb,
+    });
+
+    lv_cache_set_name(glyph_cache_p, CACHE_NAME);
+    glyph_cache_hit_cnt = 0;
+    glyph_cache_miss_cnt = 0;
+#endif
+
+#if LV_FONT_FMT_TXT_LOOKUP_CNT > 0
+    lv_mutex_init(&lookup_lock);
+#endif
+}
+
+void lv_font_fmt_txt_deinit(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    if(glyph_cache_p) {
+        lv_cache_destroy(glyph_cache_p, NULL);
+        glyph_cache_p = NULL;
+    }
+#endif
+
+#if LV_FONT_FMT_TXT_LOOKUP_CNT > 0
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_CNT; i++) {
+        if(lookups[i]) lookup_delete(lookups[i]);
+        lookups[i] = NULL;
+    }
+    lv_mutex_delete(&lookup_lock);
+#endif
+}
+
+void lv_font_fmt_txt_lookup_drop(const lv_font_t * font)
+{
+#if LV_FONT_FMT_TXT_LOOKUP_CNT > 0
+    lv_mutex_lock(&lookup_lock);
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_CNT && lookups[i]; i++) {
+        if(lookups[i]->fdsc != font->dsc) continue;
+
+        lookup_delete(lookups[i]);
+        /*Keep the used slots at the beginning*/
+        for(; i < LV_FONT_FMT_TXT_LOOKUP_CNT - 1; i++) lookups[i] = lookups[i + 1];
+        lookups[LV_FONT_FMT_TXT_LOOKUP_CNT - 1] = NULL;
+        break;
+    }
+    lv_mutex_unlock(&lookup_lock);
+#else
+    LV_UNUSED(font);
+#endif
+}
+
+void lv_font_fmt_txt_cache_drop_all(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    if(glyph_cache_p == NULL) return;
+
+    lv_cache_drop_all(glyph_cache_p, NULL);
+#endif
+}
+
+void lv_font_fmt_txt_cache_get_stats(lv_font_fmt_txt_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    lv_memzero(stats, sizeof(lv_font_fmt_txt_cache_stats_t));
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    if(glyph_cache_p == NULL) return;
+
+    lv_mutex_lock(&glyph_cache_p->lock);
+    stats->hit_cnt = glyph_cache_hit_cnt;
+    stats->miss_cnt = glyph_cache_miss_cnt;
+    lv_mutex_unlock(&glyph_cache_p->lock);
+    stats->size = (uint32_t)lv_cache_get_size(glyph_cache_p, NULL);
+    stats->max_size = (uint32_t)lv_cache_get_max_size(glyph_cache_p, NULL);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool expand_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         lv_draw_buf_t * draw_buf)
+{
+    uint8_t * bitmap_out = draw_buf->data;
+
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
         const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
         uint8_t * bitmap_out_tmp = bitmap_out;
@@ -96,7 +361,16 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
         int32_t x, y;
         uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
 
-        if(fdsc->bpp == 1) {
+        if(draw_buf->header.cf == LV_COLOR_FORMAT_A1) {
+            /*1 bpp glyphs are drawn to 1 bpp layers as they are, only the rows are aligned*/
+            if(fdsc->bpp != 1) return false;
+
+            for(y = 0; y < gdsc->box_h; y ++) {
+                copy_bits(bitmap_out_tmp, bitmap_in, (uint32_t)y * gdsc->box_w, gdsc->box_w);
+                bitmap_out_tmp += draw_buf->header.stride;
+            }
+        }
+        else if(fdsc->bpp == 1) {
             for(y = 0; y < gdsc->box_h; y ++) {
                 for(x = 0; x < gdsc->box_w; x++, i++) {
                     i = i & 0x7;
@@ -146,130 +420,155 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
                 bitmap_out_tmp += stride;
             }
         }
-        return draw_buf;
+        return true;
     }
     /*Handle compressed bitmap*/
     else {
 #if LV_USE_FONT_COMPRESSED
+        if(draw_buf->header.cf == LV_COLOR_FORMAT_A1) return false;
+
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
         decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
-        return draw_buf;
+        return true;
 #else /*!LV_USE_FONT_COMPRESSED*/
         LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
+        return false;
 #endif
     }
 
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
 }
 
-bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
-                                   uint32_t unicode_letter_next)
+/**
+ * Copy `w` bits starting at bit `bit_ofs` of `in` to the beginning of `out`
+ * @param out       the destination, the bits after the `w`th bit of the last byte are cleared
+ * @param in        the source
+ * @param bit_ofs   index of the first bit to copy (0 is the MSB of the first byte)
+ * @param w         number of bits to copy
+ */
+static void copy_bits(uint8_t * out, const uint8_t * in, uint32_t bit_ofs, int32_t w)
 {
-    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
-    bool is_tab = unicode_letter == '\t';
-    if(is_tab) {
-        unicode_letter = ' ';
-    }
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
+    in += bit_ofs >> 3;
+    uint32_t shift = bit_ofs & 0x7;
 
-    int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
-        }
+    int32_t i;
+    for(i = 0; w > 0; i++, w -= 8) {
+        uint8_t v = (uint8_t)(in[i] << shift);
+        /*Don't read the next byte if it's not needed as it might be out of the bitmap*/
+        if(shift && w > (int32_t)(8 - shift)) v |= in[i + 1] >> (8 - shift);
+        if(w < 8) v &= (uint8_t)(0xFF << (8 - w));
+        out[i] = v;
     }
+}
 
-    /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
-
-    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
-
-    uint32_t adv_w = gdsc->adv_w;
-    if(is_tab) adv_w *= 2;
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, const lv_font_fmt_txt_lookup_t * lookup, uint32_t letter)
+{
+    if(letter == '\0') return 0;
 
-    adv_w += kv;
-    adv_w  = (adv_w + (1 << 3)) >> 4;
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
-    dsc_out->adv_w = adv_w;
-    dsc_out->box_h = gdsc->box_h;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = gdsc->ofs_x;
-    dsc_out->ofs_y = gdsc->ofs_y;
-    dsc_out->format = (uint8_t)fdsc->bpp;
-    dsc_out->is_placeholder = false;
-    dsc_out->gid.index = gid;
+    uint16_t i;
+    if(lookup && lookup->page_cmap) {
+        /*Most of the characters are usually in the first cmap (e.g. ASCII) so check it directly*/
+        uint32_t rcp0 = letter - fdsc->cmaps[0].range_start;
+        if(rcp0 < fdsc->cmaps[0].range_length && lookup->list_pages[0] == NULL) {
+            return get_cmap_glyph_id(&fdsc->cmaps[0], rcp0, 0, fdsc->cmaps[0].list_length);
+        }
 
-    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+        /*Else only the cmaps around the character's page need to be checked*/
+        uint32_t page = (letter >> 8) - lookup->first_page;
+        if(page >= lookup->page_cnt) return 0;
 
-    return true;
-}
+        for(i = lookup->page_cmap[page]; i < fdsc->cmap_num; i++) {
+            const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+            if(letter < cmap->range_start) return 0;
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+            uint32_t rcp = letter - cmap->range_start;
+            if(rcp >= cmap->range_length) continue;
 
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
-{
-    if(letter == '\0') return 0;
+            const uint16_t * list_pages = lookup->list_pages[i];
+            if(list_pages == NULL) return get_cmap_glyph_id(cmap, rcp, 0, cmap->list_length);
+            else return get_cmap_glyph_id(cmap, rcp, list_pages[rcp >> 8], list_pages[(rcp >> 8) + 1]);
+        }
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+        return 0;
+    }
 
-    uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
         /*Relative code point*/
         uint32_t rcp = letter - fdsc->cmaps[i].range_start;
         if(rcp >= fdsc->cmaps[i].range_length) continue;
-        uint32_t glyph_id = 0;
-        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
-            glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
-            const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
-            glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
-            }
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
-            }
-        }
 
-        return glyph_id;
+        return get_cmap_glyph_id(&fdsc->cmaps[i], rcp, 0, fdsc->cmaps[i].list_length);
     }
 
     return 0;
 
 }
 
-static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
+/**
+ * Get the glyph ID of a character from a cmap
+ * @param cmap          the cmap containing the character
+ * @param rcp           the relative code point of the character in the cmap
+ * @param list_start    search `unicode_list` only from this index...
+ * @param list_end      ...until this index (exclusive)
+ * @return              the glyph ID or 0 if the character is not in the cmap
+ */
+static uint32_t get_cmap_glyph_id(const lv_font_fmt_txt_cmap_t * cmap, uint32_t rcp, uint32_t list_start,
+                                  uint32_t list_end)
+{
+    uint32_t glyph_id = 0;
+    if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+        glyph_id = cmap->glyph_id_start + rcp;
+    }
+    else if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+        const uint8_t * gid_ofs_8 = cmap->glyph_id_ofs_list;
+        glyph_id = cmap->glyph_id_start + gid_ofs_8[rcp];
+    }
+    else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+        uint16_t key = rcp;
+        uint16_t * p = lv_utils_bsearch(&key, cmap->unicode_list + list_start, list_end - list_start,
+                                        sizeof(cmap->unicode_list[0]), unicode_list_compare);
+
+        if(p) {
+            lv_uintptr_t ofs = p - cmap->unicode_list;
+            glyph_id = cmap->glyph_id_start + (uint32_t) ofs;
+        }
+    }
+    else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+        uint16_t key = rcp;
+        uint16_t * p = lv_utils_bsearch(&key, cmap->unicode_list + list_start, list_end - list_start,
+                                        sizeof(cmap->unicode_list[0]), unicode_list_compare);
+
+        if(p) {
+            lv_uintptr_t ofs = p - cmap->unicode_list;
+            const uint16_t * gid_ofs_16 = cmap->glyph_id_ofs_list;
+            glyph_id = cmap->glyph_id_start + gid_ofs_16[ofs];
+        }
+    }
+
+    return glyph_id;
+}
+
+static int8_t get_kern_value(const lv_font_t * font, const lv_font_fmt_txt_lookup_t * lookup, uint32_t gid_left,
+                             uint32_t gid_right)
 {
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
     int8_t value = 0;
 
-    if(fdsc->kern_classes == 0) {
+    if(lookup && lookup->kern_values) {
+        /*Kern pairs converted to classes*/
+        if(gid_left >= lookup->kern_gid_cnt || gid_right >= lookup->kern_gid_cnt) return 0;
+
+        uint8_t left_class = lookup->kern_left_class[gid_left];
+        uint8_t right_class = lookup->kern_right_class[gid_right];
+        if(left_class > 0 && right_class > 0) {
+            value = lookup->kern_values[(left_class - 1) * lookup->kern_right_class_cnt + (right_class - 1)];
+        }
+    }
+    else if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
         if(kdsc->glyph_ids_size == 0) {
@@ -353,6 +652,9 @@ static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h,
 {
     const lv_opa_t * opa_table;
     switch(bpp) {
+        case 1:
+            opa_table = opa1_table;
+            break;
         case 2:
             opa_table = opa2_table;
             break;
@@ -553,3 +855,231 @@ static int unicode_list_compare(const void * ref, const void * element)
 {
     return (*(uint16_t *)ref) - (*(uint16_t *)element);
 }
+
+#if LV_FONT_FMT_TXT_LOOKUP_CNT > 0
+
+/**
+ * Get the lookup tables of a font and create them if the font is used the first time
+ * @param fdsc      the font's descriptor
+ * @return          the lookup tables or NULL if all LV_FONT_FMT_TXT_LOOKUP_CNT slots are used
+ */
+static lv_font_fmt_txt_lookup_t * get_lookup(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    /*The slots are filled from the beginning and never emptied while the font is used
+     *so they can be read without locking*/
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_CNT && lookups[i]; i++) {
+        if(lookups[i]->fdsc == fdsc) return lookups[i];
+    }
+    if(i == LV_FONT_FMT_TXT_LOOKUP_CNT) return NULL;
+
+    lv_mutex_lock(&lookup_lock);
+
+    /*Another thread might have added it in the meantime*/
+    lv_font_fmt_txt_lookup_t * lookup = NULL;
+    for(i = 0; i < LV_FONT_FMT_TXT_LOOKUP_CNT && lookups[i]; i++) {
+        if(lookups[i]->fdsc == fdsc) {
+            lookup = lookups[i];
+            break;
+        }
+    }
+
+    if(lookup == NULL && i < LV_FONT_FMT_TXT_LOOKUP_CNT) {
+        lookup = lookup_create(fdsc);
+        lookups[i] = lookup;
+    }
+
+    lv_mutex_unlock(&lookup_lock);
+
+    return lookup;
+}
+
+static lv_font_fmt_txt_lookup_t * lookup_create(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_lookup_t * lookup = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_lookup_t));
+    LV_ASSERT_MALLOC(lookup);
+    if(lookup == NULL) return NULL;
+
+    lookup->fdsc = fdsc;
+
+    if(fdsc->kern_dsc && fdsc->kern_classes == 0) {
+        lookup_create_kern_matrix(lookup, fdsc->kern_dsc);
+    }
+
+    if(fdsc->cmap_num == 0) return lookup;
+
+    /*The pages can be mapped to the first cmap to check only if the cmaps are sorted.
+     *If not, the cmaps are searched one by one as usual*/
+    uint32_t i;
+    uint32_t last_letter = 0;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        if(i > 0 && cmap->range_start < fdsc->cmaps[i - 1].range_start) return lookup;
+        if(cmap->range_length == 0) continue;
+        last_letter = LV_MAX(last_letter, cmap->range_start + cmap->range_length - 1);
+    }
+
+    lookup->list_pages = lv_malloc_zeroed(fdsc->cmap_num * sizeof(uint16_t *));
+    LV_ASSERT_MALLOC(lookup->list_pages);
+    if(lookup->list_pages == NULL) return lookup;
+
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        if(cmap->unicode_list == NULL) continue;
+
+        uint32_t page_cnt = (cmap->range_length + 255) >> 8;
+        uint16_t * list_pages = lv_malloc((page_cnt + 1) * sizeof(uint16_t));
+        LV_ASSERT_MALLOC(list_pages);
+        if(list_pages == NULL) return lookup;
+
+        uint32_t p;
+        uint32_t j = 0;
+        for(p = 0; p < page_cnt; p++) {
+            while(j < cmap->list_length && cmap->unicode_list[j] < (p << 8)) j++;
+            list_pages[p] = (uint16_t)j;
+        }
+        list_pages[page_cnt] = cmap->list_length;
+        lookup->list_pages[i] = list_pages;
+    }
+
+    lookup->first_page = fdsc->cmaps[0].range_start >> 8;
+    lookup->page_cnt = (last_letter >> 8) - lookup->first_page + 1;
+    uint16_t * page_cmap = lv_malloc(lookup->page_cnt * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(page_cmap);
+    if(page_cmap == NULL) return lookup;
+
+    uint32_t p;
+    for(p = 0; p < lookup->page_cnt; p++) page_cmap[p] = fdsc->cmap_num;
+
+    /*Go backward so that the pages point to the first cmap overlapping with them*/
+    for(i = fdsc->cmap_num; i > 0; i--) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i - 1];
+        if(cmap->range_length == 0) continue;
+
+        uint32_t first = (cmap->range_start >> 8) - lookup->first_page;
+        uint32_t last = ((cmap->range_start + cmap->range_length - 1) >> 8) - lookup->first_page;
+        for(p = first; p <= last; p++) page_cmap[p] = (uint16_t)(i - 1);
+    }
+
+    lookup->page_cmap = page_cmap;
+
+    return lookup;
+}
+
+/**
+ * Convert the kern pairs to classes like in `lv_font_fmt_txt_kern_classes_t`, where every glyph
+ * of the pairs is a class on its own, so the kern values can be read directly from a matrix.
+ * @param lookup    store the classes and the matrix here
+ * @param kdsc      the kern pairs
+ */
+static void lookup_create_kern_matrix(lv_font_fmt_txt_lookup_t * lookup, const lv_font_fmt_txt_kern_pair_t * kdsc)
+{
+    if(kdsc->glyph_ids_size > 1 || kdsc->pair_cnt == 0) return;
+
+    const uint8_t * ids_8 = kdsc->glyph_ids;
+    const uint16_t * ids_16 = kdsc->glyph_ids;
+    uint32_t i;
+    uint32_t gid_cnt = 0;
+    for(i = 0; i < kdsc->pair_cnt * 2; i++) {
+        uint32_t gid = kdsc->glyph_ids_size == 0 ? ids_8[i] : ids_16[i];
+        gid_cnt = LV_MAX(gid_cnt, gid + 1);
+    }
+
+    uint8_t * left_class = lv_malloc_zeroed(gid_cnt);
+    uint8_t * right_class = lv_malloc_zeroed(gid_cnt);
+    LV_ASSERT_MALLOC(left_class);
+    LV_ASSERT_MALLOC(right_class);
+
+    uint32_t left_cnt = 0;
+    uint32_t right_cnt = 0;
+    if(left_class && right_class) {
+        for(i = 0; i < kdsc->pair_cnt; i++) {
+            uint32_t left = kdsc->glyph_ids_size == 0 ? ids_8[i * 2] : ids_16[i * 2];
+            uint32_t right = kdsc->glyph_ids_size == 0 ? ids_8[i * 2 + 1] : ids_16[i * 2 + 1];
+            if(left_class[left] == 0) left_class[left] = (uint8_t)LV_MIN(++left_cnt, 255);
+            if(right_class[right] == 0) right_class[right] = (uint8_t)LV_MIN(++right_cnt, 255);
+        }
+    }
+
+    int8_t * values = NULL;
+    if(left_class && right_class && left_cnt < 255 && right_cnt < 255 && left_cnt * right_cnt <= KERN_MATRIX_MAX_SIZE) {
+        values = lv_malloc_zeroed(left_cnt * right_cnt);
+        LV_ASSERT_MALLOC(values);
+    }
+
+    if(values == NULL) {
+        /*Too many glyphs with kerning, keep using the pairs*/
+        lv_free(left_class);
+        lv_free(right_class);
+        return;
+    }
+
+    for(i = 0; i < kdsc->pair_cnt; i++) {
+        uint32_t left = kdsc->glyph_ids_size == 0 ? ids_8[i * 2] : ids_16[i * 2];
+        uint32_t right = kdsc->glyph_ids_size == 0 ? ids_8[i * 2 + 1] : ids_16[i * 2 + 1];
+        values[(left_class[left] - 1) * right_cnt + (right_class[right] - 1)] = kdsc->values[i];
+    }
+
+    lookup->kern_left_class = left_class;
+    lookup->kern_right_class = right_class;
+    lookup->kern_values = values;
+    lookup->kern_gid_cnt = gid_cnt;
+    lookup->kern_right_class_cnt = right_cnt;
+}
+
+static void lookup_delete(lv_font_fmt_txt_lookup_t * lookup)
+{
+    if(lookup->list_pages) {
+        uint32_t i;
+        for(i = 0; i < lookup->fdsc->cmap_num; i++) lv_free(lookup->list_pages[i]);
+        lv_free(lookup->list_pages);
+    }
+
+    lv_free(lookup->page_cmap);
+    lv_free(lookup->kern_left_class);
+    lv_free(lookup->kern_right_class);
+    lv_free(lookup->kern_values);
+    lv_free(lookup);
+}
+
+#endif /*LV_FONT_FMT_TXT_LOOKUP_CNT > 0*/
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->font != rhs->font) return lhs->font > rhs->font ? 1 : -1;
+    if(lhs->gid != rhs->gid) return lhs->gid > rhs->gid ? 1 : -1;
+    if(lhs->cf != rhs->cf) return lhs->cf > rhs->cf ? 1 : -1;
+    return 0;
+}
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    const lv_font_fmt_txt_dsc_t * fdsc = data->font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[data->gid];
+
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h, data->cf,
+                                                     LV_STRIDE_AUTO);
+    if(draw_buf == NULL) return false;
+
+    if(!expand_glyph(fdsc, gdsc, draw_buf)) {
+        lv_draw_buf_destroy(draw_buf);
+        return false;
+    }
+
+    data->draw_buf = draw_buf;
+    return true;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_draw_buf_destroy(data->draw_buf);
+    data->draw_buf = NULL;
+}
+
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
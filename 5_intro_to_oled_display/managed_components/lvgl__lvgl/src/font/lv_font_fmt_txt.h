@@ -185,6 +185,14 @@ typedef struct {
     uint16_t bitmap_format  : 2;
 } lv_font_fmt_txt_dsc_t;
 
+/** Statistics of the glyph cache of the native font format*/
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of glyph bitmaps found in the cache*/
+    uint32_t miss_cnt;      /**< Number of glyph bitmaps which were not in the cache and had to be expanded*/
+    uint32_t size;          /**< Bytes used by the cached glyph bitmaps*/
+    uint32_t max_size;      /**< The size of the cache in bytes, i.e. `LV_FONT_FMT_TXT_CACHE_SIZE`*/
+} lv_font_fmt_txt_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -193,10 +201,20 @@ typedef struct {
  * Used as `get_glyph_bitmap` callback in lvgl's native font format if the font is uncompressed.
  * @param g_dsc         the glyph descriptor including which font to use, which supply the glyph_index and format.
  * @param draw_buf      a draw buffer that can be used to store the bitmap of the glyph, it's OK not to use it.
- * @return pointer to an A8 bitmap (not necessarily bitmap_out) or NULL if `unicode_letter` not found
+ * @return pointer to an A8 bitmap (not necessarily bitmap_out) or NULL if `unicode_letter` not found.
+ *              If `draw_buf` is LV_COLOR_FORMAT_A1, 1 bpp glyphs are returned as A1 bitmaps.
  */
 const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
 
+/**
+ * Used as `release_glyph` callback in lvgl's native font format.
+ * Releases the glyph bitmap acquired from the glyph cache by `lv_font_get_bitmap_fmt_txt`.
+ * `lv_font_glyph_release_draw_data` calls it for fonts which have no `release_glyph` callback too.
+ * @param font          pointer to font
+ * @param g_dsc         the glyph descriptor whose bitmap was used
+ */
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+
 /**
  * Used as `get_glyph_dsc` callback in lvgl's native font format if the font is uncompressed.
  * @param font pointer to font
@@ -209,6 +227,19 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Drop all the glyphs from the glyph cache of the native font format.
+ * Should be called before a font is freed (e.g. `lv_binfont_destroy` calls it).
+ */
+void lv_font_fmt_txt_cache_drop_all(void);
+
+/**
+ * Get the statistics of the glyph cache of the native font format.
+ * All fields are 0 if `LV_FONT_FMT_TXT_CACHE_SIZE` is 0.
+ * @param stats         store the statistics here
+ */
+void lv_font_fmt_txt_cache_get_stats(lv_font_fmt_txt_cache_stats_t * stats);
+
 /**********************
  *      MACROS
  **********************/
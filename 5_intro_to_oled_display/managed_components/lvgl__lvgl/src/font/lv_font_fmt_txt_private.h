@@ -45,6 +45,23 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Initialize the run time data of the native font format, e.g. the glyph cache.
+ * Called by `lv_init`.
+ */
+void lv_font_fmt_txt_init(void);
+
+/**
+ * Free the run time data of the native font format. Called by `lv_deinit`.
+ */
+void lv_font_fmt_txt_deinit(void);
+
+/**
+ * Free the glyph and kerning lookup tables of a font. Call it before freeing the font's descriptor.
+ * @param font      pointer to a font
+ */
+void lv_font_fmt_txt_lookup_drop(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
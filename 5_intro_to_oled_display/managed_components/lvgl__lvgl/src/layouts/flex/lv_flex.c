@@ -8,6 +8,7 @@
  *********************/
 #include "lv_flex.h"
 #include "../lv_layout.h"
+#include "../lv_layout_private.h"
 #include "../../core/lv_obj_private.h"
 
 #if LV_USE_FLEX
@@ -25,6 +26,7 @@ typedef struct {
     lv_flex_align_t main_place;
     lv_flex_align_t cross_place;
     lv_flex_align_t track_place;
+    lv_layout_item_t * items;
     uint8_t row : 1;
     uint8_t wrap : 1;
     uint8_t rev : 1;
@@ -57,6 +59,7 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void flex_update(lv_obj_t * cont, void * user_data);
+static void items_fill(lv_obj_t * cont, lv_layout_item_t * items);
 static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id, int32_t max_main_size,
                               int32_t item_gap, track_t * t);
 static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, int32_t item_last_id, int32_t abs_x,
@@ -64,8 +67,8 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
 static void place_content(lv_flex_align_t place, int32_t max_size, int32_t content_size, int32_t item_cnt,
                           int32_t * start_pos, int32_t * gap);
 static lv_obj_t * get_next_item(lv_obj_t * cont, bool rev, int32_t * item_id);
-static int32_t lv_obj_get_width_with_margin(const lv_obj_t * obj);
-static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj);
+static int32_t get_width_with_margin(const lv_obj_t * obj, const lv_layout_item_t * item);
+static int32_t get_height_with_margin(const lv_obj_t * obj, const lv_layout_item_t * item);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -137,6 +140,10 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     f.cross_place = lv_obj_get_style_flex_cross_place(cont, LV_PART_MAIN);
     f.track_place = lv_obj_get_style_flex_track_place(cont, LV_PART_MAIN);
 
+    f.items = lv_layout_get_items(cont, LV_LAYOUT_FLEX);
+    if(f.items == NULL) return;
+    items_fill(cont, f.items);
+
     bool rtl = lv_obj_get_style_base_dir(cont, LV_PART_MAIN) == LV_BASE_DIR_RTL;
     int32_t track_gap = !f.row ? lv_obj_get_style_pad_column(cont, LV_PART_MAIN) : lv_obj_get_style_pad_row(cont,
                                                                                                             LV_PART_MAIN);
@@ -216,6 +223,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
             *cross_pos += t.track_cross_size + gap + track_gap;
         }
     }
+    lv_layout_release_items(f.items);
     LV_ASSERT_MEM_INTEGRITY();
 
     if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
@@ -227,6 +235,29 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     LV_TRACE_LAYOUT("finished");
 }
 
+/**
+ * Read the style properties of the children used by the layout.
+ * Only the children whose styles have changed are read again when the items are cached.
+ */
+static void items_fill(lv_obj_t * cont, lv_layout_item_t * items)
+{
+    uint32_t i;
+    for(i = 0; i < cont->spec_attr->child_cnt; i++) {
+        lv_obj_t * obj = cont->spec_attr->children[i];
+        lv_layout_item_t * item = &items[i];
+        if(lv_layout_item_is_valid(item, obj)) continue;
+
+        item->margin_left = lv_obj_get_style_margin_left(obj, LV_PART_MAIN);
+        item->margin_right = lv_obj_get_style_margin_right(obj, LV_PART_MAIN);
+        item->margin_top = lv_obj_get_style_margin_top(obj, LV_PART_MAIN);
+        item->margin_bottom = lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
+        item->translate_x = lv_obj_get_style_translate_x(obj, LV_PART_MAIN);
+        item->translate_y = lv_obj_get_style_translate_y(obj, LV_PART_MAIN);
+        item->flex_grow = lv_obj_get_style_flex_grow(obj, LV_PART_MAIN);
+        lv_layout_item_set_valid(item, obj);
+    }
+}
+
 /**
  * Find the last item of a track
  */
@@ -240,9 +271,10 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
     if(f->wrap && ((f->row && w_set == LV_SIZE_CONTENT) || (!f->row && h_set == LV_SIZE_CONTENT))) {
         f->wrap = false;
     }
-    int32_t(*get_main_size)(const lv_obj_t *) = (f->row ? lv_obj_get_width_with_margin : lv_obj_get_height_with_margin);
-    int32_t(*get_cross_size)(const lv_obj_t *) = (!f->row ? lv_obj_get_width_with_margin :
-                                                  lv_obj_get_height_with_margin);
+    int32_t(*get_main_size)(const lv_obj_t *, const lv_layout_item_t *) = (f->row ? get_width_with_margin :
+                                                                           get_height_with_margin);
+    int32_t(*get_cross_size)(const lv_obj_t *, const lv_layout_item_t *) = (!f->row ? get_width_with_margin :
+                                                                            get_height_with_margin);
 
     t->track_main_size = 0;
     t->track_fix_main_size = 0;
@@ -258,7 +290,8 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
         if(item_id != item_start_id && lv_obj_has_flag(item, LV_OBJ_FLAG_FLEX_IN_NEW_TRACK)) break;
 
         if(!lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) {
-            uint8_t grow_value = lv_obj_get_style_flex_grow(item, LV_PART_MAIN);
+            const lv_layout_item_t * layout_item = &f->items[item_id];
+            uint8_t grow_value = layout_item->flex_grow;
             if(grow_value) {
                 t->grow_item_cnt++;
                 t->track_fix_main_size += item_gap;
@@ -278,12 +311,12 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
                 }
             }
             else {
-                int32_t item_size = get_main_size(item);
+                int32_t item_size = get_main_size(item, layout_item);
                 if(f->wrap && t->track_fix_main_size + item_size > max_main_size) break;
                 t->track_fix_main_size += item_size + item_gap;
             }
 
-            t->track_cross_size = LV_MAX(get_cross_size(item), t->track_cross_size);
+            t->track_cross_size = LV_MAX(get_cross_size(item, layout_item), t->track_cross_size);
             t->item_cnt++;
         }
 
@@ -300,10 +333,11 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
     /*Have at least one item in a row*/
     if(item && item_id == item_start_id) {
         item = cont->spec_attr->children[item_id];
+        const lv_layout_item_t * layout_item = &f->items[item_id];
         get_next_item(cont, f->rev, &item_id);
         if(item) {
-            t->track_cross_size = get_cross_size(item);
-            t->track_main_size = get_main_size(item);
+            t->track_cross_size = get_cross_size(item, layout_item);
+            t->track_main_size = get_main_size(item, layout_item);
             t->item_cnt = 1;
         }
     }
@@ -321,12 +355,6 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
     int32_t (*area_get_main_size)(const lv_area_t *) = (f->row ? lv_area_get_width : lv_area_get_height);
     int32_t (*area_get_cross_size)(const lv_area_t *) = (!f->row ? lv_area_get_width : lv_area_get_height);
 
-    typedef int32_t (*margin_func_t)(const lv_obj_t *, uint32_t);
-    margin_func_t get_margin_main_start = (f->row ? lv_obj_get_style_margin_left : lv_obj_get_style_margin_top);
-    margin_func_t get_margin_main_end = (f->row ? lv_obj_get_style_margin_right : lv_obj_get_style_margin_bottom);
-    margin_func_t get_margin_cross_start = (!f->row ? lv_obj_get_style_margin_left : lv_obj_get_style_margin_top);
-    margin_func_t get_margin_cross_end = (!f->row ? lv_obj_get_style_margin_right : lv_obj_get_style_margin_bottom);
-
     /*Calculate the size of grow items first*/
     uint32_t i;
     bool grow_reiterate  = true;
@@ -377,8 +405,13 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             item = get_next_item(cont, f->rev, &item_first_id);
             continue;
         }
-        int32_t grow_size = lv_obj_get_style_flex_grow(item, LV_PART_MAIN);
-        if(grow_size) {
+        const lv_layout_item_t * layout_item = &f->items[item_first_id];
+        int32_t margin_main_start = f->row ? layout_item->margin_left : layout_item->margin_top;
+        int32_t margin_main_end = f->row ? layout_item->margin_right : layout_item->margin_bottom;
+        int32_t margin_cross_start = !f->row ? layout_item->margin_left : layout_item->margin_top;
+        int32_t margin_cross_end = !f->row ? layout_item->margin_right : layout_item->margin_bottom;
+
+        if(layout_item->flex_grow) {
             int32_t s = 0;
             for(i = 0; i < t->grow_item_cnt; i++) {
                 if(t->grow_dsc[i].item == item) {
@@ -418,22 +451,22 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
                 /*Round up the cross size to avoid rounding error when dividing by 2
                  *The issue comes up e,g, with column direction with center cross direction if an element's width changes*/
                 cross_pos = (((t->track_cross_size + 1) & (~1)) - area_get_cross_size(&item->coords)) / 2;
-                cross_pos += (get_margin_cross_start(item, LV_PART_MAIN) - get_margin_cross_end(item, LV_PART_MAIN)) / 2;
+                cross_pos += (margin_cross_start - margin_cross_end) / 2;
                 break;
             case LV_FLEX_ALIGN_END:
                 cross_pos = t->track_cross_size - area_get_cross_size(&item->coords);
-                cross_pos -= get_margin_cross_end(item, LV_PART_MAIN);
+                cross_pos -= margin_cross_end;
                 break;
             default:
-                cross_pos += get_margin_cross_start(item, LV_PART_MAIN);
+                cross_pos += margin_cross_start;
                 break;
         }
 
         if(f->row && rtl) main_pos -= area_get_main_size(&item->coords);
 
         /*Handle percentage value of translate*/
-        int32_t tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
-        int32_t tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+        int32_t tr_x = layout_item->translate_x;
+        int32_t tr_y = layout_item->translate_y;
         int32_t w = lv_obj_get_width(item);
         int32_t h = lv_obj_get_height(item);
         if(LV_COORD_IS_PCT(tr_x)) tr_x = (w * LV_COORD_GET_PCT(tr_x)) / 100;
@@ -441,8 +474,8 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
 
         int32_t diff_x = abs_x - item->coords.x1 + tr_x;
         int32_t diff_y = abs_y - item->coords.y1 + tr_y;
-        diff_x += f->row ? main_pos + get_margin_main_start(item, LV_PART_MAIN) : cross_pos;
-        diff_y += f->row ? cross_pos : main_pos + get_margin_main_start(item, LV_PART_MAIN);
+        diff_x += f->row ? main_pos + margin_main_start : cross_pos;
+        diff_y += f->row ? cross_pos : main_pos + margin_main_start;
 
         if(diff_x || diff_y) {
             lv_obj_invalidate(item);
@@ -455,8 +488,7 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
         }
 
         if(!(f->row && rtl)) main_pos += area_get_main_size(&item->coords) + item_gap + place_gap
-                                             + get_margin_main_start(item, LV_PART_MAIN)
-                                             + get_margin_main_end(item, LV_PART_MAIN);
+                                             + margin_main_start + margin_main_end;
         else main_pos -= item_gap + place_gap;
 
         item = get_next_item(cont, f->rev, &item_first_id);
@@ -519,18 +551,14 @@ static lv_obj_t * get_next_item(lv_obj_t * cont, bool rev, int32_t * item_id)
     }
 }
 
-static int32_t lv_obj_get_width_with_margin(const lv_obj_t * obj)
+static int32_t get_width_with_margin(const lv_obj_t * obj, const lv_layout_item_t * item)
 {
-    return lv_obj_get_style_margin_left(obj, LV_PART_MAIN)
-           + lv_obj_get_width(obj)
-           + lv_obj_get_style_margin_right(obj, LV_PART_MAIN);
+    return item->margin_left + lv_obj_get_width(obj) + item->margin_right;
 }
 
-static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj)
+static int32_t get_height_with_margin(const lv_obj_t * obj, const lv_layout_item_t * item)
 {
-    return lv_obj_get_style_margin_top(obj, LV_PART_MAIN)
-           + lv_obj_get_height(obj)
-           + lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
+    return item->margin_top + lv_obj_get_height(obj) + item->margin_bottom;
 }
 
 #endif /*LV_USE_FLEX*/
@@ -12,6 +12,7 @@
 
 #include "../../stdlib/lv_string.h"
 #include "../lv_layout.h"
+#include "../lv_layout_private.h"
 #include "../../core/lv_obj_private.h"
 #include "../../core/lv_global.h"
 /*********************
@@ -40,6 +41,7 @@ typedef struct {
     int32_t * y;
     int32_t * w;
     int32_t * h;
+    lv_layout_item_t * items;
     uint32_t col_num;
     uint32_t row_num;
     int32_t grid_w;
@@ -58,7 +60,10 @@ static void calc(lv_obj_t * obj, lv_grid_calc_t * calc);
 static void calc_free(lv_grid_calc_t * calc);
 static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c);
 static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c);
-static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint);
+static void items_fill(lv_obj_t * cont, lv_layout_item_t * items);
+static int32_t * track_buf_get(lv_obj_t * cont, bool col, uint32_t track_num);
+static void item_repos(lv_obj_t * item, const lv_layout_item_t * layout_item, lv_grid_calc_t * c,
+                       item_repos_hint_t * hint);
 static int32_t grid_align(int32_t cont_size, bool auto_size, lv_grid_align_t align, int32_t gap,
                           uint32_t track_num,
                           int32_t * size_array, int32_t * pos_array, bool reverse);
@@ -104,16 +109,6 @@ static inline lv_grid_align_t get_grid_row_align(lv_obj_t * obj)
 {
     return lv_obj_get_style_grid_row_align(obj, 0);
 }
-static inline int32_t get_margin_hor(lv_obj_t * obj)
-{
-    return lv_obj_get_style_margin_left(obj, LV_PART_MAIN)
-           + lv_obj_get_style_margin_right(obj, LV_PART_MAIN);
-}
-static inline int32_t get_margin_ver(lv_obj_t * obj)
-{
-    return lv_obj_get_style_margin_top(obj, LV_PART_MAIN)
-           + lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
-}
 
 static inline int32_t div_round_closest(int32_t dividend, int32_t divisor)
 {
@@ -194,6 +189,9 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     //    if(col_templ == NULL || row_templ == NULL) return;
 
     lv_grid_calc_t c;
+    c.items = lv_layout_get_items(cont, LV_LAYOUT_GRID);
+    if(c.items == NULL) return;
+    items_fill(cont, c.items);
     calc(cont, &c);
 
     item_repos_hint_t hint;
@@ -209,9 +207,10 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     uint32_t i;
     for(i = 0; i < cont->spec_attr->child_cnt; i++) {
         lv_obj_t * item = cont->spec_attr->children[i];
-        item_repos(item, &c, &hint);
+        item_repos(item, &c.items[i], &c, &hint);
     }
     calc_free(&c);
+    lv_layout_release_items(c.items);
 
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
@@ -233,7 +232,9 @@ static void grid_update(lv_obj_t * cont, void * user_data)
 static void calc(lv_obj_t * cont, lv_grid_calc_t * calc_out)
 {
     if(lv_obj_get_child(cont, 0) == NULL) {
+        lv_layout_item_t * items = calc_out->items;
         lv_memzero(calc_out, sizeof(lv_grid_calc_t));
+        calc_out->items = items;
         return;
     }
 
@@ -266,10 +267,73 @@ static void calc(lv_obj_t * cont, lv_grid_calc_t * calc_out)
  */
 static void calc_free(lv_grid_calc_t * calc)
 {
+#if LV_LAYOUT_CACHE
+    /*The tracks are kept in the cache of the container*/
+    LV_UNUSED(calc);
+#else
+    /*`w` and `h` are in the same buffer*/
     lv_free(calc->x);
     lv_free(calc->y);
-    lv_free(calc->w);
-    lv_free(calc->h);
+#endif
+}
+
+/**
+ * Read the style properties of the children used by the layout.
+ * Only the children whose styles have changed are read again when the items are cached.
+ */
+static void items_fill(lv_obj_t * cont, lv_layout_item_t * items)
+{
+    uint32_t i;
+    for(i = 0; i < cont->spec_attr->child_cnt; i++) {
+        lv_obj_t * obj = cont->spec_attr->children[i];
+        lv_layout_item_t * item = &items[i];
+        if(lv_layout_item_is_valid(item, obj)) continue;
+
+        item->margin_left = lv_obj_get_style_margin_left(obj, LV_PART_MAIN);
+        item->margin_right = lv_obj_get_style_margin_right(obj, LV_PART_MAIN);
+        item->margin_top = lv_obj_get_style_margin_top(obj, LV_PART_MAIN);
+        item->margin_bottom = lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
+        item->translate_x = lv_obj_get_style_translate_x(obj, LV_PART_MAIN);
+        item->translate_y = lv_obj_get_style_translate_y(obj, LV_PART_MAIN);
+        item->cell_col_pos = get_col_pos(obj);
+        item->cell_col_span = get_col_span(obj);
+        item->cell_row_pos = get_row_pos(obj);
+        item->cell_row_span = get_row_span(obj);
+        item->cell_x_align = get_cell_col_align(obj);
+        item->cell_y_align = get_cell_row_align(obj);
+        item->rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
+        lv_layout_item_set_valid(item, obj);
+    }
+}
+
+/**
+ * Get a buffer for the positions and sizes of the columns or rows
+ * @param cont          the container
+ * @param col           true: for the columns, false: for the rows
+ * @param track_num     number of tracks
+ * @return              buffer with `2 * track_num` elements
+ */
+static int32_t * track_buf_get(lv_obj_t * cont, bool col, uint32_t track_num)
+{
+#if LV_LAYOUT_CACHE
+    lv_layout_cache_t * cache = cont->spec_attr->layout_cache;
+    int32_t ** buf = col ? &cache->col_buf : &cache->row_buf;
+    uint32_t * cnt = col ? &cache->col_cnt : &cache->row_cnt;
+    if(*cnt < track_num) {
+        int32_t * new_buf = lv_realloc(*buf, sizeof(int32_t) * 2 * track_num);
+        LV_ASSERT_MALLOC(new_buf);
+        if(new_buf == NULL) return NULL;
+        *buf = new_buf;
+        *cnt = track_num;
+    }
+    return *buf;
+#else
+    LV_UNUSED(cont);
+    LV_UNUSED(col);
+    int32_t * buf = lv_malloc(sizeof(int32_t) * 2 * track_num);
+    LV_ASSERT_MALLOC(buf);
+    return buf;
+#endif
 }
 
 static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
@@ -299,30 +363,29 @@ static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
     int32_t cont_w = lv_obj_get_content_width(cont);
 
     c->col_num = count_tracks(col_templ);
-    c->x = lv_malloc(sizeof(int32_t) * c->col_num);
-    c->w = lv_malloc(sizeof(int32_t) * c->col_num);
+    c->x = track_buf_get(cont, true, c->col_num);
+    c->w = c->x + c->col_num;
 
-    /*Set sizes for CONTENT cells*/
+    /*Set sizes for CONTENT cells from the size of their children in one pass*/
     uint32_t i;
     for(i = 0; i < c->col_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(col_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t col_span = get_col_span(item);
-                if(col_span != 1) continue;
-
-                uint32_t col_pos = get_col_pos(item);
-                if(col_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_width(item));
-            }
-            if(size >= 0) c->w[i] = size;
-            else c->w[i] = 0;
-        }
+        c->w[i] = LV_COORD_MIN;
+    }
+
+    uint32_t ci;
+    for(ci = 0; ci < cont->spec_attr->child_cnt; ci++) {
+        lv_obj_t * item = cont->spec_attr->children[ci];
+        if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+        if(c->items[ci].cell_col_span != 1) continue;
+
+        uint32_t col_pos = c->items[ci].cell_col_pos;
+        if(col_pos >= c->col_num || !IS_CONTENT(col_templ[col_pos])) continue;
+
+        c->w[col_pos] = LV_MAX(c->w[col_pos], lv_obj_get_width(item));
+    }
+
+    for(i = 0; i < c->col_num; i++) {
+        if(IS_CONTENT(col_templ[i]) && c->w[i] < 0) c->w[i] = 0;
     }
 
     uint32_t col_fr_cnt = 0;
@@ -389,29 +452,29 @@ static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
     }
 
     c->row_num = count_tracks(row_templ);
-    c->y = lv_malloc(sizeof(int32_t) * c->row_num);
-    c->h = lv_malloc(sizeof(int32_t) * c->row_num);
-    /*Set sizes for CONTENT cells*/
+    c->y = track_buf_get(cont, false, c->row_num);
+    c->h = c->y + c->row_num;
+
+    /*Set sizes for CONTENT cells from the size of their children in one pass*/
     uint32_t i;
     for(i = 0; i < c->row_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(row_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t row_span = get_row_span(item);
-                if(row_span != 1) continue;
-
-                uint32_t row_pos = get_row_pos(item);
-                if(row_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_height(item));
-            }
-            if(size >= 0) c->h[i] = size;
-            else c->h[i] = 0;
-        }
+        c->h[i] = LV_COORD_MIN;
+    }
+
+    uint32_t ci;
+    for(ci = 0; ci < cont->spec_attr->child_cnt; ci++) {
+        lv_obj_t * item = cont->spec_attr->children[ci];
+        if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+        if(c->items[ci].cell_row_span != 1) continue;
+
+        uint32_t row_pos = c->items[ci].cell_row_pos;
+        if(row_pos >= c->row_num || !IS_CONTENT(row_templ[row_pos])) continue;
+
+        c->h[row_pos] = LV_MAX(c->h[row_pos], lv_obj_get_height(item));
+    }
+
+    for(i = 0; i < c->row_num; i++) {
+        if(IS_CONTENT(row_templ[i]) && c->h[i] < 0) c->h[i] = 0;
     }
 
     uint32_t row_fr_cnt = 0;
@@ -457,21 +520,23 @@ static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
 /**
  * Reposition a grid item in its cell
  * @param item a grid item to reposition
+ * @param layout_item the style properties of `item`
  * @param calc the calculated grid of `cont`
  * @param child_id_ext helper value if the ID of the child is know (order from the oldest) else -1
  * @param grid_abs helper value, the absolute position of the grid, NULL if unknown
  */
-static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint)
+static void item_repos(lv_obj_t * item, const lv_layout_item_t * layout_item, lv_grid_calc_t * c,
+                       item_repos_hint_t * hint)
 {
     if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) return;
-    uint32_t col_span = get_col_span(item);
-    uint32_t row_span = get_row_span(item);
+    uint32_t col_span = layout_item->cell_col_span;
+    uint32_t row_span = layout_item->cell_row_span;
     if(row_span == 0 || col_span == 0) return;
 
-    uint32_t col_pos = get_col_pos(item);
-    uint32_t row_pos = get_row_pos(item);
-    lv_grid_align_t col_align = get_cell_col_align(item);
-    lv_grid_align_t row_align = get_cell_row_align(item);
+    uint32_t col_pos = layout_item->cell_col_pos;
+    uint32_t row_pos = layout_item->cell_row_pos;
+    lv_grid_align_t col_align = layout_item->cell_x_align;
+    lv_grid_align_t row_align = layout_item->cell_y_align;
 
     int32_t col_x1 = c->x[col_pos];
     int32_t col_x2 = c->x[col_pos + col_span - 1] + c->w[col_pos + col_span - 1];
@@ -482,7 +547,7 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     int32_t row_h = row_y2 - row_y1;
 
     /*If the item has RTL base dir switch start and end*/
-    if(lv_obj_get_style_base_dir(item, LV_PART_MAIN) == LV_BASE_DIR_RTL) {
+    if(layout_item->rtl) {
         if(col_align == LV_GRID_ALIGN_START) col_align = LV_GRID_ALIGN_END;
         else if(col_align == LV_GRID_ALIGN_END) col_align = LV_GRID_ALIGN_START;
     }
@@ -495,21 +560,20 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     switch(col_align) {
         default:
         case LV_GRID_ALIGN_START:
-            x = c->x[col_pos] + lv_obj_get_style_margin_left(item, LV_PART_MAIN);
+            x = c->x[col_pos] + layout_item->margin_left;
             item->w_layout = 0;
             break;
         case LV_GRID_ALIGN_STRETCH:
-            x = c->x[col_pos] + lv_obj_get_style_margin_left(item, LV_PART_MAIN);
-            item_w = col_w - get_margin_hor(item);
+            x = c->x[col_pos] + layout_item->margin_left;
+            item_w = col_w - layout_item->margin_left - layout_item->margin_right;
             item->w_layout = 1;
             break;
         case LV_GRID_ALIGN_CENTER:
-            x = c->x[col_pos] + (col_w - item_w) / 2 + (lv_obj_get_style_margin_left(item, LV_PART_MAIN) -
-                                                        lv_obj_get_style_margin_right(item, LV_PART_MAIN)) / 2;
+            x = c->x[col_pos] + (col_w - item_w) / 2 + (layout_item->margin_left - layout_item->margin_right) / 2;
             item->w_layout = 0;
             break;
         case LV_GRID_ALIGN_END:
-            x = c->x[col_pos] + col_w - lv_obj_get_width(item) - lv_obj_get_style_margin_right(item, LV_PART_MAIN);
+            x = c->x[col_pos] + col_w - lv_obj_get_width(item) - layout_item->margin_right;
             item->w_layout = 0;
             break;
     }
@@ -517,21 +581,20 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     switch(row_align) {
         default:
         case LV_GRID_ALIGN_START:
-            y = c->y[row_pos] + lv_obj_get_style_margin_top(item, LV_PART_MAIN);
+            y = c->y[row_pos] + layout_item->margin_top;
             item->h_layout = 0;
             break;
         case LV_GRID_ALIGN_STRETCH:
-            y = c->y[row_pos] + lv_obj_get_style_margin_top(item, LV_PART_MAIN);
-            item_h = row_h - get_margin_ver(item);
+            y = c->y[row_pos] + layout_item->margin_top;
+            item_h = row_h - layout_item->margin_top - layout_item->margin_bottom;
             item->h_layout = 1;
             break;
         case LV_GRID_ALIGN_CENTER:
-            y = c->y[row_pos] + (row_h - item_h) / 2 + (lv_obj_get_style_margin_top(item, LV_PART_MAIN) -
-                                                        lv_obj_get_style_margin_bottom(item, LV_PART_MAIN)) / 2;
+            y = c->y[row_pos] + (row_h - item_h) / 2 + (layout_item->margin_top - layout_item->margin_bottom) / 2;
             item->h_layout = 0;
             break;
         case LV_GRID_ALIGN_END:
-            y = c->y[row_pos] + row_h - lv_obj_get_height(item) - lv_obj_get_style_margin_bottom(item, LV_PART_MAIN);
+            y = c->y[row_pos] + row_h - lv_obj_get_height(item) - layout_item->margin_bottom;
             item->h_layout = 0;
             break;
     }
@@ -550,8 +613,8 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     }
 
     /*Handle percentage value of translate*/
-    int32_t tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
-    int32_t tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+    int32_t tr_x = layout_item->translate_x;
+    int32_t tr_y = layout_item->translate_y;
     int32_t w = lv_obj_get_width(item);
     int32_t h = lv_obj_get_height(item);
     if(LV_COORD_IS_PCT(tr_x)) tr_x = (w * LV_COORD_GET_PCT(tr_x)) / 100;
@@ -9,6 +9,7 @@
 #include "lv_layout_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -23,6 +24,9 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_LAYOUT_CACHE
+    static void items_sync(lv_layout_cache_t * cache, lv_obj_t * cont);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -74,6 +78,119 @@ void lv_layout_apply(lv_obj_t * obj)
     }
 }
 
+lv_layout_item_t * lv_layout_get_items(lv_obj_t * cont, uint32_t layout)
+{
+    uint32_t child_cnt = lv_obj_get_child_count(cont);
+
+#if LV_LAYOUT_CACHE
+    if(cont->spec_attr == NULL) lv_obj_allocate_spec_attr(cont);
+
+    lv_layout_cache_t * cache = cont->spec_attr->layout_cache;
+    if(cache == NULL) {
+        cache = lv_malloc_zeroed(sizeof(lv_layout_cache_t));
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return NULL;
+        cache->layout = layout;
+        cont->spec_attr->layout_cache = cache;
+    }
+
+    /*Another layout might have filled other fields*/
+    if(cache->layout != layout) {
+        lv_memzero(cache->items, cache->item_cnt * sizeof(lv_layout_item_t));
+        cache->layout = layout;
+    }
+
+    if(cache->item_cnt < child_cnt) {
+        /*Leave some space for the next children to not reallocate on every insert*/
+        uint32_t new_cnt = child_cnt + child_cnt / 4 + 1;
+        lv_layout_item_t * new_items = lv_realloc(cache->items, new_cnt * sizeof(lv_layout_item_t));
+        LV_ASSERT_MALLOC(new_items);
+        if(new_items == NULL) return NULL;
+        lv_memzero(&new_items[cache->item_cnt], (new_cnt - cache->item_cnt) * sizeof(lv_layout_item_t));
+        cache->items = new_items;
+        cache->item_cnt = new_cnt;
+    }
+
+    items_sync(cache, cont);
+    return cache->items;
+#else
+    LV_UNUSED(layout);
+    lv_layout_item_t * items = lv_malloc(child_cnt * sizeof(lv_layout_item_t));
+    LV_ASSERT_MALLOC(items);
+    return items;
+#endif
+}
+
+void lv_layout_release_items(lv_layout_item_t * items)
+{
+#if LV_LAYOUT_CACHE
+    LV_UNUSED(items);
+#else
+    lv_free(items);
+#endif
+}
+
+void lv_layout_cache_delete(lv_obj_t * cont)
+{
+#if LV_LAYOUT_CACHE
+    if(cont->spec_attr == NULL || cont->spec_attr->layout_cache == NULL) return;
+
+    lv_layout_cache_t * cache = cont->spec_attr->layout_cache;
+    lv_free(cache->items);
+    lv_free(cache->col_buf);
+    lv_free(cache->row_buf);
+    lv_free(cache);
+    cont->spec_attr->layout_cache = NULL;
+#else
+    LV_UNUSED(cont);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_LAYOUT_CACHE
+/**
+ * Move the items to the new index of their children.
+ * Children inserted or deleted one by one shift the items only by one,
+ * so the items of the other children can be used again.
+ * @param cache     the cache of the container
+ * @param cont      the container
+ */
+static void items_sync(lv_layout_cache_t * cache, lv_obj_t * cont)
+{
+    lv_obj_t ** children = cont->spec_attr->children;
+    uint32_t child_cnt = cont->spec_attr->child_cnt;
+    lv_layout_item_t * items = cache->items;
+    uint32_t old_cnt = cache->child_cnt;
+
+    uint32_t i;
+    for(i = 0; i < child_cnt && i < old_cnt; i++) {
+        if(items[i].obj == children[i]) continue;
+
+        /*A child was inserted here*/
+        if(i + 1 < child_cnt && items[i].obj == children[i + 1]) {
+            uint32_t move_cnt = LV_MIN(old_cnt, child_cnt - 1) - i;
+            lv_memmove(&items[i + 1], &items[i], move_cnt * sizeof(lv_layout_item_t));
+            items[i].obj = NULL;
+            old_cnt = i + 1 + move_cnt;
+        }
+        /*The child of this item was deleted or moved away*/
+        else if(i + 1 < old_cnt && items[i + 1].obj == children[i]) {
+            lv_memmove(&items[i], &items[i + 1], (old_cnt - i - 1) * sizeof(lv_layout_item_t));
+            /*Don't leave a copy of the last item behind*/
+            items[old_cnt - 1].obj = NULL;
+            old_cnt--;
+        }
+    }
+
+    /*Forget the deleted children. Shifting might have left items behind up to the old end.*/
+    uint32_t end = LV_MAX(old_cnt, cache->child_cnt);
+    for(i = child_cnt; i < end; i++) {
+        items[i].obj = NULL;
+    }
+
+    cache->child_cnt = child_cnt;
+}
+#endif
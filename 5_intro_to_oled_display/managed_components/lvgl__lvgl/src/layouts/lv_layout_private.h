@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_layout.h"
+#include "../core/lv_obj_private.h"
 
 /*********************
  *      DEFINES
@@ -29,9 +30,45 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
+/**
+ * The style properties of a child used by the layouts.
+ * Each layout fills only the fields it uses.
+ */
+typedef struct {
+    lv_obj_t * obj;             /**< The child whose properties are stored*/
+    int32_t margin_left;
+    int32_t margin_right;
+    int32_t margin_top;
+    int32_t margin_bottom;
+    int32_t translate_x;        /**< Can be a percentage*/
+    int32_t translate_y;        /**< Can be a percentage*/
+    int32_t cell_col_pos;
+    int32_t cell_col_span;
+    int32_t cell_row_pos;
+    int32_t cell_row_span;
+    uint8_t flex_grow;
+    uint8_t cell_x_align;
+    uint8_t cell_y_align;
+    uint8_t rtl;
+} lv_layout_item_t;
+
+#if LV_LAYOUT_CACHE
+/**
+ * Kept between the layout updates of a container. The properties of a child
+ * are read again only if its styles have changed, the tracks of the grid are
+ * reallocated only if their number changes.
+ */
+typedef struct lv_layout_cache_t {
+    uint32_t layout;            /**< The layout which filled `items`*/
+    uint32_t item_cnt;          /**< Number of allocated items*/
+    uint32_t child_cnt;         /**< Number of children in the previous update*/
+    lv_layout_item_t * items;   /**< Indexed by the ID of the children*/
+    int32_t * col_buf;          /**< Position and size of the grid columns*/
+    int32_t * row_buf;          /**< Position and size of the grid rows*/
+    uint32_t col_cnt;
+    uint32_t row_cnt;
+} lv_layout_cache_t;
+#endif
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -47,6 +84,57 @@ void lv_layout_deinit(void);
  */
 void lv_layout_apply(lv_obj_t * obj);
 
+/**
+ * Get an array with an item for each child of a container.
+ * With `LV_LAYOUT_CACHE` the items filled in the previous update are kept.
+ * @param cont      pointer to a container with children
+ * @param layout    ID of the layout using the items
+ * @return          the items or NULL on error. Release with `lv_layout_release_items`
+ */
+lv_layout_item_t * lv_layout_get_items(lv_obj_t * cont, uint32_t layout);
+
+/**
+ * Release the items got with `lv_layout_get_items` at the end of the update
+ * @param items     the items
+ */
+void lv_layout_release_items(lv_layout_item_t * items);
+
+/**
+ * Free the cache of a container's layout
+ * @param cont      pointer to a container
+ */
+void lv_layout_cache_delete(lv_obj_t * cont);
+
+/**
+ * Check if an item of `lv_layout_get_items` still has the current properties of a child
+ * @param item      pointer to an item
+ * @param obj       the child with the same ID as the item
+ * @return          true: the item can be used without filling it again
+ */
+static inline bool lv_layout_item_is_valid(const lv_layout_item_t * item, const lv_obj_t * obj)
+{
+#if LV_LAYOUT_CACHE
+    return item->obj == obj && obj->layout_item_cached;
+#else
+    LV_UNUSED(item);
+    LV_UNUSED(obj);
+    return false;
+#endif
+}
+
+/**
+ * Mark an item as filled with the current properties of a child
+ * @param item      pointer to an item
+ * @param obj       the child with the same ID as the item
+ */
+static inline void lv_layout_item_set_valid(lv_layout_item_t * item, lv_obj_t * obj)
+{
+    item->obj = obj;
+#if LV_LAYOUT_CACHE
+    obj->layout_item_cached = 1;
+#endif
+}
+
 /**********************
  *      MACROS
  **********************/
@@ -152,6 +152,9 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
 {
     LV_ASSERT_NULL(font);
 
+    /*The cached text sizes refer to the font*/
+    lv_text_cache_drop_all();
+
     if(font->dsc != NULL) {
         ttf_font_desc_t * ttf = (ttf_font_desc_t *)font->dsc;
 #if LV_TINY_TTF_FILE_SUPPORT != 0
@@ -29,6 +29,10 @@
 #define LV_DRAW_SW_ASM_HELIUM       2
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
+#define LV_DRAW_SW_I1_DITHER_NONE   0
+#define LV_DRAW_SW_I1_DITHER_BAYER4 1
+#define LV_DRAW_SW_I1_DITHER_BAYER8 2
+
 /* Handle special Kconfig options */
 #ifndef LV_KCONFIG_IGNORE
     #include "lv_conf_kconfig.h"
@@ -212,6 +216,26 @@
             #endif
         #endif
     #endif
+
+    /*Serve the allocations up to 128 bytes from 1 kB pages of same sized slots instead of TLSF.
+     *The pages are in a fixed area at the beginning of the heap so the small objects don't
+     *fragment the rest of the heap. If all pages are used, TLSF serves the small allocations too.*/
+    #ifndef LV_MEM_SLAB
+        #ifdef CONFIG_LV_MEM_SLAB
+            #define LV_MEM_SLAB CONFIG_LV_MEM_SLAB
+        #else
+            #define LV_MEM_SLAB 0
+        #endif
+    #endif
+    #if LV_MEM_SLAB
+        #ifndef LV_MEM_SLAB_SIZE
+            #ifdef CONFIG_LV_MEM_SLAB_SIZE
+                #define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+            #else
+                #define LV_MEM_SLAB_SIZE (16 * 1024U)   /*[bytes] Size of the area of the pages, taken from `LV_MEM_SIZE`*/
+            #endif
+        #endif
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
 /*====================
@@ -319,6 +343,16 @@
     #endif
 #endif
 
+/*The draw tasks and their descriptors are allocated from per layer chunks of this size and freed at once
+ *when all the draw tasks of the layer are ready. 0: allocate each of them with `lv_malloc`*/
+#ifndef LV_DRAW_TASK_ARENA_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_ARENA_SIZE
+        #define LV_DRAW_TASK_ARENA_SIZE CONFIG_LV_DRAW_TASK_ARENA_SIZE
+    #else
+        #define LV_DRAW_TASK_ARENA_SIZE    (2 * 1024)   /*[bytes]*/
+    #endif
+#endif
+
 /* The stack size of the drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -450,6 +484,114 @@
 	    #endif
 	#endif
 
+    /* Dither on I1 layers instead of setting only the pixels whose luminance is above 50%.
+     * Fills, gradients, anti-aliased edges and images get an ordered pattern aligned to the screen.
+     * - LV_DRAW_SW_I1_DITHER_NONE:   no dithering
+     * - LV_DRAW_SW_I1_DITHER_BAYER4: 4x4 Bayer matrix, 17 levels of gray
+     * - LV_DRAW_SW_I1_DITHER_BAYER8: 8x8 Bayer matrix, 65 levels of gray */
+    #ifndef LV_DRAW_SW_I1_DITHER
+        #ifdef CONFIG_LV_DRAW_SW_I1_DITHER
+            #define LV_DRAW_SW_I1_DITHER CONFIG_LV_DRAW_SW_I1_DITHER
+        #else
+            #define LV_DRAW_SW_I1_DITHER    LV_DRAW_SW_I1_DITHER_NONE
+        #endif
+    #endif
+
+    /* Blend images in NORMAL mode with the kernels generated by `scripts/blend_kernel_gen.py`.
+     * They have no per-pixel conditions and can be vectorized but use more flash than the
+     * hand-written kernels, so they can be enabled per source and destination color format. */
+    #ifndef LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565
+            #define LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565 CONFIG_LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565        0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565
+            #define LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565 CONFIG_LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565      0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565
+            #define LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565 CONFIG_LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565        0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565
+            #define LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565 CONFIG_LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565    0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565
+            #define LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565 CONFIG_LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565    0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565
+            #define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565 CONFIG_LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565  0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565
+            #define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565 CONFIG_LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565  0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_AL88_TO_I1
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_AL88_TO_I1
+            #define LV_DRAW_SW_BLEND_GEN_AL88_TO_I1 CONFIG_LV_DRAW_SW_BLEND_GEN_AL88_TO_I1
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_AL88_TO_I1          0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_L8_TO_I1
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_L8_TO_I1
+            #define LV_DRAW_SW_BLEND_GEN_L8_TO_I1 CONFIG_LV_DRAW_SW_BLEND_GEN_L8_TO_I1
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_L8_TO_I1            0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1
+            #define LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1 CONFIG_LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1        0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1
+            #define LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1 CONFIG_LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1        0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1
+            #define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1 CONFIG_LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1      0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1
+            #define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1 CONFIG_LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1
+        #else
+            #define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1      0
+        #endif
+    #endif
+
 	/* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
      * > 1 means multiple threads will render the screen in parallel */
@@ -465,6 +607,16 @@
         #endif
     #endif
 
+    /* Pin the thread of draw unit N to CPU core N (modulo the number of cores).
+     * Only the FreeRTOS (ESP-IDF) and pthread (Linux) OSAL can pin threads, others ignore it */
+    #ifndef LV_DRAW_SW_PIN_UNITS_TO_CORES
+        #ifdef CONFIG_LV_DRAW_SW_PIN_UNITS_TO_CORES
+            #define LV_DRAW_SW_PIN_UNITS_TO_CORES CONFIG_LV_DRAW_SW_PIN_UNITS_TO_CORES
+        #else
+            #define LV_DRAW_SW_PIN_UNITS_TO_CORES   0
+        #endif
+    #endif
+
     /* Use Arm-2D to accelerate the sw render */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -1037,7 +1189,8 @@
 /*Default cache size in bytes.
  *Used by image decoders such as `lv_lodepng` to keep the decoded image in the memory.
  *If size is not set to 0, the decoder will fail to decode when the cache is full.
- *If size is 0, the cache function is not enabled and the decoded mem will be released immediately after use.*/
+ *If size is 0, the cache function is not enabled and the decoded mem will be released immediately after use.
+ *On I1 displays the software renderer also caches images converted to 1 bpp, see `LV_DRAW_SW_SUPPORT_I1`.*/
 #ifndef LV_CACHE_DEF_SIZE
     #ifdef CONFIG_LV_CACHE_DEF_SIZE
         #define LV_CACHE_DEF_SIZE CONFIG_LV_CACHE_DEF_SIZE
@@ -1085,6 +1238,37 @@
     #endif
 #endif
 
+/* Store the already resolved style properties of the objects in a table per part
+ * to get them in O(1) time. Adds about 150 bytes + 1 value per used property to each styled object part */
+#ifndef LV_OBJ_STYLE_TABLE
+    #ifdef CONFIG_LV_OBJ_STYLE_TABLE
+        #define LV_OBJ_STYLE_TABLE CONFIG_LV_OBJ_STYLE_TABLE
+    #else
+        #define LV_OBJ_STYLE_TABLE      0
+    #endif
+#endif
+
+/* Styles with at least this many properties find the built-in properties in O(1) time from an index.
+ * Each such style gains an index of about 140 bytes (1 byte per built-in property).
+ * Set it to 255 to never use the index. */
+#ifndef LV_STYLE_PROP_INDEX_MIN_CNT
+    #ifdef CONFIG_LV_STYLE_PROP_INDEX_MIN_CNT
+        #define LV_STYLE_PROP_INDEX_MIN_CNT CONFIG_LV_STYLE_PROP_INDEX_MIN_CNT
+    #else
+        #define LV_STYLE_PROP_INDEX_MIN_CNT     8
+    #endif
+#endif
+
+/* Get the steps of `lv_anim_path_ease_in/out/in_out` and `lv_anim_path_overshoot` from tables
+ * instead of solving the cubic Bezier curve in each frame. The values are the same. Adds about 8 kB ROM */
+#ifndef LV_ANIM_PATH_TABLES
+    #ifdef CONFIG_LV_ANIM_PATH_TABLES
+        #define LV_ANIM_PATH_TABLES CONFIG_LV_ANIM_PATH_TABLES
+    #else
+        #define LV_ANIM_PATH_TABLES     0
+    #endif
+#endif
+
 /* Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1596,6 +1780,29 @@
     #endif
 #endif
 
+/*Size of the cache of the expanded glyph bitmaps of `lv_font_fmt_txt` fonts in bytes.
+ *Glyphs are expanded to A8 (or kept as A1 on 1 bpp layers) only once and reused while they fit.
+ *0: to disable caching*/
+#ifndef LV_FONT_FMT_TXT_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_CACHE_SIZE 0
+    #endif
+#endif
+
+/*Number of `lv_font_fmt_txt` fonts which get a page table to look up the glyphs of the characters
+ *and a kerning matrix when they are first used. It makes fonts with many or sparse character maps
+ *(e.g. CJK fonts) much faster, and needs about 2 bytes per 256 characters of a font's Unicode range.
+ *0: to disable*/
+#ifndef LV_FONT_FMT_TXT_LOOKUP_CNT
+    #ifdef CONFIG_LV_FONT_FMT_TXT_LOOKUP_CNT
+        #define LV_FONT_FMT_TXT_LOOKUP_CNT CONFIG_LV_FONT_FMT_TXT_LOOKUP_CNT
+    #else
+        #define LV_FONT_FMT_TXT_LOOKUP_CNT 0
+    #endif
+#endif
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
@@ -1666,6 +1873,17 @@
     #endif
 #endif
 
+/*Size of the cache of text sizes in bytes (the texts are copied into it).
+ *Tables, span groups and labels measure a text only once while it, its font and width don't change.
+ *0: to disable caching*/
+#ifndef LV_TEXT_CACHE_SIZE
+    #ifdef CONFIG_LV_TEXT_CACHE_SIZE
+        #define LV_TEXT_CACHE_SIZE CONFIG_LV_TEXT_CACHE_SIZE
+    #else
+        #define LV_TEXT_CACHE_SIZE 0
+    #endif
+#endif
+
 /*Support bidirectional texts. Allows mixing Left-to-Right and Right-to-Left texts.
  *The direction will be processed according to the Unicode Bidirectional Algorithm:
  *https://www.w3.org/International/articles/inline-bidi-markup/uba-basics*/
@@ -1978,6 +2196,13 @@
             #define LV_LABEL_WAIT_CHAR_COUNT 3  /*The count of wait chart*/
         #endif
     #endif
+    #ifndef LV_LABEL_LINE_CACHE
+        #ifdef CONFIG_LV_LABEL_LINE_CACHE
+            #define LV_LABEL_LINE_CACHE CONFIG_LV_LABEL_LINE_CACHE
+        #else
+            #define LV_LABEL_LINE_CACHE 0   /*Store the line breaks and line widths (12 bytes per line) to not wrap the text on every draw*/
+        #endif
+    #endif
 #endif
 
 #ifndef LV_USE_LED
@@ -2317,6 +2542,16 @@
     #endif
 #endif
 
+/*Keep the style properties of the children and the track sizes of the grid in the containers
+ *to not read them again on each layout update. Uses about 48 bytes per child.*/
+#ifndef LV_LAYOUT_CACHE
+    #ifdef CONFIG_LV_LAYOUT_CACHE
+        #define LV_LAYOUT_CACHE CONFIG_LV_LAYOUT_CACHE
+    #else
+        #define LV_LAYOUT_CACHE 0
+    #endif
+#endif
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
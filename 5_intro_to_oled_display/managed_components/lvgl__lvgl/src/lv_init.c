@@ -11,6 +11,8 @@
 #include "misc/lv_profiler_builtin_private.h"
 #include "misc/lv_anim_private.h"
 #include "draw/lv_image_decoder_private.h"
+#include "font/lv_font_fmt_txt_private.h"
+#include "misc/cache/lv_text_cache.h"
 #include "draw/lv_draw_buf_private.h"
 #include "core/lv_refr_private.h"
 #include "core/lv_obj_style_private.h"
@@ -226,6 +228,10 @@ void lv_init(void)
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
+    lv_font_fmt_txt_init();
+
+    lv_text_cache_init();
+
 #if LV_USE_DRAW_VG_LITE
     lv_draw_vg_lite_init();
 #endif
@@ -381,6 +387,10 @@ void lv_deinit(void)
 
     lv_image_decoder_deinit();
 
+    lv_font_fmt_txt_deinit();
+
+    lv_text_cache_deinit();
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
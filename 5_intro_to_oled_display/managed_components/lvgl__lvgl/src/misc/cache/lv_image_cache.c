@@ -10,6 +10,8 @@
 #include "../../draw/lv_image_decoder_private.h"
 #include "../lv_assert.h"
 #include "../../core/lv_global.h"
+#include "../../draw/lv_draw_buf.h"
+#include "../../stdlib/lv_string.h"
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
@@ -43,6 +45,12 @@ static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
  *  STATIC VARIABLES
  **********************/
 
+/*The color formats the draw units convert images to, see `lv_image_cache_add_converted`*/
+static const lv_color_format_t converted_cfs[] = {
+    LV_COLOR_FORMAT_I1,
+    LV_COLOR_FORMAT_A1,
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -89,9 +97,17 @@ void lv_image_cache_drop(const void * src)
     lv_image_cache_data_t search_key = {
         .src = src,
         .src_type = lv_image_src_get_type(src),
+        .converted_cf = LV_COLOR_FORMAT_UNKNOWN,
     };
 
     lv_cache_drop(img_cache_p, &search_key, NULL);
+
+    /*Drop the converted images too*/
+    uint32_t i;
+    for(i = 0; i < sizeof(converted_cfs) / sizeof(converted_cfs[0]); i++) {
+        search_key.converted_cf = converted_cfs[i];
+        lv_cache_drop(img_cache_p, &search_key, NULL);
+    }
 }
 
 bool lv_image_cache_is_enabled(void)
@@ -99,6 +115,51 @@ bool lv_image_cache_is_enabled(void)
     return lv_cache_is_enabled(img_cache_p);
 }
 
+lv_cache_entry_t * lv_image_cache_acquire_converted(const void * src, lv_color_format_t cf)
+{
+    LV_ASSERT_NULL(src);
+
+    lv_image_cache_data_t search_key = {
+        .src = src,
+        .src_type = lv_image_src_get_type(src),
+        .converted_cf = cf,
+    };
+
+    return lv_cache_acquire(img_cache_p, &search_key, NULL);
+}
+
+lv_cache_entry_t * lv_image_cache_add_converted(const void * src, lv_draw_buf_t * converted)
+{
+    LV_ASSERT_NULL(src);
+    LV_ASSERT_NULL(converted);
+
+    /*Don't evict everything (and log an error) for an image which can't fit anyway*/
+    if(converted->data_size > lv_cache_get_max_size(img_cache_p, NULL)) return NULL;
+
+    lv_image_cache_data_t search_key = {
+        .src = src,
+        .src_type = lv_image_src_get_type(src),
+        .converted_cf = converted->header.cf,
+    };
+    search_key.slot.size = converted->data_size;
+
+    lv_cache_entry_t * entry = lv_cache_add(img_cache_p, &search_key, NULL);
+    if(entry == NULL) return NULL;
+
+    lv_image_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    cached_data->decoded = converted;
+    if(cached_data->src_type == LV_IMAGE_SRC_FILE) {
+        cached_data->src = lv_strdup(cached_data->src);
+    }
+
+    return entry;
+}
+
+void lv_image_cache_release(lv_cache_entry_t * entry)
+{
+    lv_cache_release(img_cache_p, entry, NULL);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -127,7 +188,13 @@ static lv_cache_compare_res_t image_cache_compare_cb(
     const lv_image_cache_data_t * lhs,
     const lv_image_cache_data_t * rhs)
 {
-    return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    lv_cache_compare_res_t res = image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    if(res != 0) return res;
+
+    if(lhs->converted_cf != rhs->converted_cf) {
+        return lhs->converted_cf > rhs->converted_cf ? 1 : -1;
+    }
+    return 0;
 }
 
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
@@ -16,6 +16,8 @@ extern "C" {
 
 #include "../../lv_conf_internal.h"
 #include "../lv_types.h"
+#include "../lv_color.h"
+#include "lv_cache_entry.h"
 
 /*********************
  *      DEFINES
@@ -56,6 +58,33 @@ void lv_image_cache_drop(const void * src);
  */
 bool lv_image_cache_is_enabled(void);
 
+/**
+ * Get an image converted to a color format, e.g. to the color format of a display,
+ * if it's in the cache.
+ * @param src       pointer to an image source
+ * @param cf        the color format of the converted image
+ * @return          the acquired cache entry whose `decoded` is the converted image,
+ *                  or NULL if not found. Release it with `lv_image_cache_release`.
+ */
+lv_cache_entry_t * lv_image_cache_acquire_converted(const void * src, lv_color_format_t cf);
+
+/**
+ * Add an image converted to a color format to the cache.
+ * It's stored next to the decoded image of the same source, accounted with the size of `converted`.
+ * @param src       pointer to an image source
+ * @param converted the converted image, allocated with `lv_draw_buf_create_ex`.
+ *                  The cache takes its ownership if it was added.
+ * @return          the acquired cache entry, or NULL if the image couldn't be added, e.g. it's larger than the cache.
+ *                  Release it with `lv_image_cache_release`.
+ */
+lv_cache_entry_t * lv_image_cache_add_converted(const void * src, lv_draw_buf_t * converted);
+
+/**
+ * Release a cache entry returned by `lv_image_cache_acquire_converted` or `lv_image_cache_add_converted`.
+ * @param entry     the cache entry
+ */
+void lv_image_cache_release(lv_cache_entry_t * entry);
+
 /*************************
  *    GLOBAL VARIABLES
  *************************/
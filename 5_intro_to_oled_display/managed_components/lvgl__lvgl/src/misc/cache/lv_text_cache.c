@@ -0,0 +1,247 @@
+/**
+* @file lv_text_cache.c
+*
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_text_cache.h"
+#include "lv_cache.h"
+#include "lv_cache_private.h"
+#include "../lv_text_private.h"
+#include "../../core/lv_global.h"
+#include "../../stdlib/lv_string.h"
+#include "../../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CACHE_NAME  "TEXT"
+
+#define text_cache_p (LV_GLOBAL_DEFAULT()->text_cache)
+
+/*Don't let a single long text evict most of the other entries*/
+#define TEXT_MAX_SIZE   (LV_TEXT_CACHE_SIZE / 4)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_TEXT_CACHE_SIZE > 0
+
+typedef enum {
+    TEXT_CACHE_TYPE_SIZE,       /**< Wrapped text: the longest line and the number of lines*/
+    TEXT_CACHE_TYPE_WIDTH,      /**< The width of the whole text in one line*/
+} text_cache_type_t;
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    uint32_t hash;
+    uint32_t len;
+    const char * text;          /**< The caller's text in the search key, an own copy in the cache*/
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_width;
+    lv_text_flag_t flag;
+    text_cache_type_t type;
+    int32_t width;
+    uint32_t line_cnt;          /**< Including the empty line after a trailing '\n' or '\r'*/
+} text_cache_data_t;
+
+#endif /*LV_TEXT_CACHE_SIZE > 0*/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+#if LV_TEXT_CACHE_SIZE > 0
+    static bool get_entry(text_cache_data_t * data);
+    static lv_cache_compare_res_t text_cache_compare_cb(const text_cache_data_t * lhs, const text_cache_data_t * rhs);
+    static bool text_cache_create_cb(text_cache_data_t * data, void * user_data);
+    static void text_cache_free_cb(text_cache_data_t * data, void * user_data);
+#endif
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_text_cache_init(void)
+{
+#if LV_TEXT_CACHE_SIZE > 0
+    if(text_cache_p != NULL) return;
+
+    text_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(text_cache_data_t), LV_TEXT_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) text_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) text_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) text_cache_free_cb,
+    });
+
+    lv_cache_set_name(text_cache_p, CACHE_NAME);
+#endif
+}
+
+void lv_text_cache_deinit(void)
+{
+#if LV_TEXT_CACHE_SIZE > 0
+    if(text_cache_p) {
+        lv_cache_destroy(text_cache_p, NULL);
+        text_cache_p = NULL;
+    }
+#endif
+}
+
+void lv_text_cache_get_size(lv_point_t * size_res, const char * text, const lv_font_t * font, int32_t letter_space,
+                            int32_t line_space, int32_t max_width, lv_text_flag_t flag)
+{
+#if LV_TEXT_CACHE_SIZE > 0
+    if(text != NULL && font != NULL) {
+        text_cache_data_t data;
+        data.type = TEXT_CACHE_TYPE_SIZE;
+        data.text = text;
+        data.font = font;
+        data.letter_space = letter_space;
+        data.max_width = (flag & LV_TEXT_FLAG_EXPAND) ? LV_COORD_MAX : max_width;
+        data.flag = flag;
+
+        if(get_entry(&data)) {
+            /*The same as in `lv_text_get_size`*/
+            int32_t line_height = lv_font_get_line_height(font);
+            size_res->x = data.width;
+            size_res->y = (int32_t)data.line_cnt * (line_height + line_space);
+            if(size_res->y == 0) size_res->y = line_height;
+            else size_res->y -= line_space;
+            return;
+        }
+    }
+#endif
+
+    lv_text_get_size(size_res, text, font, letter_space, line_space, max_width, flag);
+}
+
+int32_t lv_text_cache_get_width(const char * txt, const lv_font_t * font, int32_t letter_space)
+{
+    if(txt == NULL || font == NULL) return 0;
+
+#if LV_TEXT_CACHE_SIZE > 0
+    text_cache_data_t data;
+    data.type = TEXT_CACHE_TYPE_WIDTH;
+    data.text = txt;
+    data.font = font;
+    data.letter_space = letter_space;
+    data.max_width = 0;
+    data.flag = LV_TEXT_FLAG_NONE;
+
+    if(get_entry(&data)) return data.width;
+#endif
+
+    return lv_text_get_width(txt, lv_strlen(txt), font, letter_space);
+}
+
+void lv_text_cache_drop_all(void)
+{
+#if LV_TEXT_CACHE_SIZE > 0
+    if(text_cache_p) lv_cache_drop_all(text_cache_p, NULL);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_TEXT_CACHE_SIZE > 0
+
+/**
+ * Find or create the cache entry of a text and copy its `width` and `line_cnt` to `data`.
+ * @param data      the search key with `type`, `text`, `font`, `letter_space`, `max_width` and `flag` set
+ * @return          true: found or created; false: the text can't be cached
+ */
+static bool get_entry(text_cache_data_t * data)
+{
+    if(text_cache_p == NULL) return false;
+
+    /*FNV-1a hash. Only to make the comparisons fast, the texts are compared too.*/
+    const uint8_t * p = (const uint8_t *)data->text;
+    uint32_t hash = 2166136261u;
+    while(*p) {
+        hash = (hash ^ *p) * 16777619u;
+        p++;
+    }
+
+    data->hash = hash;
+    data->len = (uint32_t)(p - (const uint8_t *)data->text);
+    data->slot.size = sizeof(text_cache_data_t) + data->len + 1;
+    if(data->slot.size > TEXT_MAX_SIZE) return false;
+
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(text_cache_p, data, NULL);
+    if(entry == NULL) return false;
+
+    const text_cache_data_t * cached = lv_cache_entry_get_data(entry);
+    data->width = cached->width;
+    data->line_cnt = cached->line_cnt;
+    lv_cache_release(text_cache_p, entry, NULL);
+
+    return true;
+}
+
+static lv_cache_compare_res_t text_cache_compare_cb(const text_cache_data_t * lhs, const text_cache_data_t * rhs)
+{
+    if(lhs->hash != rhs->hash) return lhs->hash > rhs->hash ? 1 : -1;
+    if(lhs->type != rhs->type) return lhs->type > rhs->type ? 1 : -1;
+    if(lhs->font != rhs->font) return lhs->font > rhs->font ? 1 : -1;
+    if(lhs->letter_space != rhs->letter_space) return lhs->letter_space > rhs->letter_space ? 1 : -1;
+    if(lhs->max_width != rhs->max_width) return lhs->max_width > rhs->max_width ? 1 : -1;
+    if(lhs->flag != rhs->flag) return lhs->flag > rhs->flag ? 1 : -1;
+    if(lhs->len != rhs->len) return lhs->len > rhs->len ? 1 : -1;
+
+    int cmp_res = lv_memcmp(lhs->text, rhs->text, lhs->len);
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static bool text_cache_create_cb(text_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    char * text = lv_malloc(data->len + 1);
+    if(text == NULL) return false;
+    lv_memcpy(text, data->text, data->len + 1);
+
+    if(data->type == TEXT_CACHE_TYPE_WIDTH) {
+        data->width = lv_text_get_width(text, data->len, data->font, data->letter_space);
+        data->line_cnt = 1;
+    }
+    else {
+        data->line_cnt = lv_text_get_lines(text, data->font, data->letter_space, data->max_width, data->flag,
+                                           &data->width, NULL, NULL);
+    }
+
+    data->text = text;
+    return true;
+}
+
+static void text_cache_free_cb(text_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free((void *)data->text);
+    data->text = NULL;
+}
+
+#endif /*LV_TEXT_CACHE_SIZE > 0*/
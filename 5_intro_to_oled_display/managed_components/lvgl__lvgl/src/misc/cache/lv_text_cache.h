@@ -0,0 +1,87 @@
+/**
+* @file lv_text_cache.h
+*
+ */
+
+#ifndef LV_TEXT_CACHE_H
+#define LV_TEXT_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_conf_internal.h"
+#include "../lv_types.h"
+#include "../lv_area.h"
+#include "../lv_text.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the text cache. Called from `lv_init()`.
+ */
+void lv_text_cache_init(void);
+
+/**
+ * Free the text cache. Called from `lv_deinit()`.
+ */
+void lv_text_cache_deinit(void);
+
+/**
+ * Get the size of a text like `lv_text_get_size`, but wrap and measure the text only if
+ * it wasn't measured recently with the same font, letter space, max. width and flags.
+ * Falls back to `lv_text_get_size` if the cache is disabled or the text doesn't fit into it.
+ * @param size_res      pointer to a 'point_t' variable to store the result
+ * @param text          pointer to a text
+ * @param font          pointer to font of the text
+ * @param letter_space  letter space of the text
+ * @param line_space    line space of the text
+ * @param max_width     max width of the text (break the lines to fit this size). Set COORD_MAX to avoid
+ * @param flag          settings for the text from ::lv_text_flag_t
+ */
+void lv_text_cache_get_size(lv_point_t * size_res, const char * text, const lv_font_t * font, int32_t letter_space,
+                            int32_t line_space, int32_t max_width, lv_text_flag_t flag);
+
+/**
+ * Get the width of a whole text in one line like `lv_text_get_width(txt, lv_strlen(txt), ...)`,
+ * but measure the text only if it wasn't measured recently with the same font and letter space.
+ * @param txt           pointer to a text
+ * @param font          pointer to font of the text
+ * @param letter_space  letter space of the text
+ * @return              the width of the text
+ */
+int32_t lv_text_cache_get_width(const char * txt, const lv_font_t * font, int32_t letter_space);
+
+/**
+ * Remove all the cached text sizes.
+ * Needs to be called when a font is deleted, as its address might be reused by a new font.
+ */
+void lv_text_cache_drop_all(void);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEXT_CACHE_H*/
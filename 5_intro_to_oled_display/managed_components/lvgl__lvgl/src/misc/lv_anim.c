@@ -22,7 +22,6 @@
 #define LV_ANIM_RESOLUTION 1024
 #define LV_ANIM_RES_SHIFT 10
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
 
 /**********************
  *      TYPEDEFS
@@ -32,14 +31,22 @@
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
-static void anim_mark_list_change(void);
+static void anim_calc_values(uint32_t now);
+static void anim_update_timer(void);
+static bool anim_add(lv_anim_t * a);
+static void anim_unlink(lv_anim_t * a);
+static void anim_compact(void);
 static void anim_completed_handler(lv_anim_t * a);
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
                                          int32_t y1, int32_t x2, int32_t y2);
 static uint32_t convert_speed_to_time(uint32_t speed, int32_t start, int32_t end);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(lv_anim_t * a_current);
-static void remove_anim(void * a);
+static void remove_anim(lv_anim_t * a);
+#if LV_ANIM_PATH_TABLES
+static inline int32_t anim_path_table_value(const lv_anim_t * a, const int16_t * table);
+static const int16_t * anim_get_path_table(lv_anim_path_cb_t path_cb);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -54,22 +61,32 @@ static void remove_anim(void * a);
     #define LV_TRACE_ANIM(...)
 #endif
 
+/*The animation is past its delay and `start_cb` was called*/
+#define ANIM_IS_PLAYING(a) ((a)->start_cb_called && (a)->act_time >= 0)
+
+#if LV_ANIM_PATH_TABLES
+#include "lv_anim_path_table.h"
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
-    anim_mark_list_change(); /*Turn off the animation timer*/
-    state.anim_list_changed = false;
-    state.anim_run_round = false;
+    anim_update_timer(); /*Turn off the animation timer*/
 }
 
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+    lv_free(state.anims);
+    lv_free(state.values);
+    state.anims = NULL;
+    state.values = NULL;
+    state.anim_cnt = 0;
+    state.anim_capacity = 0;
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -87,17 +104,21 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
 {
     LV_TRACE_ANIM("begin");
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
+    lv_anim_t * new_anim = lv_malloc(sizeof(lv_anim_t));
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
-    new_anim->run_round = state.anim_run_round;
     new_anim->last_timer_run = lv_tick_get();
 
+    /*Add the new animation to the started ones*/
+    if(!anim_add(new_anim)) {
+        lv_free(new_anim);
+        return NULL;
+    }
+
     /*Set the start value*/
     if(new_anim->early_apply) {
         if(new_anim->get_value_cb) {
@@ -120,9 +141,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         }
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
-    anim_mark_list_change();
+    anim_update_timer();
 
     LV_TRACE_ANIM("finished");
     return new_anim;
@@ -144,22 +163,19 @@ uint32_t lv_anim_get_playtime(const lv_anim_t * a)
 
 bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
-        if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a && (a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             remove_anim(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
             del_any = true;
-            del = true;
-        }
 
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+            /*Always start from the newest on delete, because we don't know
+             *how the animations were changed in `a->deleted_cb` */
+            i = state.anim_cnt;
+        }
     }
 
     return del_any;
@@ -167,15 +183,23 @@ bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
-    anim_mark_list_change();
+    /*Delete from the end to not move the others*/
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        if(state.anims[i]) remove_anim(state.anims[i]);
+        if(i > state.anim_cnt) i = state.anim_cnt; /*`deleted_cb` might have deleted others too*/
+    }
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+    /*Find the most recently started one*/
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a && a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
     }
@@ -191,8 +215,10 @@ lv_timer_t * lv_anim_get_timer(void)
 uint16_t lv_anim_count_running(void)
 {
     uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        if(state.anims[i]) cnt++;
+    }
 
     return cnt;
 }
@@ -259,25 +285,41 @@ int32_t lv_anim_path_linear(const lv_anim_t * a)
 
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
+#if LV_ANIM_PATH_TABLES
+    return anim_path_table_value(a, anim_path_ease_in_table);
+#else
     return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
                                      LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+#endif
 }
 
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
+#if LV_ANIM_PATH_TABLES
+    return anim_path_table_value(a, anim_path_ease_out_table);
+#else
     return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
                                      LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+#endif
 }
 
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
+#if LV_ANIM_PATH_TABLES
+    return anim_path_table_value(a, anim_path_ease_in_out_table);
+#else
     return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
                                      LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+#endif
 }
 
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
+#if LV_ANIM_PATH_TABLES
+    return anim_path_table_value(a, anim_path_overshoot_table);
+#else
     return lv_anim_path_cubic_bezier(a, 341, 0, 683, 1300);
+#endif
 }
 
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
@@ -494,72 +536,106 @@ static void anim_timer(lv_timer_t * param)
 {
     LV_UNUSED(param);
 
-    /*Flip the run round*/
-    state.anim_run_round = state.anim_run_round ? false : true;
-
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
+    lv_anim_state_t * state_p = &state;
+    if(state_p->running) return;    /*Called by `lv_anim_refr_now()` from an animation's callback*/
 
-    while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
-        a->act_time += elaps;
+    /*The animations started in the callbacks are added after these ones and run only in the next round*/
+    state_p->running = true;
+    state_p->run_cnt = state_p->anim_cnt;
 
-        a->last_timer_run = lv_tick_get();
+    /*No callbacks are called here, so the animations can't change meanwhile*/
+    anim_calc_values(lv_tick_get());
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        state.anim_list_changed = false;
-
-        if(a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+    /*Handle the most recently started animations first.
+     *E.g. a new style transition's `start_cb` needs to delete the previous one before that runs.*/
+    uint32_t i = state_p->run_cnt;
+    while(i > 0) {
+        i--;
+        /*Animations deleted in a callback are set to NULL*/
+        lv_anim_t * a = state_p->anims[i];
+        if(a == NULL || a->act_time < 0) continue;
 
+        int32_t new_value;
+        if(!a->start_cb_called) {
             /*The animation will run now for the first time. Call `start_cb`*/
-            if(!a->start_cb_called && a->act_time >= 0) {
+            if(a->early_apply == 0 && a->get_value_cb) {
+                int32_t v_ofs = a->get_value_cb(a);
+                a->start_value += v_ofs;
+                a->end_value += v_ofs;
+            }
 
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
+            resolve_time(a);
 
-                resolve_time(a);
+            if(a->start_cb) a->start_cb(a);
+            a->start_cb_called = 1;
 
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
+            /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
+            remove_concurrent_anims(a);
+            if(state_p->anims[i] != a) continue;
 
-                /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
-                remove_concurrent_anims(a);
-            }
+            if(a->act_time > a->duration) a->act_time = a->duration;
+            new_value = a->path_cb(a);
+        }
+        else {
+            new_value = state_p->values[i];
+        }
+
+        if(new_value != a->current_value) {
+            a->current_value = new_value;
+            /*Apply the calculated value*/
+            if(a->exec_cb) a->exec_cb(a->var, new_value);
+            if(state_p->anims[i] == a && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
+        }
 
-            if(a->act_time >= 0) {
-                if(a->act_time > a->duration) a->act_time = a->duration;
+        /*If the time is elapsed the animation is ready*/
+        if(state_p->anims[i] == a && a->act_time >= a->duration) {
+            anim_completed_handler(a);
+        }
+    }
 
-                int32_t new_value;
-                new_value = a->path_cb(a);
+    state_p->running = false;
+    anim_compact();
+    anim_update_timer();
+}
 
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
+/**
+ * Step the time of all animations and calculate the new value of those which are playing.
+ * The consecutive animations with the same path (e.g. the style transitions of a state change)
+ * are processed together.
+ * @param now       the current tick
+ */
+static void anim_calc_values(uint32_t now)
+{
+    lv_anim_t ** anims = state.anims;
+    int32_t * values = state.values;
+    uint32_t cnt = state.run_cnt;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_anim_t * a = anims[i];
+        a->act_time += now - a->last_timer_run;
+        a->last_timer_run = now;
+        if(ANIM_IS_PLAYING(a) && a->act_time > a->duration) a->act_time = a->duration;
+    }
 
-                /*If the time is elapsed the animation is ready*/
-                if(!state.anim_list_changed && a->act_time >= a->duration) {
-                    anim_completed_handler(a);
-                }
+    i = 0;
+    while(i < cnt) {
+        lv_anim_path_cb_t path_cb = anims[i]->path_cb;
+        uint32_t end = i + 1;
+        while(end < cnt && anims[end]->path_cb == path_cb) end++;
+
+#if LV_ANIM_PATH_TABLES
+        const int16_t * table = anim_get_path_table(path_cb);
+        if(table) {
+            for(; i < end; i++) {
+                if(ANIM_IS_PLAYING(anims[i])) values[i] = anim_path_table_value(anims[i], table);
             }
+            continue;
+        }
+#endif
+        for(; i < end; i++) {
+            if(ANIM_IS_PLAYING(anims[i])) values[i] = path_cb(anims[i]);
         }
-
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
     }
-
 }
 
 /**
@@ -581,9 +657,7 @@ static void anim_completed_handler(lv_anim_t * a)
 
         /*Delete the animation from the list.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
-        /*Flag that the list has changed*/
-        anim_mark_list_change();
+        anim_unlink(a);
 
         /*Call the callback function at the end*/
         if(a->completed_cb != NULL) a->completed_cb(a);
@@ -612,15 +686,84 @@ static void anim_completed_handler(lv_anim_t * a)
     }
 }
 
-static void anim_mark_list_change(void)
+/**
+ * Run the animation timer only if there are animations
+ */
+static void anim_update_timer(void)
 {
-    state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL)
+    if(state.running) return;  /*Will be updated at the end of `anim_timer`*/
+
+    if(state.anim_cnt == 0)
         lv_timer_pause(state.timer);
     else
         lv_timer_resume(state.timer);
 }
 
+/**
+ * Add an animation to the end of the started ones
+ * @param a     pointer to an allocated animation
+ * @return      true: added; false: out of memory
+ */
+static bool anim_add(lv_anim_t * a)
+{
+    if(state.anim_cnt >= state.anim_capacity) {
+        uint32_t new_capacity = state.anim_capacity ? state.anim_capacity * 2 : 8;
+        lv_anim_t ** new_anims = lv_realloc(state.anims, new_capacity * sizeof(lv_anim_t *));
+        LV_ASSERT_MALLOC(new_anims);
+        if(new_anims == NULL) return false;
+        state.anims = new_anims;
+
+        int32_t * new_values = lv_realloc(state.values, new_capacity * sizeof(int32_t));
+        LV_ASSERT_MALLOC(new_values);
+        if(new_values == NULL) return false;
+        state.values = new_values;
+        state.anim_capacity = new_capacity;
+    }
+
+    state.anims[state.anim_cnt] = a;
+    state.anim_cnt++;
+    return true;
+}
+
+/**
+ * Remove an animation from the started ones without freeing it.
+ * Only set it to NULL if `anim_timer` is running, it will be removed at the end.
+ * @param a     pointer to a started animation
+ */
+static void anim_unlink(lv_anim_t * a)
+{
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        if(state.anims[i] == a) break;
+    }
+    if(i == state.anim_cnt) return;
+
+    if(state.running) {
+        state.anims[i] = NULL;
+    }
+    else {
+        lv_memmove(&state.anims[i], &state.anims[i + 1], (state.anim_cnt - i - 1) * sizeof(lv_anim_t *));
+        state.anim_cnt--;
+        anim_update_timer();
+    }
+}
+
+/**
+ * Remove the animations deleted while `anim_timer` was running
+ */
+static void anim_compact(void)
+{
+    lv_anim_t ** anims = state.anims;
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        if(anims[i] == NULL) continue;
+        anims[cnt] = anims[i];
+        cnt++;
+    }
+    state.anim_cnt = cnt;
+}
+
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
 {
     /*Calculate the current step*/
@@ -667,41 +810,65 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 {
     if(a_current->exec_cb == NULL && a_current->custom_exec_cb == NULL) return false;
 
-    lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
          *a wrapper callback is used here an the real callback data is stored in the `user_data`.
          *Therefore equality check would remove all animations.*/
-        if(a != a_current &&
+        if(a && a != a_current &&
            (a->act_time >= 0 || a->early_apply) &&
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
-            if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
-            anim_mark_list_change();
-
+            remove_anim(a);
             del_any = true;
-            del = true;
-        }
 
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+            /*Always start from the newest on delete, because we don't know
+             *how the animations were changed in `a->deleted_cb` */
+            i = state.anim_cnt;
+        }
     }
 
     return del_any;
 }
 
-static void remove_anim(void * a)
+static void remove_anim(lv_anim_t * a)
 {
-    lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
-    if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
+    anim_unlink(a);
+    if(a->deleted_cb != NULL) a->deleted_cb(a);
     lv_free(a);
 }
+
+#if LV_ANIM_PATH_TABLES
+
+/**
+ * Calculate the value of an animation from the steps of its path
+ * @param a         pointer to an animation
+ * @param table     the steps of the path for each time in [0..LV_BEZIER_VAL_MAX]
+ * @return          the current value
+ */
+static inline int32_t anim_path_table_value(const lv_anim_t * a, const int16_t * table)
+{
+    int32_t t = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
+
+    int32_t new_value;
+    new_value = table[t] * (a->end_value - a->start_value);
+    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
+    new_value += a->start_value;
+
+    return new_value;
+}
+
+static const int16_t * anim_get_path_table(lv_anim_path_cb_t path_cb)
+{
+    if(path_cb == lv_anim_path_ease_in) return anim_path_ease_in_table;
+    if(path_cb == lv_anim_path_ease_out) return anim_path_ease_out_table;
+    if(path_cb == lv_anim_path_ease_in_out) return anim_path_ease_in_out_table;
+    if(path_cb == lv_anim_path_overshoot) return anim_path_overshoot_table;
+    return NULL;
+}
+
+#endif /*LV_ANIM_PATH_TABLES*/
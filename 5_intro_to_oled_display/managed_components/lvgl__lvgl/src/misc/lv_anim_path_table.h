@@ -0,0 +1,294 @@
+/**
+ * @file lv_anim_path_table.h
+ *
+ * The steps of the built-in cubic Bezier animation paths for each time in [0..LV_BEZIER_VAL_MAX].
+ * Included only by `lv_anim.c`.
+ */
+
+/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "anim_path_table_gen.py"
+ **********************************************************************
+ */
+
+#ifndef LV_ANIM_PATH_TABLE_H
+#define LV_ANIM_PATH_TABLE_H
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const int16_t anim_path_ease_in_table[LV_BEZIER_VAL_MAX + 1] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 7,
+    7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10,
+    11, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 15, 15,
+    15, 16, 16, 16, 16, 17, 17, 18, 18, 18, 19, 19, 19, 19, 20, 20,
+    21, 21, 21, 22, 22, 22, 23, 23, 24, 24, 24, 25, 25, 25, 26, 26,
+    26, 27, 27, 28, 28, 28, 29, 30, 30, 30, 31, 31, 32, 32, 32, 33,
+    33, 34, 34, 35, 35, 35, 36, 37, 37, 37, 38, 38, 38, 39, 40, 40,
+    40, 41, 41, 42, 42, 43, 44, 44, 44, 45, 45, 46, 46, 47, 47, 48,
+    48, 49, 50, 50, 50, 51, 52, 52, 52, 53, 54, 54, 54, 55, 56, 57,
+    57, 57, 58, 58, 59, 60, 60, 60, 61, 62, 63, 63, 63, 64, 64, 65,
+    66, 67, 67, 67, 68, 69, 69, 70, 71, 71, 71, 72, 73, 74, 74, 75,
+    75, 75, 76, 77, 77, 78, 79, 80, 81, 81, 82, 82, 82, 83, 84, 85,
+    86, 86, 87, 88, 88, 89, 89, 89, 90, 91, 92, 93, 93, 94, 95, 96,
+    96, 97, 98, 98, 99, 99, 99, 100, 101, 102, 103, 103, 104, 105, 105, 106,
+    106, 107, 108, 109, 110, 111, 111, 112, 113, 113, 114, 115, 115, 116, 117, 118,
+    119, 119, 120, 121, 121, 122, 123, 123, 124, 125, 125, 126, 127, 128, 129, 129,
+    130, 131, 131, 132, 133, 133, 134, 135, 135, 137, 138, 139, 140, 141, 141, 142,
+    143, 143, 144, 145, 145, 146, 147, 147, 148, 149, 150, 151, 151, 153, 154, 155,
+    155, 156, 157, 157, 158, 160, 160, 160, 162, 163, 163, 164, 165, 166, 166, 167,
+    168, 170, 170, 171, 172, 172, 173, 174, 175, 175, 177, 178, 178, 179, 180, 181,
+    181, 183, 184, 185, 185, 186, 187, 188, 190, 190, 191, 192, 192, 193, 194, 194,
+    196, 197, 198, 198, 199, 200, 202, 202, 203, 204, 205, 205, 206, 208, 209, 210,
+    210, 212, 213, 214, 214, 215, 217, 217, 218, 219, 220, 220, 221, 223, 224, 224,
+    225, 226, 228, 228, 229, 231, 232, 232, 233, 234, 234, 236, 237, 238, 239, 239,
+    241, 242, 242, 243, 245, 246, 246, 247, 248, 250, 250, 251, 252, 254, 254, 255,
+    256, 258, 258, 259, 260, 262, 262, 263, 264, 266, 267, 267, 268, 270, 270, 271,
+    272, 274, 275, 275, 276, 278, 279, 279, 280, 282, 283, 283, 285, 286, 287, 287,
+    289, 290, 291, 293, 293, 294, 296, 296, 297, 298, 299, 301, 301, 303, 304, 305,
+    306, 306, 308, 309, 311, 311, 312, 312, 314, 315, 316, 318, 318, 319, 320, 322,
+    322, 324, 325, 326, 326, 328, 329, 330, 330, 332, 333, 334, 336, 336, 337, 339,
+    340, 340, 342, 343, 345, 346, 346, 347, 349, 350, 350, 352, 353, 355, 356, 356,
+    357, 359, 360, 360, 362, 363, 365, 366, 367, 367, 369, 370, 372, 372, 373, 375,
+    376, 376, 378, 379, 380, 382, 382, 383, 383, 387, 387, 388, 389, 391, 391, 392,
+    394, 395, 395, 397, 398, 400, 401, 402, 402, 404, 406, 407, 408, 408, 410, 411,
+    413, 413, 414, 416, 417, 419, 419, 420, 421, 423, 425, 425, 426, 427, 429, 431,
+    432, 432, 433, 435, 437, 437, 439, 439, 441, 442, 444, 444, 446, 447, 448, 450,
+    450, 451, 453, 455, 456, 456, 457, 459, 460, 462, 462, 464, 465, 466, 468, 468,
+    469, 471, 472, 474, 475, 477, 477, 478, 480, 481, 481, 483, 484, 486, 487, 489,
+    489, 490, 492, 493, 495, 496, 498, 499, 499, 501, 502, 504, 505, 507, 508, 508,
+    510, 512, 513, 514, 514, 516, 517, 519, 520, 522, 522, 523, 525, 526, 528, 529,
+    529, 531, 532, 534, 535, 537, 538, 538, 541, 541, 543, 544, 545, 547, 549, 549,
+    552, 552, 553, 555, 556, 558, 559, 559, 562, 562, 564, 565, 567, 568, 568, 570,
+    571, 572, 574, 576, 577, 579, 580, 581, 581, 583, 585, 586, 587, 589, 590, 592,
+    592, 595, 595, 598, 598, 599, 601, 602, 604, 605, 605, 608, 608, 610, 611, 612,
+    614, 616, 617, 618, 620, 622, 622, 624, 626, 626, 628, 629, 630, 632, 633, 635,
+    636, 637, 639, 641, 642, 643, 645, 645, 648, 649, 650, 650, 654, 655, 655, 657,
+    658, 659, 661, 662, 664, 665, 667, 668, 669, 671, 672, 674, 675, 677, 678, 679,
+    681, 682, 684, 685, 687, 688, 689, 690, 692, 693, 693, 696, 700, 701, 702, 702,
+    705, 705, 706, 709, 710, 712, 712, 715, 716, 718, 719, 720, 721, 723, 724, 725,
+    727, 728, 730, 731, 732, 735, 735, 737, 738, 741, 741, 742, 745, 745, 748, 749,
+    750, 752, 753, 754, 756, 757, 758, 760, 761, 762, 765, 766, 768, 769, 772, 772,
+    773, 774, 775, 778, 779, 779, 782, 783, 784, 787, 787, 789, 790, 792, 793, 795,
+    799, 800, 799, 801, 805, 804, 806, 808, 810, 811, 812, 813, 813, 816, 819, 820,
+    821, 822, 823, 826, 827, 828, 829, 832, 833, 835, 835, 836, 840, 841, 843, 845,
+    846, 845, 848, 849, 850, 853, 854, 855, 857, 858, 859, 862, 864, 865, 865, 867,
+    869, 871, 873, 874, 875, 876, 878, 880, 883, 884, 886, 887, 888, 889, 891, 893,
+    895, 897, 899, 898, 901, 902, 904, 905, 909, 908, 911, 911, 915, 916, 916, 916,
+    919, 921, 922, 924, 925, 927, 929, 930, 932, 933, 935, 937, 939, 939, 941, 943,
+    944, 946, 949, 949, 950, 953, 954, 958, 959, 962, 960, 964, 966, 965, 968, 968,
+    972, 972, 974, 976, 977, 980, 981, 983, 984, 986, 989, 989, 992, 993, 994, 997,
+    997, 1000, 1001, 1003, 1005, 1007, 1009, 1009, 1010, 1014, 1014, 1018, 1018, 1022, 1022, 1023,
+    1024,
+};
+
+static const int16_t anim_path_ease_out_table[LV_BEZIER_VAL_MAX + 1] = {
+    0, 0, 4, 7, 9, 11, 12, 13, 14, 16, 18, 19, 21, 23, 24, 27,
+    27, 30, 32, 33, 34, 37, 38, 39, 41, 42, 44, 46, 47, 50, 51, 53,
+    54, 55, 57, 58, 60, 62, 63, 67, 67, 69, 72, 74, 75, 76, 76, 80,
+    82, 83, 84, 84, 88, 89, 91, 93, 94, 95, 98, 99, 100, 101, 103, 105,
+    107, 108, 110, 112, 113, 115, 115, 117, 120, 121, 122, 124, 125, 127, 128, 129,
+    131, 133, 134, 137, 138, 139, 140, 143, 143, 146, 147, 148, 150, 151, 153, 155,
+    156, 157, 158, 160, 163, 163, 166, 167, 168, 170, 172, 173, 174, 175, 178, 179,
+    180, 181, 183, 184, 187, 188, 190, 192, 193, 194, 196, 197, 198, 200, 202, 203,
+    204, 205, 208, 209, 210, 212, 213, 214, 218, 218, 219, 220, 221, 224, 226, 228,
+    229, 231, 232, 233, 234, 236, 238, 239, 241, 242, 243, 245, 246, 248, 250, 251,
+    252, 254, 255, 256, 258, 260, 260, 262, 264, 266, 267, 268, 270, 271, 272, 274,
+    275, 276, 278, 279, 282, 283, 285, 286, 287, 289, 290, 291, 293, 294, 296, 297,
+    298, 299, 301, 303, 304, 305, 306, 308, 309, 311, 314, 314, 315, 316, 318, 319,
+    320, 322, 324, 325, 326, 328, 332, 332, 333, 334, 336, 337, 339, 340, 342, 343,
+    345, 346, 347, 349, 350, 352, 353, 355, 356, 357, 359, 360, 362, 363, 365, 366,
+    367, 369, 370, 372, 373, 375, 376, 378, 379, 379, 380, 382, 383, 385, 387, 388,
+    389, 391, 392, 394, 395, 397, 398, 398, 400, 401, 402, 404, 406, 407, 408, 410,
+    411, 413, 414, 416, 417, 417, 419, 420, 421, 423, 425, 426, 427, 429, 429, 431,
+    432, 433, 435, 437, 438, 439, 439, 441, 444, 446, 446, 447, 448, 450, 451, 453,
+    455, 455, 456, 457, 459, 460, 462, 464, 465, 466, 466, 468, 469, 471, 472, 474,
+    474, 475, 477, 478, 480, 481, 483, 483, 484, 486, 487, 489, 490, 492, 493, 493,
+    495, 496, 498, 499, 501, 501, 502, 504, 505, 507, 508, 510, 510, 512, 513, 514,
+    514, 516, 517, 519, 520, 522, 523, 525, 525, 526, 528, 529, 531, 532, 532, 534,
+    535, 537, 538, 540, 540, 541, 543, 544, 545, 547, 547, 549, 550, 552, 553, 553,
+    556, 556, 558, 559, 560, 562, 562, 564, 565, 567, 568, 568, 570, 571, 572, 572,
+    574, 576, 577, 577, 580, 581, 581, 583, 585, 586, 586, 587, 589, 590, 590, 592,
+    594, 595, 595, 596, 598, 599, 601, 602, 604, 604, 605, 607, 608, 608, 610, 611,
+    612, 614, 616, 616, 617, 618, 620, 622, 622, 623, 624, 626, 628, 628, 629, 630,
+    632, 633, 633, 635, 636, 637, 637, 639, 641, 642, 643, 643, 645, 646, 648, 649,
+    649, 650, 652, 654, 655, 655, 657, 658, 658, 659, 661, 662, 664, 664, 665, 665,
+    668, 669, 669, 671, 672, 672, 674, 675, 677, 678, 678, 679, 681, 682, 684, 684,
+    685, 687, 688, 688, 689, 690, 692, 693, 693, 695, 696, 698, 698, 700, 701, 702,
+    702, 703, 705, 706, 707, 707, 709, 710, 710, 712, 713, 713, 715, 716, 718, 719,
+    719, 720, 721, 723, 724, 724, 725, 727, 727, 728, 730, 731, 731, 732, 734, 735,
+    735, 738, 738, 739, 741, 741, 742, 744, 745, 745, 746, 748, 749, 749, 750, 752,
+    753, 753, 756, 756, 757, 758, 758, 760, 761, 762, 762, 764, 765, 766, 766, 768,
+    769, 770, 770, 772, 773, 773, 775, 775, 775, 778, 778, 779, 780, 782, 782, 783,
+    784, 786, 786, 787, 788, 789, 789, 790, 792, 792, 793, 795, 796, 796, 797, 799,
+    800, 800, 801, 802, 804, 804, 805, 806, 806, 807, 808, 810, 810, 811, 812, 813,
+    813, 815, 816, 817, 817, 819, 820, 820, 821, 822, 823, 823, 824, 826, 827, 827,
+    828, 829, 831, 832, 833, 833, 834, 835, 835, 836, 838, 839, 839, 840, 841, 843,
+    843, 844, 845, 845, 846, 847, 848, 848, 849, 850, 850, 852, 853, 854, 855, 855,
+    855, 856, 858, 858, 859, 859, 861, 862, 862, 864, 864, 865, 866, 867, 867, 868,
+    868, 871, 871, 872, 872, 873, 874, 874, 876, 875, 877, 877, 878, 880, 880, 881,
+    882, 883, 884, 885, 885, 886, 886, 887, 888, 888, 889, 890, 890, 891, 892, 893,
+    895, 895, 896, 897, 897, 898, 898, 899, 899, 901, 902, 902, 903, 904, 905, 905,
+    905, 906, 908, 908, 909, 910, 911, 911, 911, 912, 914, 915, 915, 916, 916, 916,
+    917, 917, 918, 919, 921, 921, 921, 922, 923, 924, 924, 924, 926, 927, 927, 928,
+    928, 929, 929, 930, 932, 932, 932, 933, 934, 935, 934, 935, 935, 937, 938, 939,
+    939, 939, 940, 940, 941, 941, 942, 943, 944, 944, 944, 945, 946, 947, 947, 948,
+    949, 949, 950, 950, 951, 952, 953, 953, 954, 954, 954, 955, 956, 957, 957, 958,
+    958, 958, 959, 960, 960, 960, 962, 962, 962, 964, 964, 964, 964, 965, 966, 967,
+    967, 968, 969, 968, 969, 970, 970, 971, 971, 972, 972, 973, 973, 973, 974, 975,
+    975, 976, 976, 976, 977, 977, 978, 980, 980, 980, 980, 981, 981, 981, 982, 983,
+    984, 984, 984, 984, 985, 985, 986, 986, 986, 988, 988, 988, 989, 989, 989, 990,
+    990, 990, 992, 992, 993, 993, 993, 993, 993, 994, 994, 994, 996, 996, 996, 996,
+    997, 997, 998, 998, 998, 999, 1000, 1000, 1000, 1001, 1001, 1001, 1001, 1001, 1002, 1002,
+    1003, 1003, 1004, 1004, 1004, 1005, 1005, 1005, 1005, 1005, 1005, 1007, 1007, 1007, 1008, 1008,
+    1008, 1008, 1008, 1009, 1009, 1009, 1010, 1010, 1011, 1011, 1011, 1011, 1012, 1012, 1012, 1012,
+    1012, 1012, 1012, 1014, 1014, 1014, 1014, 1014, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1016,
+    1016, 1016, 1016, 1017, 1017, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1019, 1019, 1019,
+    1019, 1019, 1019, 1019, 1019, 1020, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+    1021, 1021, 1021, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022,
+    1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1023, 1023,
+    1024,
+};
+
+static const int16_t anim_path_ease_in_out_table[LV_BEZIER_VAL_MAX + 1] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7,
+    7, 8, 8, 8, 8, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 12,
+    12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 16, 16, 16, 16, 17, 17,
+    18, 18, 18, 19, 19, 19, 20, 20, 20, 21, 21, 22, 22, 23, 23, 23,
+    24, 24, 25, 25, 26, 26, 27, 27, 28, 28, 28, 29, 30, 30, 31, 31,
+    32, 32, 33, 33, 34, 34, 35, 35, 36, 37, 37, 38, 38, 39, 40, 40,
+    41, 41, 41, 42, 43, 44, 44, 45, 45, 46, 47, 47, 48, 49, 50, 50,
+    51, 51, 52, 52, 53, 54, 54, 55, 56, 57, 57, 57, 58, 59, 60, 60,
+    61, 62, 63, 63, 64, 65, 66, 67, 67, 68, 68, 69, 71, 71, 71, 72,
+    73, 74, 75, 75, 76, 77, 78, 79, 80, 81, 82, 82, 83, 84, 85, 86,
+    87, 88, 89, 89, 90, 91, 92, 92, 93, 94, 95, 96, 97, 98, 99, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 116,
+    116, 118, 118, 120, 120, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 137, 138, 139, 140, 141, 141, 142, 143, 144, 145, 146, 148, 148,
+    150, 151, 153, 154, 155, 156, 157, 158, 160, 160, 162, 163, 164, 165, 166, 167,
+    168, 170, 172, 172, 174, 175, 177, 178, 179, 180, 181, 183, 184, 185, 186, 187,
+    188, 190, 191, 193, 194, 196, 197, 198, 199, 200, 202, 203, 204, 205, 206, 208,
+    210, 210, 213, 214, 215, 217, 218, 219, 220, 221, 223, 224, 225, 228, 229, 231,
+    232, 233, 234, 236, 237, 238, 239, 241, 242, 245, 246, 247, 248, 250, 251, 252,
+    254, 255, 258, 258, 260, 262, 263, 264, 266, 267, 268, 270, 271, 272, 275, 276,
+    278, 279, 280, 282, 283, 285, 286, 287, 290, 291, 293, 294, 296, 297, 298, 299,
+    301, 303, 305, 306, 308, 309, 311, 312, 314, 315, 318, 319, 320, 322, 324, 325,
+    326, 328, 330, 332, 332, 334, 336, 337, 339, 340, 342, 343, 345, 347, 349, 350,
+    352, 353, 355, 356, 357, 360, 362, 363, 365, 366, 367, 369, 370, 372, 375, 376,
+    378, 379, 380, 382, 385, 387, 388, 389, 391, 392, 394, 395, 398, 400, 401, 402,
+    404, 406, 407, 408, 410, 411, 416, 417, 419, 420, 421, 423, 426, 427, 429, 431,
+    432, 433, 435, 437, 438, 439, 442, 444, 446, 447, 448, 450, 453, 455, 456, 457,
+    459, 460, 462, 464, 466, 468, 469, 471, 472, 474, 475, 480, 481, 483, 484, 486,
+    487, 489, 490, 492, 493, 495, 496, 498, 499, 501, 502, 504, 505, 507, 508, 510,
+    512, 516, 517, 519, 520, 522, 523, 525, 528, 529, 531, 532, 534, 535, 537, 538,
+    541, 543, 544, 545, 547, 549, 550, 552, 553, 556, 558, 559, 560, 562, 564, 565,
+    567, 570, 571, 572, 574, 576, 577, 579, 580, 585, 586, 587, 589, 590, 592, 594,
+    596, 598, 599, 601, 602, 604, 605, 607, 610, 611, 612, 614, 616, 617, 618, 620,
+    622, 624, 626, 628, 629, 630, 632, 633, 635, 637, 639, 641, 642, 643, 645, 646,
+    648, 650, 652, 654, 655, 657, 658, 661, 661, 664, 665, 667, 668, 669, 672, 672,
+    675, 677, 678, 679, 681, 682, 684, 685, 687, 688, 690, 690, 693, 695, 696, 698,
+    700, 701, 702, 706, 707, 707, 709, 710, 712, 716, 715, 719, 720, 721, 723, 724,
+    725, 727, 728, 730, 730, 734, 735, 737, 738, 739, 741, 742, 744, 745, 746, 748,
+    750, 749, 753, 754, 756, 757, 758, 760, 762, 762, 765, 766, 765, 769, 770, 772,
+    773, 774, 775, 777, 777, 780, 779, 783, 784, 786, 787, 787, 788, 792, 790, 795,
+    793, 797, 799, 797, 800, 801, 802, 804, 805, 806, 807, 808, 811, 813, 813, 816,
+    816, 817, 819, 820, 821, 822, 823, 824, 826, 827, 829, 831, 832, 833, 834, 835,
+    836, 838, 839, 841, 843, 844, 845, 846, 847, 848, 849, 850, 852, 853, 854, 855,
+    856, 857, 858, 859, 861, 862, 864, 864, 866, 866, 868, 868, 871, 871, 873, 873,
+    875, 876, 877, 878, 880, 881, 882, 883, 884, 886, 886, 888, 889, 889, 891, 891,
+    893, 893, 895, 896, 897, 898, 898, 899, 901, 902, 903, 904, 905, 905, 906, 906,
+    909, 910, 911, 911, 912, 914, 916, 916, 917, 917, 919, 919, 921, 921, 923, 923,
+    924, 925, 926, 927, 928, 929, 929, 930, 932, 932, 932, 933, 934, 935, 935, 938,
+    938, 939, 939, 941, 941, 943, 943, 944, 944, 945, 946, 947, 948, 948, 949, 949,
+    951, 952, 953, 954, 954, 955, 956, 957, 958, 958, 959, 960, 960, 962, 962, 962,
+    963, 964, 964, 964, 965, 966, 967, 967, 968, 969, 969, 971, 971, 972, 972, 973,
+    973, 974, 975, 976, 976, 976, 977, 977, 978, 980, 980, 980, 981, 981, 982, 983,
+    984, 984, 985, 985, 986, 986, 988, 988, 989, 989, 989, 989, 989, 990, 990, 992,
+    992, 993, 993, 993, 993, 994, 994, 996, 996, 996, 997, 997, 997, 998, 998, 1000,
+    1000, 1000, 1000, 1001, 1001, 1001, 1001, 1002, 1003, 1003, 1004, 1004, 1004, 1004, 1005, 1005,
+    1005, 1006, 1007, 1007, 1008, 1008, 1008, 1008, 1008, 1009, 1009, 1010, 1010, 1010, 1011, 1011,
+    1011, 1012, 1012, 1012, 1012, 1012, 1012, 1014, 1014, 1014, 1014, 1014, 1015, 1015, 1015, 1015,
+    1015, 1015, 1016, 1016, 1016, 1017, 1017, 1017, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1019,
+    1019, 1019, 1019, 1019, 1019, 1019, 1020, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+    1021, 1021, 1021, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022,
+    1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1023, 1023,
+    1024,
+};
+
+static const int16_t anim_path_overshoot_table[LV_BEZIER_VAL_MAX + 1] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7,
+    8, 8, 8, 9, 9, 10, 10, 10, 11, 11, 11, 12, 12, 13, 13, 14,
+    14, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21,
+    22, 22, 23, 24, 24, 25, 25, 26, 26, 27, 28, 28, 29, 29, 30, 31,
+    31, 32, 33, 33, 34, 35, 35, 36, 37, 37, 38, 39, 39, 40, 41, 42,
+    42, 43, 44, 45, 45, 46, 47, 48, 48, 49, 50, 51, 52, 52, 53, 54,
+    55, 56, 56, 57, 58, 59, 60, 61, 62, 62, 63, 64, 65, 66, 67, 68,
+    69, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    118, 119, 120, 121, 122, 123, 124, 126, 127, 128, 129, 130, 131, 133, 134, 135,
+    136, 137, 139, 140, 141, 142, 143, 145, 146, 147, 148, 150, 151, 152, 153, 155,
+    156, 157, 158, 160, 161, 162, 163, 165, 166, 167, 169, 170, 171, 173, 174, 175,
+    176, 178, 179, 181, 182, 183, 184, 186, 187, 189, 190, 191, 193, 194, 195, 197,
+    198, 200, 201, 202, 204, 205, 206, 208, 209, 211, 212, 214, 215, 216, 218, 219,
+    221, 222, 223, 225, 226, 228, 229, 231, 232, 234, 235, 237, 238, 239, 241, 242,
+    244, 245, 247, 248, 250, 251, 253, 254, 256, 257, 259, 260, 262, 263, 265, 266,
+    268, 269, 271, 272, 274, 275, 277, 279, 280, 282, 283, 285, 286, 288, 289, 291,
+    292, 294, 295, 297, 299, 300, 302, 303, 305, 306, 308, 310, 311, 313, 314, 316,
+    317, 319, 321, 322, 324, 326, 327, 329, 330, 332, 334, 335, 337, 338, 340, 342,
+    343, 345, 347, 348, 350, 351, 353, 355, 356, 358, 360, 361, 363, 365, 366, 368,
+    369, 371, 373, 374, 376, 378, 379, 381, 382, 384, 386, 388, 389, 391, 393, 394,
+    396, 398, 399, 401, 403, 404, 406, 408, 409, 411, 413, 415, 416, 418, 420, 421,
+    423, 424, 426, 428, 430, 431, 433, 435, 437, 438, 440, 441, 443, 445, 447, 449,
+    450, 452, 453, 455, 457, 459, 460, 462, 464, 466, 467, 469, 471, 472, 474, 476,
+    477, 479, 481, 483, 484, 486, 488, 490, 491, 493, 495, 496, 498, 500, 501, 503,
+    505, 506, 508, 510, 512, 514, 515, 517, 519, 520, 522, 523, 526, 527, 529, 531,
+    532, 534, 536, 538, 539, 541, 542, 545, 546, 548, 549, 551, 553, 555, 556, 558,
+    560, 562, 563, 565, 567, 568, 570, 572, 574, 575, 577, 579, 580, 582, 584, 585,
+    587, 589, 591, 593, 594, 596, 598, 599, 601, 603, 604, 606, 608, 609, 611, 613,
+    615, 616, 618, 620, 621, 623, 625, 626, 628, 630, 632, 633, 635, 637, 639, 640,
+    642, 644, 645, 647, 648, 650, 652, 654, 655, 657, 658, 660, 662, 664, 665, 667,
+    669, 670, 672, 674, 675, 677, 678, 680, 682, 683, 686, 687, 689, 690, 692, 693,
+    695, 697, 698, 700, 702, 704, 705, 707, 708, 710, 711, 713, 715, 716, 718, 720,
+    721, 723, 724, 726, 728, 729, 731, 732, 734, 735, 737, 739, 740, 742, 743, 745,
+    747, 748, 750, 751, 753, 755, 756, 758, 759, 761, 763, 764, 766, 767, 769, 771,
+    772, 773, 775, 776, 778, 780, 781, 783, 784, 786, 788, 789, 790, 792, 793, 795,
+    797, 798, 799, 801, 802, 804, 805, 807, 808, 810, 811, 813, 814, 816, 818, 819,
+    820, 821, 823, 825, 827, 828, 829, 830, 832, 834, 835, 836, 837, 839, 841, 842,
+    843, 844, 846, 848, 849, 850, 852, 853, 855, 856, 857, 859, 860, 862, 863, 864,
+    866, 867, 869, 870, 871, 872, 873, 875, 877, 878, 879, 881, 882, 883, 884, 886,
+    887, 888, 890, 891, 892, 893, 895, 897, 897, 899, 900, 901, 903, 904, 905, 906,
+    908, 909, 910, 912, 913, 914, 915, 917, 918, 919, 920, 921, 922, 924, 925, 926,
+    927, 929, 929, 931, 932, 933, 934, 936, 937, 938, 939, 940, 942, 942, 944, 945,
+    945, 947, 948, 949, 950, 951, 952, 954, 955, 955, 957, 957, 959, 960, 961, 962,
+    963, 964, 966, 966, 967, 968, 969, 970, 971, 972, 973, 975, 975, 977, 977, 978,
+    980, 980, 982, 982, 983, 984, 985, 986, 987, 987, 989, 990, 990, 992, 992, 993,
+    995, 995, 996, 997, 998, 999, 999, 1001, 1001, 1002, 1003, 1004, 1005, 1005, 1006, 1007,
+    1008, 1009, 1009, 1010, 1011, 1012, 1013, 1013, 1014, 1015, 1016, 1016, 1017, 1018, 1019, 1019,
+    1020, 1021, 1021, 1022, 1023, 1024, 1025, 1025, 1025, 1026, 1027, 1028, 1028, 1028, 1029, 1030,
+    1031, 1032, 1032, 1033, 1034, 1034, 1035, 1035, 1036, 1036, 1037, 1038, 1038, 1038, 1039, 1040,
+    1040, 1041, 1041, 1042, 1042, 1042, 1043, 1043, 1044, 1045, 1045, 1046, 1046, 1046, 1047, 1047,
+    1047, 1048, 1048, 1049, 1050, 1050, 1050, 1050, 1050, 1052, 1052, 1052, 1053, 1052, 1053, 1054,
+    1054, 1054, 1054, 1055, 1055, 1056, 1055, 1055, 1056, 1057, 1056, 1057, 1057, 1057, 1058, 1058,
+    1058, 1058, 1058, 1059, 1059, 1059, 1059, 1059, 1060, 1060, 1059, 1060, 1060, 1059, 1061, 1061,
+    1060, 1061, 1060, 1061, 1061, 1061, 1061, 1060, 1061, 1061, 1061, 1061, 1061, 1062, 1061, 1061,
+    1061, 1061, 1061, 1061, 1061, 1061, 1060, 1061, 1061, 1061, 1060, 1060, 1060, 1061, 1060, 1060,
+    1060, 1059, 1060, 1059, 1060, 1059, 1059, 1059, 1058, 1059, 1058, 1057, 1057, 1057, 1058, 1057,
+    1056, 1056, 1056, 1056, 1056, 1055, 1054, 1055, 1054, 1054, 1054, 1053, 1053, 1052, 1052, 1052,
+    1051, 1051, 1051, 1050, 1049, 1049, 1049, 1049, 1048, 1047, 1047, 1046, 1046, 1045, 1045, 1045,
+    1044, 1044, 1043, 1042, 1041, 1041, 1041, 1040, 1040, 1039, 1038, 1037, 1037, 1037, 1036, 1035,
+    1034, 1034, 1033, 1032, 1031, 1030, 1030, 1029, 1028, 1027, 1026, 1026, 1025, 1024, 1023, 1023,
+    1024,
+};
+
+#endif /*LV_ANIM_PATH_TABLE_H*/
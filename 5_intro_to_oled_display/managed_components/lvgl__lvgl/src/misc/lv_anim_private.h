@@ -25,10 +25,13 @@ extern "C" {
  **********************/
 
 typedef struct {
-    bool anim_list_changed;
-    bool anim_run_round;
+    lv_anim_t ** anims;        /**< The started animations in the order of starting them*/
+    int32_t * values;          /**< The new values of `anims` calculated at the beginning of `anim_timer`*/
+    uint32_t anim_cnt;
+    uint32_t anim_capacity;
+    uint32_t run_cnt;          /**< The number of animations `anim_timer` runs now. The others were started meanwhile.*/
+    bool running;              /**< `anim_timer` is running: the deleted items of `anims` are only set to NULL*/
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
 } lv_anim_state_t;
 
 /**********************
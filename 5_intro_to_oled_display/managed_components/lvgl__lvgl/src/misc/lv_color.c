@@ -44,6 +44,7 @@ uint8_t lv_color_format_get_bpp(lv_color_format_t cf)
 {
     switch(cf) {
         case LV_COLOR_FORMAT_I1:
+        case LV_COLOR_FORMAT_I1_PAGE:
         case LV_COLOR_FORMAT_A1:
             return 1;
         case LV_COLOR_FORMAT_I2:
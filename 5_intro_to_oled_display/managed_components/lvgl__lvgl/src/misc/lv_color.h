@@ -64,6 +64,7 @@ enum {
  */
 #define LV_COLOR_FORMAT_GET_BPP(cf) (       \
                                             (cf) == LV_COLOR_FORMAT_I1 ? 1 :        \
+                                            (cf) == LV_COLOR_FORMAT_I1_PAGE ? 1 :   \
                                             (cf) == LV_COLOR_FORMAT_A1 ? 1 :        \
                                             (cf) == LV_COLOR_FORMAT_I2 ? 2 :        \
                                             (cf) == LV_COLOR_FORMAT_A2 ? 2 :        \
@@ -131,6 +132,7 @@ typedef enum {
     LV_COLOR_FORMAT_RAW_ALPHA         = 0x02,
 
     /*<=1 byte (+alpha) formats*/
+    LV_COLOR_FORMAT_I1_PAGE           = 0x05,   /**< 1 bpp without palette, 8 vertical pixels per byte (SSD1306/SH1107 pages)*/
     LV_COLOR_FORMAT_L8                = 0x06,
     LV_COLOR_FORMAT_I1                = 0x07,
     LV_COLOR_FORMAT_I2                = 0x08,
@@ -194,6 +196,7 @@ typedef enum {
 
 #define LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf) ((cf) >= LV_COLOR_FORMAT_A1 && (cf) <= LV_COLOR_FORMAT_A8)
 #define LV_COLOR_FORMAT_IS_INDEXED(cf) ((cf) >= LV_COLOR_FORMAT_I1 && (cf) <= LV_COLOR_FORMAT_I8)
+#define LV_COLOR_FORMAT_IS_PAGED(cf) ((cf) == LV_COLOR_FORMAT_I1_PAGE)
 #define LV_COLOR_FORMAT_IS_YUV(cf)  ((cf) >= LV_COLOR_FORMAT_YUV_START && (cf) <= LV_COLOR_FORMAT_YUV_END)
 #define LV_COLOR_INDEXED_PALETTE_SIZE(cf) ((cf) == LV_COLOR_FORMAT_I1 ? 2 :\
                                            (cf) == LV_COLOR_FORMAT_I2 ? 4 :\
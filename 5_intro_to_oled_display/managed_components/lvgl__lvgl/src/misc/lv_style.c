@@ -20,6 +20,8 @@
 #define lv_style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define last_custom_prop_id LV_GLOBAL_DEFAULT()->style_last_custom_prop_id
 
+#define PROP_INDEX_SIZE     LV_STYLE_NUM_BUILT_IN_PROPS
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -27,6 +29,11 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static size_t get_alloc_size(uint32_t prop_cnt);
+static lv_style_prop_t * get_props(const lv_style_t * style);
+static uint8_t * get_prop_index(const lv_style_t * style);
+static int32_t find_prop(const lv_style_t * style, lv_style_prop_t prop);
+static void build_prop_index(lv_style_t * style);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -248,40 +255,40 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
         return false;
     }
 
-    if(style->prop_cnt == 0)  return false;
+    int32_t i = find_prop(style, prop);
+    if(i < 0) return false;
 
-    uint8_t * tmp = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-    uint8_t * old_props = (uint8_t *)tmp;
-    uint32_t i;
-    for(i = 0; i < style->prop_cnt; i++) {
-        if(old_props[i] == prop) {
-            lv_style_value_t * old_values = (lv_style_value_t *)style->values_and_props;
-
-            size_t size = (style->prop_cnt - 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
-            uint8_t * new_values_and_props = lv_malloc(size);
-            if(new_values_and_props == NULL) return false;
-            style->values_and_props = new_values_and_props;
-            style->prop_cnt--;
-
-            tmp = new_values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-            uint8_t * new_props = (uint8_t *)tmp;
-            lv_style_value_t * new_values = (lv_style_value_t *)new_values_and_props;
-
-            uint32_t j;
-            for(i = j = 0; j <= style->prop_cnt;
-                j++) { /*<=: because prop_cnt already reduced but all the old props. needs to be checked.*/
-                if(old_props[j] != prop) {
-                    new_values[i] = old_values[j];
-                    new_props[i++] = old_props[j];
-                }
-            }
-
-            lv_free(old_values);
-            return true;
-        }
+    uint32_t last = style->prop_cnt - 1;
+    lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+    lv_style_prop_t * props = get_props(style);
+    uint8_t * index = get_prop_index(style);
+
+    /*Move the last property to the place of the removed one*/
+    values[i] = values[last];
+    props[i] = props[last];
+    if(index) {
+        if(props[i] < LV_STYLE_NUM_BUILT_IN_PROPS) index[props[i]] = i + 1;
+        if(prop < LV_STYLE_NUM_BUILT_IN_PROPS) index[prop] = 0;
     }
 
-    return false;
+    if(last == 0) {
+        lv_free(style->values_and_props);
+        style->values_and_props = NULL;
+        style->prop_cnt = 0;
+        return true;
+    }
+
+    /*The props (and the index) start earlier as there is one less value*/
+    uint8_t * new_props = (uint8_t *)style->values_and_props + last * sizeof(lv_style_value_t);
+    lv_memmove(new_props, props, last * sizeof(lv_style_prop_t));
+    if(last >= LV_STYLE_PROP_INDEX_MIN_CNT) lv_memmove(new_props + last, index, PROP_INDEX_SIZE);
+    style->prop_cnt = last;
+
+    /*Just keep the larger buffer if it can't be shrunk*/
+    void * values_and_props = lv_realloc(style->values_and_props, get_alloc_size(style->prop_cnt));
+    if(values_and_props) style->values_and_props = values_and_props;
+
+    return true;
 }
 
 void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
@@ -295,39 +302,36 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
 
     LV_ASSERT(prop != LV_STYLE_PROP_INV);
 
-    lv_style_prop_t * props;
-    int32_t i;
-
-    if(style->values_and_props) {
-        props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        for(i = style->prop_cnt - 1; i >= 0; i--) {
-            if(props[i] == prop) {
-                lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
-                values[i] = value;
-                return;
-            }
-        }
+    int32_t i = find_prop(style, prop);
+    if(i >= 0) {
+        lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+        values[i] = value;
+        return;
     }
 
-    size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
-    uint8_t * values_and_props = lv_realloc(style->values_and_props, size);
+    uint32_t cnt = style->prop_cnt;
+    uint8_t * values_and_props = lv_realloc(style->values_and_props, get_alloc_size(cnt + 1));
     if(values_and_props == NULL) return;
     style->values_and_props = values_and_props;
 
-    props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-    /*Shift all props to make place for the value before them*/
-    for(i = style->prop_cnt - 1; i >= 0; i--) {
-        props[i + sizeof(lv_style_value_t) / sizeof(lv_style_prop_t)] = props[i];
-    }
+    /*Shift the props (and the index) to make place for the new value before them*/
+    lv_style_prop_t * props = values_and_props + cnt * sizeof(lv_style_value_t);
+    lv_style_prop_t * new_props = values_and_props + (cnt + 1) * sizeof(lv_style_value_t);
+    if(cnt >= LV_STYLE_PROP_INDEX_MIN_CNT) lv_memmove(new_props + cnt + 1, props + cnt, PROP_INDEX_SIZE);
+    lv_memmove(new_props, props, cnt * sizeof(lv_style_prop_t));
     style->prop_cnt++;
 
-    /*Go to the new position with the props*/
-    props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+    /*Set the new property and value*/
     lv_style_value_t * values = (lv_style_value_t *)values_and_props;
+    new_props[cnt] = prop;
+    values[cnt] = value;
 
-    /*Set the new property and value*/
-    props[style->prop_cnt - 1] = prop;
-    values[style->prop_cnt - 1] = value;
+    if(style->prop_cnt == LV_STYLE_PROP_INDEX_MIN_CNT) {
+        build_prop_index(style);
+    }
+    else if(style->prop_cnt > LV_STYLE_PROP_INDEX_MIN_CNT && prop < LV_STYLE_NUM_BUILT_IN_PROPS) {
+        get_prop_index(style)[prop] = cnt + 1;
+    }
 
     uint32_t group = lv_style_get_prop_group(prop);
     style->has_group |= (uint32_t)1 << group;
@@ -440,3 +444,59 @@ uint8_t lv_style_prop_lookup_flags(lv_style_prop_t prop)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+static size_t get_alloc_size(uint32_t prop_cnt)
+{
+    size_t size = prop_cnt * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+    if(prop_cnt >= LV_STYLE_PROP_INDEX_MIN_CNT) size += PROP_INDEX_SIZE;
+    return size;
+}
+
+static lv_style_prop_t * get_props(const lv_style_t * style)
+{
+    return (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+}
+
+/**
+ * Get the index of the built-in properties of a style
+ * @param style     pointer to a not constant style
+ * @return          the index or NULL if the style has too few properties to have an index
+ */
+static uint8_t * get_prop_index(const lv_style_t * style)
+{
+    if(style->prop_cnt < LV_STYLE_PROP_INDEX_MIN_CNT) return NULL;
+    return get_props(style) + style->prop_cnt;
+}
+
+/**
+ * Find a property in a not constant style
+ * @param style     pointer to a style
+ * @param prop      the property to find
+ * @return          index of the property's value or -1 if not found
+ */
+static int32_t find_prop(const lv_style_t * style, lv_style_prop_t prop)
+{
+    if(style->prop_cnt == 0) return -1;
+
+    uint8_t * index = get_prop_index(style);
+    if(index && prop < LV_STYLE_NUM_BUILT_IN_PROPS) return (int32_t)index[prop] - 1;
+
+    lv_style_prop_t * props = get_props(style);
+    uint32_t i;
+    for(i = 0; i < style->prop_cnt; i++) {
+        if(props[i] == prop) return i;
+    }
+    return -1;
+}
+
+static void build_prop_index(lv_style_t * style)
+{
+    lv_style_prop_t * props = get_props(style);
+    uint8_t * index = get_prop_index(style);
+    lv_memzero(index, PROP_INDEX_SIZE);
+
+    uint32_t i;
+    for(i = 0; i < style->prop_cnt; i++) {
+        if(props[i] < LV_STYLE_NUM_BUILT_IN_PROPS) index[props[i]] = i + 1;
+    }
+}
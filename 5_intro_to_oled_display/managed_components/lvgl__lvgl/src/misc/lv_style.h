@@ -370,6 +370,11 @@ typedef struct {
     uint32_t sentinel;
 #endif
 
+    /**
+     * `prop_cnt` values, then `prop_cnt` property IDs, then if `prop_cnt >= LV_STYLE_PROP_INDEX_MIN_CNT`
+     * the index of each built-in property's value + 1 (0: not set).
+     * For constant styles an `lv_style_const_prop_t` array.
+     */
     void * values_and_props;
 
     uint32_t has_group;
@@ -509,10 +514,17 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
     }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+        lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+        if(style->prop_cnt >= LV_STYLE_PROP_INDEX_MIN_CNT && prop < LV_STYLE_NUM_BUILT_IN_PROPS) {
+            const uint8_t * index = props + style->prop_cnt;
+            if(index[prop] == 0) return LV_STYLE_RES_NOT_FOUND;
+            *value = values[index[prop] - 1];
+            return LV_STYLE_RES_FOUND;
+        }
+
         uint32_t i;
         for(i = 0; i < style->prop_cnt; i++) {
             if(props[i] == prop) {
-                lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
                 *value = values[i];
                 return LV_STYLE_RES_FOUND;
             }
@@ -98,42 +98,59 @@ void lv_text_get_size(lv_point_t * size_res, const char * text, const lv_font_t
     if(text == NULL) return;
     if(font == NULL) return;
 
+    uint32_t line_cnt = lv_text_get_lines(text, font, letter_space, max_width, flag, &size_res->x, NULL, NULL);
+    int32_t letter_height = lv_font_get_line_height(font);
+
+    int64_t height = (int64_t)line_cnt * (letter_height + line_space);
+    if(height > (int64_t)LV_MAX_OF(int32_t)) {
+        LV_LOG_WARN("integer overflow while calculating text height");
+        size_res->y = LV_MAX_OF(int32_t);
+        return;
+    }
+
+    /*Correction with the last line space or set the height manually if the text is empty*/
+    size_res->y = (int32_t)height;
+    if(size_res->y == 0)
+        size_res->y = letter_height;
+    else
+        size_res->y -= line_space;
+}
+
+uint32_t lv_text_get_lines(const char * text, const lv_font_t * font, int32_t letter_space, int32_t max_width,
+                           lv_text_flag_t flag, int32_t * width_res, lv_text_line_cb_t line_cb, void * user_data)
+{
+    if(width_res) *width_res = 0;
+
+    if(text == NULL) return 0;
+    if(font == NULL) return 0;
+
     if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
 
-    uint32_t line_start     = 0;
-    uint32_t new_line_start = 0;
-    uint16_t letter_height = lv_font_get_line_height(font);
+    uint32_t line_cnt = 0;
+    uint32_t line_start = 0;
+    int32_t width = 0;
+    lv_text_line_t line;
 
-    /*Calc. the height and longest line*/
     while(text[line_start] != '\0') {
-        new_line_start += lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
-
-        if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(int32_t)) {
-            LV_LOG_WARN("integer overflow while calculating text height");
-            return;
-        }
-        else {
-            size_res->y += letter_height;
-            size_res->y += line_space;
-        }
+        line.start = line_start;
+        line.end = line_start + lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+        line.width = lv_text_get_width(&text[line_start], line.end - line_start, font, letter_space);
 
         /*Calculate the longest line*/
-        int32_t act_line_length = lv_text_get_width(&text[line_start], new_line_start - line_start, font, letter_space);
+        width = LV_MAX(width, line.width);
+        line_start = line.end;
+        line_cnt++;
 
-        size_res->x = LV_MAX(act_line_length, size_res->x);
-        line_start  = new_line_start;
+        if(line_cb && !line_cb(&line, user_data)) break;
     }
 
     /*Make the text one line taller if the last character is '\n' or '\r'*/
     if((line_start != 0) && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
-        size_res->y += letter_height + line_space;
+        line_cnt++;
     }
 
-    /*Correction with the last line space or set the height manually if the text is empty*/
-    if(size_res->y == 0)
-        size_res->y = letter_height;
-    else
-        size_res->y -= line_space;
+    if(width_res) *width_res = width;
+    return line_cnt;
 }
 
 /**
@@ -53,6 +53,21 @@ typedef enum {
     LV_TEXT_ALIGN_RIGHT, /**< Align text to right*/
 } lv_text_align_t;
 
+/** The position and width of a line of a wrapped text*/
+typedef struct {
+    uint32_t start;     /**< Byte index of the line's first character in the text*/
+    uint32_t end;       /**< Byte index where the next line starts*/
+    int32_t width;      /**< Width of the line in pixels*/
+} lv_text_line_t;
+
+/**
+ * Called by `lv_text_get_lines` with each line of a wrapped text
+ * @param line          the position and width of the line
+ * @param user_data     the `user_data` passed to `lv_text_get_lines`
+ * @return              true: continue with the next line; false: stop wrapping
+ */
+typedef bool (*lv_text_line_cb_t)(const lv_text_line_t * line, void * user_data);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -72,6 +87,22 @@ typedef enum {
 void lv_text_get_size(lv_point_t * size_res, const char * text, const lv_font_t * font, int32_t letter_space,
                       int32_t line_space, int32_t max_width, lv_text_flag_t flag);
 
+/**
+ * Wrap a text to lines and measure them the same way as `lv_text_get_size`
+ * @param text          pointer to a text
+ * @param font          pointer to font of the text
+ * @param letter_space  letter space of the text
+ * @param max_width     max width of the lines. Not used with `LV_TEXT_FLAG_EXPAND`
+ * @param flag          settings for the text from ::lv_text_flag_t
+ * @param width_res     store the width of the longest line here. Can be NULL.
+ * @param line_cb       called with each line. Can be NULL.
+ * @param user_data     passed to `line_cb`
+ * @return              number of lines in the height of the text. If the text ends with '\n' or '\r'
+ *                      it's one more than the number of lines passed to `line_cb`.
+ */
+uint32_t lv_text_get_lines(const char * text, const lv_font_t * font, int32_t letter_space, int32_t max_width,
+                           lv_text_flag_t flag, int32_t * width_res, lv_text_line_cb_t line_cb, void * user_data);
+
 /**
  * Give the length of a text with a given font
  * @param txt a '\0' terminate string
@@ -12,6 +12,7 @@
 #include "../stdlib/lv_sprintf.h"
 #include "lv_assert.h"
 #include "lv_ll.h"
+#include "lv_math.h"
 #include "lv_profiler.h"
 
 /*********************
@@ -21,6 +22,10 @@
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
 
+/*Keep the deadlines closer than half of the tick range to `lv_tick_get()`
+ *so that they can be compared by their signed difference*/
+#define DEADLINE_MAX_DISTANCE 0x3FFFFFFF
+
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
 
@@ -31,9 +36,15 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
+static void lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static void timer_schedule(lv_timer_t * timer);
+static void timer_unschedule(lv_timer_t * timer);
+static bool timer_before(const lv_timer_t * a, const lv_timer_t * b);
+static void heap_sift_up(uint32_t idx);
+static void heap_sift_down(uint32_t idx);
+static lv_timer_t * heap_find_due(uint32_t idx, uint32_t tick);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,42 +101,27 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
+    /*Run the due timers in the order of their deadlines. The timers created, deleted or
+     *rescheduled by the callbacks are moved in the heap right away so it's always safe to continue.
+     *A timer runs at most once per call, e.g. timers with 0 period will run again in the next call.*/
+    state_p->handler_pass++;
+    while(1) {
+        lv_timer_t * timer_active = heap_find_due(0, lv_tick_get());
+        if(timer_active == NULL) break;
+
+        /*The deadline of timers with very long period is limited, so check the real remaining time*/
+        if(timer_active->repeat_count != 0 && lv_timer_time_remaining(timer_active) != 0) {
+            timer_schedule(timer_active);
+            continue;
         }
-    } while(timer_active);
 
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
+        lv_timer_exec(timer_active);
+    }
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(state_p->heap_size > 0) {
+        int32_t delay = (int32_t)(state_p->heap[0]->deadline - lv_tick_get());
+        time_until_next = delay > 0 ? (uint32_t)delay : 0;
     }
 
     state_p->busy_time += lv_tick_elaps(handler_start);
@@ -171,6 +167,21 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
 
+    /*Reserve the place in the heap now, so resuming or rescheduling the timer can't fail later*/
+    if(state.timer_cnt >= state.heap_capacity) {
+        uint32_t new_capacity = state.heap_capacity ? state.heap_capacity * 2 : 8;
+        lv_timer_t ** new_heap = lv_realloc(state.heap, new_capacity * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) {
+            lv_ll_remove(timer_ll_p, new_timer);
+            lv_free(new_timer);
+            return NULL;
+        }
+        state.heap = new_heap;
+        state.heap_capacity = new_capacity;
+    }
+    state.timer_cnt++;
+
     new_timer->period = period;
     new_timer->timer_cb = timer_xcb;
     new_timer->repeat_count = -1;
@@ -178,8 +189,11 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->heap_index = LV_TIMER_NOT_SCHEDULED;
+    new_timer->handler_pass = state.handler_pass - 1;   /*Not run in the current handler call*/
+    new_timer->create_id = state.create_cnt++;
 
-    state.timer_created = true;
+    timer_schedule(new_timer);
 
     lv_timer_handler_resume();
 
@@ -194,8 +208,10 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    timer_unschedule(timer);
     lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
+    state.timer_cnt--;
+    if(state.timer_running == timer) state.timer_running = NULL;
 
     lv_free(timer);
 }
@@ -204,12 +220,14 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    timer_unschedule(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    timer_schedule(timer);
     lv_timer_handler_resume();
 }
 
@@ -217,18 +235,21 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    if(!timer->paused) timer_schedule(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    if(!timer->paused) timer_schedule(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+    if(!timer->paused) timer_schedule(timer);
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -247,6 +268,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    if(!timer->paused) timer_schedule(timer);
     lv_timer_handler_resume();
 }
 
@@ -261,6 +283,11 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_size = 0;
+    state.heap_capacity = 0;
+    state.timer_cnt = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -305,51 +332,42 @@ bool lv_timer_get_paused(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
+ * Execute a due timer and delete or pause it if its repeat count is over
  * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
  */
-static bool lv_timer_exec(lv_timer_t * timer)
+static void lv_timer_exec(lv_timer_t * timer)
 {
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count != 0) {
+        /* Decrement the repeat count and schedule the next run before executing the timer_cb.
+         * So the callback can freely reschedule, pause or delete the timer*/
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
-        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
+        timer->handler_pass = state.handler_pass;
+        timer_schedule(timer);
 
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
+        state.timer_running = timer;
+        if(timer->timer_cb) timer->timer_cb(timer);
+        LV_ASSERT_MEM_INTEGRITY();
 
-        if(!state.timer_deleted) {
-            LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
-        }
-        else {
+        if(state.timer_running == NULL) { /*The timer was deleted by itself*/
             LV_TRACE_TIMER("timer callback finished");
+            return;
         }
-
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
+        state.timer_running = NULL;
+        LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
     }
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
-        if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
-            if(timer->auto_delete) {
-                LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-                lv_timer_delete(timer);
-            }
-            else {
-                LV_TRACE_TIMER("pausing timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-                lv_timer_pause(timer);
-            }
+    if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
+        if(timer->auto_delete) {
+            LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_delete(timer);
+        }
+        else {
+            LV_TRACE_TIMER("pausing timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_pause(timer);
         }
     }
-
-    return exec;
 }
 
 /**
@@ -378,6 +396,128 @@ static void lv_timer_handler_resume(void)
     }
 }
 
+/**
+ * Update the deadline of a timer and move it to its place in the heap (or add it if it's not there yet)
+ * @param timer pointer to a not paused lv_timer
+ */
+static void timer_schedule(lv_timer_t * timer)
+{
+    uint32_t now = lv_tick_get();
+    uint32_t elp = lv_tick_elaps(timer->last_run);
+    if(timer->repeat_count == 0) timer->deadline = now; /*Due now to delete or pause it*/
+    else if(elp >= timer->period) timer->deadline = now - LV_MIN(elp - timer->period, DEADLINE_MAX_DISTANCE);
+    else timer->deadline = now + LV_MIN(timer->period - elp, DEADLINE_MAX_DISTANCE);
+
+    lv_timer_state_t * state_p = &state;
+    if(timer->heap_index == LV_TIMER_NOT_SCHEDULED) {
+        /*`lv_timer_create` has already reserved the place*/
+        timer->heap_index = state_p->heap_size;
+        state_p->heap[state_p->heap_size] = timer;
+        state_p->heap_size++;
+        heap_sift_up(timer->heap_index);
+    }
+    else {
+        heap_sift_up(timer->heap_index);
+        heap_sift_down(timer->heap_index);
+    }
+}
+
+/**
+ * Remove a timer from the heap. Nothing happens if it's not there.
+ * @param timer pointer to lv_timer
+ */
+static void timer_unschedule(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_index;
+    if(idx == LV_TIMER_NOT_SCHEDULED) return;
+
+    lv_timer_state_t * state_p = &state;
+    timer->heap_index = LV_TIMER_NOT_SCHEDULED;
+    state_p->heap_size--;
+    if(idx == state_p->heap_size) return;
+
+    /*Fill the gap with the last item*/
+    lv_timer_t * last = state_p->heap[state_p->heap_size];
+    last->heap_index = idx;
+    state_p->heap[idx] = last;
+    heap_sift_up(idx);
+    heap_sift_down(last->heap_index);
+}
+
+/**
+ * Tell if a timer needs to run before an other one
+ * @param a pointer to lv_timer
+ * @param b pointer to lv_timer
+ * @return true: `a` needs to run first
+ */
+static bool timer_before(const lv_timer_t * a, const lv_timer_t * b)
+{
+    int32_t diff = (int32_t)(a->deadline - b->deadline);
+    if(diff != 0) return diff < 0;
+
+    /*From the timers with the same deadline the newer ones as the timer list was processed from the head.
+     *Only fields which don't change while the timer is in the heap can be used here.*/
+    return (int32_t)(a->create_id - b->create_id) > 0;
+}
+
+static void heap_sift_up(uint32_t idx)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * timer = heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!timer_before(timer, heap[parent])) break;
+        heap[idx] = heap[parent];
+        heap[idx]->heap_index = idx;
+        idx = parent;
+    }
+    heap[idx] = timer;
+    timer->heap_index = idx;
+}
+
+static void heap_sift_down(uint32_t idx)
+{
+    lv_timer_t ** heap = state.heap;
+    uint32_t size = state.heap_size;
+    lv_timer_t * timer = heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= size) break;
+        if(child + 1 < size && timer_before(heap[child + 1], heap[child])) child++;
+        if(!timer_before(heap[child], timer)) break;
+        heap[idx] = heap[child];
+        heap[idx]->heap_index = idx;
+        idx = child;
+    }
+    heap[idx] = timer;
+    timer->heap_index = idx;
+}
+
+/**
+ * Find the due timer with the earliest deadline which hasn't run in this handler call yet.
+ * It's usually the root, but a timer made ready again by its callback can be in front of the others.
+ * @param idx   index of the root of the sub-heap to search
+ * @param tick  the current tick
+ * @return      the timer to run next or NULL if there are no more due timers
+ */
+static lv_timer_t * heap_find_due(uint32_t idx, uint32_t tick)
+{
+    if(idx >= state.heap_size) return NULL;
+
+    lv_timer_t * timer = state.heap[idx];
+    if((int32_t)(timer->deadline - tick) > 0) return NULL;
+
+    /*It's before all the timers below it. If it has already run in this call, look for the first
+     *one below it which hasn't.*/
+    if(timer->handler_pass != state.handler_pass) return timer;
+
+    lv_timer_t * left = heap_find_due(idx * 2 + 1, tick);
+    lv_timer_t * right = heap_find_due(idx * 2 + 2, tick);
+    if(left == NULL) return right;
+    if(right == NULL) return left;
+    return timer_before(right, left) ? right : left;
+}
+
 void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data)
 {
     state.resume_cb = cb;
@@ -20,6 +20,8 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_TIMER_NOT_SCHEDULED 0xFFFFFFFF
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,15 +37,24 @@ struct lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
+    uint32_t deadline;         /**< Tick of the next run, the key of the timer in the deadline heap */
+    uint32_t heap_index;       /**< Position in the deadline heap or `LV_TIMER_NOT_SCHEDULED` if paused */
+    uint32_t handler_pass;     /**< The `lv_timer_handler` call in which the timer ran last */
+    uint32_t create_id;        /**< Order of creation. Newer timers run first from the ones with the same deadline */
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
+    lv_timer_t ** heap;        /**< Binary min-heap of the not paused timers ordered by their deadline */
+    uint32_t heap_size;
+    uint32_t heap_capacity;    /**< Kept at least `timer_cnt` so scheduling a timer never allocates */
+    uint32_t timer_cnt;
+    uint32_t handler_pass;     /**< Incremented in every `lv_timer_handler` call */
+    uint32_t create_cnt;       /**< Incremented in every `lv_timer_create` call */
+    lv_timer_t * timer_running; /**< The timer whose callback is running. Cleared if it's deleted.*/
 
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
     uint32_t timer_time_until_next;
 
     bool already_running;
@@ -107,6 +107,37 @@ lv_result_t lv_thread_init(lv_thread_t * pxThread, lv_thread_prio_t xSchedPriori
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_thread_init_pinned(lv_thread_t * pxThread, lv_thread_prio_t xSchedPriority,
+                                  void (*pvStartRoutine)(void *), size_t usStackSize,
+                                  uint32_t ulCore, void * xAttr)
+{
+#if (ESP_PLATFORM) && !CONFIG_FREERTOS_UNICORE
+    pxThread->pTaskArg = xAttr;
+    pxThread->pvStartRoutine = pvStartRoutine;
+
+    BaseType_t xTaskCreateStatus = xTaskCreatePinnedToCore(
+                                       prvRunThread,
+                                       pcTASK_NAME,
+                                       (configSTACK_DEPTH_TYPE)(usStackSize / sizeof(StackType_t)),
+                                       (void *)pxThread,
+                                       tskIDLE_PRIORITY + xSchedPriority,
+                                       &pxThread->xTaskHandle,
+                                       (BaseType_t)(ulCore % portNUM_PROCESSORS));
+
+    /* Ensure that the FreeRTOS task was successfully created. */
+    if(xTaskCreateStatus != pdPASS) {
+        LV_LOG_ERROR("xTaskCreatePinnedToCore failed!");
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+#else
+    /* Single core or no affinity API in this FreeRTOS port. */
+    LV_UNUSED(ulCore);
+    return lv_thread_init(pxThread, xSchedPriority, pvStartRoutine, usStackSize, xAttr);
+#endif
+}
+
 lv_result_t lv_thread_delete(lv_thread_t * pxThread)
 {
     vTaskDelete(pxThread->xTaskHandle);
@@ -65,6 +65,15 @@ void lv_unlock(void)
 #endif /*LV_USE_OS != LV_OS_NONE*/
 }
 
+#if LV_USE_OS != LV_OS_PTHREAD && LV_USE_OS != LV_OS_FREERTOS
+lv_result_t lv_thread_init_pinned(lv_thread_t * thread, lv_thread_prio_t prio, void (*callback)(void *),
+                                  size_t stack_size, uint32_t core, void * user_data)
+{
+    LV_UNUSED(core);
+    return lv_thread_init(thread, prio, callback, stack_size, user_data);
+}
+#endif /*LV_USE_OS != LV_OS_PTHREAD && LV_USE_OS != LV_OS_FREERTOS*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -75,6 +75,20 @@ typedef enum {
 lv_result_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size,
                            void * user_data);
 
+/**
+ * Create a new thread which runs only on one CPU core.
+ * OSALs which can't pin threads create a normal thread with `lv_thread_init`.
+ * @param thread        a variable in which the thread will be stored
+ * @param prio          priority of the thread
+ * @param callback      function of the thread
+ * @param stack_size    stack size in bytes
+ * @param core          index of the core, it wraps around the number of cores
+ * @param user_data     arbitrary data, will be available in the callback
+ * @return              LV_RESULT_OK: success; LV_RESULT_INVALID: failure
+ */
+lv_result_t lv_thread_init_pinned(lv_thread_t * thread, lv_thread_prio_t prio, void (*callback)(void *),
+                                  size_t stack_size, uint32_t core, void * user_data);
+
 /**
  * Delete a thread
  * @param thread        the thread to delete
@@ -6,11 +6,15 @@
 /*********************
  *      INCLUDES
  *********************/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE /*For pthread_attr_setaffinity_np*/
+#endif
 #include "lv_os.h"
 
 #if LV_USE_OS == LV_OS_PTHREAD
 
 #include <errno.h>
+#include <unistd.h>
 #include "../misc/lv_log.h"
 
 /*********************
@@ -51,6 +55,36 @@ lv_result_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*c
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_thread_init_pinned(lv_thread_t * thread, lv_thread_prio_t prio, void (*callback)(void *),
+                                  size_t stack_size, uint32_t core, void * user_data)
+{
+#if defined(__linux__)
+    LV_UNUSED(prio);
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, stack_size);
+
+    long core_cnt = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(core_cnt > 0 ? core % core_cnt : 0, &cpu_set);
+    pthread_attr_setaffinity_np(&attr, sizeof(cpu_set), &cpu_set);
+
+    thread->callback = callback;
+    thread->user_data = user_data;
+    int ret = pthread_create(&thread->thread, &attr, generic_callback, thread);
+    pthread_attr_destroy(&attr);
+    if(ret) {
+        LV_LOG_WARN("Error: %d", ret);
+        return LV_RESULT_INVALID;
+    }
+    return LV_RESULT_OK;
+#else
+    LV_UNUSED(core);
+    return lv_thread_init(thread, prio, callback, stack_size, user_data);
+#endif
+}
+
 lv_result_t lv_thread_delete(lv_thread_t * thread)
 {
     int ret = pthread_join(thread->thread, NULL);
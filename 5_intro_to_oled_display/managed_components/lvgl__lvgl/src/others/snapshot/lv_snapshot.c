@@ -121,7 +121,9 @@ lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t * obj, lv_color_format_t cf, l
     lv_display_t * disp_old = lv_refr_get_disp_refreshing();
     lv_display_t * disp_new = lv_obj_get_display(obj);
     lv_layer_t * layer_old = disp_new->layer_head;
+    lv_layer_t * layer_tail_old = disp_new->layer_tail;
     disp_new->layer_head = &layer;
+    disp_new->layer_tail = &layer;
 
     lv_refr_set_disp_refreshing(disp_new);
     lv_obj_redraw(&layer, obj);
@@ -132,6 +134,7 @@ lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t * obj, lv_color_format_t cf, l
     }
 
     disp_new->layer_head = layer_old;
+    disp_new->layer_tail = layer_tail_old;
     lv_refr_set_disp_refreshing(disp_old);
 
     return LV_RESULT_OK;
@@ -38,6 +38,14 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+#if LV_MEM_SLAB
+    #define SLAB_PAGE_SIZE      1024
+    #define SLAB_MAX_SIZE       128
+    #define SLAB_CAPACITY(slot_size) (SLAB_PAGE_SIZE / (slot_size))
+    /*`class_idx` of the pages which are not used by any class*/
+    #define SLAB_CLASS_NONE     0xFF
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,10 +54,28 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+static void * mem_alloc(size_t size);
+#if LV_MEM_SLAB
+    static void slab_init(void);
+    static void * slab_malloc(size_t size);
+    static void slab_free(lv_mem_slab_page_t * page, void * p);
+    static lv_mem_slab_page_t * slab_find_page(const void * p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_MEM_SLAB
+static const uint16_t slab_slot_sizes[LV_MEM_SLAB_CLASS_CNT] = {8, 16, 24, 32, 48, 64, 96, 128};
+
+static const uint16_t slab_capacities[LV_MEM_SLAB_CLASS_CNT] = {
+    SLAB_CAPACITY(8), SLAB_CAPACITY(16), SLAB_CAPACITY(24), SLAB_CAPACITY(32),
+    SLAB_CAPACITY(48), SLAB_CAPACITY(64), SLAB_CAPACITY(96), SLAB_CAPACITY(128)
+};
+
+/*Class of the sizes in 8 byte steps: [0] for 1..8 bytes, [1] for 9..16 bytes, etc*/
+static const uint8_t slab_class_of_size[SLAB_MAX_SIZE / 8] = {0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7};
+#endif
 
 /**********************
  *      MACROS
@@ -93,6 +119,10 @@ void lv_mem_init(void)
     LV_ASSERT_MALLOC(pool_p);
     *pool_p = lv_tlsf_get_pool(state.tlsf);
 
+#if LV_MEM_SLAB
+    slab_init();
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
 #endif
@@ -101,6 +131,14 @@ void lv_mem_init(void)
 void lv_mem_deinit(void)
 {
     lv_ll_clear(&state.pool_ll);
+#if LV_MEM_SLAB
+    /*The pages are in the first pool so they are freed with it*/
+    lv_memzero(state.slab_classes, sizeof(state.slab_classes));
+    state.slab_pages = NULL;
+    state.slab_mem = NULL;
+    state.slab_unused = NULL;
+    state.slab_page_cnt = 0;
+#endif
     lv_tlsf_destroy(state.tlsf);
 #if LV_USE_OS
     lv_mutex_delete(&state.mutex);
@@ -141,12 +179,7 @@ void * lv_malloc_core(size_t size)
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    void * p = lv_tlsf_malloc(state.tlsf, size);
-
-    if(p) {
-        state.cur_used += lv_tlsf_block_size(p);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
-    }
+    void * p = mem_alloc(size);
 
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -160,6 +193,55 @@ void * lv_realloc_core(void * p, size_t new_size)
     lv_mutex_lock(&state.mutex);
 #endif
 
+#if LV_MEM_SLAB
+    if(p == NULL) {
+        void * p_new = mem_alloc(new_size);
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return p_new;
+    }
+
+    lv_mem_slab_page_t * page = slab_find_page(p);
+    if(page) {
+        /*Keep the slot if the new size belongs to the same class, else move the data
+         *to have the same memory usage as if it were allocated with the new size*/
+        size_t slot_size = slab_slot_sizes[page->class_idx];
+        void * p_new = p;
+        if(new_size > SLAB_MAX_SIZE || slab_class_of_size[(new_size - 1) >> 3] != page->class_idx) {
+            p_new = mem_alloc(new_size);
+            if(p_new) {
+                lv_memcpy(p_new, p, LV_MIN(slot_size, new_size));
+                slab_free(page, p);
+            }
+            /*It's shrinking so the data still fits into the old slot*/
+            else if(new_size < slot_size) {
+                p_new = p;
+            }
+        }
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return p_new;
+    }
+
+    /*Move the data to a slot if it shrinks enough to always keep the small data in the slab area*/
+    if(new_size <= SLAB_MAX_SIZE) {
+        void * p_new = slab_malloc(new_size);
+        if(p_new) {
+            /*It can be a small block from before the slots ran out which is growing*/
+            size_t old_size = lv_tlsf_block_size(p);
+            lv_memcpy(p_new, p, LV_MIN(old_size, new_size));
+            lv_tlsf_free(state.tlsf, p);
+            state.cur_used -= old_size;
+#if LV_USE_OS
+            lv_mutex_unlock(&state.mutex);
+#endif
+            return p_new;
+        }
+    }
+#endif
+
     size_t old_size = lv_tlsf_block_size(p);
     void * p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
 
@@ -181,6 +263,20 @@ void lv_free_core(void * p)
     lv_mutex_lock(&state.mutex);
 #endif
 
+#if LV_MEM_SLAB
+    lv_mem_slab_page_t * page = slab_find_page(p);
+    if(page) {
+#if LV_MEM_ADD_JUNK
+        lv_memset(p, 0xbb, slab_slot_sizes[page->class_idx]);
+#endif
+        slab_free(page, p);
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return;
+    }
+#endif
+
 #if LV_MEM_ADD_JUNK
     lv_memset(p, 0xbb, lv_tlsf_block_size(data));
 #endif
@@ -200,12 +296,15 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     LV_TRACE_MEM("begin");
 
+#if LV_MEM_SLAB && LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+
     lv_pool_t * pool_p;
     LV_LL_READ(&state.pool_ll, pool_p) {
         lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
     }
 
-    mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
         mon_p->frag_pct = 100 - mon_p->frag_pct;
@@ -214,6 +313,30 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
         mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
     }
 
+#if LV_MEM_SLAB
+    /*Count the allocated slots as used blocks instead of the slab area, and the rest of the slab
+     *area as free memory. The fragmentation is about the memory outside of the slab area.*/
+    if(state.slab_pages) mon_p->used_cnt--;
+
+    mon_p->free_size += state.slab_page_cnt * SLAB_PAGE_SIZE;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        lv_mem_slab_class_t * c = &state.slab_classes[i];
+        lv_mem_slab_monitor_t * slab_mon = &mon_p->slab[i];
+        slab_mon->slot_size = slab_slot_sizes[i];
+        slab_mon->page_cnt = c->page_cnt;
+        slab_mon->used_cnt = c->used_cnt;
+        slab_mon->free_cnt = c->page_cnt * slab_capacities[i] - c->used_cnt;
+        mon_p->used_cnt += c->used_cnt;
+        mon_p->free_size -= c->used_cnt * slab_mon->slot_size;
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+#endif
+
+    mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
+
     mon_p->max_used = state.max_used;
 
     LV_TRACE_MEM("finished");
@@ -243,6 +366,23 @@ lv_result_t lv_mem_test_core(void)
         }
     }
 
+#if LV_MEM_SLAB
+    uint32_t i;
+    for(i = 0; i < state.slab_page_cnt; i++) {
+        lv_mem_slab_page_t * page = &state.slab_pages[i];
+        if(page->class_idx == SLAB_CLASS_NONE) continue;
+        if(page->class_idx >= LV_MEM_SLAB_CLASS_CNT ||
+           page->used_cnt > page->bump_cnt ||
+           page->bump_cnt > slab_capacities[page->class_idx]) {
+            LV_LOG_WARN("slab page failed");
+#if LV_USE_OS
+            lv_mutex_unlock(&state.mutex);
+#endif
+            return LV_RESULT_INVALID;
+        }
+    }
+#endif
+
     LV_TRACE_MEM("passed");
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -270,4 +410,166 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+
+/**
+ * Allocate memory from a slab page or from TLSF. The mutex needs to be locked.
+ * @param size      size in bytes
+ * @return          pointer to the allocated memory or NULL on failure
+ */
+static void * mem_alloc(size_t size)
+{
+#if LV_MEM_SLAB
+    if(size <= SLAB_MAX_SIZE) {
+        void * p = slab_malloc(size);
+        if(p) return p;
+        /*There is no space for a new page, but there might be for the data itself*/
+    }
+#endif
+
+    void * p = lv_tlsf_malloc(state.tlsf, size);
+
+    if(p) {
+        state.cur_used += lv_tlsf_block_size(p);
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    }
+
+    return p;
+}
+
+#if LV_MEM_SLAB
+
+/**
+ * Allocate the slab area from the beginning of the first pool and add all of its pages to the unused pages
+ */
+static void slab_init(void)
+{
+    uint32_t page_cnt = LV_MEM_SLAB_SIZE / SLAB_PAGE_SIZE;
+    size_t desc_size = ((page_cnt * sizeof(lv_mem_slab_page_t)) + ALIGN_MASK) & ~ALIGN_MASK;
+    uint8_t * buf = lv_tlsf_malloc(state.tlsf, desc_size + page_cnt * SLAB_PAGE_SIZE);
+    if(buf == NULL) {
+        LV_LOG_WARN("couldn't allocate the slab area");
+        return;
+    }
+
+    /*Only the descriptors are used, the pages are counted when a class gets them*/
+    state.cur_used += lv_tlsf_block_size(buf) - page_cnt * SLAB_PAGE_SIZE;
+    state.max_used = LV_MAX(state.cur_used, state.max_used);
+
+    state.slab_pages = (lv_mem_slab_page_t *)buf;
+    state.slab_mem = buf + desc_size;
+    state.slab_page_cnt = page_cnt;
+    state.slab_unused = NULL;
+
+    uint32_t i;
+    for(i = page_cnt; i > 0; i--) {
+        lv_mem_slab_page_t * page = &state.slab_pages[i - 1];
+        page->class_idx = SLAB_CLASS_NONE;
+        page->next = state.slab_unused;
+        state.slab_unused = page;
+    }
+}
+
+/**
+ * Allocate a slot for the given size
+ * @param size      size in bytes, 1..SLAB_MAX_SIZE
+ * @return          pointer to the slot or NULL if all pages are used
+ */
+static void * slab_malloc(size_t size)
+{
+    uint32_t class_idx = slab_class_of_size[(size - 1) >> 3];
+    lv_mem_slab_class_t * c = &state.slab_classes[class_idx];
+
+    lv_mem_slab_page_t * page = c->partial;
+    if(page == NULL) {
+        page = state.slab_unused;
+        if(page == NULL) return NULL;
+        state.slab_unused = page->next;
+
+        page->free_slots = NULL;
+        page->used_cnt = 0;
+        page->bump_cnt = 0;
+        page->class_idx = class_idx;
+        page->prev = NULL;
+        page->next = NULL;
+        c->partial = page;
+        c->page_cnt++;
+
+        state.cur_used += SLAB_PAGE_SIZE;
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    }
+
+    void * p;
+    if(page->free_slots) {
+        p = page->free_slots;
+        page->free_slots = *(void **)p;
+    }
+    else {
+        p = state.slab_mem + (page - state.slab_pages) * SLAB_PAGE_SIZE + page->bump_cnt * slab_slot_sizes[class_idx];
+        page->bump_cnt++;
+    }
+    page->used_cnt++;
+    c->used_cnt++;
+
+    /*Full pages are not on the list of the class*/
+    if(page->free_slots == NULL && page->bump_cnt == slab_capacities[class_idx]) {
+        c->partial = page->next;
+        if(page->next) page->next->prev = NULL;
+        page->next = NULL;
+    }
+
+    return p;
+}
+
+/**
+ * Free a slot
+ * @param page      the page of the slot
+ * @param p         pointer to the slot
+ */
+static void slab_free(lv_mem_slab_page_t * page, void * p)
+{
+    lv_mem_slab_class_t * c = &state.slab_classes[page->class_idx];
+
+    /*A full page gets a free slot so add it to the list of the class*/
+    if(page->free_slots == NULL && page->bump_cnt == slab_capacities[page->class_idx]) {
+        page->prev = NULL;
+        page->next = c->partial;
+        if(c->partial) c->partial->prev = page;
+        c->partial = page;
+    }
+
+    *(void **)p = page->free_slots;
+    page->free_slots = p;
+    page->used_cnt--;
+    c->used_cnt--;
+
+    /*Give back the empty page so that any class can use it*/
+    if(page->used_cnt == 0) {
+        if(page->prev) page->prev->next = page->next;
+        else c->partial = page->next;
+        if(page->next) page->next->prev = page->prev;
+        c->page_cnt--;
+
+        page->class_idx = SLAB_CLASS_NONE;
+        page->next = state.slab_unused;
+        state.slab_unused = page;
+
+        state.cur_used -= SLAB_PAGE_SIZE;
+    }
+}
+
+/**
+ * Find the slab page of a pointer
+ * @param p     pointer to an allocated memory
+ * @return      the page containing `p` or NULL if `p` was allocated from TLSF
+ */
+static lv_mem_slab_page_t * slab_find_page(const void * p)
+{
+    const uint8_t * p8 = p;
+    if(p8 < state.slab_mem || p8 >= state.slab_mem + state.slab_page_cnt * SLAB_PAGE_SIZE) return NULL;
+
+    return &state.slab_pages[(p8 - state.slab_mem) / SLAB_PAGE_SIZE];
+}
+
+#endif /*LV_MEM_SLAB*/
+
 #endif /*LV_STDLIB_BUILTIN*/
@@ -17,6 +17,7 @@ extern "C" {
  *********************/
 
 #include "lv_tlsf.h"
+#include "../lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -26,6 +27,25 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_MEM_SLAB
+/** Descriptor of a page of same sized slots of the slab allocator*/
+typedef struct lv_mem_slab_page_t {
+    struct lv_mem_slab_page_t * next;   /**< Next page of the class with free slots or next unused page*/
+    struct lv_mem_slab_page_t * prev;   /**< Previous page of the class with free slots*/
+    void * free_slots;                  /**< The freed slots linked through their first word*/
+    uint16_t used_cnt;                  /**< Number of allocated slots*/
+    uint16_t bump_cnt;                  /**< The slots from this index were never allocated*/
+    uint8_t class_idx;                  /**< Index of the slot size or 0xFF if the page is unused*/
+} lv_mem_slab_page_t;
+
+/** The pages of a slot size of the slab allocator*/
+typedef struct {
+    lv_mem_slab_page_t * partial;       /**< Pages with free slots, allocations are served from the first*/
+    uint32_t page_cnt;
+    uint32_t used_cnt;
+} lv_mem_slab_class_t;
+#endif
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
@@ -34,6 +54,13 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_MEM_SLAB
+    lv_mem_slab_class_t slab_classes[LV_MEM_SLAB_CLASS_CNT];
+    lv_mem_slab_page_t * slab_pages;    /**< Descriptors of the pages*/
+    uint8_t * slab_mem;                 /**< The pages, `LV_MEM_SLAB_SIZE` bytes in the first pool*/
+    lv_mem_slab_page_t * slab_unused;   /**< Pages not used by any class*/
+    uint32_t slab_page_cnt;
+#endif
 } lv_tlsf_state_t;
 
 /**********************
@@ -23,12 +23,29 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_SLAB
+/** Number of slot sizes of the slab allocator: 8, 16, 24, 32, 48, 64, 96 and 128 bytes */
+#define LV_MEM_SLAB_CLASS_CNT   8
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
 typedef void * lv_mem_pool_t;
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_SLAB
+/**
+ * Usage of the slots of one size of the slab allocator.
+ */
+typedef struct {
+    uint32_t slot_size; /**< Size of the slots in bytes */
+    uint32_t page_cnt;  /**< Number of pages allocated for this size */
+    uint32_t used_cnt;  /**< Number of allocated slots */
+    uint32_t free_cnt;  /**< Number of free slots in the pages */
+} lv_mem_slab_monitor_t;
+#endif
+
 /**
  * Heap information structure.
  */
@@ -41,6 +58,9 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_SLAB
+    lv_mem_slab_monitor_t slab[LV_MEM_SLAB_CLASS_CNT];  /**< The free slots are counted in `free_size` too */
+#endif
 } lv_mem_monitor_t;
 
 /**********************
@@ -22,6 +22,7 @@
 #include "../../misc/lv_bidi_private.h"
 #include "../../misc/lv_text_ap.h"
 #include "../../misc/lv_text_private.h"
+#include "../../misc/cache/lv_text_cache.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../../stdlib/lv_string.h"
 
@@ -58,6 +59,15 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
+static void get_text_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, int32_t letter_space,
+                          int32_t line_space, int32_t max_w, lv_text_flag_t flag, bool update);
+#if LV_LABEL_LINE_CACHE
+    static bool lines_match(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                            lv_text_flag_t flag);
+    static bool update_lines(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                             lv_text_flag_t flag);
+    static bool add_line_cb(const lv_text_line_t * line, void * user_data);
+#endif
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords);
 
@@ -699,6 +709,10 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->dot.tmp_ptr   = NULL;
     label->dot_tmp_alloc = 0;
 
+#if LV_LABEL_LINE_CACHE
+    lv_memzero(&label->lines, sizeof(label->lines));
+#endif
+
     lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
     lv_label_set_text(obj, LV_LABEL_DEFAULT_TEXT);
@@ -714,6 +728,11 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LINE_CACHE
+    lv_free(label->lines.lines);
+    label->lines.lines = NULL;
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -756,7 +775,7 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
 
             w = LV_MIN(w, lv_obj_get_style_max_width(obj, 0));
 
-            lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            get_text_size(obj, &label->size_cache, font, letter_space, line_space, w, flag, false);
             label->invalid_size_cache = false;
         }
 
@@ -793,6 +812,15 @@ static void draw_main(lv_event_t * e)
 
     label_draw_dsc.flag = flag;
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
+
+#if LV_LABEL_LINE_CACHE
+    if(update_lines(label, label_draw_dsc.font, label_draw_dsc.letter_space, lv_area_get_width(&txt_coords), flag)) {
+        label_draw_dsc.lines = label->lines.lines;
+        label_draw_dsc.line_cnt = label->lines.line_cnt;
+        label_draw_dsc.lines_text = label->text;
+        label_draw_dsc.lines_font = label_draw_dsc.font;
+    }
+#endif
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
 
     label_draw_dsc.sel_start = lv_label_get_text_selection_start(obj);
@@ -807,8 +835,8 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        lv_text_cache_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space,
+                               label_draw_dsc.line_space, LV_COORD_MAX, flag);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -840,8 +868,8 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        lv_text_cache_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space,
+                               label_draw_dsc.line_space, LV_COORD_MAX, flag);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -899,6 +927,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->text == NULL) return;
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
+#endif
+#if LV_LABEL_LINE_CACHE
+    label->lines.valid = 0;
 #endif
     label->invalid_size_cache = true;
 
@@ -913,7 +944,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_point_t size;
     lv_text_flag_t flag = get_label_flags(label);
 
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    get_text_size(obj, &size, font, letter_space, line_space, max_w, flag, true);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1165,6 +1196,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+#if LV_LABEL_LINE_CACHE
+                label->lines.valid = 0;
+#endif
             }
         }
     }
@@ -1197,6 +1231,9 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+#if LV_LABEL_LINE_CACHE
+    label->lines.valid = 0;
+#endif
 }
 
 /**
@@ -1313,6 +1350,121 @@ static lv_text_flag_t get_label_flags(lv_label_t * label)
     return flag;
 }
 
+/**
+ * Get the size of the label's text. Use the cached lines if the text was wrapped the same way.
+ * @param update    true: wrap the text and cache the lines if they are not cached yet
+ */
+static void get_text_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, int32_t letter_space,
+                          int32_t line_space, int32_t max_w, lv_text_flag_t flag, bool update)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+#if LV_LABEL_LINE_CACHE
+    bool cached = update ? update_lines(label, font, letter_space, max_w, flag) :
+                  lines_match(label, font, letter_space, max_w, flag);
+    if(cached) {
+        const lv_label_lines_t * lines = &label->lines;
+        int32_t line_height = lv_font_get_line_height(font);
+        size_res->x = lines->width;
+        size_res->y = (int32_t)lines->line_cnt * (line_height + line_space);
+
+        /*Make the text one line taller if the last character is '\n' or '\r' like `lv_text_get_size`*/
+        if(lines->line_cnt > 0) {
+            char last = label->text[lines->lines[lines->line_cnt - 1].end - 1];
+            if(last == '\n' || last == '\r') size_res->y += line_height + line_space;
+        }
+
+        if(size_res->y == 0) size_res->y = line_height;
+        else size_res->y -= line_space;
+        return;
+    }
+#else
+    LV_UNUSED(update);
+#endif
+
+    lv_text_cache_get_size(size_res, label->text, font, letter_space, line_space, max_w, flag);
+}
+
+#if LV_LABEL_LINE_CACHE
+
+static bool lines_match(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                        lv_text_flag_t flag)
+{
+    const lv_label_lines_t * lines = &label->lines;
+    if(flag & LV_TEXT_FLAG_EXPAND) max_w = LV_COORD_MAX;
+
+    return lines->valid && lines->font == font && lines->letter_space == letter_space &&
+           lines->max_width == max_w && lines->flag == flag;
+}
+
+/**
+ * Wrap the label's text and store the lines, unless it's already done with the same parameters
+ * @return      true: the lines are valid; false: out of memory
+ */
+static bool update_lines(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                         lv_text_flag_t flag)
+{
+    if(lines_match(label, font, letter_space, max_w, flag)) return true;
+
+    lv_label_lines_t * lines = &label->lines;
+    lines->valid = 0;
+    if(label->text == NULL || font == NULL) return false;
+
+    if(flag & LV_TEXT_FLAG_EXPAND) max_w = LV_COORD_MAX;
+
+    int32_t width;
+    lines->line_cnt = 0;
+    lv_text_get_lines(label->text, font, letter_space, max_w, flag, &width, add_line_cb, lines);
+
+    /*Out of memory if the last line doesn't end at the end of the text*/
+    uint32_t line_cnt = lines->line_cnt;
+    uint32_t text_end = line_cnt ? lines->lines[line_cnt - 1].end : 0;
+    if(label->text[text_end] != '\0') return false;
+
+    /*Don't keep a lot of memory if the text became much shorter*/
+    if(lines->line_buf_cnt > 4 && line_cnt < lines->line_buf_cnt / 4) {
+        uint32_t buf_cnt = LV_MAX(line_cnt, 4);
+        lv_text_line_t * buf = lv_realloc(lines->lines, buf_cnt * sizeof(lv_text_line_t));
+        if(buf) {
+            lines->lines = buf;
+            lines->line_buf_cnt = buf_cnt;
+        }
+    }
+
+    lines->width = width;
+    lines->font = font;
+    lines->letter_space = letter_space;
+    lines->max_width = max_w;
+    lines->flag = flag;
+    lines->valid = 1;
+
+    return true;
+}
+
+/**
+ * Store a line of the label's text in `lv_label_lines_t`
+ * @return      false: out of memory
+ */
+static bool add_line_cb(const lv_text_line_t * line, void * user_data)
+{
+    lv_label_lines_t * lines = user_data;
+    if(lines->line_cnt == lines->line_buf_cnt) {
+        uint32_t buf_cnt = LV_MAX(lines->line_buf_cnt * 2, 4);
+        lv_text_line_t * buf = lv_realloc(lines->lines, buf_cnt * sizeof(lv_text_line_t));
+        LV_ASSERT_MALLOC(buf);
+        if(buf == NULL) return false;
+
+        lines->lines = buf;
+        lines->line_buf_cnt = buf_cnt;
+    }
+
+    lines->lines[lines->line_cnt] = *line;
+    lines->line_cnt++;
+    return true;
+}
+
+#endif /*LV_LABEL_LINE_CACHE*/
+
 /* Function created because of this pattern be used in multiple functions */
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt, uint32_t length,
                                    const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords)
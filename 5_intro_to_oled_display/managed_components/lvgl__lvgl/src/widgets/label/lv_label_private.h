@@ -28,6 +28,21 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_LABEL_LINE_CACHE
+/** The wrapped lines of the label's text and the parameters they were wrapped with*/
+typedef struct {
+    lv_text_line_t * lines;
+    uint32_t line_cnt;
+    uint32_t line_buf_cnt;          /**< Number of lines `lines` has space for*/
+    int32_t width;                  /**< Width of the longest line*/
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_width;
+    lv_text_flag_t flag;
+    uint8_t valid : 1;              /**< 0: the text has changed, wrap it again*/
+} lv_label_lines_t;
+#endif
+
 struct lv_label_t {
     lv_obj_t obj;
     char * text;
@@ -46,6 +61,10 @@ struct lv_label_t {
     uint32_t sel_end;
 #endif
 
+#if LV_LABEL_LINE_CACHE
+    lv_label_lines_t lines;
+#endif
+
     lv_point_t size_cache;              /**< Text size cache */
     lv_point_t offset;                  /**< Text draw position offset */
     lv_label_long_mode_t long_mode : 3; /**< Determine what to do with the long texts */
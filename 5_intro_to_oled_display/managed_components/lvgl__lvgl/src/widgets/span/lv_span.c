@@ -15,6 +15,7 @@
 
 #include "../../misc/lv_assert.h"
 #include "../../misc/lv_text_private.h"
+#include "../../misc/cache/lv_text_cache.h"
 #include "../../core/lv_global.h"
 
 /*********************
@@ -411,6 +412,12 @@ uint32_t lv_spangroup_get_expand_width(lv_obj_t * obj, uint32_t max_width)
         uint32_t j = 0;
         const char * cur_txt = cur_span->txt;
         span_text_check(&cur_txt);
+        if(max_width == 0) {
+            /*The same as below: the sum of the letter widths and a letter space after each letter*/
+            width += lv_text_cache_get_width(cur_txt, font, 0) + lv_text_get_encoded_length(cur_txt) * letter_space;
+            continue;
+        }
+
         while(cur_txt[j] != '\0') {
             if(max_width > 0 && width >= max_width) {
                 return max_width;
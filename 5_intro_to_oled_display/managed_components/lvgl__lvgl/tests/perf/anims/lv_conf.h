@@ -0,0 +1,19 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the animation benchmark.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH              16
+
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+
+#define LV_USE_LOG                  0
+
+#define LV_ANIM_PATH_TABLES         1
+
+#endif /*LV_CONF_H*/
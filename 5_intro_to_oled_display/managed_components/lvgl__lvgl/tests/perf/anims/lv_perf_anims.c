@@ -0,0 +1,132 @@
+/**
+ * @file lv_perf_anims.c
+ * Measure the cost of one round of the animation timer with many running
+ * animations: with linear and cubic Bezier paths, with a mix of paths and while
+ * an animation is replaced in every round.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ANIM_CNT    1000
+
+/*`path` is the path of every animation or NULL to mix the paths*/
+#define ANIM_CASES(name, run_cb, path) \
+    {name, run_cb, 10, 0, start_anims, delete_anims, path}, \
+    {name, run_cb, 100, 0, start_anims, delete_anims, path}, \
+    {name, run_cb, ANIM_CNT, 0, start_anims, delete_anims, path}
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void start_anims(const lv_perf_case_t * perf_case);
+static void delete_anims(const lv_perf_case_t * perf_case);
+static void refr_round(const lv_perf_case_t * perf_case);
+static void churn(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+static void start_anim(const lv_perf_case_t * perf_case, uint32_t idx);
+static void exec_cb(void * var, int32_t v);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static int32_t values[ANIM_CNT];
+static uint32_t round_cnt;
+
+static const lv_anim_path_cb_t linear = lv_anim_path_linear;
+static const lv_anim_path_cb_t ease_in_out = lv_anim_path_ease_in_out;
+
+static const lv_perf_case_t cases[] = {
+    ANIM_CASES("linear", refr_round, &linear),
+    ANIM_CASES("ease_in_out", refr_round, &ease_in_out),
+    ANIM_CASES("mixed", refr_round, NULL),
+    ANIM_CASES("churn", churn, NULL),
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_perf_run("case,anims,ns_per_round,ns_per_anim", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void start_anims(const lv_perf_case_t * perf_case)
+{
+    uint32_t i;
+    for(i = 0; i < perf_case->cnt; i++) {
+        start_anim(perf_case, i);
+    }
+
+    round_cnt = 0;
+}
+
+static void delete_anims(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_anim_delete_all();
+}
+
+static void refr_round(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_tick_inc(1);
+    lv_anim_refr_now();
+}
+
+static void churn(const lv_perf_case_t * perf_case)
+{
+    /*Replace an animation in every round*/
+    uint32_t idx = (round_cnt * 7919) % perf_case->cnt;
+    lv_anim_delete(&values[idx], exec_cb);
+    start_anim(perf_case, idx);
+    round_cnt++;
+
+    lv_tick_inc(1);
+    lv_anim_refr_now();
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    printf("%s,%" LV_PRIu32 ",%.1f,%.2f\n", perf_case->name, perf_case->cnt, ns, ns / perf_case->cnt);
+}
+
+static void start_anim(const lv_perf_case_t * perf_case, uint32_t idx)
+{
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_linear, lv_anim_path_ease_in_out, lv_anim_path_ease_out, lv_anim_path_overshoot
+    };
+    const lv_anim_path_cb_t * path = perf_case->user_data;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &values[idx]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 1000);
+    lv_anim_set_duration(&a, 300 + (idx * 31) % 500);
+    lv_anim_set_playback_duration(&a, 300);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_set_path_cb(&a, path ? *path : paths[idx % 4]);
+    lv_anim_start(&a);
+}
+
+static void exec_cb(void * var, int32_t v)
+{
+    *(int32_t *)var = v;
+}
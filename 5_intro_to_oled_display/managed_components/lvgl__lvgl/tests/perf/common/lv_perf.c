@@ -0,0 +1,117 @@
+/**
+ * @file lv_perf.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "lv_perf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_perf_run(const char * header, const lv_perf_case_t * cases, uint32_t case_cnt,
+                 lv_perf_report_cb_t report_cb)
+{
+    printf("%s\n", header);
+
+    uint32_t i;
+    for(i = 0; i < case_cnt; i++) {
+        const lv_perf_case_t * perf_case = &cases[i];
+        if(perf_case->setup_cb) perf_case->setup_cb(perf_case);
+        report_cb(perf_case, lv_perf_measure(perf_case));
+        if(perf_case->teardown_cb) perf_case->teardown_cb(perf_case);
+    }
+}
+
+double lv_perf_measure(const lv_perf_case_t * perf_case)
+{
+    if(perf_case->repeat_cnt == 0) {
+        /*Warm up*/
+        perf_case->run_cb(perf_case);
+
+        uint32_t cnt = 0;
+        int64_t start = lv_perf_now_ns();
+        int64_t elapsed;
+        do {
+            perf_case->run_cb(perf_case);
+            cnt++;
+            elapsed = lv_perf_now_ns() - start;
+        } while(elapsed < LV_PERF_MIN_MEASURE_NS);
+
+        return (double)elapsed / cnt;
+    }
+
+    /*No warm up to do the same in every run*/
+    int64_t best = INT64_MAX;
+    uint32_t run;
+    for(run = 0; run < LV_PERF_RUN_CNT; run++) {
+        int64_t start = lv_perf_now_ns();
+        uint32_t i;
+        for(i = 0; i < perf_case->repeat_cnt; i++) {
+            perf_case->run_cb(perf_case);
+        }
+        int64_t elapsed = lv_perf_now_ns() - start;
+        if(elapsed < best) best = elapsed;
+    }
+
+    return (double)best / perf_case->repeat_cnt;
+}
+
+int64_t lv_perf_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+lv_display_t * lv_perf_display_create(int32_t hor_res, int32_t ver_res, uint32_t buf_lines)
+{
+    /*Not from the LVGL heap to not change what the harnesses measure on it*/
+    uint32_t buf_size = hor_res * buf_lines * LV_COLOR_DEPTH / 8;
+    uint8_t * buf = malloc(buf_size);
+    if(buf == NULL) {
+        printf("out of memory\n");
+        exit(1);
+    }
+
+    lv_display_t * disp = lv_display_create(hor_res, ver_res);
+    lv_display_set_buffers(disp, buf, NULL, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    return disp;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+
+    /*Measure only the rendering*/
+    lv_display_flush_ready(disp);
+}
@@ -0,0 +1,35 @@
+# Shared part of the CMakeLists.txt of the perf harnesses. Include it after `project()`:
+#
+#   include(${CMAKE_CURRENT_SOURCE_DIR}/../common/lv_perf.cmake)
+#
+# Each executable compiles LVGL with the `lv_conf.h` of the harness and the given
+# definitions, so different options can be compared in the same build directory.
+
+set(CMAKE_C_STANDARD 99)
+
+get_filename_component(LVGL_DIR ${CMAKE_CURRENT_LIST_DIR}/../../.. ABSOLUTE)
+set(LV_PERF_COMMON_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+file(GLOB_RECURSE LVGL_SOURCES ${LVGL_DIR}/src/*.c)
+
+# lv_perf_add_executable(<target> SOURCES <file>... [DEFINITIONS <def>...] [LIBRARIES <lib>...])
+function(lv_perf_add_executable target)
+    cmake_parse_arguments(ARG "" "" "SOURCES;DEFINITIONS;LIBRARIES" ${ARGN})
+    add_executable(${target} ${ARG_SOURCES} ${LV_PERF_COMMON_DIR}/lv_perf.c ${LVGL_SOURCES})
+    target_include_directories(${target} PRIVATE
+        ${CMAKE_CURRENT_SOURCE_DIR}
+        ${LV_PERF_COMMON_DIR}
+        ${LVGL_DIR}
+        ${LVGL_DIR}/..
+    )
+    target_compile_definitions(${target} PRIVATE LV_CONF_INCLUDE_SIMPLE ${ARG_DEFINITIONS})
+    target_compile_options(${target} PRIVATE -O2)
+    target_link_libraries(${target} PRIVATE ${ARG_LIBRARIES} m)
+endfunction()
+
+# Add `<target>` built with `<option>=<on_value>` and `<target>_off` with `<option>=<off_value>`.
+# The other arguments are passed to lv_perf_add_executable() but DEFINITIONS can't be used.
+function(lv_perf_add_on_off target option on_value off_value)
+    lv_perf_add_executable(${target} ${ARGN} DEFINITIONS ${option}=${on_value})
+    lv_perf_add_executable(${target}_off ${ARGN} DEFINITIONS ${option}=${off_value})
+endfunction()
@@ -0,0 +1,107 @@
+/**
+ * @file lv_perf.h
+ * Shared part of the perf harnesses: a table of cases measured one after the
+ * other, the timing loop and a headless display.
+ */
+
+#ifndef LV_PERF_H
+#define LV_PERF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include "lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Repeat a case at least for this long to get a stable average*/
+#ifndef LV_PERF_MIN_MEASURE_NS
+    #define LV_PERF_MIN_MEASURE_NS  (200 * 1000 * 1000LL)
+#endif
+
+/*Number of runs of the cases with a fixed repeat count. The best of the runs is used.*/
+#ifndef LV_PERF_RUN_CNT
+    #define LV_PERF_RUN_CNT         5
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_perf_case_t lv_perf_case_t;
+
+typedef void (*lv_perf_case_cb_t)(const lv_perf_case_t * perf_case);
+
+/**
+ * Print the CSV row of a case.
+ * `ns` is the time of one `run_cb` call.
+ */
+typedef void (*lv_perf_report_cb_t)(const lv_perf_case_t * perf_case, double ns);
+
+struct _lv_perf_case_t {
+    const char * name;
+    lv_perf_case_cb_t run_cb;           /**< The measured operation*/
+    uint32_t cnt;                       /**< A parameter of the case, e.g. the number of timers*/
+
+    /**
+     * 0: call `run_cb` once to warm up, then for at least `LV_PERF_MIN_MEASURE_NS`.
+     * Else call it this many times in each of `LV_PERF_RUN_CNT` runs and use the best run.
+     */
+    uint32_t repeat_cnt;
+    lv_perf_case_cb_t setup_cb;         /**< Called before measuring, can be NULL*/
+    lv_perf_case_cb_t teardown_cb;      /**< Called after the row is printed, can be NULL*/
+    const void * user_data;
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Print a CSV header and measure the cases one after the other.
+ * @param header        the header line without `\n`
+ * @param cases         array of the cases
+ * @param case_cnt      number of cases
+ * @param report_cb     prints the row of each case
+ */
+void lv_perf_run(const char * header, const lv_perf_case_t * cases, uint32_t case_cnt,
+                 lv_perf_report_cb_t report_cb);
+
+/**
+ * Measure a case without calling its setup and teardown callbacks.
+ * @param perf_case     the case to measure
+ * @return              the time of one `run_cb` call in nanoseconds
+ */
+double lv_perf_measure(const lv_perf_case_t * perf_case);
+
+/**
+ * Get the monotonic time.
+ * @return              the time in nanoseconds
+ */
+int64_t lv_perf_now_ns(void);
+
+/**
+ * Create a display which renders into a partial buffer and drops the rendered areas,
+ * so that only the rendering is measured.
+ * @param hor_res       horizontal resolution
+ * @param ver_res       vertical resolution
+ * @param buf_lines     number of lines in the draw buffer
+ * @return              the created display
+ */
+lv_display_t * lv_perf_display_create(int32_t hor_res, int32_t ver_res, uint32_t buf_lines);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PERF_H*/
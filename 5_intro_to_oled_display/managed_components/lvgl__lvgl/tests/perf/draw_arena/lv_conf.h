@@ -0,0 +1,19 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the draw task arena benchmark.
+ * `LV_DRAW_TASK_ARENA_SIZE` is set by CMakeLists.txt for each executable.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH              16
+
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+#define LV_MEM_SIZE                 (512 * 1024U)
+
+#define LV_USE_LOG                  0
+
+#endif /*LV_CONF_H*/
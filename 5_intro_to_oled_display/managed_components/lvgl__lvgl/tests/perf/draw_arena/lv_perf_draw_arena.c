@@ -0,0 +1,152 @@
+/**
+ * @file lv_perf_draw_arena.c
+ * Measure the cost of creating and deleting draw tasks without rendering them
+ * for a growing number of table cells (background, border and text each), and
+ * the time of refreshing a screen of buttons. After the refreshes the
+ * fragmentation of the heap is printed too.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+#include "src/lvgl_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES     800
+#define VER_RES     480
+#define CELL_W      50
+#define CELL_H      20
+#define BUTTON_CNT  48
+
+/*Number of created tasks or refreshes in a run*/
+#define TASK_CNT        (1000 * 1000)
+#define REFRESH_CNT     200
+
+/*Each cell has 3 tasks*/
+#define CELLS(cnt) {"tasks", frame, cnt, TASK_CNT / (cnt * 3), init_layer}
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void init_layer(const lv_perf_case_t * perf_case);
+static void frame(const lv_perf_case_t * perf_case);
+static void refresh(const lv_perf_case_t * perf_case);
+static void report_tasks(const lv_perf_case_t * perf_case, double ns);
+static void report_refresh(const lv_perf_case_t * perf_case, double ns);
+static void add_cell(uint32_t idx);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Not added to a display, so the tasks are deleted only when they are set ready*/
+static lv_layer_t layer;
+
+static const lv_perf_case_t task_cases[] = {
+    CELLS(4), CELLS(16), CELLS(64), CELLS(256)
+};
+
+static const lv_perf_case_t refresh_cases[] = {
+    {"refresh", refresh, 0, REFRESH_CNT},
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_perf_run("case,tasks_per_frame,ns_per_task", task_cases, sizeof(task_cases) / sizeof(task_cases[0]),
+                report_tasks);
+
+    lv_perf_display_create(HOR_RES, VER_RES, 40);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < BUTTON_CNT; i++) {
+        lv_obj_t * btn = lv_button_create(scr);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %" LV_PRIu32, i);
+    }
+
+    printf("\n");
+    lv_perf_run("case,us_per_refresh,used_pct,frag_pct", refresh_cases,
+                sizeof(refresh_cases) / sizeof(refresh_cases[0]), report_refresh);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void init_layer(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_memzero(&layer, sizeof(layer));
+    lv_area_set(&layer.buf_area, 0, 0, HOR_RES - 1, VER_RES - 1);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+    layer.color_format = LV_COLOR_FORMAT_RGB565;
+}
+
+/**
+ * Add the cells and delete their tasks as if they were drawn
+ */
+static void frame(const lv_perf_case_t * perf_case)
+{
+    uint32_t c;
+    for(c = 0; c < perf_case->cnt; c++) add_cell(c);
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_READY;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+static void refresh(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+static void report_tasks(const lv_perf_case_t * perf_case, double ns)
+{
+    printf("%s,%" LV_PRIu32 ",%.1f\n", perf_case->name, perf_case->cnt * 3, ns / (perf_case->cnt * 3));
+}
+
+static void report_refresh(const lv_perf_case_t * perf_case, double ns)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("%s,%.1f,%d,%d\n", perf_case->name, ns / 1000, mon.used_pct, mon.frag_pct);
+}
+
+static void add_cell(uint32_t idx)
+{
+    lv_area_t a;
+    a.x1 = (idx % (HOR_RES / CELL_W)) * CELL_W;
+    a.y1 = (idx / (HOR_RES / CELL_W)) * CELL_H;
+    a.x2 = a.x1 + CELL_W - 1;
+    a.y2 = a.y1 + CELL_H - 1;
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.border_width = 1;
+    lv_draw_rect(&layer, &rect_dsc, &a);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.text = "Cell";
+    lv_draw_label(&layer, &label_dsc, &a);
+}
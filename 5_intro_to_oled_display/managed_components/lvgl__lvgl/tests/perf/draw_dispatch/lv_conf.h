@@ -0,0 +1,17 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the draw dispatch benchmark.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH              16
+
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+
+#define LV_USE_LOG                  0
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,122 @@
+/**
+ * @file lv_perf_draw_dispatch.c
+ * Measure how long it takes to find every available draw task of a layer
+ * as the number of draw tasks grows. The layer looks like a dense table:
+ * each cell has a background and a smaller rectangle on it.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "lv_perf.h"
+#include "src/lvgl_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES     800
+#define VER_RES     480
+#define CELL_SIZE   16
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void create_cells(const lv_perf_case_t * perf_case);
+static void scan(const lv_perf_case_t * perf_case);
+static void delete_cells(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+static void add_rect(int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Not added to a display, so the tasks stay queued*/
+static lv_layer_t layer;
+
+#define CELLS(cnt) {"scan", scan, cnt, 0, create_cells, delete_cells}
+static const lv_perf_case_t cases[] = {
+    CELLS(16), CELLS(32), CELLS(64), CELLS(128), CELLS(256), CELLS(512), CELLS(1024), CELLS(1500)
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_perf_run("tasks,scan_us,ns_per_task,indexed", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void create_cells(const lv_perf_case_t * perf_case)
+{
+    lv_memzero(&layer, sizeof(layer));
+    lv_area_set(&layer.buf_area, 0, 0, HOR_RES - 1, VER_RES - 1);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+    layer.color_format = LV_COLOR_FORMAT_RGB565;
+
+    uint32_t c;
+    for(c = 0; c < perf_case->cnt; c++) {
+        int32_t x = (c % (HOR_RES / CELL_SIZE)) * CELL_SIZE;
+        int32_t y = (c / (HOR_RES / CELL_SIZE)) * CELL_SIZE;
+        add_rect(x, y, x + CELL_SIZE - 1, y + CELL_SIZE - 1);
+        add_rect(x + 4, y + 4, x + CELL_SIZE - 5, y + CELL_SIZE - 5);
+    }
+}
+
+/**
+ * Find all the available tasks as a draw unit would do
+ */
+static void scan(const lv_perf_case_t * perf_case)
+{
+    uint8_t unit_id = layer.draw_task_head->preferred_draw_unit_id;
+    uint32_t cnt = 0;
+    lv_draw_task_t * t = lv_draw_get_next_available_task(&layer, NULL, unit_id);
+    while(t) {
+        cnt++;
+        t = lv_draw_get_next_available_task(&layer, t, unit_id);
+    }
+
+    /*Only the backgrounds are available*/
+    if(cnt != perf_case->cnt) {
+        printf("Wrong number of available tasks\n");
+        exit(1);
+    }
+}
+
+static void delete_cells(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_READY;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    uint32_t task_cnt = perf_case->cnt * 2;
+    printf("%" LV_PRIu32 ",%.1f,%.1f,%s\n", task_cnt, ns / 1000, ns / task_cnt, layer._task_index ? "yes" : "no");
+}
+
+static void add_rect(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    lv_area_t a = {x1, y1, x2, y2};
+    lv_draw_rect(&layer, &dsc, &a);
+}
@@ -0,0 +1,38 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the draw unit benchmark.
+ * `LV_DRAW_SW_DRAW_UNIT_CNT` is set by CMakeLists.txt for each executable.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/*Same color depth as the SPI panels of the ESP-IDF examples*/
+#define LV_COLOR_DEPTH              16
+
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+
+#define LV_USE_OS                   LV_OS_PTHREAD
+#define LV_DRAW_THREAD_STACK_SIZE   (64 * 1024)
+#define LV_DRAW_SW_PIN_UNITS_TO_CORES   1
+
+/*Refresh as fast as possible, so the FPS shows the rendering speed*/
+#define LV_DEF_REFR_PERIOD          1
+
+#define LV_USE_LOG                  0
+
+#define LV_USE_SYSMON               1
+#define LV_USE_PERF_MONITOR         1
+
+#define LV_FONT_MONTSERRAT_14       1
+#define LV_FONT_MONTSERRAT_16       1
+#define LV_FONT_MONTSERRAT_20       1
+#define LV_FONT_MONTSERRAT_24       1
+#define LV_FONT_MONTSERRAT_26       1
+
+#define LV_USE_DEMO_WIDGETS         1
+#define LV_USE_DEMO_BENCHMARK       1
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,84 @@
+/**
+ * @file lv_perf_draw_units.c
+ * Run the scenes of `lv_demo_benchmark` on a headless display and print the
+ * results as CSV. Each executable is built with a different number of SW draw units.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <unistd.h>
+#include "lv_perf.h"
+#include "demos/lv_demos.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef LV_PERF_HOR_RES
+    #define LV_PERF_HOR_RES     800
+#endif
+
+#ifndef LV_PERF_VER_RES
+    #define LV_PERF_VER_RES     480
+#endif
+
+/*Partial rendering into a tenth of the screen, as the ESP-IDF ports do*/
+#ifndef LV_PERF_BUF_LINES
+    #define LV_PERF_BUF_LINES   (LV_PERF_VER_RES / 10)
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t tick_get_cb(void);
+static void end_cb(const lv_demo_benchmark_result_t * results, uint32_t result_cnt);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static volatile bool finished;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+    lv_tick_set_cb(tick_get_cb);
+
+    lv_perf_display_create(LV_PERF_HOR_RES, LV_PERF_VER_RES, LV_PERF_BUF_LINES);
+
+    lv_demo_benchmark_set_end_cb(end_cb);
+    lv_demo_benchmark();
+
+    while(!finished) {
+        uint32_t idle_ms = lv_timer_handler();
+        if(idle_ms != LV_NO_TIMER_READY && idle_ms > 0) usleep(idle_ms * 1000);
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t tick_get_cb(void)
+{
+    return (uint32_t)(lv_perf_now_ns() / 1000000);
+}
+
+static void end_cb(const lv_demo_benchmark_result_t * results, uint32_t result_cnt)
+{
+    uint32_t i;
+    printf("draw_units,scene,fps,render_ms,cpu\n");
+    for(i = 0; i < result_cnt; i++) {
+        if(!results[i].valid) continue;
+        printf("%d,%s,%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32 "\n", LV_DRAW_SW_DRAW_UNIT_CNT, results[i].name,
+               results[i].fps_avg, results[i].render_avg_time, results[i].cpu_avg_usage);
+    }
+
+    finished = true;
+}
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+"""
+Run every lv_perf_draw_units_<N> executable of a build directory one after
+the other and print the FPS of each benchmark scene with the speedup over
+the smallest number of draw units.
+"""
+
+import argparse
+import csv
+import io
+import os
+import re
+import subprocess
+import sys
+
+
+def run(executable):
+    '''Run one benchmark and return {scene: fps}.'''
+    print(f'Running {os.path.basename(executable)}...', file=sys.stderr)
+    out = subprocess.run([executable], check=True, capture_output=True, text=True).stdout
+    rows = csv.DictReader(io.StringIO(out[out.index('draw_units,'):]))
+    return {row['scene']: int(row['fps']) for row in rows}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('build_dir', help='CMake build directory of tests/perf/draw_units')
+    args = parser.parse_args()
+
+    executables = {}
+    for name in os.listdir(args.build_dir):
+        match = re.fullmatch(r'lv_perf_draw_units_(\d+)', name)
+        if match:
+            executables[int(match.group(1))] = os.path.join(args.build_dir, name)
+    if not executables:
+        sys.exit(f'No lv_perf_draw_units_<N> executable in {args.build_dir}')
+
+    unit_cnts = sorted(executables)
+    fps = {n: run(executables[n]) for n in unit_cnts}
+    base = fps[unit_cnts[0]]
+
+    print(f'CPU cores: {os.cpu_count()}')
+    header = ['Scene'] + [f'{n} unit{"s" if n > 1 else ""}' for n in unit_cnts]
+    print(' | '.join(header))
+    print(' | '.join(['---'] * len(header)))
+    for scene in base:
+        cells = [scene]
+        for n in unit_cnts:
+            value = fps[n].get(scene)
+            if value is None:
+                cells.append('N/A')
+            elif n == unit_cnts[0] or not base[scene]:
+                cells.append(f'{value} FPS')
+            else:
+                cells.append(f'{value} FPS ({value / base[scene]:.2f}x)')
+        print(' | '.join(cells))
+
+
+if __name__ == '__main__':
+    main()
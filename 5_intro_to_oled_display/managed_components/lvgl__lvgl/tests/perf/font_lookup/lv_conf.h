@@ -0,0 +1,22 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the font lookup benchmark.
+ * `LV_FONT_FMT_TXT_LOOKUP_CNT` is set by CMakeLists.txt for each executable.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH              16
+
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+
+#define LV_USE_LOG                  0
+
+#define LV_FONT_MONTSERRAT_14       1
+#define LV_FONT_SIMSUN_16_CJK       1
+#define LV_FONT_DEJAVU_16_PERSIAN_HEBREW    1
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,114 @@
+/**
+ * @file lv_perf_font_lookup.c
+ * Measure the cost of finding the glyphs of the characters:
+ * getting the size of long texts with a CJK, a Persian/Hebrew
+ * and an ASCII font.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+#include "src/lvgl_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEXT_LEN    1000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const lv_font_t * font;
+    uint32_t first;
+    uint32_t last;
+    char txt[TEXT_LEN * 4 + 1];     /*Max. 4 bytes per character in UTF-8*/
+} text_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void create_text(const lv_perf_case_t * perf_case);
+static void get_size(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static text_t cjk = {&lv_font_simsun_16_cjk, 0x4e00, 0x9fff};
+static text_t persian_hebrew = {&lv_font_dejavu_16_persian_hebrew, 0x5d0, 0xfeff};
+static text_t ascii = {&lv_font_montserrat_14, 0x20, 0x7e};
+static volatile int32_t sink;
+
+static const lv_perf_case_t cases[] = {
+    {"cjk", get_size, 0, 0, create_text, NULL, &cjk},
+    {"persian_hebrew", get_size, 0, 0, create_text, NULL, &persian_hebrew},
+    {"ascii", get_size, 0, 0, create_text, NULL, &ascii},
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_perf_run("case,us,lookup_cnt", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Write TEXT_LEN characters of the font to the text in UTF-8, spread over its range
+ */
+static void create_text(const lv_perf_case_t * perf_case)
+{
+    text_t * text = (text_t *)perf_case->user_data;
+    char * txt = text->txt;
+    uint32_t len = 0;
+    uint32_t letter = text->first;
+    while(len < TEXT_LEN) {
+        lv_font_glyph_dsc_t g;
+        if(lv_font_get_glyph_dsc(text->font, &g, letter, 0)) {
+            if(letter < 0x80) {
+                *txt++ = (char)letter;
+            }
+            else if(letter < 0x800) {
+                *txt++ = (char)(0xC0 | (letter >> 6));
+                *txt++ = (char)(0x80 | (letter & 0x3F));
+            }
+            else {
+                *txt++ = (char)(0xE0 | (letter >> 12));
+                *txt++ = (char)(0x80 | ((letter >> 6) & 0x3F));
+                *txt++ = (char)(0x80 | (letter & 0x3F));
+            }
+            len++;
+        }
+
+        /*Jump around in the range to not read only the neighboring glyphs*/
+        letter += 37;
+        if(letter > text->last) letter = text->first + (letter - text->last) % 37;
+    }
+    *txt = '\0';
+}
+
+static void get_size(const lv_perf_case_t * perf_case)
+{
+    const text_t * text = perf_case->user_data;
+    lv_point_t size;
+    lv_text_get_size(&size, text->txt, text->font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    sink += size.x;
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    printf("%s,%.1f,%d\n", perf_case->name, ns / 1000, LV_FONT_FMT_TXT_LOOKUP_CNT);
+}
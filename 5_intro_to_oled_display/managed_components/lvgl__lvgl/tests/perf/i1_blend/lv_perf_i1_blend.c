@@ -0,0 +1,261 @@
+/**
+ * @file lv_perf_i1_blend.c
+ * Measure the throughput of the I1 blend kernels on monochrome display sized
+ * areas: opaque fills, fills through an anti-aliased mask and copies of I1 images,
+ * and the same done pixel by pixel as the kernels did earlier.
+ * The vertical gradient, the L8 image and the Floyd-Steinberg conversion show
+ * the cost of dithering when built with `LV_DRAW_SW_I1_DITHER`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+#include "src/lvgl_private.h"
+#include "src/draw/sw/blend/lv_draw_sw_blend_to_i1.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MAX_W       256
+#define MAX_H       128
+#define STRIDE      (MAX_W / 8 + 1)
+
+/*Every blend on an area*/
+#define AREA_CASES(area) \
+    {"fill", fill, 0, 0, set_area, NULL, &area}, \
+    {"fill_per_px", fill_ref, 0, 0, set_area, NULL, &area}, \
+    {"mask_fill", mask_fill, 0, 0, set_area, NULL, &area}, \
+    {"mask_fill_per_px", mask_fill_ref, 0, 0, set_area, NULL, &area}, \
+    {"blit", blit, 0, 0, set_area, NULL, &area}, \
+    {"blit_per_px", blit_ref, 0, 0, set_area, NULL, &area}, \
+    {"gradient", gradient, 0, 0, set_area, NULL, &area}, \
+    {"l8_blit", l8_blit, 0, 0, set_area, NULL, &area}
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    int32_t w;
+    int32_t h;
+    int32_t x;
+} blend_area_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void set_area(const lv_perf_case_t * perf_case);
+static void fill(const lv_perf_case_t * perf_case);
+static void fill_ref(const lv_perf_case_t * perf_case);
+static void mask_fill(const lv_perf_case_t * perf_case);
+static void mask_fill_ref(const lv_perf_case_t * perf_case);
+static void blit(const lv_perf_case_t * perf_case);
+static void blit_ref(const lv_perf_case_t * perf_case);
+static void gradient(const lv_perf_case_t * perf_case);
+static void l8_blit(const lv_perf_case_t * perf_case);
+static void fs_dither(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+static void init_fill_dsc(lv_draw_sw_blend_fill_dsc_t * dsc, const lv_opa_t * mask_buf);
+static void init_image_dsc(lv_draw_sw_blend_image_dsc_t * dsc);
+static void write_bit(uint8_t * buf, int32_t bit_idx, uint8_t value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t dest[STRIDE * MAX_H];
+static uint8_t src[STRIDE * MAX_H];
+static uint8_t src_l8[MAX_W * MAX_H];
+static lv_opa_t mask[MAX_W * MAX_H];
+static int32_t area_w;
+static int32_t area_h;
+static int32_t area_x;
+
+/*Byte aligned and not aligned areas*/
+static const blend_area_t small = {128, 64, 0};
+static const blend_area_t small_unaligned = {128, 64, 3};
+static const blend_area_t large = {256, 128, 0};
+static const blend_area_t large_unaligned = {256, 128, 3};
+
+static const lv_perf_case_t cases[] = {
+    AREA_CASES(small),
+    AREA_CASES(small_unaligned),
+    {"fs_dither", fs_dither, 0, 0, set_area, NULL, &small},
+    AREA_CASES(large),
+    AREA_CASES(large_unaligned),
+    {"fs_dither", fs_dither, 0, 0, set_area, NULL, &large},
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < sizeof(src); i++) src[i] = (uint8_t)(i * 37);
+    for(i = 0; i < sizeof(src_l8); i++) src_l8[i] = (uint8_t)((i % MAX_W) + (i / MAX_W));
+
+    /*Like a large anti-aliased glyph: mostly transparent or covered with a few edge pixels*/
+    for(i = 0; i < sizeof(mask); i++) {
+        uint32_t x = i % MAX_W;
+        uint32_t r = (x + i / MAX_W) % 32;
+        mask[i] = r < 12 ? LV_OPA_TRANSP : r < 14 ? (lv_opa_t)(r * 18) : LV_OPA_COVER;
+    }
+
+    lv_perf_run("case,w,h,x,us,mpx_per_s,dither", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void set_area(const lv_perf_case_t * perf_case)
+{
+    const blend_area_t * area = perf_case->user_data;
+    area_w = area->w;
+    area_h = area->h;
+    area_x = area->x;
+}
+
+static void fill(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    init_fill_dsc(&dsc, NULL);
+    lv_draw_sw_blend_color_to_i1(&dsc);
+}
+
+static void fill_ref(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    int32_t x, y;
+    for(y = 0; y < area_h; y++) {
+        for(x = 0; x < area_w; x++) write_bit(&dest[y * STRIDE], area_x + x, 1);
+    }
+}
+
+static void mask_fill(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    init_fill_dsc(&dsc, mask);
+    lv_draw_sw_blend_color_to_i1(&dsc);
+}
+
+static void mask_fill_ref(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    int32_t x, y;
+    for(y = 0; y < area_h; y++) {
+        const lv_opa_t * mask_row = &mask[y * MAX_W];
+        for(x = 0; x < area_w; x++) {
+            if(mask_row[x] == LV_OPA_TRANSP) continue;
+            uint8_t * byte = &dest[y * STRIDE + (area_x + x) / 8];
+            uint8_t cur = (*byte >> (7 - (area_x + x) % 8)) & 1;
+            uint8_t new_bit = mask_row[x] == LV_OPA_COVER ? 1 : (mask_row[x] + (255 - mask_row[x]) * cur) / 255;
+            write_bit(&dest[y * STRIDE], area_x + x, new_bit);
+        }
+    }
+}
+
+static void blit(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_draw_sw_blend_image_dsc_t dsc;
+    init_image_dsc(&dsc);
+    lv_draw_sw_blend_image_to_i1(&dsc);
+}
+
+static void blit_ref(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    int32_t x, y;
+    for(y = 0; y < area_h; y++) {
+        const uint8_t * src_row = &src[y * STRIDE];
+        for(x = 0; x < area_w; x++) {
+            write_bit(&dest[y * STRIDE], area_x + x, (src_row[x / 8] >> (7 - x % 8)) & 1);
+        }
+    }
+}
+
+/*Like a vertical gradient: an opaque fill with a different color in each row*/
+static void gradient(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    int32_t y;
+    for(y = 0; y < area_h; y++) {
+        lv_draw_sw_blend_fill_dsc_t dsc;
+        init_fill_dsc(&dsc, NULL);
+        dsc.dest_buf = &dest[y * STRIDE];
+        dsc.dest_h = 1;
+        dsc.color = lv_color_make((uint8_t)(y * 255 / area_h), (uint8_t)(y * 255 / area_h), (uint8_t)(y * 255 / area_h));
+        lv_area_set(&dsc.relative_area, area_x, y, area_x + area_w - 1, y);
+        lv_draw_sw_blend_color_to_i1(&dsc);
+    }
+}
+
+static void l8_blit(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_draw_sw_blend_image_dsc_t dsc;
+    init_image_dsc(&dsc);
+    dsc.src_buf = src_l8;
+    dsc.src_stride = MAX_W;
+    dsc.src_color_format = LV_COLOR_FORMAT_L8;
+    lv_draw_sw_blend_image_to_i1(&dsc);
+}
+
+static void fs_dither(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_draw_sw_i1_dither(src_l8, dest, area_w, area_h, MAX_W, STRIDE, LV_COLOR_FORMAT_L8);
+}
+
+static void init_fill_dsc(lv_draw_sw_blend_fill_dsc_t * dsc, const lv_opa_t * mask_buf)
+{
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest;
+    dsc->dest_w = area_w;
+    dsc->dest_h = area_h;
+    dsc->dest_stride = STRIDE;
+    dsc->color = lv_color_white();
+    dsc->opa = LV_OPA_COVER;
+    dsc->mask_buf = mask_buf;
+    dsc->mask_stride = MAX_W;
+    dsc->mask_color_format = LV_COLOR_FORMAT_A8;
+    lv_area_set(&dsc->relative_area, area_x, 0, area_x + area_w - 1, area_h - 1);
+}
+
+static void init_image_dsc(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest;
+    dsc->dest_w = area_w;
+    dsc->dest_h = area_h;
+    dsc->dest_stride = STRIDE;
+    dsc->src_buf = src;
+    dsc->src_stride = STRIDE;
+    dsc->src_color_format = LV_COLOR_FORMAT_I1;
+    dsc->opa = LV_OPA_COVER;
+    dsc->blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_area_set(&dsc->relative_area, area_x, 0, area_x + area_w - 1, area_h - 1);
+}
+
+static void write_bit(uint8_t * buf, int32_t bit_idx, uint8_t value)
+{
+    if(value) buf[bit_idx / 8] |= (1 << (7 - (bit_idx % 8)));
+    else buf[bit_idx / 8] &= ~(1 << (7 - (bit_idx % 8)));
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    double us = ns / 1000;
+    printf("%s,%d,%d,%d,%.2f,%.1f,%d\n", perf_case->name, (int)area_w, (int)area_h, (int)area_x, us,
+           area_w * area_h / us, LV_DRAW_SW_I1_DITHER);
+}
@@ -0,0 +1,97 @@
+/**
+ * @file lv_perf_label_lines.c
+ * Measure the cost of wrapping the text of labels: redrawing
+ * multi-line, center aligned labels as they are, and after setting their text.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+#include "src/lvgl_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES     800
+#define VER_RES     480
+#define BUF_LINES   (VER_RES / 10)
+#define LABEL_CNT   12
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void render(const lv_perf_case_t * perf_case);
+static void set_text(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_obj_t * labels[LABEL_CNT];
+
+static const char * text =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et "
+    "dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex "
+    "ea commodo consequat. Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat "
+    "nulla pariatur. Excepteur sint occaecat cupidatat non proident, sunt in culpa qui officia deserunt mollit "
+    "anim id est laborum.";
+
+static const lv_perf_case_t cases[] = {
+    {"render", render},
+    {"set_text", set_text},
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_display_t * disp = lv_perf_display_create(HOR_RES, VER_RES, BUF_LINES);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < LABEL_CNT; i++) {
+        labels[i] = lv_label_create(scr);
+        lv_label_set_text_static(labels[i], text);
+        lv_obj_set_width(labels[i], 180);
+        lv_obj_set_style_text_align(labels[i], LV_TEXT_ALIGN_CENTER, 0);
+    }
+    lv_refr_now(disp);
+
+    lv_perf_run("case,us,line_cache", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void render(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+static void set_text(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    uint32_t i;
+    for(i = 0; i < LABEL_CNT; i++) {
+        lv_label_set_text_static(labels[i], text);
+    }
+    lv_refr_now(NULL);
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    printf("%s,%.1f,%s\n", perf_case->name, ns / 1000, LV_LABEL_LINE_CACHE ? "yes" : "no");
+}
@@ -0,0 +1,152 @@
+/**
+ * @file lv_perf_layout_insert.c
+ * Measure how long it takes to add an item to a large flex or grid container
+ * and update the layout, then delete the item and update the layout again.
+ * The items are buttons with a label as in a typical list.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define GRID_COL_CNT    4
+#define MAX_ITEM_CNT    1000
+
+/*Number of inserts in a run*/
+#define INSERT_CNT      200
+
+#define LAYOUT_CASES(name, layout) \
+    {name, insert, 50, INSERT_CNT, create_cont, delete_cont, &layout}, \
+    {name, insert, 200, INSERT_CNT, create_cont, delete_cont, &layout}, \
+    {name, insert, 500, INSERT_CNT, create_cont, delete_cont, &layout}, \
+    {name, insert, MAX_ITEM_CNT, INSERT_CNT, create_cont, delete_cont, &layout}
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    bool grid;
+    lv_flex_flow_t flow;    /*If not grid*/
+    bool front;             /*Insert the item as the first child*/
+} layout_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void create_cont(const lv_perf_case_t * perf_case);
+static void delete_cont(const lv_perf_case_t * perf_case);
+static void insert(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+static lv_obj_t * create_item(const layout_dsc_t * layout, uint32_t idx);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_obj_t * cont;
+
+/*Row templates of the grid for the largest item count*/
+static int32_t grid_col_dsc[GRID_COL_CNT + 1];
+static int32_t grid_row_dsc[MAX_ITEM_CNT / GRID_COL_CNT + 2];
+
+static const layout_dsc_t flex_column = {false, LV_FLEX_FLOW_COLUMN, false};
+static const layout_dsc_t flex_front = {false, LV_FLEX_FLOW_COLUMN, true};
+static const layout_dsc_t flex_wrap = {false, LV_FLEX_FLOW_ROW_WRAP, false};
+static const layout_dsc_t grid = {true, LV_FLEX_FLOW_COLUMN, false};
+
+static const lv_perf_case_t cases[] = {
+    LAYOUT_CASES("flex_column", flex_column),
+    LAYOUT_CASES("flex_front", flex_front),
+    LAYOUT_CASES("flex_wrap", flex_wrap),
+    LAYOUT_CASES("grid", grid),
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_perf_display_create(320, 240, 10);
+
+    lv_perf_run("case,items,us_per_insert", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void create_cont(const lv_perf_case_t * perf_case)
+{
+    const layout_dsc_t * layout = perf_case->user_data;
+
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 320, 240);
+
+    if(layout->grid) {
+        uint32_t i;
+        for(i = 0; i < GRID_COL_CNT; i++) grid_col_dsc[i] = LV_GRID_CONTENT;
+        grid_col_dsc[GRID_COL_CNT] = LV_GRID_TEMPLATE_LAST;
+
+        /*One more cell than items for the inserted item*/
+        uint32_t row_cnt = perf_case->cnt / GRID_COL_CNT + 1;
+        for(i = 0; i < row_cnt; i++) grid_row_dsc[i] = LV_GRID_CONTENT;
+        grid_row_dsc[row_cnt] = LV_GRID_TEMPLATE_LAST;
+        lv_obj_set_grid_dsc_array(cont, grid_col_dsc, grid_row_dsc);
+    }
+    else {
+        lv_obj_set_flex_flow(cont, layout->flow);
+    }
+
+    uint32_t i;
+    for(i = 0; i < perf_case->cnt; i++) {
+        create_item(layout, i);
+    }
+
+    lv_obj_update_layout(cont);
+}
+
+static void delete_cont(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_obj_delete(cont);
+}
+
+static void insert(const lv_perf_case_t * perf_case)
+{
+    const layout_dsc_t * layout = perf_case->user_data;
+
+    lv_obj_t * item = create_item(layout, perf_case->cnt);
+    if(layout->front) lv_obj_move_to_index(item, 0);
+    lv_obj_update_layout(cont);
+    lv_obj_delete(item);
+    lv_obj_update_layout(cont);
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    printf("%s,%" LV_PRIu32 ",%.1f\n", perf_case->name, perf_case->cnt, ns / 1000);
+}
+
+static lv_obj_t * create_item(const layout_dsc_t * layout, uint32_t idx)
+{
+    lv_obj_t * btn = lv_button_create(cont);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text_fmt(label, "Item %" LV_PRIu32, idx);
+
+    if(layout->grid) {
+        lv_obj_set_grid_cell(btn, LV_GRID_ALIGN_STRETCH, idx % GRID_COL_CNT, 1,
+                             LV_GRID_ALIGN_CENTER, idx / GRID_COL_CNT, 1);
+    }
+
+    return btn;
+}
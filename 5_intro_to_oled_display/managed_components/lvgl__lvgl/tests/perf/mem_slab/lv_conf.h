@@ -0,0 +1,21 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the slab allocator benchmark.
+ * `LV_MEM_SLAB` is set by CMakeLists.txt for each executable.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH              16
+
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+#define LV_MEM_SIZE                 (64 * 1024U)
+/*The small blocks of the working set need to fit into the slab area to not fall back to TLSF*/
+#define LV_MEM_SLAB_SIZE            (24 * 1024U)
+
+#define LV_USE_LOG                  0
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,154 @@
+/**
+ * @file lv_perf_mem_slab.c
+ * Measure the builtin heap while a working set of allocations is replaced one
+ * by one: only small blocks, small blocks mixed with larger ones, and widgets
+ * created and deleted on a screen. After each case the fragmentation of the
+ * heap is printed too.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "lv_perf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BLOCK_CNT   192
+#define OBJ_CNT     32
+
+/*Number of replaces in a run. The same number in every run to end up with the same heap.*/
+#define BLOCK_REPLACE_CNT   (1000 * 1000)
+#define OBJ_REPLACE_CNT     (10 * 1000)
+
+/*Every 8th block is 256..1023 bytes in the mixed case*/
+#define MIXED_BLOCKS        1
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void alloc_blocks(const lv_perf_case_t * perf_case);
+static void free_blocks(const lv_perf_case_t * perf_case);
+static void replace_block(const lv_perf_case_t * perf_case);
+static void create_objs(const lv_perf_case_t * perf_case);
+static void delete_objs(const lv_perf_case_t * perf_case);
+static void replace_obj(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+static void * alloc_block(const lv_perf_case_t * perf_case);
+static lv_obj_t * create_obj(lv_obj_t * parent);
+static uint32_t rand_next(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static void * blocks[BLOCK_CNT];
+static lv_obj_t * objs[OBJ_CNT];
+static uint32_t rand_seed;
+
+static const lv_perf_case_t cases[] = {
+    {"small", replace_block, 0, BLOCK_REPLACE_CNT, alloc_blocks, free_blocks},
+    {"mixed", replace_block, MIXED_BLOCKS, BLOCK_REPLACE_CNT, alloc_blocks, free_blocks},
+    {"objects", replace_obj, 0, OBJ_REPLACE_CNT, create_objs, delete_objs},
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_perf_display_create(320, 240, 10);
+
+    lv_perf_run("case,ns_per_replace,used_pct,frag_pct,biggest_free", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void alloc_blocks(const lv_perf_case_t * perf_case)
+{
+    rand_seed = 1;
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) blocks[i] = alloc_block(perf_case);
+}
+
+static void free_blocks(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) lv_free(blocks[i]);
+}
+
+static void replace_block(const lv_perf_case_t * perf_case)
+{
+    uint32_t idx = rand_next() % BLOCK_CNT;
+    lv_free(blocks[idx]);
+    blocks[idx] = alloc_block(perf_case);
+}
+
+static void create_objs(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    rand_seed = 1;
+    uint32_t i;
+    for(i = 0; i < OBJ_CNT; i++) objs[i] = create_obj(lv_screen_active());
+}
+
+static void delete_objs(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_obj_clean(lv_screen_active());
+}
+
+static void replace_obj(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    uint32_t idx = rand_next() % OBJ_CNT;
+    lv_obj_delete(objs[idx]);
+    objs[idx] = create_obj(lv_screen_active());
+}
+
+/**
+ * Print the heap while the working set is still allocated
+ */
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("%s,%.1f,%d,%d,%zu\n", perf_case->name, ns, mon.used_pct, mon.frag_pct, mon.free_biggest_size);
+}
+
+static void * alloc_block(const lv_perf_case_t * perf_case)
+{
+    uint32_t r = rand_next();
+    size_t size = (perf_case->cnt == MIXED_BLOCKS && (r & 0x7) == 0) ? 256 + (r >> 8) % 768 : 4 + (r >> 8) % 125;
+    void * p = lv_malloc(size);
+    if(p == NULL) {
+        printf("out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static lv_obj_t * create_obj(lv_obj_t * parent)
+{
+    lv_obj_t * btn = lv_button_create(parent);
+    lv_obj_set_pos(btn, rand_next() % 200, rand_next() % 200);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text_fmt(label, "Button %" LV_PRIu32, rand_next() % 1000);
+    return btn;
+}
+
+static uint32_t rand_next(void)
+{
+    rand_seed = rand_seed * 1103515245 + 12345;
+    return rand_seed >> 1;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the RGB565 blend benchmark.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH              16
+
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
+
+#define LV_USE_LOG                  0
+
+#define LV_DRAW_SW_SUPPORT_L8       1
+#define LV_DRAW_SW_SUPPORT_AL88     1
+#define LV_DRAW_SW_SUPPORT_I1       1
+
+/*Measure the generated kernels. Configure with -DBLEND_GEN=OFF to measure the hand-written ones*/
+#define LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565        BLEND_GEN
+#define LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565      BLEND_GEN
+#define LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565        BLEND_GEN
+#define LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565    BLEND_GEN
+#define LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565    BLEND_GEN
+#define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565  BLEND_GEN
+#define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565  BLEND_GEN
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,119 @@
+/**
+ * @file lv_perf_rgb565_blend.c
+ * Measure the throughput of the NORMAL blend mode image kernels of the RGB565
+ * renderer: every source color format opaque, with opacity, through a mask and
+ * with both, on a display sized area.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+#include "src/lvgl_private.h"
+#include "src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define AREA_W      480
+#define AREA_H      272
+
+/*Opaque, with opacity, through a mask and with both*/
+#define CF_CASES(cf) \
+    {#cf, blend, LV_COLOR_FORMAT_##cf, 0, init_dsc, NULL, &cover}, \
+    {#cf, blend, LV_COLOR_FORMAT_##cf, 0, init_dsc, NULL, &half}, \
+    {#cf, blend, LV_COLOR_FORMAT_##cf, 0, init_dsc, NULL, &cover_mask}, \
+    {#cf, blend, LV_COLOR_FORMAT_##cf, 0, init_dsc, NULL, &half_mask}
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_opa_t opa;
+    bool mask;
+} blend_opa_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void init_dsc(const lv_perf_case_t * perf_case);
+static void blend(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint16_t dest[AREA_W * AREA_H];
+static uint8_t src[AREA_W * AREA_H * 4];
+static lv_opa_t mask[AREA_W * AREA_H];
+static lv_draw_sw_blend_image_dsc_t dsc;
+
+static const blend_opa_t cover = {LV_OPA_COVER, false};
+static const blend_opa_t half = {LV_OPA_50, false};
+static const blend_opa_t cover_mask = {LV_OPA_COVER, true};
+static const blend_opa_t half_mask = {LV_OPA_50, true};
+
+static const lv_perf_case_t cases[] = {
+    CF_CASES(I1),
+    CF_CASES(L8),
+    CF_CASES(AL88),
+    CF_CASES(RGB565),
+    CF_CASES(RGB888),
+    CF_CASES(XRGB8888),
+    CF_CASES(ARGB8888),
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < sizeof(src); i++) src[i] = (uint8_t)(i * 37);
+    for(i = 0; i < sizeof(mask); i++) mask[i] = (lv_opa_t)(i * 13);
+
+    lv_perf_run("cf,opa,mask,us,mpx_per_s", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void init_dsc(const lv_perf_case_t * perf_case)
+{
+    const blend_opa_t * opa = perf_case->user_data;
+    lv_color_format_t cf = perf_case->cnt;
+
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = dest;
+    dsc.dest_w = AREA_W;
+    dsc.dest_h = AREA_H;
+    dsc.dest_stride = AREA_W * 2;
+    dsc.src_buf = src;
+    dsc.src_stride = lv_draw_buf_width_to_stride(AREA_W, cf);
+    dsc.src_color_format = cf;
+    dsc.opa = opa->opa;
+    dsc.mask_buf = opa->mask ? mask : NULL;
+    dsc.mask_stride = AREA_W;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_area_set(&dsc.relative_area, 0, 0, AREA_W - 1, AREA_H - 1);
+}
+
+static void blend(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_draw_sw_blend_image_to_rgb565(&dsc);
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    double us = ns / 1000;
+    printf("%s,%d,%d,%.1f,%.1f\n", perf_case->name, dsc.opa, dsc.mask_buf != NULL, us, AREA_W * AREA_H / us);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file lv_perf_style_table.c
+ * Measure the cost of getting style properties on the widgets demo:
+ * reading the typical draw and layout properties of every object,
+ * recalculating the whole layout and redrawing the whole screen.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+#include "src/lvgl_private.h"
+#include "demos/lv_demos.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES     800
+#define VER_RES     480
+#define BUF_LINES   (VER_RES / 10)
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void read_props(const lv_perf_case_t * perf_case);
+static lv_obj_tree_walk_res_t read_props_cb(lv_obj_t * obj, void * user_data);
+static void layout(const lv_perf_case_t * perf_case);
+static lv_obj_tree_walk_res_t mark_layout_cb(lv_obj_t * obj, void * user_data);
+static void render(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static volatile int32_t sink;
+
+static const lv_perf_case_t cases[] = {
+    {"read_props", read_props},
+    {"layout", layout},
+    {"render", render},
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_display_t * disp = lv_perf_display_create(HOR_RES, VER_RES, BUF_LINES);
+    lv_demo_widgets();
+    lv_refr_now(disp);
+
+    lv_perf_run("case,us,style_table", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void read_props(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_obj_tree_walk(lv_screen_active(), read_props_cb, NULL);
+}
+
+static lv_obj_tree_walk_res_t read_props_cb(lv_obj_t * obj, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*Roughly what lv_obj's layout and draw functions read*/
+    int32_t v = 0;
+    v += lv_obj_get_style_width(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_height(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_bg_opa(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_bg_color(obj, LV_PART_MAIN).red;
+    v += lv_obj_get_style_shadow_width(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_outline_width(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_opa(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_transform_rotation(obj, LV_PART_MAIN);
+    v += lv_obj_get_style_text_color(obj, LV_PART_MAIN).red;
+    v += lv_obj_get_style_text_font(obj, LV_PART_MAIN)->line_height;
+    v += lv_obj_get_style_width(obj, LV_PART_SCROLLBAR);
+    v += lv_obj_get_style_bg_opa(obj, LV_PART_SCROLLBAR);
+    sink += v;
+
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+
+static void layout(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_obj_tree_walk(lv_screen_active(), mark_layout_cb, NULL);
+    lv_obj_update_layout(lv_screen_active());
+}
+
+static lv_obj_tree_walk_res_t mark_layout_cb(lv_obj_t * obj, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_obj_mark_layout_as_dirty(obj);
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+
+static void render(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    printf("%s,%.1f,%s\n", perf_case->name, ns / 1000, LV_OBJ_STYLE_TABLE ? "yes" : "no");
+}
@@ -0,0 +1,109 @@
+/**
+ * @file lv_perf_text_cache.c
+ * Measure the cost of measuring the texts of widgets: changing one cell of
+ * a 20x10 table, restyling the table, and the expand width of a span group.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+#include "src/lvgl_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES     800
+#define VER_RES     480
+#define BUF_LINES   (VER_RES / 10)
+#define ROW_CNT     20
+#define COL_CNT     10
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void set_cell(const lv_perf_case_t * perf_case);
+static void restyle(const lv_perf_case_t * perf_case);
+static void span_width(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_obj_t * table;
+static lv_obj_t * spans;
+static uint32_t counter;
+static volatile int32_t sink;
+
+static const lv_perf_case_t cases[] = {
+    {"set_cell", set_cell},
+    {"restyle", restyle},
+    {"span_width", span_width},
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_display_t * disp = lv_perf_display_create(HOR_RES, VER_RES, BUF_LINES);
+
+    table = lv_table_create(lv_screen_active());
+    lv_table_set_column_count(table, COL_CNT);
+    lv_table_set_row_count(table, ROW_CNT);
+    uint32_t row, col;
+    for(row = 0; row < ROW_CNT; row++) {
+        for(col = 0; col < COL_CNT; col++) {
+            lv_table_set_column_width(table, col, 120);
+            lv_table_set_cell_value_fmt(table, row, col, "Row %" LV_PRIu32 ", column %" LV_PRIu32, row, col);
+        }
+    }
+
+    spans = lv_spangroup_create(lv_screen_active());
+    for(col = 0; col < COL_CNT; col++) {
+        lv_span_t * span = lv_spangroup_new_span(spans);
+        lv_span_set_text_static(span, "A span of a span group with some text ");
+    }
+    lv_refr_now(disp);
+
+    lv_perf_run("case,us,text_cache", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Like a live value in a table: set one cell and update the row heights*/
+static void set_cell(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    counter++;
+    lv_table_set_cell_value_fmt(table, 5, 5, "Value %" LV_PRIu32, counter % 100);
+    lv_obj_send_event(table, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_update_layout(table);
+}
+
+static void restyle(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_obj_send_event(table, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_update_layout(table);
+}
+
+static void span_width(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    sink += (int32_t)lv_spangroup_get_expand_width(spans, 0);
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    printf("%s,%.1f,%d\n", perf_case->name, ns / 1000, LV_TEXT_CACHE_SIZE);
+}
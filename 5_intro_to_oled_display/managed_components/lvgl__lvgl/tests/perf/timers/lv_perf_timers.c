@@ -0,0 +1,133 @@
+/**
+ * @file lv_perf_timers.c
+ * Measure the cost of `lv_timer_handler` with many timers: with periods of
+ * 10..1000 ms while the tick advances 1 ms per call, when none of the timers is
+ * due, and while timers are created and deleted.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include "lv_perf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TIMER_CNT   1000
+
+#define TIMER_CASES(name, run_cb, setup_cb) \
+    {name, run_cb, 10, 0, setup_cb, delete_timers}, \
+    {name, run_cb, 100, 0, setup_cb, delete_timers}, \
+    {name, run_cb, TIMER_CNT, 0, setup_cb, delete_timers}
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void create_timers(const lv_perf_case_t * perf_case);
+static void create_idle_timers(const lv_perf_case_t * perf_case);
+static void delete_timers(const lv_perf_case_t * perf_case);
+static void periodic(const lv_perf_case_t * perf_case);
+static void idle(const lv_perf_case_t * perf_case);
+static void churn(const lv_perf_case_t * perf_case);
+static void report(const lv_perf_case_t * perf_case, double ns);
+static void timer_cb(lv_timer_t * timer);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_timer_t * timers[TIMER_CNT];
+static uint32_t call_cnt;
+static uint32_t run_cnt;
+
+static const lv_perf_case_t cases[] = {
+    TIMER_CASES("periodic", periodic, create_timers),
+    TIMER_CASES("idle", idle, create_idle_timers),
+    TIMER_CASES("churn", churn, create_timers),
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    lv_perf_run("case,timers,ns_per_call,runs_per_call", cases, sizeof(cases) / sizeof(cases[0]), report);
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void create_timers(const lv_perf_case_t * perf_case)
+{
+    uint32_t i;
+    for(i = 0; i < perf_case->cnt; i++) {
+        timers[i] = lv_timer_create(timer_cb, 10 + (i * 7919) % 991, NULL);
+    }
+
+    call_cnt = 0;
+    run_cnt = 0;
+}
+
+static void create_idle_timers(const lv_perf_case_t * perf_case)
+{
+    uint32_t i;
+    for(i = 0; i < perf_case->cnt; i++) {
+        timers[i] = lv_timer_create(timer_cb, 60000, NULL);
+    }
+
+    call_cnt = 0;
+    run_cnt = 0;
+}
+
+static void delete_timers(const lv_perf_case_t * perf_case)
+{
+    uint32_t i;
+    for(i = 0; i < perf_case->cnt; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+static void periodic(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_tick_inc(1);
+    lv_timer_handler();
+    call_cnt++;
+}
+
+static void idle(const lv_perf_case_t * perf_case)
+{
+    LV_UNUSED(perf_case);
+    lv_timer_handler();
+    call_cnt++;
+}
+
+static void churn(const lv_perf_case_t * perf_case)
+{
+    /*Replace a timer in every call*/
+    uint32_t idx = (call_cnt * 7919) % perf_case->cnt;
+    lv_timer_delete(timers[idx]);
+    timers[idx] = lv_timer_create(timer_cb, 10 + (call_cnt * 31) % 991, NULL);
+
+    lv_tick_inc(1);
+    lv_timer_handler();
+    call_cnt++;
+}
+
+static void report(const lv_perf_case_t * perf_case, double ns)
+{
+    printf("%s,%" LV_PRIu32 ",%.1f,%.2f\n", perf_case->name, perf_case->cnt, ns, (double)run_cnt / call_cnt);
+}
+
+static void timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
@@ -22,7 +22,28 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_TABLE          1
+#define LV_FONT_FMT_TXT_CACHE_SIZE  (64 * 1024)
+#define LV_FONT_FMT_TXT_LOOKUP_CNT  8
+#define LV_LABEL_LINE_CACHE         1
+#define LV_TEXT_CACHE_SIZE          (16 * 1024)
+#define LV_ANIM_PATH_TABLES         1
+#define LV_LAYOUT_CACHE             1
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
+/* Blend with the generated kernels here and with the hand-written ones in the other build */
+#define LV_DRAW_SW_BLEND_GEN_I1_TO_RGB565        1
+#define LV_DRAW_SW_BLEND_GEN_AL88_TO_RGB565      1
+#define LV_DRAW_SW_BLEND_GEN_L8_TO_RGB565        1
+#define LV_DRAW_SW_BLEND_GEN_RGB565_TO_RGB565    1
+#define LV_DRAW_SW_BLEND_GEN_RGB888_TO_RGB565    1
+#define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_RGB565  1
+#define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_RGB565  1
+#define LV_DRAW_SW_BLEND_GEN_AL88_TO_I1          1
+#define LV_DRAW_SW_BLEND_GEN_L8_TO_I1            1
+#define LV_DRAW_SW_BLEND_GEN_RGB565_TO_I1        1
+#define LV_DRAW_SW_BLEND_GEN_RGB888_TO_I1        1
+#define LV_DRAW_SW_BLEND_GEN_XRGB8888_TO_I1      1
+#define LV_DRAW_SW_BLEND_GEN_ARGB8888_TO_I1      1
 #endif
 
 #ifdef LVGL_CI_USING_DEF_HEAP
@@ -30,6 +51,9 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_OBJ_STYLE_TABLE      0
+#define LV_MEM_SLAB             1
+#define LV_MEM_SLAB_SIZE        (256 * 1024)
 #define LV_BIN_DECODER_RAM_LOAD 0
 #endif
 
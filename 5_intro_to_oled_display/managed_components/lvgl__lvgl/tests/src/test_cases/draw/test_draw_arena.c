@@ -0,0 +1,164 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+
+/*The layer is not added to the display, so its tasks are not dispatched*/
+static lv_layer_t layer;
+
+static void add_rect(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(color);
+    lv_area_t a = {x1, y1, x2, y2};
+    lv_draw_rect(&layer, &dsc, &a);
+}
+
+/*The other tasks are set to waiting to not let the draw units take them when dispatching*/
+static void set_all_ready(uint32_t step)
+{
+    uint32_t i = 0;
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = i % step == 0 ? LV_DRAW_TASK_STATE_READY : LV_DRAW_TASK_STATE_WAITING;
+        i++;
+        t = t->next;
+    }
+}
+
+static uint32_t get_chunk_cnt(void)
+{
+    uint32_t cnt = 0;
+    lv_draw_arena_chunk_t * c = layer._arena_chunks;
+    while(c) {
+        cnt++;
+        c = c->next;
+    }
+    return cnt;
+}
+
+void setUp(void)
+{
+    lv_memzero(&layer, sizeof(layer));
+    lv_area_set(&layer.buf_area, 0, 0, 199, 199);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+}
+
+void tearDown(void)
+{
+    set_all_ready(1);
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+void test_draw_arena_reset(void)
+{
+#if LV_DRAW_TASK_ARENA_SIZE
+    TEST_ASSERT_EQUAL_UINT32(0, get_chunk_cnt());
+    TEST_ASSERT_NOT_NULL(_draw_info.arena_spare);
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        add_rect(i, i, i + 10, i + 10, i);
+    }
+    TEST_ASSERT_NULL(_draw_info.arena_spare);
+    TEST_ASSERT_GREATER_THAN_UINT32(1, get_chunk_cnt());
+
+    /*The remaining tasks are still intact*/
+    set_all_ready(2);
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_GREATER_THAN_UINT32(1, get_chunk_cnt());
+    i = 1;
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        lv_draw_fill_dsc_t * fill_dsc = lv_draw_task_get_fill_dsc(t);
+        TEST_ASSERT_NOT_NULL(fill_dsc);
+        TEST_ASSERT_EQUAL_UINT32(i, lv_color_to_u32(fill_dsc->color) & 0xffffff);
+        TEST_ASSERT_EQUAL_INT32(i, t->area.x1);
+        i += 2;
+        t = t->next;
+    }
+
+    /*Only the chunk allocated at init is kept as spare when all the tasks are deleted*/
+    set_all_ready(1);
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_EQUAL_UINT32(0, get_chunk_cnt());
+    TEST_ASSERT_NOT_NULL(_draw_info.arena_spare);
+    TEST_ASSERT_EQUAL_PTR(_draw_info.arena_reserved, _draw_info.arena_spare);
+    TEST_ASSERT_NULL(_draw_info.arena_spare->next);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_draw_arena_no_leak(void)
+{
+    size_t mem_before = lv_test_get_free_mem();
+
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        add_rect(i, 0, i + 10, 10, i);
+    }
+
+#if LV_DRAW_TASK_ARENA_SIZE
+    /*Larger than a chunk, the next tasks are still allocated from the current chunk*/
+    lv_area_t large_area = {0, 0, 10, 10};
+    lv_draw_task_t * large_task = lv_draw_add_task(&layer, &large_area);
+    uint8_t * large = lv_draw_task_alloc_dsc(&layer, large_task, LV_DRAW_TASK_ARENA_SIZE + 100);
+    TEST_ASSERT_NOT_NULL(large);
+    lv_memset(large, 0xaa, LV_DRAW_TASK_ARENA_SIZE + 100);
+    lv_draw_fill_dsc_init((lv_draw_fill_dsc_t *)large);
+    large_task->type = LV_DRAW_TASK_TYPE_FILL;
+    lv_draw_finalize_task_creation(&layer, large_task);
+    size_t used = layer._arena_chunks->used;
+    add_rect(0, 0, 10, 10, 0);
+    TEST_ASSERT_GREATER_THAN(used, layer._arena_chunks->used);
+#endif
+
+    /*The application replaces a descriptor allocated from the arena*/
+    lv_area_t replaced_area = {0, 50, 10, 60};
+    lv_draw_task_t * replaced_task = lv_draw_add_task(&layer, &replaced_area);
+    lv_draw_task_alloc_dsc(&layer, replaced_task, sizeof(lv_draw_fill_dsc_t));
+    replaced_task->draw_dsc = lv_malloc(sizeof(lv_draw_fill_dsc_t));
+    lv_draw_fill_dsc_init(replaced_task->draw_dsc);
+    replaced_task->type = LV_DRAW_TASK_TYPE_FILL;
+    lv_draw_finalize_task_creation(&layer, replaced_task);
+
+    /*The local text is copied*/
+    static const char text[] = "Hello";
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.text = text;
+    label_dsc.text_local = 1;
+    lv_area_t a = {0, 100, 199, 199};
+    lv_draw_label(&layer, &label_dsc, &a);
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t->next) t = t->next;
+    lv_draw_label_dsc_t * label_dsc_copy = lv_draw_task_get_label_dsc(t);
+    TEST_ASSERT_NOT_EQUAL(text, label_dsc_copy->text);
+    TEST_ASSERT_EQUAL_STRING(text, label_dsc_copy->text);
+
+    /*A draw task with a descriptor allocated by the application*/
+    t = lv_draw_add_task(&layer, &a);
+    lv_draw_fill_dsc_t * fill_dsc = lv_malloc(sizeof(lv_draw_fill_dsc_t));
+    lv_draw_fill_dsc_init(fill_dsc);
+    t->draw_dsc = fill_dsc;
+    t->type = LV_DRAW_TASK_TYPE_FILL;
+    lv_draw_finalize_task_creation(&layer, t);
+
+    set_all_ready(1);
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+
+    LV_UNUSED(mem_before);
+    LV_HEAP_CHECK(TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0));
+}
+
+#endif
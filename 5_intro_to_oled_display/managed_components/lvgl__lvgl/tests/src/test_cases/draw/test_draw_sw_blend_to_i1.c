@@ -0,0 +1,348 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../../draw/sw/blend/lv_draw_sw_blend_to_i1.h"
+
+#include "unity/unity.h"
+
+#if LV_DRAW_SW_SUPPORT_I1
+
+/*Compare the byte and word based I1 blend kernels with the simple pixel by pixel ones*/
+
+#define STRIDE      48
+#define ROWS        3
+#define CASE_CNT    3000
+
+static uint8_t dest[STRIDE * ROWS];
+static uint8_t dest_ref[STRIDE * ROWS];
+static uint8_t src[STRIDE * ROWS];
+static lv_opa_t mask[STRIDE * 8 * ROWS];
+static uint32_t rnd_state;
+
+void setUp(void)
+{
+    rnd_state = 0x12345678;
+}
+
+void tearDown(void)
+{
+}
+
+static uint32_t rnd(void)
+{
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+static uint8_t get_bit(const uint8_t * buf, int32_t bit_idx)
+{
+    return (buf[bit_idx / 8] >> (7 - (bit_idx % 8))) & 1;
+}
+
+static void write_bit(uint8_t * buf, int32_t bit_idx, uint8_t value)
+{
+    if(value) buf[bit_idx / 8] |= (1 << (7 - (bit_idx % 8)));
+    else buf[bit_idx / 8] &= ~(1 << (7 - (bit_idx % 8)));
+}
+
+/*The dithering threshold of a pixel on the screen, computed unlike in the kernels*/
+static uint8_t ref_th(int32_t x, int32_t y)
+{
+#if LV_DRAW_SW_I1_DITHER == LV_DRAW_SW_I1_DITHER_NONE
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+    return 127;
+#else
+    int32_t bits = LV_DRAW_SW_I1_DITHER == LV_DRAW_SW_I1_DITHER_BAYER4 ? 2 : 3;
+    int32_t v = 0;
+    int32_t i;
+    /*The value of the Bayer matrix is the bit reversed interleave of `x ^ y` and `y`*/
+    for(i = 0; i < bits; i++) v = (v << 2) | ((((x ^ y) >> i) & 1) << 1) | ((y >> i) & 1);
+    return (uint8_t)(v * (256 >> (2 * bits)) + (128 >> (2 * bits)));
+#endif
+}
+
+static lv_opa_t rnd_opa(void)
+{
+    static const lv_opa_t opas[] = {0, 1, 2, 100, 127, 128, 129, 200, 252, 253, 254, 255};
+    return opas[rnd() % (sizeof(opas) / sizeof(opas[0]))];
+}
+
+static void rnd_buffers(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(dest); i++) {
+        dest[i] = (uint8_t)rnd();
+        dest_ref[i] = dest[i];
+        src[i] = (uint8_t)rnd();
+    }
+
+    /*Mostly transparent and covered runs as with real masks*/
+    for(i = 0; i < sizeof(mask); i++) {
+        uint32_t r = rnd() % 8;
+        if(r < 3) mask[i] = LV_OPA_TRANSP;
+        else if(r < 6) mask[i] = LV_OPA_COVER;
+        else mask[i] = rnd_opa();
+
+        if(i % 8 == 0 && rnd() % 2) {
+            /*Sometimes 8 same values in a row*/
+            uint32_t j;
+            for(j = 1; j < 8 && i + j < sizeof(mask); j++) mask[i + j] = mask[i];
+            i += 7;
+        }
+    }
+}
+
+/*The pixel by pixel fill of the earlier `lv_draw_sw_blend_color_to_i1`*/
+static void ref_color_to_i1(const lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    uint8_t src_lumi = lv_color_luminance(dsc->color);
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    uint8_t * dest_buf = dsc->dest_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t x, y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x < dsc->dest_w; x++) {
+            uint8_t src_color = src_lumi > ref_th(dsc->layer_ofs.x + dsc->relative_area.x1 + x,
+                                                  dsc->layer_ofs.y + dsc->relative_area.y1 + y);
+            uint8_t cur = get_bit(dest_buf, x + bit_ofs);
+            uint8_t new_bit;
+            if(dsc->mask_color_format == LV_COLOR_FORMAT_A1 && mask_buf) {
+                if(get_bit(mask_buf, x + dsc->mask_bit_ofs) == 0) continue;
+                new_bit = dsc->opa >= LV_OPA_MAX ? src_color : (dsc->opa * src_color + (255 - dsc->opa) * cur) / 255;
+            }
+            else if(mask_buf == NULL) {
+                new_bit = dsc->opa >= LV_OPA_MAX ? src_color : (dsc->opa * src_color + (255 - dsc->opa) * cur) / 255;
+            }
+            else {
+                if(mask_buf[x] == LV_OPA_TRANSP) continue;
+                uint8_t px_opa = dsc->opa >= LV_OPA_MAX ? mask_buf[x] : (mask_buf[x] * dsc->opa) / 255;
+                if(px_opa == LV_OPA_COVER) new_bit = src_color;
+                else new_bit = (px_opa * src_color + (255 - px_opa) * cur) / 255;
+            }
+            write_bit(dest_buf, x + bit_ofs, new_bit);
+        }
+        dest_buf += dsc->dest_stride;
+        if(mask_buf) mask_buf += dsc->mask_stride;
+    }
+}
+
+/*The pixel by pixel copy of the earlier `i1_image_blend`*/
+static void ref_i1_image_to_i1(const lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    uint8_t * dest_buf = dsc->dest_buf;
+    const uint8_t * src_buf = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t x, y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x < dsc->dest_w; x++) {
+            uint8_t s = get_bit(src_buf, x);
+            uint8_t d = get_bit(dest_buf, x + bit_ofs);
+            uint8_t px_opa;
+            if(mask_buf == NULL) px_opa = dsc->opa >= LV_OPA_MAX ? 255 : dsc->opa;
+            else px_opa = dsc->opa >= LV_OPA_MAX ? mask_buf[x] : LV_OPA_MIX2(mask_buf[x], dsc->opa);
+            uint8_t blended = (uint8_t)(s * px_opa + d * (255 - px_opa));
+            write_bit(dest_buf, x + bit_ofs, blended > 127);
+        }
+        dest_buf += dsc->dest_stride;
+        src_buf += dsc->src_stride;
+        if(mask_buf) mask_buf += dsc->mask_stride;
+    }
+}
+
+/*The pixel by pixel blending of L8 images as in `l8_image_blend`*/
+static void ref_l8_image_to_i1(const lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    uint8_t * dest_buf = dsc->dest_buf;
+    const uint8_t * src_buf = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t x, y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x < dsc->dest_w; x++) {
+            uint8_t lumi = get_bit(dest_buf, x + bit_ofs) * 255;
+            uint8_t px_opa;
+            if(mask_buf == NULL) px_opa = dsc->opa;
+            else px_opa = dsc->opa >= LV_OPA_MAX ? mask_buf[x] : LV_OPA_MIX2(mask_buf[x], dsc->opa);
+            if(px_opa >= LV_OPA_MAX) lumi = src_buf[x];
+            else if(px_opa > LV_OPA_TRANSP) lumi = (uint8_t)((src_buf[x] * px_opa + lumi * (255 - px_opa)) >> 8);
+
+            uint8_t th = ref_th(dsc->layer_ofs.x + dsc->relative_area.x1 + x, dsc->layer_ofs.y + dsc->relative_area.y1 + y);
+            write_bit(dest_buf, x + bit_ofs, lumi > th);
+        }
+        dest_buf += dsc->dest_stride;
+        src_buf += dsc->src_stride;
+        if(mask_buf) mask_buf += dsc->mask_stride;
+    }
+}
+
+static void init_area(lv_area_t * area, int32_t * w)
+{
+    area->x1 = (int32_t)(rnd() % 24);
+    area->y1 = 0;
+    *w = 1 + (int32_t)(rnd() % (STRIDE * 8 - area->x1 - 8));
+    /*Often short, e.g. glyphs*/
+    if(rnd() % 2) *w = 1 + (int32_t)(rnd() % 20);
+    area->x2 = area->x1 + *w - 1;
+    area->y2 = ROWS - 1;
+}
+
+static void test_fill(lv_color_format_t mask_cf)
+{
+    static const uint32_t colors[] = {0xffffff, 0x000000, 0x808080, 0x7f7f7f, 0x303030, 0xe0e0e0};
+
+    uint32_t i;
+    for(i = 0; i < CASE_CNT; i++) {
+        rnd_buffers();
+
+        lv_draw_sw_blend_fill_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        init_area(&dsc.relative_area, &dsc.dest_w);
+        dsc.dest_h = ROWS;
+        dsc.dest_stride = STRIDE;
+        dsc.layer_ofs.x = (int32_t)(rnd() % 100);
+        dsc.layer_ofs.y = (int32_t)(rnd() % 100);
+        dsc.color = lv_color_hex(colors[rnd() % 6]);
+        dsc.opa = rnd() % 2 ? LV_OPA_COVER : rnd_opa();
+        dsc.mask_color_format = mask_cf;
+        if(mask_cf == LV_COLOR_FORMAT_A1) {
+            dsc.mask_buf = src;
+            dsc.mask_stride = STRIDE;
+            dsc.mask_bit_ofs = (int32_t)(rnd() % 8);
+        }
+        else if(rnd() % 3) {
+            dsc.mask_buf = mask;
+            dsc.mask_stride = STRIDE * 8;
+        }
+
+        dsc.dest_buf = &dest_ref[dsc.relative_area.x1 / 8];
+        ref_color_to_i1(&dsc);
+        dsc.dest_buf = &dest[dsc.relative_area.x1 / 8];
+        lv_draw_sw_blend_color_to_i1(&dsc);
+
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(dest_ref, dest, sizeof(dest));
+    }
+}
+
+void test_draw_sw_blend_to_i1_fill(void)
+{
+    test_fill(LV_COLOR_FORMAT_A8);
+}
+
+void test_draw_sw_blend_to_i1_fill_a1_mask(void)
+{
+    test_fill(LV_COLOR_FORMAT_A1);
+}
+
+void test_draw_sw_blend_to_i1_i1_image(void)
+{
+    uint32_t i;
+    for(i = 0; i < CASE_CNT; i++) {
+        rnd_buffers();
+
+        lv_draw_sw_blend_image_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        init_area(&dsc.relative_area, &dsc.dest_w);
+        dsc.dest_h = ROWS;
+        dsc.dest_stride = STRIDE;
+        dsc.src_buf = src;
+        dsc.src_stride = STRIDE;
+        dsc.src_color_format = LV_COLOR_FORMAT_I1;
+        dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+        dsc.opa = rnd() % 2 ? LV_OPA_COVER : rnd_opa();
+        if(rnd() % 2) {
+            dsc.mask_buf = mask;
+            dsc.mask_stride = STRIDE * 8;
+        }
+
+        dsc.dest_buf = &dest_ref[dsc.relative_area.x1 / 8];
+        ref_i1_image_to_i1(&dsc);
+        dsc.dest_buf = &dest[dsc.relative_area.x1 / 8];
+        lv_draw_sw_blend_image_to_i1(&dsc);
+
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(dest_ref, dest, sizeof(dest));
+    }
+}
+
+#if LV_DRAW_SW_SUPPORT_L8
+void test_draw_sw_blend_to_i1_l8_image(void)
+{
+    static uint8_t src_l8[STRIDE * 8 * ROWS];
+
+    uint32_t i;
+    for(i = 0; i < CASE_CNT; i++) {
+        rnd_buffers();
+        uint32_t j;
+        for(j = 0; j < sizeof(src_l8); j++) src_l8[j] = (uint8_t)rnd();
+
+        lv_draw_sw_blend_image_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        init_area(&dsc.relative_area, &dsc.dest_w);
+        dsc.dest_h = ROWS;
+        dsc.dest_stride = STRIDE;
+        dsc.layer_ofs.x = (int32_t)(rnd() % 100);
+        dsc.layer_ofs.y = (int32_t)(rnd() % 100);
+        dsc.src_buf = src_l8;
+        dsc.src_stride = STRIDE * 8;
+        dsc.src_color_format = LV_COLOR_FORMAT_L8;
+        dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+        dsc.opa = rnd() % 2 ? LV_OPA_COVER : rnd_opa();
+        if(rnd() % 2) {
+            dsc.mask_buf = mask;
+            dsc.mask_stride = STRIDE * 8;
+        }
+
+        dsc.dest_buf = &dest_ref[dsc.relative_area.x1 / 8];
+        ref_l8_image_to_i1(&dsc);
+        dsc.dest_buf = &dest[dsc.relative_area.x1 / 8];
+        lv_draw_sw_blend_image_to_i1(&dsc);
+
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(dest_ref, dest, sizeof(dest));
+    }
+}
+#endif
+
+void test_draw_sw_blend_to_i1_error_diffusion(void)
+{
+    /*The ratio of the set pixels has to follow the luminance*/
+    static const uint8_t levels[] = {0, 1, 32, 64, 127, 128, 200, 254, 255};
+    static uint8_t src_l8[64 * 32];
+    static uint8_t dest_i1[8 * 32];
+
+    uint32_t i;
+    for(i = 0; i < sizeof(levels); i++) {
+        lv_memset(src_l8, levels[i], sizeof(src_l8));
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_sw_i1_dither(src_l8, dest_i1, 64, 32, 64, 8, LV_COLOR_FORMAT_L8));
+
+        uint32_t set_cnt = 0;
+        uint32_t j;
+        for(j = 0; j < 64 * 32; j++) set_cnt += get_bit(dest_i1, (int32_t)j);
+
+        uint32_t expected = levels[i] * 64 * 32 / 255;
+        TEST_ASSERT_UINT32_WITHIN(16, expected, set_cnt);
+        if(levels[i] == 0) TEST_ASSERT_EQUAL_UINT32(0, set_cnt);
+        if(levels[i] == 255) TEST_ASSERT_EQUAL_UINT32(64 * 32, set_cnt);
+    }
+
+    /*Other formats give the same as their luminance in L8*/
+    static uint16_t src_rgb565[64 * 32];
+    static uint8_t dest_l8[8 * 32];
+    for(i = 0; i < 64 * 32; i++) {
+        lv_color_t c = lv_color_hex(rnd() & 0xffffff);
+        src_rgb565[i] = lv_color_to_u16(c);
+        src_l8[i] = lv_color16_luminance(*(lv_color16_t *)&src_rgb565[i]);
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_sw_i1_dither(src_l8, dest_l8, 64, 32, 64, 8, LV_COLOR_FORMAT_L8));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_sw_i1_dither(src_rgb565, dest_i1, 64, 32, 128, 8,
+                                                         LV_COLOR_FORMAT_RGB565));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(dest_l8, dest_i1, sizeof(dest_i1));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_sw_i1_dither(src_l8, dest_i1, 64, 32, 64, 8, LV_COLOR_FORMAT_A8));
+}
+
+#endif /*LV_DRAW_SW_SUPPORT_I1*/
+
+#endif
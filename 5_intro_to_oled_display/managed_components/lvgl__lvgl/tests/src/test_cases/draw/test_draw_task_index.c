@@ -0,0 +1,190 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*The layer is not added to the display, so its tasks are not dispatched, only checked*/
+static lv_layer_t layer;
+
+static void add_rect(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(0xff0000);
+    lv_area_t a = {x1, y1, x2, y2};
+    lv_draw_rect(&layer, &dsc, &a);
+}
+
+static uint32_t count_available(void)
+{
+    uint32_t cnt = 0;
+    if(layer.draw_task_head == NULL) return 0;
+
+    /*Only the SW draw unit is enabled, so all tasks prefer it*/
+    uint8_t unit_id = layer.draw_task_head->preferred_draw_unit_id;
+    lv_draw_task_t * t = lv_draw_get_next_available_task(&layer, NULL, unit_id);
+    while(t) {
+        cnt++;
+        t = lv_draw_get_next_available_task(&layer, t, unit_id);
+    }
+    return cnt;
+}
+
+static void set_all_ready(uint32_t step)
+{
+    uint32_t i = 0;
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        if(i % step == 0) t->state = LV_DRAW_TASK_STATE_READY;
+        i++;
+        t = t->next;
+    }
+}
+
+void setUp(void)
+{
+    lv_memzero(&layer, sizeof(layer));
+    lv_area_set(&layer.buf_area, 0, 0, 199, 199);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+}
+
+void tearDown(void)
+{
+    set_all_ready(1);
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+void test_draw_task_index_grid(void)
+{
+    int32_t x;
+    int32_t y;
+    /*A background in each cell and a smaller rectangle on it*/
+    for(y = 0; y < 200; y += 20) {
+        for(x = 0; x < 200; x += 20) {
+            add_rect(x, y, x + 19, y + 19);
+            add_rect(x + 5, y + 5, x + 14, y + 14);
+        }
+    }
+
+    TEST_ASSERT_NOT_NULL(layer._task_index);
+
+    /*Only the backgrounds can be drawn*/
+    TEST_ASSERT_EQUAL_UINT32(100, count_available());
+
+    /*Finish the backgrounds, now the rectangles on them are independent.
+     *Don't dispatch while there are queued tasks, the SW draw unit would take them.*/
+    set_all_ready(2);
+    TEST_ASSERT_EQUAL_UINT32(100, count_available());
+
+    set_all_ready(1);
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer._task_index);
+}
+
+void test_draw_task_index_same_as_list(void)
+{
+    uint32_t i;
+    /*Few tasks are checked on the list*/
+    for(i = 0; i < 20; i++) {
+        add_rect(i * 10, 0, i * 10 + 14, 9);
+    }
+    TEST_ASSERT_NULL(layer._task_index);
+    uint32_t cnt_list = count_available();
+
+    set_all_ready(1);
+    lv_draw_dispatch_layer(NULL, &layer);
+
+    /*Add the same tasks after many small ones*/
+    for(i = 0; i < 40; i++) {
+        add_rect(i * 5, 100, i * 5 + 4, 104);
+    }
+    for(i = 0; i < 20; i++) {
+        add_rect(i * 10, 0, i * 10 + 14, 9);
+    }
+    TEST_ASSERT_NOT_NULL(layer._task_index);
+    TEST_ASSERT_EQUAL_UINT32(40 + cnt_list, count_available());
+}
+
+void test_draw_task_index_out_of_layer(void)
+{
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        add_rect(i * 5, 100, i * 5 + 4, 104);
+    }
+    TEST_ASSERT_NOT_NULL(layer._task_index);
+
+    /*Both are clamped to the left edge tiles, they still have to be compared*/
+    add_rect(-50, 0, -10, 10);
+    add_rect(-30, 5, -20, 15);
+    TEST_ASSERT_EQUAL_UINT32(41, count_available());
+
+    /*Overlapping the layer from outside*/
+    add_rect(-100, -100, 300, 300);
+    TEST_ASSERT_EQUAL_UINT32(41, count_available());
+}
+
+void test_draw_task_index_tail(void)
+{
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        add_rect(i * 5, 100, i * 5 + 4, 104);
+    }
+    TEST_ASSERT_EQUAL_UINT32(40, layer._task_cnt);
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t->next) t = t->next;
+    TEST_ASSERT_EQUAL_PTR(t, layer._task_tail);
+
+    /*Remove every second task, the tail too. The others are set to waiting to not let the draw units take them.*/
+    t = layer.draw_task_head;
+    for(i = 0; t; i++) {
+        t->state = i % 2 == 0 || t->next == NULL ? LV_DRAW_TASK_STATE_READY : LV_DRAW_TASK_STATE_WAITING;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_EQUAL_UINT32(19, layer._task_cnt);
+
+    t = layer.draw_task_head;
+    while(t->next) t = t->next;
+    TEST_ASSERT_EQUAL_PTR(t, layer._task_tail);
+
+    /*The new task is added after the tail*/
+    add_rect(0, 0, 10, 10);
+    TEST_ASSERT_EQUAL_PTR(t->next, layer._task_tail);
+    TEST_ASSERT_EQUAL_UINT32(20, layer._task_cnt);
+}
+
+void test_draw_task_index_covering_task(void)
+{
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        add_rect(i * 5, 100, i * 5 + 4, 104);
+    }
+    TEST_ASSERT_NOT_NULL(layer._task_index);
+
+    /*A task covering the layer is being drawn, the newer tasks depend on it*/
+    add_rect(0, 0, 199, 199);
+    lv_draw_task_t * cover = layer._task_tail;
+    for(i = 0; i < 10; i++) {
+        add_rect(i * 20, 0, i * 20 + 9, 9);
+    }
+    set_all_ready(1);
+    cover->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    lv_draw_task_t * t = cover->next;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_QUEUED;
+        t = t->next;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, count_available());
+
+    /*Only the first one of the overlapping tasks can be drawn*/
+    cover->state = LV_DRAW_TASK_STATE_READY;
+    add_rect(0, 0, 9, 9);
+    TEST_ASSERT_EQUAL_UINT32(10, count_available());
+}
+
+#endif
@@ -0,0 +1,122 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#define SCREEN_W    800
+#define SCREEN_H    480
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_BIN_DECODER_RAM_LOAD && LV_USE_DRAW_VG_LITE == 0
+static uint8_t ref_px[SCREEN_W * SCREEN_H];
+
+static uint8_t get_i1_px(const lv_draw_buf_t * buf, int32_t x, int32_t y)
+{
+    const uint8_t * byte = lv_draw_buf_goto_xy(buf, x, y);
+    return (*byte >> (7 - (x & 0x7))) & 0x1;
+}
+
+static uint8_t get_i1_page_px(const lv_draw_buf_t * buf, int32_t x, int32_t y)
+{
+    const uint8_t * byte = lv_draw_buf_goto_xy(buf, x, y);
+    return (*byte >> (y & 0x7)) & 0x1;
+}
+
+static void render_scene(lv_color_format_t cf, lv_demo_render_scene_t id, lv_opa_t opa)
+{
+    lv_display_set_color_format(NULL, cf);
+    lv_demo_render(id, opa);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+#endif
+
+void test_render_to_i1_page_layout(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_I1_PAGE);
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+
+    /*One byte per column, 8 rows per line*/
+    TEST_ASSERT_EQUAL_UINT32(LV_ROUND_UP(SCREEN_W, LV_DRAW_BUF_STRIDE_ALIGN), buf->header.stride);
+    TEST_ASSERT_EQUAL_UINT32(SCREEN_H / 8, lv_draw_buf_height_to_lines(SCREEN_H, LV_COLOR_FORMAT_I1_PAGE));
+    TEST_ASSERT_EQUAL_UINT32(3, lv_draw_buf_height_to_lines(17, LV_COLOR_FORMAT_I1_PAGE));
+    TEST_ASSERT_EQUAL_UINT32(17, lv_draw_buf_height_to_lines(17, LV_COLOR_FORMAT_I1));
+
+    uint8_t * base = lv_draw_buf_goto_xy(buf, 0, 0);
+    TEST_ASSERT_EQUAL_PTR(base + 5, lv_draw_buf_goto_xy(buf, 5, 7));
+    TEST_ASSERT_EQUAL_PTR(base + buf->header.stride * 2 + 5, lv_draw_buf_goto_xy(buf, 5, 16));
+
+    /*A white pixel sets only its own bit*/
+    lv_obj_t * bg = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(bg);
+    lv_obj_set_size(bg, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_opa(bg, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(bg, lv_color_black(), 0);
+
+    lv_obj_t * dot = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(dot);
+    lv_obj_set_style_bg_opa(dot, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(dot, lv_color_white(), 0);
+    lv_obj_set_pos(dot, 10, 11);
+    lv_obj_set_size(dot, 1, 1);
+    lv_refr_now(NULL);
+
+    uint8_t * page = lv_draw_buf_goto_xy(buf, 0, 11);
+    TEST_ASSERT_EQUAL_HEX8(0x00, page[9]);
+    TEST_ASSERT_EQUAL_HEX8(1 << 3, page[10]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, page[11]);
+}
+
+void test_render_to_i1_page_matches_i1(void)
+{
+#if LV_BIN_DECODER_RAM_LOAD && LV_USE_DRAW_VG_LITE == 0
+    lv_opa_t opa_values[2] = {0xff, 0xc0};
+    uint32_t opa;
+    for(opa = 0; opa < 2; opa++) {
+        uint32_t i;
+        for(i = 0; i < LV_DEMO_RENDER_SCENE_NUM; i++) {
+            /*The non-normal blend modes are not handled for every source format in the I1 kernels*/
+            if(i == LV_DEMO_RENDER_SCENE_BLEND_MODE) continue;
+
+            render_scene(LV_COLOR_FORMAT_I1, i, opa_values[opa]);
+            lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+            int32_t x, y;
+            for(y = 0; y < SCREEN_H; y++) {
+                for(x = 0; x < SCREEN_W; x++) {
+                    ref_px[y * SCREEN_W + x] = get_i1_px(buf, x, y);
+                }
+            }
+
+            render_scene(LV_COLOR_FORMAT_I1_PAGE, i, opa_values[opa]);
+            buf = lv_display_get_buf_active(NULL);
+            uint32_t diff = 0;
+            for(y = 0; y < SCREEN_H; y++) {
+                for(x = 0; x < SCREEN_W; x++) {
+                    if(ref_px[y * SCREEN_W + x] != get_i1_page_px(buf, x, y)) diff++;
+                }
+            }
+
+            char msg[128];
+            lv_snprintf(msg, sizeof(msg), "scene %s, opa %d", lv_demo_render_get_scene_name(i), opa_values[opa]);
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, diff, msg);
+        }
+    }
+#else
+    /*Without LV_BIN_DECODER_RAM_LOAD can't test rotated images*/
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -27,6 +27,25 @@ static void custom_exec_cb(lv_anim_t * a, int32_t v)
     *var_i32 = v;
 }
 
+static int32_t * delete_var;
+
+static void delete_exec_cb(void * var, int32_t v)
+{
+    exec_cb(var, v);
+    if(delete_var) lv_anim_delete(delete_var, NULL);
+}
+
+static void start_anim(int32_t * var, lv_anim_exec_xcb_t cb, uint32_t duration)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, var);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, cb);
+    lv_anim_set_duration(&a, duration);
+    lv_anim_start(&a);
+}
+
 void test_anim_delete(void)
 {
     int32_t var;
@@ -91,4 +110,97 @@ void test_anim_delete_custom(void)
     TEST_ASSERT_EQUAL(39, var);
 }
 
+void test_anim_delete_in_exec_cb(void)
+{
+    static int32_t var1;
+    static int32_t var2;
+    static int32_t var3;
+
+    start_anim(&var1, exec_cb, 100);
+    start_anim(&var2, delete_exec_cb, 100);
+    start_anim(&var3, exec_cb, 100);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_anim_count_running());
+
+    /*The start values are applied right away*/
+    TEST_ASSERT_EQUAL(0, var1);
+
+    /*The newest animations run first, so var1 is deleted before its turn*/
+    delete_var = &var1;
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(0, var1);
+    TEST_ASSERT_EQUAL(19, var2);
+    TEST_ASSERT_EQUAL(19, var3);
+    TEST_ASSERT_EQUAL_UINT32(2, lv_anim_count_running());
+
+    /*var3 was updated already when var2's callback deletes it*/
+    delete_var = &var3;
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(39, var2);
+    TEST_ASSERT_EQUAL(39, var3);
+
+    /*Delete itself*/
+    delete_var = &var2;
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(59, var2);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(59, var2);
+    TEST_ASSERT_EQUAL(39, var3);
+    delete_var = NULL;
+}
+
+void test_anim_many(void)
+{
+    static int32_t vars[100];
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        vars[i] = -1;
+        start_anim(&vars[i], exec_cb, 10 + i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(100, lv_anim_count_running());
+    TEST_ASSERT_NOT_NULL(lv_anim_get(&vars[50], exec_cb));
+
+    lv_test_wait(30);
+    for(i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL(i <= 20 ? 100 : (lv_map(30, 0, 10 + i, 0, LV_BEZIER_VAL_MAX) * 100) >> LV_BEZIER_VAL_SHIFT, vars[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(100 - 21, lv_anim_count_running());
+
+    lv_anim_delete_all();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+    TEST_ASSERT_NULL(lv_anim_get(&vars[50], exec_cb));
+}
+
+void test_anim_path_bezier(void)
+{
+    /*With the tables the result must be the same*/
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, LV_BEZIER_VAL_MAX);
+    lv_anim_set_duration(&a, LV_BEZIER_VAL_MAX);
+
+    int32_t t;
+    for(t = 0; t <= LV_BEZIER_VAL_MAX; t++) {
+        a.act_time = t;
+        TEST_ASSERT_EQUAL(lv_cubic_bezier(t, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                                          LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1)), lv_anim_path_ease_in(&a));
+        TEST_ASSERT_EQUAL(lv_cubic_bezier(t, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
+                                          LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)), lv_anim_path_ease_out(&a));
+        TEST_ASSERT_EQUAL(lv_cubic_bezier(t, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                                          LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)), lv_anim_path_ease_in_out(&a));
+        TEST_ASSERT_EQUAL(lv_cubic_bezier(t, 341, 0, 683, 1300), lv_anim_path_overshoot(&a));
+    }
+
+    /*Other ranges and durations*/
+    lv_anim_set_values(&a, 100, -300);
+    lv_anim_set_duration(&a, 333);
+    for(t = 0; t <= 333; t++) {
+        a.act_time = t;
+        int32_t step = lv_cubic_bezier(lv_map(t, 0, 333, 0, LV_BEZIER_VAL_MAX), LV_BEZIER_VAL_FLOAT(0.42),
+                                       LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+        TEST_ASSERT_EQUAL(((step * -400) >> LV_BEZIER_VAL_SHIFT) + 100, lv_anim_path_ease_in_out(&a));
+    }
+}
+
 #endif
@@ -0,0 +1,276 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define SCREEN_W    800
+#define SCREEN_H    480
+
+static uint8_t ref_px[SCREEN_W * SCREEN_H];
+
+void setUp(void)
+{
+    lv_font_fmt_txt_cache_drop_all();
+}
+
+void tearDown(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_labels(const lv_font_t * font)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+
+    static const int32_t pos[][2] = {{0, 0}, {13, 21}, {-5, 43}, {101, 67}, {250, 93}};
+    uint32_t i;
+    for(i = 0; i < sizeof(pos) / sizeof(pos[0]); i++) {
+        lv_obj_t * label = lv_label_create(scr);
+        lv_label_set_text(label, "The quick brown fox jumps over the lazy dog! 0123456789 {}[]()");
+        lv_obj_set_style_text_font(label, font, 0);
+        lv_obj_set_style_text_color(label, lv_color_white(), 0);
+        lv_obj_set_pos(label, pos[i][0], pos[i][1]);
+    }
+}
+
+static void render(lv_color_format_t cf)
+{
+    lv_display_set_color_format(NULL, cf);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+static uint8_t get_px(const lv_draw_buf_t * buf, lv_color_format_t cf, int32_t x, int32_t y)
+{
+    const uint8_t * byte = lv_draw_buf_goto_xy(buf, x, y);
+    if(cf == LV_COLOR_FORMAT_I1) return (*byte >> (7 - (x & 0x7))) & 0x1;
+    if(cf == LV_COLOR_FORMAT_I1_PAGE) return (*byte >> (y & 0x7)) & 0x1;
+    return *byte > 127;
+}
+
+static uint32_t compare_to_ref(lv_color_format_t cf)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t diff = 0;
+    int32_t x, y;
+    for(y = 0; y < SCREEN_H; y++) {
+        for(x = 0; x < SCREEN_W; x++) {
+            if(ref_px[y * SCREEN_W + x] != get_px(buf, cf, x, y)) diff++;
+        }
+    }
+    return diff;
+}
+
+static void render_ref(void)
+{
+    render(LV_COLOR_FORMAT_L8);
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    int32_t x, y;
+    for(y = 0; y < SCREEN_H; y++) {
+        for(x = 0; x < SCREEN_W; x++) {
+            ref_px[y * SCREEN_W + x] = get_px(buf, LV_COLOR_FORMAT_L8, x, y);
+        }
+    }
+}
+
+#if LV_USE_FONT_COMPRESSED
+static uint8_t rle_bitmap[4096];
+static uint32_t rle_bit_pos;
+static lv_font_fmt_txt_glyph_dsc_t rle_glyph_dsc[128];
+static lv_font_fmt_txt_dsc_t rle_font_dsc;
+static lv_font_t rle_font;
+
+static uint8_t get_bit(const uint8_t * bitmap, uint32_t i)
+{
+    return (bitmap[i >> 3] >> (7 - (i & 0x7))) & 0x1;
+}
+
+static void rle_put(uint8_t v, uint8_t len)
+{
+    while(len) {
+        len--;
+        if((v >> len) & 0x1) rle_bitmap[rle_bit_pos >> 3] |= 0x80 >> (rle_bit_pos & 0x7);
+        rle_bit_pos++;
+    }
+}
+
+/*Compress a 1 bpp glyph the way `rle_next()` reads it, with the lines XORed. Runs are sent
+ *as repeat bits only, after 11 of them the pixel is sent again instead of a counter.*/
+static void rle_encode_glyph(const uint8_t * bitmap, int32_t w, int32_t h)
+{
+    bool repeated = false;
+    uint8_t prev = 0;
+    uint32_t count = 0;
+    int32_t i;
+    for(i = 0; i < w * h; i++) {
+        uint8_t px = get_bit(bitmap, i);
+        if(i >= w) px ^= get_bit(bitmap, i - w);
+
+        if(!repeated) {
+            rle_put(px, 1);
+            if(i != 0 && px == prev) {
+                repeated = true;
+                count = 0;
+            }
+            prev = px;
+        }
+        else if(px == prev) {
+            rle_put(1, 1);
+            count++;
+            if(count == 11) {
+                rle_put(0, 6);
+                rle_put(px, 1);
+                repeated = false;
+            }
+        }
+        else {
+            rle_put(0, 1);
+            rle_put(px, 1);
+            prev = px;
+            repeated = false;
+        }
+    }
+}
+
+/*A copy of a plain 1 bpp font with compressed bitmaps*/
+static const lv_font_t * rle_font_create(const lv_font_t * plain_font)
+{
+    const lv_font_fmt_txt_dsc_t * plain_dsc = plain_font->dsc;
+    TEST_ASSERT_EQUAL(1, plain_dsc->bpp);
+    TEST_ASSERT_EQUAL(1, plain_dsc->cmap_num);
+    TEST_ASSERT_EQUAL(LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY, plain_dsc->cmaps[0].type);
+
+    uint32_t glyph_cnt = plain_dsc->cmaps[0].glyph_id_start + plain_dsc->cmaps[0].range_length;
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(rle_glyph_dsc) / sizeof(rle_glyph_dsc[0]), glyph_cnt);
+
+    lv_memzero(rle_bitmap, sizeof(rle_bitmap));
+    rle_bit_pos = 0;
+    uint32_t gid;
+    for(gid = 0; gid < glyph_cnt; gid++) {
+        const lv_font_fmt_txt_glyph_dsc_t * gdsc = &plain_dsc->glyph_dsc[gid];
+        rle_glyph_dsc[gid] = *gdsc;
+        rle_glyph_dsc[gid].bitmap_index = rle_bit_pos / 8;
+        rle_encode_glyph(&plain_dsc->glyph_bitmap[gdsc->bitmap_index], gdsc->box_w, gdsc->box_h);
+        rle_bit_pos = LV_ALIGN_UP(rle_bit_pos, 8);
+    }
+    /*The reader may look one byte ahead*/
+    TEST_ASSERT_LESS_THAN_UINT32(sizeof(rle_bitmap), rle_bit_pos / 8 + 1);
+
+    rle_font_dsc = *plain_dsc;
+    rle_font_dsc.glyph_bitmap = rle_bitmap;
+    rle_font_dsc.glyph_dsc = rle_glyph_dsc;
+    rle_font_dsc.bitmap_format = LV_FONT_FMT_TXT_COMPRESSED;
+    rle_font = *plain_font;
+    rle_font.dsc = &rle_font_dsc;
+    return &rle_font;
+}
+#endif
+
+void test_font_fmt_txt_cache_stats(void)
+{
+    lv_font_fmt_txt_cache_stats_t stats;
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(LV_FONT_FMT_TXT_CACHE_SIZE, stats.max_size);
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "aabbcc");
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+    lv_refr_now(NULL);
+
+    /*Every glyph is expanded only once*/
+    lv_font_fmt_txt_cache_stats_t stats2;
+    lv_font_fmt_txt_cache_get_stats(&stats2);
+    TEST_ASSERT_EQUAL_UINT32(3, stats2.miss_cnt - stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, stats2.hit_cnt - stats.hit_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats2.size);
+
+    /*Redrawing the label uses only the cached glyphs*/
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    lv_font_fmt_txt_cache_stats_t stats3;
+    lv_font_fmt_txt_cache_get_stats(&stats3);
+    TEST_ASSERT_EQUAL_UINT32(stats2.miss_cnt, stats3.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(6, stats3.hit_cnt - stats2.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats2.size, stats3.size);
+
+    lv_font_fmt_txt_cache_drop_all();
+    lv_font_fmt_txt_cache_get_stats(&stats3);
+    TEST_ASSERT_EQUAL_UINT32(0, stats3.size);
+#else
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+#endif
+}
+
+void test_font_fmt_txt_cache_budget(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, SCREEN_W);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+
+    /*More glyphs than what fits into the cache*/
+    char txt[4 * 1024];
+    uint32_t i;
+    for(i = 0; i < sizeof(txt) - 1; i++) txt[i] = (char)(' ' + 1 + (i % 94));
+    txt[sizeof(txt) - 1] = '\0';
+    lv_label_set_text(label, txt);
+    lv_refr_now(NULL);
+
+    lv_font_fmt_txt_cache_stats_t stats;
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_FONT_FMT_TXT_CACHE_SIZE, stats.size);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_font_fmt_txt_cache_a1_glyphs(void)
+{
+    create_labels(&lv_font_unscii_8);
+
+    /*Expanded to A8*/
+    render_ref();
+
+    /*Drawn as A1 from the font's bitmap, twice to use the cached glyphs too*/
+    render(LV_COLOR_FORMAT_I1);
+    TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(LV_COLOR_FORMAT_I1));
+    render(LV_COLOR_FORMAT_I1);
+    TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(LV_COLOR_FORMAT_I1));
+
+    render(LV_COLOR_FORMAT_I1_PAGE);
+    TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(LV_COLOR_FORMAT_I1_PAGE));
+}
+
+void test_font_fmt_txt_cache_a1_glyphs_compressed(void)
+{
+#if LV_USE_FONT_COMPRESSED
+    create_labels(&lv_font_unscii_8);
+    render_ref();
+    lv_obj_clean(lv_screen_active());
+
+    /*Compressed 1 bpp glyphs are decompressed to A8 on every layer*/
+    create_labels(rle_font_create(&lv_font_unscii_8));
+    render(LV_COLOR_FORMAT_L8);
+    TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(LV_COLOR_FORMAT_L8));
+
+    render(LV_COLOR_FORMAT_I1);
+    TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(LV_COLOR_FORMAT_I1));
+    render(LV_COLOR_FORMAT_I1);
+    TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(LV_COLOR_FORMAT_I1));
+
+    render(LV_COLOR_FORMAT_I1_PAGE);
+    TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(LV_COLOR_FORMAT_I1_PAGE));
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*A small font with multi page cmaps and kern pairs. Only the glyph descriptors are used.*/
+static const lv_font_fmt_txt_glyph_dsc_t test_glyph_dsc[] = {
+    {.adv_w = 0}, /*id = 0 reserved*/
+    {.adv_w = 160}, {.adv_w = 160}, {.adv_w = 160}, {.adv_w = 160},
+    {.adv_w = 160}, {.adv_w = 160}, {.adv_w = 160}, {.adv_w = 160},
+    {.adv_w = 160}, {.adv_w = 160}, {.adv_w = 160}, {.adv_w = 160},
+};
+
+static const uint16_t test_unicode_list[] = {0x0, 0x5, 0x12c, 0x12d, 0x320};
+
+static const uint8_t test_glyph_id_ofs[] = {0, 1, 2};
+
+static const lv_font_fmt_txt_cmap_t test_cmaps[] = {
+    {
+        .range_start = 0x41, .range_length = 3, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL,
+        .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 0x100, .range_length = 3, .glyph_id_start = 4,
+        .unicode_list = NULL, .glyph_id_ofs_list = test_glyph_id_ofs,
+        .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = 0x4e00, .range_length = 0x321, .glyph_id_start = 7,
+        .unicode_list = test_unicode_list, .glyph_id_ofs_list = NULL,
+        .list_length = 5, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+};
+
+static const uint8_t test_kern_pair_ids[] = {1, 2, 1, 7, 8, 11, 11, 1};
+static const int8_t test_kern_pair_values[] = {-16, -32, 16, 48};
+
+static const lv_font_fmt_txt_kern_pair_t test_kern_pairs = {
+    .glyph_ids = test_kern_pair_ids,
+    .values = test_kern_pair_values,
+    .pair_cnt = 4,
+    .glyph_ids_size = 0
+};
+
+static const lv_font_fmt_txt_dsc_t test_font_dsc = {
+    .glyph_bitmap = NULL,
+    .glyph_dsc = test_glyph_dsc,
+    .cmaps = test_cmaps,
+    .kern_dsc = &test_kern_pairs,
+    .kern_scale = 16,
+    .cmap_num = 3,
+    .bpp = 1,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+static const lv_font_t test_font = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 10,
+    .base_line = 0,
+    .dsc = &test_font_dsc,
+};
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/*Find the glyph the simple way, by checking all cmaps and all items of the unicode lists*/
+static uint32_t get_glyph_id_linear(const lv_font_t * font, uint32_t letter)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if(rcp >= cmap->range_length) continue;
+
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) return cmap->glyph_id_start + rcp;
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            return cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+        }
+
+        uint32_t j;
+        for(j = 0; j < cmap->list_length; j++) {
+            if(cmap->unicode_list[j] != rcp) continue;
+            if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) return cmap->glyph_id_start + j;
+            else return cmap->glyph_id_start + ((const uint16_t *)cmap->glyph_id_ofs_list)[j];
+        }
+        return 0;
+    }
+
+    return 0;
+}
+
+static void check_all_letters(const lv_font_t * font)
+{
+    uint32_t letter;
+    for(letter = 1; letter < 0x20000; letter++) {
+        /*Drawn as a wide space*/
+        if(letter == '\t') continue;
+
+        lv_font_glyph_dsc_t dsc;
+        bool found = lv_font_get_glyph_dsc_fmt_txt(font, &dsc, letter, 0);
+        uint32_t gid = found ? dsc.gid.index : 0;
+        if(gid != get_glyph_id_linear(font, letter)) {
+            TEST_FAIL_MESSAGE("The glyph of a letter differs from the one found by a linear search");
+        }
+    }
+}
+
+static int32_t get_adv_w(uint32_t letter, uint32_t letter_next)
+{
+    lv_font_glyph_dsc_t dsc;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&test_font, &dsc, letter, letter_next));
+    return dsc.adv_w;
+}
+
+void test_font_fmt_txt_lookup_glyph_id(void)
+{
+    check_all_letters(&test_font);
+    check_all_letters(&lv_font_montserrat_14);
+#if LV_FONT_SIMSUN_16_CJK
+    check_all_letters(&lv_font_simsun_16_cjk);
+#endif
+#if LV_FONT_DEJAVU_16_PERSIAN_HEBREW
+    check_all_letters(&lv_font_dejavu_16_persian_hebrew);
+#endif
+}
+
+void test_font_fmt_txt_lookup_kern_pairs(void)
+{
+    TEST_ASSERT_EQUAL_INT32(10, get_adv_w('A', 0));
+    TEST_ASSERT_EQUAL_INT32(9, get_adv_w('A', 'B'));
+    TEST_ASSERT_EQUAL_INT32(8, get_adv_w('A', 0x4e00));
+    TEST_ASSERT_EQUAL_INT32(11, get_adv_w(0x4e05, 0x5120));
+    TEST_ASSERT_EQUAL_INT32(13, get_adv_w(0x5120, 'A'));
+
+    /*No kerning for the other pairs*/
+    TEST_ASSERT_EQUAL_INT32(10, get_adv_w('B', 'A'));
+    TEST_ASSERT_EQUAL_INT32(10, get_adv_w(0x4e00, 'A'));
+    TEST_ASSERT_EQUAL_INT32(10, get_adv_w(0x5120, 0x4e05));
+    TEST_ASSERT_EQUAL_INT32(10, get_adv_w(0x4f2d, 0x4f2c));
+}
+
+#endif
@@ -0,0 +1,299 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb888.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_l8.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_al88.h"
+
+#define SCREEN_W    800
+#define SCREEN_H    480
+
+#define IMG_W       45
+#define IMG_H       30
+
+static uint8_t ref_px[SCREEN_W * SCREEN_H];
+
+static uint8_t l8_data[IMG_W * IMG_H];
+static uint16_t rgb565_data[IMG_W * IMG_H];
+static uint8_t a1_data[(IMG_W + 7) / 8 * IMG_H];
+
+static lv_image_dsc_t l8_img;
+static lv_image_dsc_t rgb565_img;
+static lv_image_dsc_t a1_img;
+
+static void init_image(lv_image_dsc_t * img, lv_color_format_t cf, const void * data, uint32_t stride)
+{
+    lv_memzero(img, sizeof(lv_image_dsc_t));
+    img->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img->header.cf = cf;
+    img->header.w = IMG_W;
+    img->header.h = IMG_H;
+    img->header.stride = stride;
+    img->data = data;
+    img->data_size = stride * IMG_H;
+}
+
+void setUp(void)
+{
+    int32_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            l8_data[y * IMG_W + x] = (uint8_t)(x * 255 / IMG_W);
+            rgb565_data[y * IMG_W + x] = (uint16_t)(((x * 31 / IMG_W) << 11) | ((y * 63 / IMG_H) << 5));
+            if((x + y) % 3 == 0) a1_data[y * ((IMG_W + 7) / 8) + x / 8] |= (uint8_t)(0x80 >> (x % 8));
+        }
+    }
+
+    init_image(&l8_img, LV_COLOR_FORMAT_L8, l8_data, IMG_W);
+    init_image(&rgb565_img, LV_COLOR_FORMAT_RGB565, rgb565_data, IMG_W * 2);
+    init_image(&a1_img, LV_COLOR_FORMAT_A1, a1_data, (IMG_W + 7) / 8);
+
+    lv_image_cache_drop(NULL);
+}
+
+void tearDown(void)
+{
+    lv_image_cache_resize(LV_CACHE_DEF_SIZE, true);
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_images(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+
+    /*Clipped on the left not at a byte boundary too*/
+    static const int32_t pos[][2] = {{0, 0}, {13, 41}, {-5, 83}, {101, 127}};
+    const lv_image_dsc_t * srcs[] = {&l8_img, &rgb565_img, &a1_img};
+    uint32_t i, s;
+    for(s = 0; s < 3; s++) {
+        for(i = 0; i < sizeof(pos) / sizeof(pos[0]); i++) {
+            lv_obj_t * img = lv_image_create(scr);
+            lv_image_set_src(img, srcs[s]);
+            lv_obj_set_style_image_recolor(img, lv_color_white(), 0);
+            lv_obj_set_pos(img, pos[i][0] + s * 200, pos[i][1]);
+        }
+    }
+}
+
+static void render(lv_color_format_t cf)
+{
+    lv_display_set_color_format(NULL, cf);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+static uint8_t get_px(const lv_draw_buf_t * buf, lv_color_format_t cf, int32_t x, int32_t y)
+{
+    const uint8_t * byte = lv_draw_buf_goto_xy(buf, x, y);
+    if(cf == LV_COLOR_FORMAT_I1) return (*byte >> (7 - (x & 0x7))) & 0x1;
+    return (*byte >> (y & 0x7)) & 0x1;
+}
+
+static void save_ref(lv_color_format_t cf)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    int32_t x, y;
+    for(y = 0; y < SCREEN_H; y++) {
+        for(x = 0; x < SCREEN_W; x++) {
+            ref_px[y * SCREEN_W + x] = get_px(buf, cf, x, y);
+        }
+    }
+}
+
+static uint32_t compare_to_ref(lv_color_format_t cf)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t diff = 0;
+    int32_t x, y;
+    for(y = 0; y < SCREEN_H; y++) {
+        for(x = 0; x < SCREEN_W; x++) {
+            if(ref_px[y * SCREEN_W + x] != get_px(buf, cf, x, y)) diff++;
+        }
+    }
+    return diff;
+}
+
+static uint32_t get_converted_size(const void * src, lv_color_format_t cf)
+{
+    lv_cache_entry_t * entry = lv_image_cache_acquire_converted(src, cf);
+    if(entry == NULL) return 0;
+
+    const lv_image_cache_data_t * data = lv_cache_entry_get_data(entry);
+    TEST_ASSERT_EQUAL(cf, data->decoded->header.cf);
+    uint32_t size = data->decoded->data_size;
+    lv_image_cache_release(entry);
+    return size;
+}
+
+void test_image_cache_i1_entries(void)
+{
+    create_images();
+    render(LV_COLOR_FORMAT_I1);
+
+    /*Only the converted images are cached, at their own size*/
+    uint32_t l8_size = get_converted_size(&l8_img, LV_COLOR_FORMAT_I1);
+    uint32_t rgb565_size = get_converted_size(&rgb565_img, LV_COLOR_FORMAT_I1);
+    uint32_t a1_size = get_converted_size(&a1_img, LV_COLOR_FORMAT_A1);
+    TEST_ASSERT_NOT_EQUAL(0, l8_size);
+    TEST_ASSERT_NOT_EQUAL(0, rgb565_size);
+    TEST_ASSERT_NOT_EQUAL(0, a1_size);
+    TEST_ASSERT_LESS_THAN_UINT32(l8_img.data_size / 4, l8_size);
+    TEST_ASSERT_EQUAL_UINT32(l8_size + rgb565_size + a1_size,
+                             lv_cache_get_size(LV_GLOBAL_DEFAULT()->img_cache, NULL));
+
+    /*Not for other color formats*/
+    TEST_ASSERT_EQUAL_UINT32(0, get_converted_size(&l8_img, LV_COLOR_FORMAT_A1));
+
+    lv_image_cache_drop(&l8_img);
+    TEST_ASSERT_EQUAL_UINT32(0, get_converted_size(&l8_img, LV_COLOR_FORMAT_I1));
+    TEST_ASSERT_NOT_EQUAL(0, get_converted_size(&rgb565_img, LV_COLOR_FORMAT_I1));
+}
+
+void test_image_cache_i1_same_pixels(void)
+{
+    create_images();
+
+    lv_color_format_t cfs[] = {LV_COLOR_FORMAT_I1, LV_COLOR_FORMAT_I1_PAGE};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        /*Converted while drawing*/
+        uint32_t cache_size = lv_cache_get_max_size(LV_GLOBAL_DEFAULT()->img_cache, NULL);
+        lv_image_cache_resize(0, true);
+        render(cfs[i]);
+        save_ref(cfs[i]);
+        lv_image_cache_resize(cache_size, true);
+
+        /*Converted once and then drawn from the cache*/
+        render(cfs[i]);
+#if LV_DRAW_SW_I1_DITHER == LV_DRAW_SW_I1_DITHER_NONE
+        TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(cfs[i]));
+#else
+        /*Error diffusion on the converted images gives different pixels than the ordered dithering*/
+        save_ref(cfs[i]);
+#endif
+        render(cfs[i]);
+        TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(cfs[i]));
+    }
+}
+
+void test_image_cache_i1_too_small_cache(void)
+{
+    create_images();
+    render(LV_COLOR_FORMAT_I1);
+    save_ref(LV_COLOR_FORMAT_I1);
+
+    /*Smaller than a converted image: they are drawn the same way without caching them*/
+    lv_image_cache_resize(16, true);
+    render(LV_COLOR_FORMAT_I1);
+    TEST_ASSERT_EQUAL_UINT32(0, compare_to_ref(LV_COLOR_FORMAT_I1));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_cache_get_size(LV_GLOBAL_DEFAULT()->img_cache, NULL));
+}
+
+#define BLEND_W     37
+#define BLEND_H     3
+
+static void blend_i1_image(lv_color_format_t dest_cf, uint8_t * dest_buf, const uint8_t * src_buf,
+                           int32_t src_bit_ofs, const lv_opa_t * mask_buf, lv_opa_t opa, lv_blend_mode_t blend_mode)
+{
+    lv_draw_sw_blend_image_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = dest_buf;
+    dsc.dest_w = BLEND_W;
+    dsc.dest_h = BLEND_H;
+    dsc.dest_stride = BLEND_W * lv_color_format_get_size(dest_cf);
+    dsc.src_buf = src_buf;
+    dsc.src_stride = (BLEND_W + 7 + 8) / 8;
+    dsc.src_color_format = LV_COLOR_FORMAT_I1;
+    dsc.src_bit_ofs = src_bit_ofs;
+    dsc.mask_buf = mask_buf;
+    dsc.mask_stride = BLEND_W;
+    dsc.opa = opa;
+    dsc.blend_mode = blend_mode;
+    lv_area_set(&dsc.relative_area, 0, 0, BLEND_W - 1, BLEND_H - 1);
+    dsc.src_area = dsc.relative_area;
+
+    switch(dest_cf) {
+        case LV_COLOR_FORMAT_RGB565:
+            lv_draw_sw_blend_image_to_rgb565(&dsc);
+            break;
+        case LV_COLOR_FORMAT_RGB888:
+            lv_draw_sw_blend_image_to_rgb888(&dsc, 3);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888:
+            lv_draw_sw_blend_image_to_argb8888(&dsc);
+            break;
+        case LV_COLOR_FORMAT_L8:
+            lv_draw_sw_blend_image_to_l8(&dsc);
+            break;
+        case LV_COLOR_FORMAT_AL88:
+            lv_draw_sw_blend_image_to_al88(&dsc);
+            break;
+        default:
+            TEST_FAIL();
+    }
+}
+
+void test_image_cache_i1_unaligned_source(void)
+{
+    static const lv_color_format_t dest_cfs[] = {
+        LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_ARGB8888,
+        LV_COLOR_FORMAT_L8, LV_COLOR_FORMAT_AL88
+    };
+    static const lv_blend_mode_t blend_modes[] = {LV_BLEND_MODE_NORMAL, LV_BLEND_MODE_ADDITIVE};
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_60};
+    const int32_t src_stride = (BLEND_W + 7 + 8) / 8;
+    static uint8_t src_aligned[(BLEND_W + 7 + 8) / 8 * BLEND_H];
+    static uint8_t src_shifted[(BLEND_W + 7 + 8) / 8 * BLEND_H];
+    static lv_opa_t mask[BLEND_W * BLEND_H];
+    static uint8_t dest_ref[BLEND_W * BLEND_H * 4];
+    static uint8_t dest[BLEND_W * BLEND_H * 4];
+
+    int32_t x, y;
+    for(y = 0; y < BLEND_H; y++) {
+        for(x = 0; x < BLEND_W; x++) {
+            mask[y * BLEND_W + x] = (lv_opa_t)(x * 7 + y * 50);
+        }
+    }
+
+    /*The same pixels starting at the MSB and at the `ofs`th bit*/
+    int32_t ofs;
+    for(ofs = 1; ofs < 8; ofs++) {
+        lv_memzero(src_aligned, sizeof(src_aligned));
+        lv_memset(src_shifted, 0xa5, sizeof(src_shifted));
+        for(y = 0; y < BLEND_H; y++) {
+            for(x = 0; x < BLEND_W; x++) {
+                if((x * x + y) % 5 > 1) src_aligned[y * src_stride + x / 8] |= (uint8_t)(0x80 >> (x % 8));
+                uint8_t * byte = &src_shifted[y * src_stride + (x + ofs) / 8];
+                uint8_t bit = (uint8_t)(0x80 >> ((x + ofs) % 8));
+                if((x * x + y) % 5 > 1) *byte |= bit;
+                else *byte &= ~bit;
+            }
+        }
+
+        uint32_t c, b, o, m;
+        for(c = 0; c < sizeof(dest_cfs) / sizeof(dest_cfs[0]); c++) {
+            uint32_t size = BLEND_W * BLEND_H * lv_color_format_get_size(dest_cfs[c]);
+            for(b = 0; b < sizeof(blend_modes) / sizeof(blend_modes[0]); b++) {
+                for(o = 0; o < sizeof(opas) / sizeof(opas[0]); o++) {
+                    for(m = 0; m < 2; m++) {
+                        const lv_opa_t * mask_buf = m ? mask : NULL;
+                        lv_memset(dest_ref, 0x40, size);
+                        lv_memset(dest, 0x40, size);
+                        blend_i1_image(dest_cfs[c], dest_ref, src_aligned, 0, mask_buf, opas[o], blend_modes[b]);
+                        blend_i1_image(dest_cfs[c], dest, src_shifted, ofs, mask_buf, opas[o], blend_modes[b]);
+                        TEST_ASSERT_EQUAL_UINT8_ARRAY(dest_ref, dest, size);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif
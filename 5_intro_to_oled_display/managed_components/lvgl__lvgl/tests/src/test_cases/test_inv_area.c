@@ -0,0 +1,113 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_display_t * disp;
+
+static void inv(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t a = {x1, y1, x2, y2};
+    lv_inv_area(disp, &a);
+}
+
+static uint32_t get_inv_size(void)
+{
+    uint32_t size = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        size += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    return size;
+}
+
+void setUp(void)
+{
+    disp = lv_display_get_default();
+    lv_refr_now(disp);
+}
+
+void tearDown(void)
+{
+    lv_inv_area(disp, NULL);
+}
+
+void test_inv_area_contained(void)
+{
+    inv(10, 10, 109, 109);
+    inv(20, 20, 29, 29);
+    TEST_ASSERT_EQUAL_UINT32(1, disp->inv_p);
+
+    /*The larger area replaces the smaller one*/
+    inv(0, 0, 199, 199);
+    TEST_ASSERT_EQUAL_UINT32(1, disp->inv_p);
+    TEST_ASSERT_EQUAL_UINT32(200 * 200, get_inv_size());
+}
+
+void test_inv_area_join_neighbors(void)
+{
+    /*The same row of a list, updated in two steps*/
+    inv(0, 0, 99, 19);
+    inv(100, 0, 199, 19);
+    TEST_ASSERT_EQUAL_UINT32(1, disp->inv_p);
+    TEST_ASSERT_EQUAL_UINT32(200 * 20, get_inv_size());
+
+    /*The joined area is joined again with the next one*/
+    inv(0, 20, 199, 39);
+    TEST_ASSERT_EQUAL_UINT32(1, disp->inv_p);
+    TEST_ASSERT_EQUAL_UINT32(200 * 40, get_inv_size());
+}
+
+void test_inv_area_no_overdraw(void)
+{
+    /*Overlapping on a side, the common part shouldn't be drawn twice*/
+    inv(0, 0, 99, 99);
+    inv(20, 90, 79, 189);
+    TEST_ASSERT_EQUAL_UINT32(2, disp->inv_p);
+    TEST_ASSERT_EQUAL_UINT32(100 * 100 + 60 * 90, get_inv_size());
+}
+
+void test_inv_area_many_small(void)
+{
+    /*Small widgets (e.g. clocks or meters) spread on the screen, more than LV_INV_BUF_SIZE*/
+    uint32_t i;
+    for(i = 0; i < LV_INV_BUF_SIZE * 2; i++) {
+        int32_t x = (i % 8) * 100;
+        int32_t y = (i / 8) * 60;
+        inv(x, y, x + 19, y + 9);
+    }
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_INV_BUF_SIZE, disp->inv_p);
+
+    /*Much less than the full screen*/
+    TEST_ASSERT_LESS_THAN_UINT32(800 * 480 / 4, get_inv_size());
+
+    /*Every area is still invalid*/
+    for(i = 0; i < LV_INV_BUF_SIZE * 2; i++) {
+        int32_t x = (i % 8) * 100;
+        int32_t y = (i / 8) * 60;
+        lv_area_t a = {x, y, x + 19, y + 9};
+        uint32_t j;
+        for(j = 0; j < disp->inv_p; j++) {
+            if(lv_area_is_in(&a, &disp->inv_areas[j], 0)) break;
+        }
+        TEST_ASSERT_LESS_THAN_UINT32(disp->inv_p, j);
+    }
+}
+
+void test_inv_area_render(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "12:00");
+    lv_obj_center(label);
+    lv_refr_now(disp);
+
+    /*Updating a small widget redraws only a small area*/
+    lv_label_set_text(label, "12:01");
+    TEST_ASSERT_LESS_THAN_UINT32(800 * 480 / 100, get_inv_size());
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->inv_p);
+}
+
+#endif
@@ -0,0 +1,234 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 400);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_style_pad_gap(cont, 0, 0);
+    lv_obj_set_style_border_width(cont, 0, 0);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * item_create(int32_t h)
+{
+    lv_obj_t * obj = lv_obj_create(cont);
+    lv_obj_set_size(obj, 50, h);
+    return obj;
+}
+
+/*Check that each child is below the previous one*/
+static void check_column(void)
+{
+    int32_t y = cont->coords.y1;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(cont); i++) {
+        lv_obj_t * obj = lv_obj_get_child(cont, i);
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) continue;
+        y += lv_obj_get_style_margin_top(obj, 0);
+        TEST_ASSERT_EQUAL_INT32(y, obj->coords.y1);
+        y = obj->coords.y2 + 1 + lv_obj_get_style_margin_bottom(obj, 0);
+    }
+}
+
+void test_layout_cache_flex_insert_delete(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        item_create(10 + i);
+    }
+    lv_obj_update_layout(cont);
+    check_column();
+
+    lv_obj_t * first = item_create(15);
+    lv_obj_move_to_index(first, 0);
+    lv_obj_update_layout(cont);
+    check_column();
+
+    lv_obj_delete(lv_obj_get_child(cont, 5));
+    lv_obj_update_layout(cont);
+    check_column();
+
+    /*Insert and delete at the same time*/
+    lv_obj_t * obj = item_create(30);
+    lv_obj_move_to_index(obj, 3);
+    lv_obj_delete(lv_obj_get_child(cont, 7));
+    lv_obj_update_layout(cont);
+    check_column();
+
+    lv_obj_swap(first, obj);
+    lv_obj_update_layout(cont);
+    check_column();
+
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(cont);
+    check_column();
+}
+
+void test_layout_cache_flex_delete_swap(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    lv_obj_t * c = item_create(20);
+    lv_obj_t * y = item_create(20);
+    lv_obj_t * q = item_create(20);
+    lv_obj_update_layout(cont);
+
+    /*The old item of `q` must not stay in the cache after the last child*/
+    lv_obj_delete(y);
+    lv_obj_swap(c, q);
+    lv_obj_set_style_margin_top(q, 20, 0);
+    lv_obj_update_layout(cont);
+    check_column();
+
+    lv_obj_t * z = item_create(20);
+    lv_obj_move_to_index(q, 2);
+    lv_obj_update_layout(cont);
+    check_column();
+    TEST_ASSERT_EQUAL_INT32(z->coords.y1 + 40, q->coords.y1);
+}
+
+void test_layout_cache_flex_style_change(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        item_create(20);
+    }
+    lv_obj_update_layout(cont);
+
+    lv_obj_t * obj = lv_obj_get_child(cont, 2);
+    lv_obj_set_style_margin_top(obj, 7, 0);
+    lv_obj_update_layout(cont);
+    check_column();
+    TEST_ASSERT_EQUAL_INT32(cont->coords.y1 + 47, obj->coords.y1);
+
+    /*From a shared style*/
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_obj_add_style(obj, &style, 0);
+    lv_style_set_margin_bottom(&style, 5);
+    lv_obj_report_style_change(&style);
+    lv_obj_update_layout(cont);
+    check_column();
+    TEST_ASSERT_EQUAL_INT32(obj->coords.y2 + 6, lv_obj_get_child(cont, 3)->coords.y1);
+
+    lv_obj_set_style_translate_x(obj, 10, 0);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1 + 10, obj->coords.x1);
+
+    lv_obj_remove_style(obj, &style, 0);
+    lv_obj_set_style_margin_top(obj, 0, 0);
+    lv_obj_set_flex_grow(obj, 1);
+    lv_obj_update_layout(cont);
+    check_column();
+    TEST_ASSERT_EQUAL_INT32(cont->coords.y2, lv_obj_get_child(cont, 4)->coords.y2);
+}
+
+void test_layout_cache_grid(void)
+{
+    static const int32_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    static const int32_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+
+    lv_obj_t * a = item_create(20);
+    lv_obj_set_grid_cell(a, LV_GRID_ALIGN_START, 0, 1, LV_GRID_ALIGN_START, 0, 1);
+    lv_obj_t * b = item_create(30);
+    lv_obj_set_grid_cell(b, LV_GRID_ALIGN_START, 1, 1, LV_GRID_ALIGN_START, 1, 1);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1 + 50, b->coords.x1);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.y1 + 20, b->coords.y1);
+
+    /*A larger item in the first column makes it wider*/
+    lv_obj_t * c = item_create(10);
+    lv_obj_set_width(c, 80);
+    lv_obj_set_grid_cell(c, LV_GRID_ALIGN_END, 0, 1, LV_GRID_ALIGN_START, 1, 1);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1 + 80, b->coords.x1);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1, a->coords.x1);
+
+    /*Move it to the second column*/
+    lv_obj_set_grid_cell(c, LV_GRID_ALIGN_END, 1, 1, LV_GRID_ALIGN_START, 0, 1);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1 + 50, b->coords.x1);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1 + 50, c->coords.x1);
+
+    /*The inherited base direction swaps the start and end alignment*/
+    lv_obj_set_style_base_dir(cont, LV_BASE_DIR_RTL, 0);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(b->coords.x2, c->coords.x2);
+    TEST_ASSERT_EQUAL_INT32(c->coords.x1, b->coords.x1 - 30);
+
+    lv_obj_set_style_base_dir(cont, LV_BASE_DIR_LTR, 0);
+    lv_obj_delete(c);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1 + 50, b->coords.x1);
+}
+
+void test_layout_cache_change_layout(void)
+{
+    static const int32_t col_dsc[] = {60, 60, LV_GRID_TEMPLATE_LAST};
+    static const int32_t row_dsc[] = {40, 40, LV_GRID_TEMPLATE_LAST};
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * obj = item_create(20);
+        lv_obj_set_grid_cell(obj, LV_GRID_ALIGN_START, i % 2, 1, LV_GRID_ALIGN_START, i / 2, 1);
+    }
+    lv_obj_update_layout(cont);
+    check_column();
+
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    lv_obj_update_layout(cont);
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * obj = lv_obj_get_child(cont, i);
+        TEST_ASSERT_EQUAL_INT32(cont->coords.x1 + (i % 2) * 60, obj->coords.x1);
+        TEST_ASSERT_EQUAL_INT32(cont->coords.y1 + (i / 2) * 40, obj->coords.y1);
+    }
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_layout(cont, LV_LAYOUT_FLEX, 0);
+    lv_obj_update_layout(cont);
+    check_column();
+}
+
+void test_layout_cache_set_parent(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_t * cont2 = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont2, 200, 200);
+    lv_obj_set_style_pad_all(cont2, 0, 0);
+    lv_obj_set_style_border_width(cont2, 0, 0);
+    lv_obj_set_flex_flow(cont2, LV_FLEX_FLOW_ROW);
+
+    lv_obj_t * obj = item_create(20);
+    item_create(20);
+    lv_obj_update_layout(lv_screen_active());
+
+    lv_obj_set_parent(obj, cont2);
+    lv_obj_move_to_index(obj, 0);
+    lv_obj_set_style_margin_left(obj, 10, 0);
+    lv_obj_update_layout(lv_screen_active());
+    check_column();
+    TEST_ASSERT_EQUAL_INT32(cont2->coords.x1 + 10, obj->coords.x1);
+
+    lv_obj_set_parent(obj, cont);
+    lv_obj_update_layout(lv_screen_active());
+    check_column();
+}
+
+#endif
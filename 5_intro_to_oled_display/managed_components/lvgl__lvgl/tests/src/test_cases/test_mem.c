@@ -24,4 +24,136 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+void test_mem_slab(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_SLAB
+    static void * ptrs[100];
+    lv_mem_monitor_t mon1;
+    lv_mem_monitor_t mon2;
+    lv_mem_monitor(&mon1);
+
+    /*Fill more than two pages of 24 byte slots*/
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        ptrs[i] = lv_malloc(20);
+        TEST_ASSERT_NOT_NULL(ptrs[i]);
+        lv_memset(ptrs[i], i, 20);
+    }
+
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_EQUAL_UINT32(24, mon2.slab[2].slot_size);
+    TEST_ASSERT_EQUAL_UINT32(mon1.slab[2].used_cnt + 100, mon2.slab[2].used_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(mon1.slab[2].page_cnt + 1, mon2.slab[2].page_cnt);
+    TEST_ASSERT_EQUAL(mon1.used_cnt + 100, mon2.used_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+
+    /*The slot is kept only if the new size has the same slot size*/
+    ptrs[0] = lv_realloc(ptrs[0], 200);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, ptrs[0], 20);
+    void * p = lv_realloc(ptrs[1], 17);
+    TEST_ASSERT_EQUAL_PTR(ptrs[1], p);
+    p = lv_realloc(ptrs[3], 10);
+    TEST_ASSERT_NOT_EQUAL(ptrs[3], p);
+    TEST_ASSERT_EACH_EQUAL_UINT8(3, p, 10);
+    ptrs[3] = lv_realloc(p, 20);
+    TEST_ASSERT_EACH_EQUAL_UINT8(3, ptrs[3], 10);
+    lv_memset(ptrs[3], 3, 20);
+    ptrs[2] = lv_realloc(ptrs[2], 40);
+    TEST_ASSERT_EACH_EQUAL_UINT8(2, ptrs[2], 20);
+
+    /*Small data shrunk in TLSF is moved to a slot too*/
+    ptrs[0] = lv_realloc(ptrs[0], 20);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, ptrs[0], 20);
+
+    for(i = 0; i < 100; i += 2) {
+        TEST_ASSERT_EACH_EQUAL_UINT8(i, ptrs[i], 20);
+        lv_free(ptrs[i]);
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+
+    /*The freed slots are reused*/
+    for(i = 0; i < 100; i += 2) {
+        ptrs[i] = lv_malloc(17);
+    }
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_EQUAL_UINT32(mon1.slab[2].used_cnt + 100, mon2.slab[2].used_cnt);
+
+    for(i = 0; i < 100; i++) {
+        lv_free(ptrs[i]);
+    }
+
+    /*All the pages are given back*/
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_EQUAL_UINT32(mon1.slab[2].page_cnt, mon2.slab[2].page_cnt);
+    TEST_ASSERT_EQUAL_UINT32(mon1.slab[2].used_cnt, mon2.slab[2].used_cnt);
+    TEST_ASSERT_EQUAL(mon1.free_size, mon2.free_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_slab_full(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_SLAB
+    static void * ptrs[LV_MEM_SLAB_SIZE / 128 + 10];
+    const uint32_t cnt = sizeof(ptrs) / sizeof(ptrs[0]);
+    lv_mem_monitor_t mon1;
+    lv_mem_monitor_t mon2;
+    lv_mem_monitor(&mon1);
+
+    /*More 128 byte slots than what fits into the slab area*/
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        ptrs[i] = lv_malloc(128);
+        TEST_ASSERT_NOT_NULL(ptrs[i]);
+        lv_memset(ptrs[i], i, 128);
+    }
+
+    /*The rest is allocated from TLSF*/
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_LESS_THAN_UINT32(cnt, mon2.slab[7].used_cnt - mon1.slab[7].used_cnt);
+    TEST_ASSERT_EQUAL(mon1.used_cnt + cnt, mon2.used_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+
+    for(i = 0; i < cnt; i++) {
+        TEST_ASSERT_EACH_EQUAL_UINT8(i & 0xff, ptrs[i], 128);
+        lv_free(ptrs[i]);
+    }
+
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_EQUAL_UINT32(mon1.slab[7].page_cnt, mon2.slab[7].page_cnt);
+    TEST_ASSERT_EQUAL(mon1.free_size, mon2.free_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_slab_sizes(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_SLAB
+    static const size_t sizes[] = {1, 8, 9, 16, 17, 24, 25, 32, 33, 48, 49, 64, 65, 96, 97, 128, 129};
+    static void * ptrs[sizeof(sizes) / sizeof(sizes[0])];
+    lv_mem_monitor_t mon1;
+    lv_mem_monitor_t mon2;
+    lv_mem_monitor(&mon1);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        ptrs[i] = lv_malloc(sizes[i]);
+        TEST_ASSERT_NOT_NULL(ptrs[i]);
+        TEST_ASSERT_EQUAL(0, (lv_uintptr_t)ptrs[i] % sizeof(void *));
+        lv_memset(ptrs[i], 0x55, sizes[i]);
+    }
+
+    lv_mem_monitor(&mon2);
+    /*Two allocations in each class and 129 bytes from TLSF*/
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(mon1.slab[i].used_cnt + 2, mon2.slab[i].used_cnt);
+    }
+
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        lv_free(ptrs[i]);
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
 #endif
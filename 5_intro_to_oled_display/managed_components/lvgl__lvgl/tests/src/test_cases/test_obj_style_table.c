@@ -0,0 +1,131 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * obj;
+
+void setUp(void)
+{
+    obj = lv_obj_create(lv_screen_active());
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_obj_style_table_local_style(void)
+{
+    lv_obj_set_style_radius(obj, 10, 0);
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_style_radius(obj, 0));
+
+    lv_obj_set_style_radius(obj, 20, 0);
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_style_radius(obj, 0));
+
+    /*Falls back to the theme's value*/
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_RADIUS, 0);
+    lv_obj_t * ref = lv_obj_create(lv_screen_active());
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_style_radius(ref, 0), lv_obj_get_style_radius(obj, 0));
+}
+
+void test_obj_style_table_shared_style(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_border_width(&style, 3);
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL_INT32(3, lv_obj_get_style_border_width(obj, 0));
+
+    lv_style_set_border_width(&style, 5);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_border_width(obj, 0));
+
+    lv_obj_remove_style(obj, &style, 0);
+    TEST_ASSERT_NOT_EQUAL_INT32(5, lv_obj_get_style_border_width(obj, 0));
+
+    lv_style_reset(&style);
+}
+
+void test_obj_style_table_state(void)
+{
+    lv_obj_set_style_bg_opa(obj, LV_OPA_50, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_70, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_obj_add_state(obj, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_70, lv_obj_get_style_bg_opa(obj, 0));
+
+    /*Other states are resolved separately*/
+    TEST_ASSERT_TRUE(lv_obj_has_style_prop(obj, LV_STATE_CHECKED, LV_STYLE_BG_OPA));
+
+    lv_obj_remove_state(obj, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, lv_obj_get_style_bg_opa(obj, 0));
+}
+
+void test_obj_style_table_parts(void)
+{
+    lv_obj_set_style_width(obj, 30, LV_PART_SCROLLBAR);
+    lv_obj_set_style_width(obj, 40, LV_PART_INDICATOR);
+    lv_obj_set_width(obj, 100);
+
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_style_width(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_INT32(30, lv_obj_get_style_width(obj, LV_PART_SCROLLBAR));
+    TEST_ASSERT_EQUAL_INT32(40, lv_obj_get_style_width(obj, LV_PART_INDICATOR));
+}
+
+void test_obj_style_table_inherit(void)
+{
+    /*The theme sets the text color of the objects*/
+    lv_obj_t * child = lv_obj_create(obj);
+    lv_obj_remove_style_all(child);
+    lv_obj_set_style_text_color(obj, lv_color_hex(0xff0000), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(child, 0));
+
+    /*Changing the parent's inherited property is seen by the child*/
+    lv_obj_set_style_text_color(obj, lv_color_hex(0x00ff00), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(child, 0));
+
+    /*Moving to a new parent too*/
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x0000ff), 0);
+    lv_obj_set_parent(child, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(child, 0));
+}
+
+void test_obj_style_table_transition(void)
+{
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_OPA, 0};
+    static lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+
+    lv_obj_set_style_bg_opa(obj, LV_OPA_0, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_100, LV_STATE_PRESSED);
+    lv_obj_set_style_transition(obj, &tr, LV_STATE_PRESSED);
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    lv_test_wait(50);
+    lv_opa_t opa = lv_obj_get_style_bg_opa(obj, 0);
+    TEST_ASSERT_GREATER_THAN_UINT8(LV_OPA_0, opa);
+    TEST_ASSERT_LESS_THAN_UINT8(LV_OPA_100, opa);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_100, lv_obj_get_style_bg_opa(obj, 0));
+}
+
+void test_obj_style_table_custom_prop(void)
+{
+    static lv_style_prop_t prop = 0;
+    if(prop == 0) prop = lv_style_register_prop(LV_STYLE_PROP_FLAG_NONE);
+
+    lv_style_value_t v = {.num = 42};
+    lv_obj_set_local_style_prop(obj, prop, v, 0);
+    TEST_ASSERT_EQUAL_INT32(42, lv_obj_get_style_prop(obj, 0, prop).num);
+
+    v.num = 43;
+    lv_obj_set_local_style_prop(obj, prop, v, 0);
+    TEST_ASSERT_EQUAL_INT32(43, lv_obj_get_style_prop(obj, 0, prop).num);
+}
+
+#endif
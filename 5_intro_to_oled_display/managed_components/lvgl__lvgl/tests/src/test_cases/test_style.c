@@ -141,4 +141,124 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+void test_style_prop_index(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_value_t v;
+    uint32_t i;
+
+    /*Add properties until the style has an index too*/
+    for(i = 0; i < LV_STYLE_PROP_INDEX_MIN_CNT * 2; i++) {
+        v.num = i + 100;
+        lv_style_set_prop(&style, LV_STYLE_WIDTH + i, v);
+    }
+    TEST_ASSERT_EQUAL(LV_STYLE_PROP_INDEX_MIN_CNT * 2, style.prop_cnt);
+
+    /*A custom property is found on the list, not in the index*/
+    static lv_style_prop_t custom_prop = 0;
+    if(custom_prop == 0) custom_prop = lv_style_register_prop(LV_STYLE_PROP_FLAG_NONE);
+    v.num = 42;
+    lv_style_set_prop(&style, custom_prop, v);
+
+    for(i = 0; i < LV_STYLE_PROP_INDEX_MIN_CNT * 2; i++) {
+        TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_WIDTH + i, &v));
+        TEST_ASSERT_EQUAL(i + 100, v.num);
+    }
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, LV_STYLE_TEXT_COLOR, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, custom_prop, &v));
+    TEST_ASSERT_EQUAL(42, v.num);
+
+    /*Overwrite an existing value*/
+    v.num = 7;
+    lv_style_set_prop(&style, LV_STYLE_WIDTH + 3, v);
+    TEST_ASSERT_EQUAL(LV_STYLE_PROP_INDEX_MIN_CNT * 2 + 1, style.prop_cnt);
+
+    /*Remove every second property, so the style loses its index*/
+    for(i = 0; i < LV_STYLE_PROP_INDEX_MIN_CNT * 2; i += 2) {
+        TEST_ASSERT_TRUE(lv_style_remove_prop(&style, LV_STYLE_WIDTH + i));
+    }
+    TEST_ASSERT_FALSE(lv_style_remove_prop(&style, LV_STYLE_WIDTH));
+    TEST_ASSERT_TRUE(lv_style_remove_prop(&style, custom_prop));
+    TEST_ASSERT_EQUAL(LV_STYLE_PROP_INDEX_MIN_CNT, style.prop_cnt);
+    lv_style_remove_prop(&style, LV_STYLE_WIDTH + 1);
+
+    for(i = 0; i < LV_STYLE_PROP_INDEX_MIN_CNT * 2; i++) {
+        lv_style_res_t res = lv_style_get_prop(&style, LV_STYLE_WIDTH + i, &v);
+        if(i % 2 == 0 || i == 1) {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, res);
+        }
+        else {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, res);
+            TEST_ASSERT_EQUAL(i == 3 ? 7 : i + 100, v.num);
+        }
+    }
+
+    /*Remove all*/
+    for(i = 0; i < LV_STYLE_PROP_INDEX_MIN_CNT * 2; i++) {
+        lv_style_remove_prop(&style, LV_STYLE_WIDTH + i);
+    }
+    TEST_ASSERT_TRUE(lv_style_is_empty(&style));
+
+    lv_style_reset(&style);
+}
+
+static uint32_t style_changed_cnt;
+
+static void style_changed_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    style_changed_cnt++;
+}
+
+void test_style_transition_refresh(void)
+{
+    static const lv_style_prop_t props[] = {LV_STYLE_WIDTH, LV_STYLE_HEIGHT, LV_STYLE_BG_COLOR, 0};
+    static lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+
+    static lv_style_t style_pr;
+    lv_style_init(&style_pr);
+    lv_style_set_width(&style_pr, 200);
+    lv_style_set_height(&style_pr, 200);
+    lv_style_set_bg_color(&style_pr, lv_color_hex(0xff0000));
+    lv_style_set_transition(&style_pr, &tr);
+
+    /*The objects of the other tests use styles from the stack*/
+    lv_obj_clean(lv_screen_active());
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 100);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x0000ff), 0);
+    lv_obj_add_style(obj, &style_pr, LV_STATE_PRESSED);
+    lv_obj_add_event_cb(obj, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_refr_now(NULL);
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    lv_test_wait(50);
+
+    /*The new values can be read right away, the object is refreshed only once for all the properties*/
+    style_changed_cnt = 0;
+    lv_tick_inc(25);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_INT32(174, lv_obj_get_style_width(obj, 0));
+    TEST_ASSERT_EQUAL_INT32(174, lv_obj_get_style_height(obj, 0));
+    TEST_ASSERT_EQUAL_UINT32(0, style_changed_cnt);
+    lv_obj_update_layout(obj);
+    TEST_ASSERT_EQUAL_UINT32(1, style_changed_cnt);
+    TEST_ASSERT_EQUAL_INT32(174, lv_obj_get_width(obj));
+    TEST_ASSERT_EQUAL_INT32(174, lv_obj_get_height(obj));
+
+    /*The last values are applied when the transitions are completed*/
+    lv_tick_inc(50);
+    lv_anim_refr_now();
+    lv_obj_update_layout(obj);
+    TEST_ASSERT_EQUAL_INT32(200, lv_obj_get_width(obj));
+    TEST_ASSERT_EQUAL_INT32(200, lv_obj_get_height(obj));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, 0));
+
+    lv_obj_delete(obj);
+    lv_style_reset(&style_pr);
+}
+
 #endif
@@ -0,0 +1,179 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_font_t counting_font;
+static uint32_t glyph_dsc_cnt;
+
+static bool counting_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc, uint32_t letter,
+                                   uint32_t letter_next)
+{
+    LV_UNUSED(font);
+    glyph_dsc_cnt++;
+    return lv_font_montserrat_14.get_glyph_dsc(&lv_font_montserrat_14, dsc, letter, letter_next);
+}
+
+void setUp(void)
+{
+    counting_font = lv_font_montserrat_14;
+    counting_font.get_glyph_dsc = counting_get_glyph_dsc;
+    glyph_dsc_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_text_cache_drop_all();
+}
+
+static const char * texts[] = {
+    "",
+    "a",
+    "Hello world",
+    "Hello\n",
+    "\n\n",
+    "A longer text which will be wrapped into a few lines, with some punctuation.\nAnd a new line.",
+    "Árvíztűrő tükörfúrógép\r\nwith a CRLF",
+};
+
+void test_text_cache_get_size(void)
+{
+    static const int32_t max_widths[] = {LV_COORD_MAX, 100, 31, 1};
+    static const int32_t spaces[] = {0, 3, -2};
+    static const lv_text_flag_t flags[] = {LV_TEXT_FLAG_NONE, LV_TEXT_FLAG_EXPAND, LV_TEXT_FLAG_BREAK_ALL};
+
+    uint32_t t, w, s, f;
+    for(t = 0; t < sizeof(texts) / sizeof(texts[0]); t++) {
+        for(w = 0; w < sizeof(max_widths) / sizeof(max_widths[0]); w++) {
+            for(s = 0; s < sizeof(spaces) / sizeof(spaces[0]); s++) {
+                for(f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+                    lv_point_t expected;
+                    lv_text_get_size(&expected, texts[t], &lv_font_montserrat_14, spaces[s], spaces[s] * 2,
+                                     max_widths[w], flags[f]);
+
+                    /*Twice to compare both the created and the found entry*/
+                    uint32_t i;
+                    for(i = 0; i < 2; i++) {
+                        lv_point_t size;
+                        lv_text_cache_get_size(&size, texts[t], &lv_font_montserrat_14, spaces[s], spaces[s] * 2,
+                                               max_widths[w], flags[f]);
+                        TEST_ASSERT_EQUAL_INT32(expected.x, size.x);
+                        TEST_ASSERT_EQUAL_INT32(expected.y, size.y);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void test_text_cache_get_width(void)
+{
+    uint32_t t;
+    for(t = 0; t < sizeof(texts) / sizeof(texts[0]); t++) {
+        int32_t expected = lv_text_get_width(texts[t], lv_strlen(texts[t]), &lv_font_montserrat_14, 2);
+        TEST_ASSERT_EQUAL_INT32(expected, lv_text_cache_get_width(texts[t], &lv_font_montserrat_14, 2));
+        TEST_ASSERT_EQUAL_INT32(expected, lv_text_cache_get_width(texts[t], &lv_font_montserrat_14, 2));
+    }
+}
+
+void test_text_cache_measure_once(void)
+{
+#if LV_TEXT_CACHE_SIZE > 0
+    char text[32];
+    lv_strcpy(text, "Hello world");
+
+    lv_point_t size;
+    lv_text_cache_get_size(&size, text, &counting_font, 0, 0, 50, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_NOT_EQUAL(0, glyph_dsc_cnt);
+
+    /*Found in the cache*/
+    glyph_dsc_cnt = 0;
+    lv_text_cache_get_size(&size, text, &counting_font, 0, 4, 50, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL_UINT32(0, glyph_dsc_cnt);
+
+    /*The texts are compared, not only their address*/
+    text[0] = 'J';
+    lv_text_cache_get_size(&size, text, &counting_font, 0, 0, 50, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_NOT_EQUAL(0, glyph_dsc_cnt);
+
+    /*A different width needs a different entry*/
+    glyph_dsc_cnt = 0;
+    lv_text_cache_get_size(&size, text, &counting_font, 0, 0, 60, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_NOT_EQUAL(0, glyph_dsc_cnt);
+
+    glyph_dsc_cnt = 0;
+    lv_text_cache_drop_all();
+    lv_text_cache_get_size(&size, text, &counting_font, 0, 0, 60, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_NOT_EQUAL(0, glyph_dsc_cnt);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_text_cache_size_limit(void)
+{
+#if LV_TEXT_CACHE_SIZE > 0
+    /*Much more texts than what fits into the cache*/
+    uint32_t i;
+    for(i = 0; i < 2000; i++) {
+        char text[64];
+        lv_snprintf(text, sizeof(text), "Text number %" LV_PRIu32 " to measure", i);
+        lv_point_t size;
+        lv_text_cache_get_size(&size, text, &counting_font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_TEXT_CACHE_SIZE, LV_GLOBAL_DEFAULT()->text_cache->size);
+    }
+
+    /*Too long to be cached: measured every time*/
+    static char long_text[LV_TEXT_CACHE_SIZE / 2];
+    lv_memset(long_text, 'x', sizeof(long_text) - 1);
+    lv_point_t size;
+    lv_text_cache_get_size(&size, long_text, &counting_font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    glyph_dsc_cnt = 0;
+    lv_text_cache_get_size(&size, long_text, &counting_font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_NOT_EQUAL(0, glyph_dsc_cnt);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_text_cache_table_measures_changed_cells(void)
+{
+#if LV_TEXT_CACHE_SIZE > 0
+    lv_obj_t * table = lv_table_create(lv_screen_active());
+    lv_obj_set_style_text_font(table, &counting_font, LV_PART_ITEMS);
+    lv_table_set_column_count(table, 10);
+    lv_table_set_row_count(table, 20);
+
+    uint32_t row, col;
+    for(row = 0; row < 20; row++) {
+        for(col = 0; col < 10; col++) {
+            lv_table_set_cell_value_fmt(table, row, col, "%" LV_PRIu32 ":%" LV_PRIu32, row, col);
+        }
+    }
+    lv_obj_update_layout(table);
+
+    /*Re-measuring all the rows has to measure only the changed cell*/
+    glyph_dsc_cnt = 0;
+    lv_table_set_cell_value(table, 3, 4, "Changed");
+    lv_obj_send_event(table, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_update_layout(table);
+    uint32_t changed_cnt = glyph_dsc_cnt;
+
+    /*Measure all the cells again*/
+    lv_text_cache_drop_all();
+    glyph_dsc_cnt = 0;
+    lv_obj_send_event(table, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_update_layout(table);
+    uint32_t all_cnt = glyph_dsc_cnt;
+
+    TEST_ASSERT_NOT_EQUAL(0, changed_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(all_cnt / 50, changed_cnt);
+
+    lv_obj_delete(table);
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,294 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define MAX_CALLS   16
+
+/*The display and input device timers are paused to test only the timers created here*/
+static lv_timer_t * paused_timers[16];
+static uint32_t paused_timer_cnt;
+
+static lv_timer_t * calls[MAX_CALLS];
+static uint32_t call_cnt;
+
+static lv_timer_t * victim;
+
+void setUp(void)
+{
+    paused_timer_cnt = 0;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        if(!lv_timer_get_paused(timer)) {
+            TEST_ASSERT_LESS_THAN_UINT32(16, paused_timer_cnt);
+            paused_timers[paused_timer_cnt++] = timer;
+            lv_timer_pause(timer);
+        }
+        timer = lv_timer_get_next(timer);
+    }
+
+    call_cnt = 0;
+    victim = NULL;
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < paused_timer_cnt; i++) {
+        lv_timer_resume(paused_timers[i]);
+    }
+}
+
+static void record_cb(lv_timer_t * timer)
+{
+    if(call_cnt < MAX_CALLS) calls[call_cnt] = timer;
+    call_cnt++;
+}
+
+static void delete_victim_cb(lv_timer_t * timer)
+{
+    record_cb(timer);
+    if(victim) {
+        lv_timer_delete(victim);
+        victim = NULL;
+    }
+}
+
+static void delete_self_cb(lv_timer_t * timer)
+{
+    record_cb(timer);
+    lv_timer_delete(timer);
+}
+
+static void create_cb(lv_timer_t * timer)
+{
+    record_cb(timer);
+    lv_timer_t * new_timer = lv_timer_create(record_cb, 0, NULL);
+    lv_timer_set_repeat_count(new_timer, 1);
+}
+
+static void ready_self_cb(lv_timer_t * timer)
+{
+    record_cb(timer);
+    lv_timer_ready(timer);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+void test_timer_runs_only_due_timers(void)
+{
+    lv_timer_t * t1 = lv_timer_create(record_cb, 100, NULL);
+    lv_timer_t * t2 = lv_timer_create(record_cb, 300, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(0, call_cnt);
+
+    lv_tick_inc(60);
+    TEST_ASSERT_EQUAL_UINT32(40, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(0, call_cnt);
+
+    lv_tick_inc(40);
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+    TEST_ASSERT_EQUAL_PTR(t1, calls[0]);
+
+    lv_tick_inc(200);
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+    TEST_ASSERT_EQUAL_PTR(t1, calls[1]);
+    TEST_ASSERT_EQUAL_PTR(t2, calls[2]);
+
+    lv_timer_delete(t1);
+    TEST_ASSERT_EQUAL_UINT32(300, lv_timer_handler());
+    lv_timer_delete(t2);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+void test_timer_runs_in_deadline_order(void)
+{
+    lv_timer_t * t1 = lv_timer_create(record_cb, 50, NULL);
+    lv_timer_t * t2 = lv_timer_create(record_cb, 20, NULL);
+    lv_timer_t * t3 = lv_timer_create(record_cb, 35, NULL);
+
+    lv_tick_inc(60);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+    TEST_ASSERT_EQUAL_PTR(t2, calls[0]);
+    TEST_ASSERT_EQUAL_PTR(t3, calls[1]);
+    TEST_ASSERT_EQUAL_PTR(t1, calls[2]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+}
+
+void test_timer_same_deadline_runs_newest_first(void)
+{
+    lv_timer_t * timers[5];
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        timers[i] = lv_timer_create(record_cb, 30, NULL);
+    }
+
+    /*The same order as walking the timer list from its head*/
+    lv_tick_inc(30);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(5, call_cnt);
+    for(i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_PTR(timers[4 - i], calls[i]);
+    }
+
+    for(i = 0; i < 5; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+void test_timer_runs_once_per_handler_call(void)
+{
+    lv_timer_t * t1 = lv_timer_create(record_cb, 0, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+
+    lv_timer_delete(t1);
+}
+
+void test_timer_ready_in_callback(void)
+{
+    lv_timer_t * t1 = lv_timer_create(ready_self_cb, 10, NULL);
+    lv_timer_t * t2 = lv_timer_create(record_cb, 20, NULL);
+    lv_timer_t * t3 = lv_timer_create(record_cb, 30, NULL);
+
+    /*`t1` is in front of the others again but runs only in the next call*/
+    lv_tick_inc(30);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+    TEST_ASSERT_EQUAL_PTR(t1, calls[0]);
+    TEST_ASSERT_EQUAL_PTR(t2, calls[1]);
+    TEST_ASSERT_EQUAL_PTR(t3, calls[2]);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(4, call_cnt);
+    TEST_ASSERT_EQUAL_PTR(t1, calls[3]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+}
+
+void test_timer_pause_and_resume(void)
+{
+    lv_timer_t * t1 = lv_timer_create(record_cb, 100, NULL);
+    lv_timer_pause(t1);
+
+    lv_tick_inc(150);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(0, call_cnt);
+
+    /*The period has elapsed while it was paused so it runs right away*/
+    lv_timer_resume(t1);
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+
+    lv_timer_delete(t1);
+}
+
+void test_timer_set_period_ready_and_reset(void)
+{
+    lv_timer_t * t1 = lv_timer_create(record_cb, 100, NULL);
+
+    lv_tick_inc(30);
+    lv_timer_set_period(t1, 50);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_timer_handler());
+
+    lv_timer_reset(t1);
+    TEST_ASSERT_EQUAL_UINT32(50, lv_timer_handler());
+
+    lv_timer_ready(t1);
+    TEST_ASSERT_EQUAL_UINT32(50, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+
+    /*Very long periods*/
+    lv_timer_set_period(t1, 0xF0000000);
+    TEST_ASSERT_GREATER_THAN_UINT32(0x3FFFFFFF - 1, lv_timer_handler());
+    lv_tick_inc(0x40000000);
+    lv_timer_handler();
+    lv_tick_inc(0x7FFFFFFF);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+    lv_tick_inc(0x30000001);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+
+    lv_timer_delete(t1);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(record_cb, 10, NULL);
+    lv_timer_set_repeat_count(t1, 2);
+    lv_timer_t * t2 = lv_timer_create(record_cb, 10, NULL);
+    lv_timer_set_repeat_count(t2, 1);
+    lv_timer_set_auto_delete(t2, false);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+    TEST_ASSERT_TRUE(timer_exists(t1));
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t2));
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+
+    /*A repeat count set to 0 deletes the timer in the next call without running it*/
+    lv_timer_t * t3 = lv_timer_create(record_cb, 1000, NULL);
+    lv_timer_set_repeat_count(t3, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_until_next());
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t3));
+
+    lv_timer_delete(t2);
+}
+
+void test_timer_delete_and_create_in_callback(void)
+{
+    lv_timer_t * t1 = lv_timer_create(delete_victim_cb, 10, NULL);
+    victim = lv_timer_create(record_cb, 20, NULL);
+    lv_timer_t * t2 = lv_timer_create(delete_self_cb, 15, NULL);
+
+    /*The victim is deleted before its turn*/
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+    TEST_ASSERT_EQUAL_PTR(t1, calls[0]);
+    TEST_ASSERT_EQUAL_PTR(t2, calls[1]);
+    TEST_ASSERT_FALSE(timer_exists(t2));
+    lv_timer_delete(t1);
+
+    /*Timers created in a callback with 0 period run in the same call, like `lv_async_call`*/
+    call_cnt = 0;
+    t1 = lv_timer_create(create_cb, 10, NULL);
+    lv_tick_inc(10);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+    TEST_ASSERT_EQUAL_PTR(t1, calls[0]);
+    TEST_ASSERT_FALSE(timer_exists(calls[1]));
+
+    lv_timer_delete(t1);
+}
+
+#endif
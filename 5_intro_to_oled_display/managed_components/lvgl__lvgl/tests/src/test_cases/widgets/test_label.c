@@ -615,4 +615,132 @@ void test_label_max_width(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_max_width.png");
 }
 
+
+#if LV_LABEL_LINE_CACHE
+static void assert_lines_match_text(lv_obj_t * obj, int32_t max_w)
+{
+    lv_label_t * l = (lv_label_t *)obj;
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+
+    TEST_ASSERT_TRUE(l->lines.valid);
+    TEST_ASSERT_EQUAL_INT32(max_w, l->lines.max_width);
+
+    uint32_t line_start = 0;
+    uint32_t i;
+    for(i = 0; i < l->lines.line_cnt; i++) {
+        uint32_t line_end = line_start + lv_text_get_next_line(&l->text[line_start], font, letter_space, max_w, NULL,
+                                                               l->lines.flag);
+        TEST_ASSERT_EQUAL_UINT32(line_start, l->lines.lines[i].start);
+        TEST_ASSERT_EQUAL_UINT32(line_end, l->lines.lines[i].end);
+        TEST_ASSERT_EQUAL_INT32(lv_text_get_width(&l->text[line_start], line_end - line_start, font, letter_space),
+                                l->lines.lines[i].width);
+        line_start = line_end;
+    }
+    TEST_ASSERT_EQUAL_UINT8('\0', l->text[line_start]);
+}
+#endif
+
+void test_label_line_cache(void)
+{
+#if LV_LABEL_LINE_CACHE
+    lv_obj_set_width(long_label_multiline, 150);
+    lv_obj_set_style_text_align(long_label_multiline, LV_TEXT_ALIGN_CENTER, 0);
+    lv_refr_now(NULL);
+    assert_lines_match_text(long_label_multiline, 150);
+
+    /*The size is calculated from the lines like `lv_text_get_size` does*/
+    lv_point_t size;
+    lv_text_get_size(&size, long_text_multiline, LV_FONT_DEFAULT, 0, 0, 150, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL_INT32(size.y, lv_obj_get_height(long_label_multiline));
+
+    /*The lines are wrapped again if the width, letter space, font or text changes*/
+    lv_obj_set_width(long_label_multiline, 200);
+    lv_refr_now(NULL);
+    assert_lines_match_text(long_label_multiline, 200);
+
+    lv_obj_set_style_text_letter_space(long_label_multiline, 3, 0);
+    lv_refr_now(NULL);
+    assert_lines_match_text(long_label_multiline, 200);
+
+    lv_obj_set_style_text_font(long_label_multiline, &lv_font_montserrat_24, 0);
+    lv_refr_now(NULL);
+    assert_lines_match_text(long_label_multiline, 200);
+
+    lv_label_set_text(long_label_multiline, long_text);
+    lv_refr_now(NULL);
+    assert_lines_match_text(long_label_multiline, 200);
+
+    /*Drawing doesn't allocate the lines again*/
+    lv_label_t * l = (lv_label_t *)long_label_multiline;
+    const lv_text_line_t * lines = l->lines.lines;
+    lv_obj_invalidate(long_label_multiline);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(lines, l->lines.lines);
+
+    /*The text replaced by the dots is wrapped again*/
+    lv_obj_set_height(long_label_multiline, 60);
+    lv_label_set_long_mode(long_label_multiline, LV_LABEL_LONG_DOT);
+    lv_refr_now(NULL);
+    assert_lines_match_text(long_label_multiline, 200);
+#else
+    TEST_PASS();
+#endif
+}
+
+static uint32_t glyph_cnt;
+
+static void count_glyph_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc, lv_draw_fill_dsc_t * fill_dsc,
+                           const lv_area_t * fill_area)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(fill_dsc);
+    LV_UNUSED(fill_area);
+    if(dsc) glyph_cnt++;
+}
+
+void test_label_line_cache_stale_lines(void)
+{
+    /*Lines of a text which is not drawn*/
+    static const char lines_text[] = "ABCDEFGHIJ\nKLMNOPQRST";
+    static const lv_text_line_t lines[] = {{0, 11, 100}, {11, 21, 100}};
+
+    lv_layer_t layer;
+    lv_memzero(&layer, sizeof(layer));
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+
+    lv_area_t coords = {0, 0, 399, 99};
+    lv_draw_unit_t draw_unit;
+    lv_memzero(&draw_unit, sizeof(draw_unit));
+    draw_unit.target_layer = &layer;
+    draw_unit.clip_area = &coords;
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = LV_FONT_DEFAULT;
+    dsc.text = lines_text;
+    dsc.lines = lines;
+    dsc.line_cnt = 1;
+    dsc.lines_text = lines_text;
+    dsc.lines_font = LV_FONT_DEFAULT;
+
+    /*The lines are used if they were wrapped with the text and font: only the first line is drawn*/
+    glyph_cnt = 0;
+    lv_draw_label_iterate_characters(&draw_unit, &dsc, &coords, count_glyph_cb);
+    TEST_ASSERT_EQUAL_UINT32(10, glyph_cnt);
+
+    /*E.g. `LV_EVENT_DRAW_TASK_ADDED` changed the text, the lines are ignored*/
+    dsc.text = "AB";
+    glyph_cnt = 0;
+    lv_draw_label_iterate_characters(&draw_unit, &dsc, &coords, count_glyph_cb);
+    TEST_ASSERT_EQUAL_UINT32(2, glyph_cnt);
+
+    /*The font was changed, the lines are ignored*/
+    dsc.text = lines_text;
+    dsc.font = &lv_font_montserrat_24;
+    glyph_cnt = 0;
+    lv_draw_label_iterate_characters(&draw_unit, &dsc, &coords, count_glyph_cb);
+    TEST_ASSERT_EQUAL_UINT32(20, glyph_cnt);
+}
+
 #endif